@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -44,23 +43,15 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_address_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_address_2eproto;
 namespace YellowPages {
 class Address;
-class AddressDefaultTypeInternal;
+struct AddressDefaultTypeInternal;
 extern AddressDefaultTypeInternal _Address_default_instance_;
 class AddressComponent;
-class AddressComponentDefaultTypeInternal;
+struct AddressComponentDefaultTypeInternal;
 extern AddressComponentDefaultTypeInternal _AddressComponent_default_instance_;
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
@@ -75,8 +66,8 @@ enum AddressComponent_Type : int {
   AddressComponent_Type_CITY = 2,
   AddressComponent_Type_STREET = 3,
   AddressComponent_Type_HOUSE = 4,
-  AddressComponent_Type_AddressComponent_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  AddressComponent_Type_AddressComponent_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  AddressComponent_Type_AddressComponent_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  AddressComponent_Type_AddressComponent_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool AddressComponent_Type_IsValid(int value);
 constexpr AddressComponent_Type AddressComponent_Type_Type_MIN = AddressComponent_Type_COUNTRY;
@@ -99,11 +90,12 @@ inline bool AddressComponent_Type_Parse(
 }
 // ===================================================================
 
-class AddressComponent PROTOBUF_FINAL :
+class AddressComponent final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.AddressComponent) */ {
  public:
   inline AddressComponent() : AddressComponent(nullptr) {}
-  virtual ~AddressComponent();
+  ~AddressComponent() override;
+  explicit PROTOBUF_CONSTEXPR AddressComponent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AddressComponent(const AddressComponent& from);
   AddressComponent(AddressComponent&& from) noexcept
@@ -116,8 +108,13 @@ class AddressComponent PROTOBUF_FINAL :
     return *this;
   }
   inline AddressComponent& operator=(AddressComponent&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -128,13 +125,14 @@ class AddressComponent PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AddressComponent& default_instance() {
+    return *internal_default_instance();
   }
-  static const AddressComponent& default_instance();
-
   static inline const AddressComponent* internal_default_instance() {
     return reinterpret_cast<const AddressComponent*>(
                &_AddressComponent_default_instance_);
@@ -147,7 +145,12 @@ class AddressComponent PROTOBUF_FINAL :
   }
   inline void Swap(AddressComponent* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -155,56 +158,53 @@ class AddressComponent PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(AddressComponent* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AddressComponent* New() const final {
-    return CreateMaybeMessage<AddressComponent>(nullptr);
-  }
-
-  AddressComponent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AddressComponent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AddressComponent>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const AddressComponent& from);
-  void MergeFrom(const AddressComponent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AddressComponent& from) {
+    AddressComponent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(AddressComponent* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.AddressComponent";
   }
   protected:
-  explicit AddressComponent(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AddressComponent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_address_2eproto);
-    return ::descriptor_table_address_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -252,16 +252,14 @@ class AddressComponent PROTOBUF_FINAL :
   // string value = 1;
   void clear_value();
   const std::string& value() const;
-  void set_value(const std::string& value);
-  void set_value(std::string&& value);
-  void set_value(const char* value);
-  void set_value(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
   std::string* mutable_value();
-  std::string* release_value();
+  PROTOBUF_NODISCARD std::string* release_value();
   void set_allocated_value(std::string* value);
   private:
   const std::string& _internal_value() const;
-  void _internal_set_value(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
   std::string* _internal_mutable_value();
   public:
 
@@ -272,17 +270,21 @@ class AddressComponent PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_address_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Address PROTOBUF_FINAL :
+class Address final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.Address) */ {
  public:
   inline Address() : Address(nullptr) {}
-  virtual ~Address();
+  ~Address() override;
+  explicit PROTOBUF_CONSTEXPR Address(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Address(const Address& from);
   Address(Address&& from) noexcept
@@ -295,8 +297,13 @@ class Address PROTOBUF_FINAL :
     return *this;
   }
   inline Address& operator=(Address&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -307,13 +314,14 @@ class Address PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Address& default_instance() {
+    return *internal_default_instance();
   }
-  static const Address& default_instance();
-
   static inline const Address* internal_default_instance() {
     return reinterpret_cast<const Address*>(
                &_Address_default_instance_);
@@ -326,7 +334,12 @@ class Address PROTOBUF_FINAL :
   }
   inline void Swap(Address* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -334,56 +347,53 @@ class Address PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Address* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Address* New() const final {
-    return CreateMaybeMessage<Address>(nullptr);
-  }
-
-  Address* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Address* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Address>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Address& from);
-  void MergeFrom(const Address& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Address& from) {
+    Address::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Address* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.Address";
   }
   protected:
-  explicit Address(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Address(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_address_2eproto);
-    return ::descriptor_table_address_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -416,32 +426,28 @@ class Address PROTOBUF_FINAL :
   // string formatted = 1;
   void clear_formatted();
   const std::string& formatted() const;
-  void set_formatted(const std::string& value);
-  void set_formatted(std::string&& value);
-  void set_formatted(const char* value);
-  void set_formatted(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_formatted(ArgT0&& arg0, ArgT... args);
   std::string* mutable_formatted();
-  std::string* release_formatted();
+  PROTOBUF_NODISCARD std::string* release_formatted();
   void set_allocated_formatted(std::string* formatted);
   private:
   const std::string& _internal_formatted() const;
-  void _internal_set_formatted(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_formatted(const std::string& value);
   std::string* _internal_mutable_formatted();
   public:
 
   // string comment = 4;
   void clear_comment();
   const std::string& comment() const;
-  void set_comment(const std::string& value);
-  void set_comment(std::string&& value);
-  void set_comment(const char* value);
-  void set_comment(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_comment(ArgT0&& arg0, ArgT... args);
   std::string* mutable_comment();
-  std::string* release_comment();
+  PROTOBUF_NODISCARD std::string* release_comment();
   void set_allocated_comment(std::string* comment);
   private:
   const std::string& _internal_comment() const;
-  void _internal_set_comment(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_comment(const std::string& value);
   std::string* _internal_mutable_comment();
   public:
 
@@ -452,7 +458,7 @@ class Address PROTOBUF_FINAL :
   public:
   void clear_coords();
   const ::SphereProto::Coords& coords() const;
-  ::SphereProto::Coords* release_coords();
+  PROTOBUF_NODISCARD ::SphereProto::Coords* release_coords();
   ::SphereProto::Coords* mutable_coords();
   void set_allocated_coords(::SphereProto::Coords* coords);
   private:
@@ -470,11 +476,14 @@ class Address PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::AddressComponent > components_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr formatted_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr comment_;
-  ::SphereProto::Coords* coords_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::AddressComponent > components_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr formatted_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr comment_;
+    ::SphereProto::Coords* coords_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_address_2eproto;
 };
 // ===================================================================
@@ -490,53 +499,38 @@ class Address PROTOBUF_FINAL :
 
 // string value = 1;
 inline void AddressComponent::clear_value() {
-  value_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
 }
 inline const std::string& AddressComponent::value() const {
   // @@protoc_insertion_point(field_get:YellowPages.AddressComponent.value)
   return _internal_value();
 }
-inline void AddressComponent::set_value(const std::string& value) {
-  _internal_set_value(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AddressComponent::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.AddressComponent.value)
 }
 inline std::string* AddressComponent::mutable_value() {
+  std::string* _s = _internal_mutable_value();
   // @@protoc_insertion_point(field_mutable:YellowPages.AddressComponent.value)
-  return _internal_mutable_value();
+  return _s;
 }
 inline const std::string& AddressComponent::_internal_value() const {
-  return value_.Get();
+  return _impl_.value_.Get();
 }
 inline void AddressComponent::_internal_set_value(const std::string& value) {
   
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void AddressComponent::set_value(std::string&& value) {
-  
-  value_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.AddressComponent.value)
-}
-inline void AddressComponent::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.AddressComponent.value)
-}
-inline void AddressComponent::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.AddressComponent.value)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* AddressComponent::_internal_mutable_value() {
   
-  return value_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
 inline std::string* AddressComponent::release_value() {
   // @@protoc_insertion_point(field_release:YellowPages.AddressComponent.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Release();
 }
 inline void AddressComponent::set_allocated_value(std::string* value) {
   if (value != nullptr) {
@@ -544,8 +538,12 @@ inline void AddressComponent::set_allocated_value(std::string* value) {
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.AddressComponent.value)
 }
 
@@ -555,53 +553,38 @@ inline void AddressComponent::set_allocated_value(std::string* value) {
 
 // string formatted = 1;
 inline void Address::clear_formatted() {
-  formatted_.ClearToEmpty();
+  _impl_.formatted_.ClearToEmpty();
 }
 inline const std::string& Address::formatted() const {
   // @@protoc_insertion_point(field_get:YellowPages.Address.formatted)
   return _internal_formatted();
 }
-inline void Address::set_formatted(const std::string& value) {
-  _internal_set_formatted(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Address::set_formatted(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.formatted_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Address.formatted)
 }
 inline std::string* Address::mutable_formatted() {
+  std::string* _s = _internal_mutable_formatted();
   // @@protoc_insertion_point(field_mutable:YellowPages.Address.formatted)
-  return _internal_mutable_formatted();
+  return _s;
 }
 inline const std::string& Address::_internal_formatted() const {
-  return formatted_.Get();
+  return _impl_.formatted_.Get();
 }
 inline void Address::_internal_set_formatted(const std::string& value) {
   
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Address::set_formatted(std::string&& value) {
-  
-  formatted_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Address.formatted)
-}
-inline void Address::set_formatted(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Address.formatted)
-}
-inline void Address::set_formatted(const char* value,
-    size_t size) {
-  
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Address.formatted)
+  _impl_.formatted_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Address::_internal_mutable_formatted() {
   
-  return formatted_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.formatted_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Address::release_formatted() {
   // @@protoc_insertion_point(field_release:YellowPages.Address.formatted)
-  return formatted_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.formatted_.Release();
 }
 inline void Address::set_allocated_formatted(std::string* formatted) {
   if (formatted != nullptr) {
@@ -609,59 +592,64 @@ inline void Address::set_allocated_formatted(std::string* formatted) {
   } else {
     
   }
-  formatted_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), formatted,
-      GetArena());
+  _impl_.formatted_.SetAllocated(formatted, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.formatted_.IsDefault()) {
+    _impl_.formatted_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Address.formatted)
 }
 
 // repeated .YellowPages.AddressComponent components = 2;
 inline int Address::_internal_components_size() const {
-  return components_.size();
+  return _impl_.components_.size();
 }
 inline int Address::components_size() const {
   return _internal_components_size();
 }
 inline void Address::clear_components() {
-  components_.Clear();
+  _impl_.components_.Clear();
 }
 inline ::YellowPages::AddressComponent* Address::mutable_components(int index) {
   // @@protoc_insertion_point(field_mutable:YellowPages.Address.components)
-  return components_.Mutable(index);
+  return _impl_.components_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::AddressComponent >*
 Address::mutable_components() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.Address.components)
-  return &components_;
+  return &_impl_.components_;
 }
 inline const ::YellowPages::AddressComponent& Address::_internal_components(int index) const {
-  return components_.Get(index);
+  return _impl_.components_.Get(index);
 }
 inline const ::YellowPages::AddressComponent& Address::components(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.Address.components)
   return _internal_components(index);
 }
 inline ::YellowPages::AddressComponent* Address::_internal_add_components() {
-  return components_.Add();
+  return _impl_.components_.Add();
 }
 inline ::YellowPages::AddressComponent* Address::add_components() {
+  ::YellowPages::AddressComponent* _add = _internal_add_components();
   // @@protoc_insertion_point(field_add:YellowPages.Address.components)
-  return _internal_add_components();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::AddressComponent >&
 Address::components() const {
   // @@protoc_insertion_point(field_list:YellowPages.Address.components)
-  return components_;
+  return _impl_.components_;
 }
 
 // .SphereProto.Coords coords = 3;
 inline bool Address::_internal_has_coords() const {
-  return this != internal_default_instance() && coords_ != nullptr;
+  return this != internal_default_instance() && _impl_.coords_ != nullptr;
 }
 inline bool Address::has_coords() const {
   return _internal_has_coords();
 }
 inline const ::SphereProto::Coords& Address::_internal_coords() const {
-  const ::SphereProto::Coords* p = coords_;
+  const ::SphereProto::Coords* p = _impl_.coords_;
   return p != nullptr ? *p : reinterpret_cast<const ::SphereProto::Coords&>(
       ::SphereProto::_Coords_default_instance_);
 }
@@ -671,10 +659,10 @@ inline const ::SphereProto::Coords& Address::coords() const {
 }
 inline void Address::unsafe_arena_set_allocated_coords(
     ::SphereProto::Coords* coords) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(coords_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.coords_);
   }
-  coords_ = coords;
+  _impl_.coords_ = coords;
   if (coords) {
     
   } else {
@@ -684,40 +672,48 @@ inline void Address::unsafe_arena_set_allocated_coords(
 }
 inline ::SphereProto::Coords* Address::release_coords() {
   
-  ::SphereProto::Coords* temp = coords_;
-  coords_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::SphereProto::Coords* temp = _impl_.coords_;
+  _impl_.coords_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::SphereProto::Coords* Address::unsafe_arena_release_coords() {
   // @@protoc_insertion_point(field_release:YellowPages.Address.coords)
   
-  ::SphereProto::Coords* temp = coords_;
-  coords_ = nullptr;
+  ::SphereProto::Coords* temp = _impl_.coords_;
+  _impl_.coords_ = nullptr;
   return temp;
 }
 inline ::SphereProto::Coords* Address::_internal_mutable_coords() {
   
-  if (coords_ == nullptr) {
-    auto* p = CreateMaybeMessage<::SphereProto::Coords>(GetArena());
-    coords_ = p;
+  if (_impl_.coords_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SphereProto::Coords>(GetArenaForAllocation());
+    _impl_.coords_ = p;
   }
-  return coords_;
+  return _impl_.coords_;
 }
 inline ::SphereProto::Coords* Address::mutable_coords() {
+  ::SphereProto::Coords* _msg = _internal_mutable_coords();
   // @@protoc_insertion_point(field_mutable:YellowPages.Address.coords)
-  return _internal_mutable_coords();
+  return _msg;
 }
 inline void Address::set_allocated_coords(::SphereProto::Coords* coords) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(coords_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.coords_);
   }
   if (coords) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(coords)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(coords));
     if (message_arena != submessage_arena) {
       coords = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, coords, submessage_arena);
@@ -726,59 +722,44 @@ inline void Address::set_allocated_coords(::SphereProto::Coords* coords) {
   } else {
     
   }
-  coords_ = coords;
+  _impl_.coords_ = coords;
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Address.coords)
 }
 
 // string comment = 4;
 inline void Address::clear_comment() {
-  comment_.ClearToEmpty();
+  _impl_.comment_.ClearToEmpty();
 }
 inline const std::string& Address::comment() const {
   // @@protoc_insertion_point(field_get:YellowPages.Address.comment)
   return _internal_comment();
 }
-inline void Address::set_comment(const std::string& value) {
-  _internal_set_comment(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Address::set_comment(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.comment_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Address.comment)
 }
 inline std::string* Address::mutable_comment() {
+  std::string* _s = _internal_mutable_comment();
   // @@protoc_insertion_point(field_mutable:YellowPages.Address.comment)
-  return _internal_mutable_comment();
+  return _s;
 }
 inline const std::string& Address::_internal_comment() const {
-  return comment_.Get();
+  return _impl_.comment_.Get();
 }
 inline void Address::_internal_set_comment(const std::string& value) {
   
-  comment_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Address::set_comment(std::string&& value) {
-  
-  comment_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Address.comment)
-}
-inline void Address::set_comment(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  comment_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Address.comment)
-}
-inline void Address::set_comment(const char* value,
-    size_t size) {
-  
-  comment_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Address.comment)
+  _impl_.comment_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Address::_internal_mutable_comment() {
   
-  return comment_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.comment_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Address::release_comment() {
   // @@protoc_insertion_point(field_release:YellowPages.Address.comment)
-  return comment_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.comment_.Release();
 }
 inline void Address::set_allocated_comment(std::string* comment) {
   if (comment != nullptr) {
@@ -786,8 +767,12 @@ inline void Address::set_allocated_comment(std::string* comment) {
   } else {
     
   }
-  comment_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), comment,
-      GetArena());
+  _impl_.comment_.SetAllocated(comment, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.comment_.IsDefault()) {
+    _impl_.comment_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Address.comment)
 }
 
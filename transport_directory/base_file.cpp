@@ -0,0 +1,186 @@
+#include "base_file.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace BaseFile {
+
+  namespace {
+    constexpr char MAGIC[8] = { 'T', 'D', 'B', 'A', 'S', 'E', '\0', '\0' };
+    constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    struct FileHeader {
+      char magic[8];
+      uint32_t version;
+      uint32_t byte_order_mark;
+      uint32_t section_count;
+      uint32_t reserved;
+    };
+
+    struct SectionEntry {
+      uint32_t section;
+      uint32_t reserved;
+      uint64_t offset;
+      uint64_t size;
+    };
+
+    uint64_t AlignUp(uint64_t offset) {
+      return (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+    }
+  }
+
+
+  void Writer::AddSection(Section section, string data) {
+    const string& stored = owned_data_.emplace_back(move(data));
+    sections_.emplace_back(section, stored);
+  }
+
+  void Writer::Write(ostream& os) const {
+    FileHeader header = {};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.byte_order_mark = BYTE_ORDER_MARK;
+    header.section_count = sections_.size();
+
+    vector<SectionEntry> entries;
+    entries.reserve(sections_.size());
+    uint64_t offset = sizeof(FileHeader) + sections_.size() * sizeof(SectionEntry);
+    for (const auto& [section, data] : sections_) {
+      offset = AlignUp(offset);
+      entries.push_back({ static_cast<uint32_t>(section), 0, offset, data.size() });
+      offset += data.size();
+    }
+
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(SectionEntry));
+    uint64_t written = sizeof(FileHeader) + entries.size() * sizeof(SectionEntry);
+    const char padding[SECTION_ALIGNMENT] = {};
+    for (size_t idx = 0; idx < sections_.size(); ++idx) {
+      os.write(padding, entries[idx].offset - written);
+      os.write(sections_[idx].second.data(), sections_[idx].second.size());
+      written = entries[idx].offset + entries[idx].size;
+    }
+  }
+
+
+#ifdef _WIN32
+  MappedFile::MappedFile(const string& file_name) {
+    file_handle_ = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                               OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_handle_ == INVALID_HANDLE_VALUE) {
+      throw runtime_error("Cannot open base file " + file_name);
+    }
+    LARGE_INTEGER file_size;
+    GetFileSizeEx(file_handle_, &file_size);
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_ == 0) {
+      return;
+    }
+    mapping_handle_ = CreateFileMappingA(file_handle_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_handle_) {
+      CloseHandle(file_handle_);
+      throw runtime_error("Cannot map base file " + file_name);
+    }
+    data_ = static_cast<const char*>(MapViewOfFile(mapping_handle_, FILE_MAP_READ, 0, 0, 0));
+  }
+
+  MappedFile::~MappedFile() {
+    if (data_) {
+      UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+      CloseHandle(mapping_handle_);
+    }
+    CloseHandle(file_handle_);
+  }
+#else
+  MappedFile::MappedFile(const string& file_name) {
+    const int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw runtime_error("Cannot open base file " + file_name);
+    }
+    struct stat file_stat;
+    fstat(fd, &file_stat);
+    size_ = file_stat.st_size;
+    if (size_ == 0) {
+      close(fd);
+      return;
+    }
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+      throw runtime_error("Cannot map base file " + file_name);
+    }
+    data_ = static_cast<const char*>(data);
+  }
+
+  MappedFile::~MappedFile() {
+    if (data_) {
+      munmap(const_cast<char*>(data_), size_);
+    }
+  }
+#endif
+
+
+  Reader::Reader(const string& file_name) : file_(file_name) {
+    const string_view data = file_.GetData();
+    FileHeader header;
+    if (data.size() < sizeof(header)) {
+      throw runtime_error("Base file is truncated");
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+      throw runtime_error("Not a base file");
+    }
+    if (header.version != FORMAT_VERSION) {
+      throw runtime_error("Unsupported base file version " + to_string(header.version));
+    }
+    if (header.byte_order_mark != BYTE_ORDER_MARK) {
+      throw runtime_error("Base file has foreign byte order");
+    }
+
+    const uint64_t entries_end = sizeof(header) + uint64_t{ header.section_count } * sizeof(SectionEntry);
+    if (data.size() < entries_end) {
+      throw runtime_error("Base file is truncated");
+    }
+    for (uint32_t idx = 0; idx < header.section_count; ++idx) {
+      SectionEntry entry;
+      memcpy(&entry, data.data() + sizeof(header) + idx * sizeof(SectionEntry), sizeof(entry));
+      if (entry.offset > data.size() || entry.size > data.size() - entry.offset) {
+        throw runtime_error("Base file is truncated");
+      }
+      sections_[static_cast<Section>(entry.section)] = data.substr(entry.offset, entry.size);
+    }
+  }
+
+  bool Reader::HasSection(Section section) const {
+    return sections_.count(section);
+  }
+
+  string_view Reader::GetSection(Section section) const {
+    const auto it = sections_.find(section);
+    if (it == sections_.end()) {
+      throw runtime_error("Base file has no section " + to_string(static_cast<uint32_t>(section)));
+    }
+    return it->second;
+  }
+
+  void Reader::CheckArraySize(Section section, size_t actual_size, size_t expected_size) {
+    if (actual_size != expected_size) {
+      throw runtime_error("Base file section " + to_string(static_cast<uint32_t>(section)) + " has wrong size");
+    }
+  }
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Layout of the file written by make_base:
+//   header     magic, format version, byte order mark, section count
+//   sections   kind, offset and size of each section
+//   payload    sections, each aligned to SECTION_ALIGNMENT bytes
+// Fixed-size arrays are stored raw in native byte order, so that they can be
+// used right from the mapped file; the rest is stored as protobuf messages.
+namespace BaseFile {
+
+  constexpr uint32_t FORMAT_VERSION = 2;
+  constexpr size_t SECTION_ALIGNMENT = 64;
+
+  enum class Section : uint32_t {
+    CATALOG = 1,           // TCProto::TransportCatalog, stops and buses
+    ROUTE_WEIGHTS = 2,     // double[V * V], see Graph::Router
+    ROUTE_PREV_EDGES = 3,  // uint32_t[V * V]
+    ROUTER = 4,            // TCProto::TransportRouter
+    PAINTER = 5,           // TCProto::Painter
+    COMPANIES = 6,         // YellowPages::Database
+    BASE_MAP = 7,          // SVG text of the whole map, optional
+    STOPS_GEO_INDEX = 8,   // TCProto::GeoIndex, see GeoIndex
+    STOPS_GEO_CELLS = 9,   // uint32_t[rows * cols + 1]
+    STOPS_GEO_POSITIONS = 10,  // Sphere::Point[place count]
+    COMPANIES_GEO_INDEX = 11,
+    COMPANIES_GEO_CELLS = 12,
+    COMPANIES_GEO_POSITIONS = 13,
+  };
+
+  class Writer {
+  public:
+    void AddSection(Section section, std::string data);
+
+    // The array is not copied, so it must outlive the writer
+    template <typename T>
+    void AddArraySection(Section section, const T* items, size_t count) {
+      sections_.emplace_back(section, std::string_view(reinterpret_cast<const char*>(items), count * sizeof(T)));
+    }
+
+    void Write(std::ostream& os) const;
+
+  private:
+    std::deque<std::string> owned_data_;
+    std::vector<std::pair<Section, std::string_view>> sections_;
+  };
+
+  // Read-only view of the whole file, mapped into memory
+  class MappedFile {
+  public:
+    explicit MappedFile(const std::string& file_name);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view GetData() const {
+      return { data_, size_ };
+    }
+
+  private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+  };
+
+  // Sections point into the mapped file, so they are valid while the reader lives
+  class Reader {
+  public:
+    explicit Reader(const std::string& file_name);
+
+    bool HasSection(Section section) const;
+    std::string_view GetSection(Section section) const;
+
+    template <typename T>
+    const T* GetArraySection(Section section, size_t count) const {
+      const std::string_view data = GetSection(section);
+      CheckArraySize(section, data.size(), count * sizeof(T));
+      return reinterpret_cast<const T*>(data.data());
+    }
+
+  private:
+    MappedFile file_;
+    std::unordered_map<Section, std::string_view> sections_;
+
+    static void CheckArraySize(Section section, size_t actual_size, size_t expected_size);
+  };
+
+}
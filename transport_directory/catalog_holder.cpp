@@ -0,0 +1,42 @@
+#include "catalog_holder.h"
+
+using namespace std;
+
+// Every part is built before the catalog is published, so no request waits for it
+static shared_ptr<const TransportCatalog> LoadCatalog(const string& base_file_name) {
+  auto catalog = make_shared<const TransportCatalog>(base_file_name);
+  catalog->LoadAll();
+  return catalog;
+}
+
+CatalogHolder::CatalogHolder(const string& base_file_name)
+  : catalog_(LoadCatalog(base_file_name)),
+  base_file_name_(base_file_name)
+{
+}
+
+shared_ptr<const TransportCatalog> CatalogHolder::Get() const {
+  lock_guard lock(mutex_);
+  return catalog_;
+}
+
+void CatalogHolder::Reload(const string& base_file_name) {
+  lock_guard reload_lock(reload_mutex_);
+  Publish(LoadCatalog(base_file_name), base_file_name);
+}
+
+void CatalogHolder::Reload() {
+  lock_guard reload_lock(reload_mutex_);
+  Publish(LoadCatalog(base_file_name_), base_file_name_);
+}
+
+void CatalogHolder::Publish(shared_ptr<const TransportCatalog> catalog, string base_file_name) {
+  shared_ptr<const TransportCatalog> old_catalog;
+  {
+    lock_guard lock(mutex_);
+    old_catalog = move(catalog_);
+    catalog_ = move(catalog);
+  }
+  base_file_name_ = move(base_file_name);
+  // If no snapshot is left, the old catalog is freed here, outside of the lock
+}
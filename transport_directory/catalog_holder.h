@@ -0,0 +1,36 @@
+#pragma once
+
+#include "transport_catalog.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Publishes the current catalog of a resident process to concurrent readers.
+// A reader takes a snapshot and answers with it to the end, so a reload never
+// disturbs requests in flight; an old catalog is freed with its last snapshot.
+class CatalogHolder {
+public:
+  explicit CatalogHolder(const std::string& base_file_name);
+
+  std::shared_ptr<const TransportCatalog> Get() const;
+
+  // Loads the base with all its parts in the calling thread while the others
+  // keep answering with the old catalog, then publishes it. If loading fails,
+  // the old one stays. Reloads run one at a time: each publishes its catalog
+  // before the next one starts loading.
+  void Reload(const std::string& base_file_name);
+
+  // Reloads the file the current catalog was loaded from
+  void Reload();
+
+private:
+  mutable std::mutex mutex_;
+  std::shared_ptr<const TransportCatalog> catalog_;
+
+  // Held through loading and publishing; guards the file name too
+  std::mutex reload_mutex_;
+  std::string base_file_name_;
+
+  void Publish(std::shared_ptr<const TransportCatalog> catalog, std::string base_file_name);
+};
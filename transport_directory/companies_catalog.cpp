@@ -190,15 +190,12 @@ string CompanyMainName(const YellowPages::Company& company) {
 
 
 CompaniesCatalog::CompaniesCatalog(const Json::Dict& rubrics_json,
-  const vector<Json::Node>& companies_json)
+  vector<YellowPages::Company> companies)
+  : companies_(move(companies))
 {
   for (const auto& [number, names_dict] : rubrics_json) {
     rubrics_mapping_[std::stoi(number)] = names_dict.AsMap().at("name").AsString();
   }
-  companies_.reserve(companies_json.size());
-  for (const auto& company_json : companies_json) {
-    companies_.push_back(ReadCompany(company_json.AsMap()));
-  }
   ComputeWorkingTime();
 }
 
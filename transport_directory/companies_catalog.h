@@ -42,7 +42,7 @@ std::string CompanyMainName(const YellowPages::Company& company);
 
 class CompaniesCatalog {
 public:
-  CompaniesCatalog(const Json::Dict& rubrics_json, const std::vector<Json::Node>& companies_json);
+  CompaniesCatalog(const Json::Dict& rubrics_json, std::vector<YellowPages::Company> companies);
 
   YellowPages::Database Serialize() const;
   CompaniesCatalog(const YellowPages::Database& base);
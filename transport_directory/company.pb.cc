@@ -14,87 +14,83 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_address_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Address_address_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_name_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Name_name_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_company_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NearbyStop_company_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_phone_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Phone_phone_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_url_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Url_url_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_working_5ftime_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_WorkingTime_working_5ftime_2eproto;
-namespace YellowPages {
-class NearbyStopDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<NearbyStop> _instance;
-} _NearbyStop_default_instance_;
-class CompanyDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Company> _instance;
-} _Company_default_instance_;
-}  // namespace YellowPages
-static void InitDefaultsscc_info_Company_company_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::YellowPages::_Company_default_instance_;
-    new (ptr) ::YellowPages::Company();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_Company_company_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 6, 0, InitDefaultsscc_info_Company_company_2eproto}, {
-      &scc_info_Address_address_2eproto.base,
-      &scc_info_Name_name_2eproto.base,
-      &scc_info_Phone_phone_2eproto.base,
-      &scc_info_Url_url_2eproto.base,
-      &scc_info_WorkingTime_working_5ftime_2eproto.base,
-      &scc_info_NearbyStop_company_2eproto.base,}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-static void InitDefaultsscc_info_NearbyStop_company_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-  {
-    void* ptr = &::YellowPages::_NearbyStop_default_instance_;
-    new (ptr) ::YellowPages::NearbyStop();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NearbyStop_company_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_NearbyStop_company_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_company_2eproto[2];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_company_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_company_2eproto = nullptr;
+namespace YellowPages {
+PROTOBUF_CONSTEXPR NearbyStop::NearbyStop(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.meters_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NearbyStopDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NearbyStopDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NearbyStopDefaultTypeInternal() {}
+  union {
+    NearbyStop _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NearbyStopDefaultTypeInternal _NearbyStop_default_instance_;
+PROTOBUF_CONSTEXPR Company::Company(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.names_)*/{}
+  , /*decltype(_impl_.phones_)*/{}
+  , /*decltype(_impl_.urls_)*/{}
+  , /*decltype(_impl_.rubrics_)*/{}
+  , /*decltype(_impl_._rubrics_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nearby_stops_)*/{}
+  , /*decltype(_impl_.address_)*/nullptr
+  , /*decltype(_impl_.working_time_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CompanyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CompanyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CompanyDefaultTypeInternal() {}
+  union {
+    Company _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CompanyDefaultTypeInternal _Company_default_instance_;
+}  // namespace YellowPages
+static ::_pb::Metadata file_level_metadata_company_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_company_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_company_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_company_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_company_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::YellowPages::NearbyStop, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::YellowPages::NearbyStop, name_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::NearbyStop, meters_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::YellowPages::NearbyStop, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::NearbyStop, _impl_.meters_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::YellowPages::Company, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, address_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, names_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, phones_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, urls_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, rubrics_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, working_time_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, nearby_stops_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, _impl_.address_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, _impl_.names_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, _impl_.phones_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, _impl_.urls_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, _impl_.rubrics_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, _impl_.working_time_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Company, _impl_.nearby_stops_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::YellowPages::NearbyStop)},
-  { 7, -1, sizeof(::YellowPages::Company)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::YellowPages::NearbyStop)},
+  { 8, -1, -1, sizeof(::YellowPages::Company)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::YellowPages::_NearbyStop_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::YellowPages::_Company_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::YellowPages::_NearbyStop_default_instance_._instance,
+  &::YellowPages::_Company_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_company_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -110,27 +106,28 @@ const char descriptor_table_protodef_company_2eproto[] PROTOBUF_SECTION_VARIABLE
   "e\022-\n\014nearby_stops\030\007 \003(\0132\027.YellowPages.Ne"
   "arbyStopb\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_company_2eproto_deps[5] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_company_2eproto_deps[5] = {
   &::descriptor_table_address_2eproto,
   &::descriptor_table_name_2eproto,
   &::descriptor_table_phone_2eproto,
   &::descriptor_table_url_2eproto,
   &::descriptor_table_working_5ftime_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_company_2eproto_sccs[2] = {
-  &scc_info_Company_company_2eproto.base,
-  &scc_info_NearbyStop_company_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_company_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_company_2eproto = {
-  false, false, descriptor_table_protodef_company_2eproto, "company.proto", 416,
-  &descriptor_table_company_2eproto_once, descriptor_table_company_2eproto_sccs, descriptor_table_company_2eproto_deps, 2, 5,
-  schemas, file_default_instances, TableStruct_company_2eproto::offsets,
-  file_level_metadata_company_2eproto, 2, file_level_enum_descriptors_company_2eproto, file_level_service_descriptors_company_2eproto,
+static ::_pbi::once_flag descriptor_table_company_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_company_2eproto = {
+    false, false, 416, descriptor_table_protodef_company_2eproto,
+    "company.proto",
+    &descriptor_table_company_2eproto_once, descriptor_table_company_2eproto_deps, 5, 2,
+    schemas, file_default_instances, TableStruct_company_2eproto::offsets,
+    file_level_metadata_company_2eproto, file_level_enum_descriptors_company_2eproto,
+    file_level_service_descriptors_company_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_company_2eproto_getter() {
+  return &descriptor_table_company_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_company_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_company_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_company_2eproto(&descriptor_table_company_2eproto);
 namespace YellowPages {
 
 // ===================================================================
@@ -139,120 +136,132 @@ class NearbyStop::_Internal {
  public:
 };
 
-NearbyStop::NearbyStop(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+NearbyStop::NearbyStop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:YellowPages.NearbyStop)
 }
 NearbyStop::NearbyStop(const NearbyStop& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NearbyStop* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.meters_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
-  meters_ = from.meters_;
+  _this->_impl_.meters_ = from._impl_.meters_;
   // @@protoc_insertion_point(copy_constructor:YellowPages.NearbyStop)
 }
 
-void NearbyStop::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_NearbyStop_company_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  meters_ = 0u;
+inline void NearbyStop::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.meters_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 NearbyStop::~NearbyStop() {
   // @@protoc_insertion_point(destructor:YellowPages.NearbyStop)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void NearbyStop::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void NearbyStop::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void NearbyStop::ArenaDtor(void* object) {
-  NearbyStop* _this = reinterpret_cast< NearbyStop* >(object);
-  (void)_this;
-}
-void NearbyStop::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void NearbyStop::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const NearbyStop& NearbyStop::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_NearbyStop_company_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void NearbyStop::Clear() {
 // @@protoc_insertion_point(message_clear_start:YellowPages.NearbyStop)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmpty();
-  meters_ = 0u;
+  _impl_.name_.ClearToEmpty();
+  _impl_.meters_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* NearbyStop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* NearbyStop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "YellowPages.NearbyStop.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "YellowPages.NearbyStop.name"));
+        } else
+          goto handle_unusual;
         continue;
       // uint32 meters = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          meters_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.meters_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* NearbyStop::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* NearbyStop::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:YellowPages.NearbyStop)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -262,13 +271,13 @@ failure:
   }
 
   // uint32 meters = 2;
-  if (this->meters() != 0) {
+  if (this->_internal_meters() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_meters(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_meters(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:YellowPages.NearbyStop)
@@ -279,68 +288,47 @@ size_t NearbyStop::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:YellowPages.NearbyStop)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
   // uint32 meters = 2;
-  if (this->meters() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_meters());
+  if (this->_internal_meters() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_meters());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void NearbyStop::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:YellowPages.NearbyStop)
-  GOOGLE_DCHECK_NE(&from, this);
-  const NearbyStop* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<NearbyStop>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:YellowPages.NearbyStop)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:YellowPages.NearbyStop)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NearbyStop::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NearbyStop::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NearbyStop::GetClassData() const { return &_class_data_; }
 
-void NearbyStop::MergeFrom(const NearbyStop& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.NearbyStop)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void NearbyStop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NearbyStop*>(&to_msg);
+  auto& from = static_cast<const NearbyStop&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.NearbyStop)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.meters() != 0) {
-    _internal_set_meters(from._internal_meters());
+  if (from._internal_meters() != 0) {
+    _this->_internal_set_meters(from._internal_meters());
   }
-}
-
-void NearbyStop::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:YellowPages.NearbyStop)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void NearbyStop::CopyFrom(const NearbyStop& from) {
@@ -356,16 +344,22 @@ bool NearbyStop::IsInitialized() const {
 
 void NearbyStop::InternalSwap(NearbyStop* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(meters_, other->meters_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.meters_, other->_impl_.meters_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata NearbyStop::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_company_2eproto_getter, &descriptor_table_company_2eproto_once,
+      file_level_metadata_company_2eproto[0]);
 }
 
-
 // ===================================================================
 
 class Company::_Internal {
@@ -376,139 +370,143 @@ class Company::_Internal {
 
 const ::YellowPages::Address&
 Company::_Internal::address(const Company* msg) {
-  return *msg->address_;
+  return *msg->_impl_.address_;
 }
 const ::YellowPages::WorkingTime&
 Company::_Internal::working_time(const Company* msg) {
-  return *msg->working_time_;
+  return *msg->_impl_.working_time_;
 }
 void Company::clear_address() {
-  if (GetArena() == nullptr && address_ != nullptr) {
-    delete address_;
+  if (GetArenaForAllocation() == nullptr && _impl_.address_ != nullptr) {
+    delete _impl_.address_;
   }
-  address_ = nullptr;
+  _impl_.address_ = nullptr;
 }
 void Company::clear_names() {
-  names_.Clear();
+  _impl_.names_.Clear();
 }
 void Company::clear_phones() {
-  phones_.Clear();
+  _impl_.phones_.Clear();
 }
 void Company::clear_urls() {
-  urls_.Clear();
+  _impl_.urls_.Clear();
 }
 void Company::clear_working_time() {
-  if (GetArena() == nullptr && working_time_ != nullptr) {
-    delete working_time_;
-  }
-  working_time_ = nullptr;
-}
-Company::Company(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  names_(arena),
-  phones_(arena),
-  urls_(arena),
-  rubrics_(arena),
-  nearby_stops_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+  if (GetArenaForAllocation() == nullptr && _impl_.working_time_ != nullptr) {
+    delete _impl_.working_time_;
+  }
+  _impl_.working_time_ = nullptr;
+}
+Company::Company(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:YellowPages.Company)
 }
 Company::Company(const Company& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      names_(from.names_),
-      phones_(from.phones_),
-      urls_(from.urls_),
-      rubrics_(from.rubrics_),
-      nearby_stops_(from.nearby_stops_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Company* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.names_){from._impl_.names_}
+    , decltype(_impl_.phones_){from._impl_.phones_}
+    , decltype(_impl_.urls_){from._impl_.urls_}
+    , decltype(_impl_.rubrics_){from._impl_.rubrics_}
+    , /*decltype(_impl_._rubrics_cached_byte_size_)*/{0}
+    , decltype(_impl_.nearby_stops_){from._impl_.nearby_stops_}
+    , decltype(_impl_.address_){nullptr}
+    , decltype(_impl_.working_time_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_address()) {
-    address_ = new ::YellowPages::Address(*from.address_);
-  } else {
-    address_ = nullptr;
+    _this->_impl_.address_ = new ::YellowPages::Address(*from._impl_.address_);
   }
   if (from._internal_has_working_time()) {
-    working_time_ = new ::YellowPages::WorkingTime(*from.working_time_);
-  } else {
-    working_time_ = nullptr;
+    _this->_impl_.working_time_ = new ::YellowPages::WorkingTime(*from._impl_.working_time_);
   }
   // @@protoc_insertion_point(copy_constructor:YellowPages.Company)
 }
 
-void Company::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Company_company_2eproto.base);
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&address_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&working_time_) -
-      reinterpret_cast<char*>(&address_)) + sizeof(working_time_));
+inline void Company::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.names_){arena}
+    , decltype(_impl_.phones_){arena}
+    , decltype(_impl_.urls_){arena}
+    , decltype(_impl_.rubrics_){arena}
+    , /*decltype(_impl_._rubrics_cached_byte_size_)*/{0}
+    , decltype(_impl_.nearby_stops_){arena}
+    , decltype(_impl_.address_){nullptr}
+    , decltype(_impl_.working_time_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Company::~Company() {
   // @@protoc_insertion_point(destructor:YellowPages.Company)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Company::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete address_;
-  if (this != internal_default_instance()) delete working_time_;
+inline void Company::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.names_.~RepeatedPtrField();
+  _impl_.phones_.~RepeatedPtrField();
+  _impl_.urls_.~RepeatedPtrField();
+  _impl_.rubrics_.~RepeatedField();
+  _impl_.nearby_stops_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.address_;
+  if (this != internal_default_instance()) delete _impl_.working_time_;
 }
 
-void Company::ArenaDtor(void* object) {
-  Company* _this = reinterpret_cast< Company* >(object);
-  (void)_this;
-}
-void Company::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Company::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Company& Company::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Company_company_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Company::Clear() {
 // @@protoc_insertion_point(message_clear_start:YellowPages.Company)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  names_.Clear();
-  phones_.Clear();
-  urls_.Clear();
-  rubrics_.Clear();
-  nearby_stops_.Clear();
-  if (GetArena() == nullptr && address_ != nullptr) {
-    delete address_;
+  _impl_.names_.Clear();
+  _impl_.phones_.Clear();
+  _impl_.urls_.Clear();
+  _impl_.rubrics_.Clear();
+  _impl_.nearby_stops_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.address_ != nullptr) {
+    delete _impl_.address_;
   }
-  address_ = nullptr;
-  if (GetArena() == nullptr && working_time_ != nullptr) {
-    delete working_time_;
+  _impl_.address_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.working_time_ != nullptr) {
+    delete _impl_.working_time_;
   }
-  working_time_ = nullptr;
+  _impl_.working_time_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Company::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Company::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .YellowPages.Address address = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_address(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .YellowPages.Name names = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -516,11 +514,12 @@ const char* Company::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .YellowPages.Phone phones = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -528,11 +527,12 @@ const char* Company::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .YellowPages.Url urls = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -540,28 +540,31 @@ const char* Company::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated uint64 rubrics = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_rubrics(), ptr, ctx);
           CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40) {
+        } else if (static_cast<uint8_t>(tag) == 40) {
           _internal_add_rubrics(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .YellowPages.WorkingTime working_time = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr = ctx->ParseMessage(_internal_mutable_working_time(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .YellowPages.NearbyStop nearby_stops = 7;
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -569,71 +572,72 @@ const char* Company::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Company::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Company::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:YellowPages.Company)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .YellowPages.Address address = 1;
-  if (this->has_address()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_address()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::address(this), target, stream);
+      InternalWriteMessage(1, _Internal::address(this),
+        _Internal::address(this).GetCachedSize(), target, stream);
   }
 
   // repeated .YellowPages.Name names = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_names_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_names_size()); i < n; i++) {
+    const auto& repfield = this->_internal_names(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_names(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .YellowPages.Phone phones = 3;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_phones_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_phones_size()); i < n; i++) {
+    const auto& repfield = this->_internal_phones(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, this->_internal_phones(i), target, stream);
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .YellowPages.Url urls = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_urls_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_urls_size()); i < n; i++) {
+    const auto& repfield = this->_internal_urls(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, this->_internal_urls(i), target, stream);
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated uint64 rubrics = 5;
   {
-    int byte_size = _rubrics_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._rubrics_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteUInt64Packed(
           5, _internal_rubrics(), byte_size, target);
@@ -641,23 +645,22 @@ failure:
   }
 
   // .YellowPages.WorkingTime working_time = 6;
-  if (this->has_working_time()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_working_time()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::working_time(this), target, stream);
+      InternalWriteMessage(6, _Internal::working_time(this),
+        _Internal::working_time(this).GetCachedSize(), target, stream);
   }
 
   // repeated .YellowPages.NearbyStop nearby_stops = 7;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_nearby_stops_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_nearby_stops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_nearby_stops(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(7, this->_internal_nearby_stops(i), target, stream);
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:YellowPages.Company)
@@ -668,116 +671,98 @@ size_t Company::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:YellowPages.Company)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .YellowPages.Name names = 2;
   total_size += 1UL * this->_internal_names_size();
-  for (const auto& msg : this->names_) {
+  for (const auto& msg : this->_impl_.names_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .YellowPages.Phone phones = 3;
   total_size += 1UL * this->_internal_phones_size();
-  for (const auto& msg : this->phones_) {
+  for (const auto& msg : this->_impl_.phones_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .YellowPages.Url urls = 4;
   total_size += 1UL * this->_internal_urls_size();
-  for (const auto& msg : this->urls_) {
+  for (const auto& msg : this->_impl_.urls_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated uint64 rubrics = 5;
   {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt64Size(this->rubrics_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.rubrics_);
     if (data_size > 0) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _rubrics_cached_byte_size_.store(cached_size,
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._rubrics_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // repeated .YellowPages.NearbyStop nearby_stops = 7;
   total_size += 1UL * this->_internal_nearby_stops_size();
-  for (const auto& msg : this->nearby_stops_) {
+  for (const auto& msg : this->_impl_.nearby_stops_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // .YellowPages.Address address = 1;
-  if (this->has_address()) {
+  if (this->_internal_has_address()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *address_);
+        *_impl_.address_);
   }
 
   // .YellowPages.WorkingTime working_time = 6;
-  if (this->has_working_time()) {
+  if (this->_internal_has_working_time()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *working_time_);
+        *_impl_.working_time_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Company::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:YellowPages.Company)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Company* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Company>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:YellowPages.Company)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:YellowPages.Company)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Company::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Company::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Company::GetClassData() const { return &_class_data_; }
 
-void Company::MergeFrom(const Company& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.Company)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Company::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Company*>(&to_msg);
+  auto& from = static_cast<const Company&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.Company)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  names_.MergeFrom(from.names_);
-  phones_.MergeFrom(from.phones_);
-  urls_.MergeFrom(from.urls_);
-  rubrics_.MergeFrom(from.rubrics_);
-  nearby_stops_.MergeFrom(from.nearby_stops_);
-  if (from.has_address()) {
-    _internal_mutable_address()->::YellowPages::Address::MergeFrom(from._internal_address());
+  _this->_impl_.names_.MergeFrom(from._impl_.names_);
+  _this->_impl_.phones_.MergeFrom(from._impl_.phones_);
+  _this->_impl_.urls_.MergeFrom(from._impl_.urls_);
+  _this->_impl_.rubrics_.MergeFrom(from._impl_.rubrics_);
+  _this->_impl_.nearby_stops_.MergeFrom(from._impl_.nearby_stops_);
+  if (from._internal_has_address()) {
+    _this->_internal_mutable_address()->::YellowPages::Address::MergeFrom(
+        from._internal_address());
   }
-  if (from.has_working_time()) {
-    _internal_mutable_working_time()->::YellowPages::WorkingTime::MergeFrom(from._internal_working_time());
+  if (from._internal_has_working_time()) {
+    _this->_internal_mutable_working_time()->::YellowPages::WorkingTime::MergeFrom(
+        from._internal_working_time());
   }
-}
-
-void Company::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:YellowPages.Company)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Company::CopyFrom(const Company& from) {
@@ -793,32 +778,35 @@ bool Company::IsInitialized() const {
 
 void Company::InternalSwap(Company* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  names_.InternalSwap(&other->names_);
-  phones_.InternalSwap(&other->phones_);
-  urls_.InternalSwap(&other->urls_);
-  rubrics_.InternalSwap(&other->rubrics_);
-  nearby_stops_.InternalSwap(&other->nearby_stops_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.names_.InternalSwap(&other->_impl_.names_);
+  _impl_.phones_.InternalSwap(&other->_impl_.phones_);
+  _impl_.urls_.InternalSwap(&other->_impl_.urls_);
+  _impl_.rubrics_.InternalSwap(&other->_impl_.rubrics_);
+  _impl_.nearby_stops_.InternalSwap(&other->_impl_.nearby_stops_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Company, working_time_)
-      + sizeof(Company::working_time_)
-      - PROTOBUF_FIELD_OFFSET(Company, address_)>(
-          reinterpret_cast<char*>(&address_),
-          reinterpret_cast<char*>(&other->address_));
+      PROTOBUF_FIELD_OFFSET(Company, _impl_.working_time_)
+      + sizeof(Company::_impl_.working_time_)
+      - PROTOBUF_FIELD_OFFSET(Company, _impl_.address_)>(
+          reinterpret_cast<char*>(&_impl_.address_),
+          reinterpret_cast<char*>(&other->_impl_.address_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Company::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_company_2eproto_getter, &descriptor_table_company_2eproto_once,
+      file_level_metadata_company_2eproto[1]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::YellowPages::NearbyStop* Arena::CreateMaybeMessage< ::YellowPages::NearbyStop >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::YellowPages::NearbyStop*
+Arena::CreateMaybeMessage< ::YellowPages::NearbyStop >(Arena* arena) {
   return Arena::CreateMessageInternal< ::YellowPages::NearbyStop >(arena);
 }
-template<> PROTOBUF_NOINLINE ::YellowPages::Company* Arena::CreateMaybeMessage< ::YellowPages::Company >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::YellowPages::Company*
+Arena::CreateMaybeMessage< ::YellowPages::Company >(Arena* arena) {
   return Arena::CreateMessageInternal< ::YellowPages::Company >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -47,23 +46,15 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_company_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_company_2eproto;
 namespace YellowPages {
 class Company;
-class CompanyDefaultTypeInternal;
+struct CompanyDefaultTypeInternal;
 extern CompanyDefaultTypeInternal _Company_default_instance_;
 class NearbyStop;
-class NearbyStopDefaultTypeInternal;
+struct NearbyStopDefaultTypeInternal;
 extern NearbyStopDefaultTypeInternal _NearbyStop_default_instance_;
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
@@ -74,11 +65,12 @@ namespace YellowPages {
 
 // ===================================================================
 
-class NearbyStop PROTOBUF_FINAL :
+class NearbyStop final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.NearbyStop) */ {
  public:
   inline NearbyStop() : NearbyStop(nullptr) {}
-  virtual ~NearbyStop();
+  ~NearbyStop() override;
+  explicit PROTOBUF_CONSTEXPR NearbyStop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   NearbyStop(const NearbyStop& from);
   NearbyStop(NearbyStop&& from) noexcept
@@ -91,8 +83,13 @@ class NearbyStop PROTOBUF_FINAL :
     return *this;
   }
   inline NearbyStop& operator=(NearbyStop&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -103,13 +100,14 @@ class NearbyStop PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NearbyStop& default_instance() {
+    return *internal_default_instance();
   }
-  static const NearbyStop& default_instance();
-
   static inline const NearbyStop* internal_default_instance() {
     return reinterpret_cast<const NearbyStop*>(
                &_NearbyStop_default_instance_);
@@ -122,7 +120,12 @@ class NearbyStop PROTOBUF_FINAL :
   }
   inline void Swap(NearbyStop* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -130,56 +133,53 @@ class NearbyStop PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(NearbyStop* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline NearbyStop* New() const final {
-    return CreateMaybeMessage<NearbyStop>(nullptr);
-  }
-
-  NearbyStop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  NearbyStop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<NearbyStop>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const NearbyStop& from);
-  void MergeFrom(const NearbyStop& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NearbyStop& from) {
+    NearbyStop::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(NearbyStop* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.NearbyStop";
   }
   protected:
-  explicit NearbyStop(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit NearbyStop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_company_2eproto);
-    return ::descriptor_table_company_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -192,26 +192,24 @@ class NearbyStop PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
   // uint32 meters = 2;
   void clear_meters();
-  ::PROTOBUF_NAMESPACE_ID::uint32 meters() const;
-  void set_meters(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t meters() const;
+  void set_meters(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_meters() const;
-  void _internal_set_meters(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_meters() const;
+  void _internal_set_meters(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:YellowPages.NearbyStop)
@@ -221,18 +219,22 @@ class NearbyStop PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 meters_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t meters_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_company_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Company PROTOBUF_FINAL :
+class Company final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.Company) */ {
  public:
   inline Company() : Company(nullptr) {}
-  virtual ~Company();
+  ~Company() override;
+  explicit PROTOBUF_CONSTEXPR Company(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Company(const Company& from);
   Company(Company&& from) noexcept
@@ -245,8 +247,13 @@ class Company PROTOBUF_FINAL :
     return *this;
   }
   inline Company& operator=(Company&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -257,13 +264,14 @@ class Company PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Company& default_instance() {
+    return *internal_default_instance();
   }
-  static const Company& default_instance();
-
   static inline const Company* internal_default_instance() {
     return reinterpret_cast<const Company*>(
                &_Company_default_instance_);
@@ -276,7 +284,12 @@ class Company PROTOBUF_FINAL :
   }
   inline void Swap(Company* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -284,56 +297,53 @@ class Company PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Company* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Company* New() const final {
-    return CreateMaybeMessage<Company>(nullptr);
-  }
-
-  Company* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Company* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Company>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Company& from);
-  void MergeFrom(const Company& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Company& from) {
+    Company::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Company* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.Company";
   }
   protected:
-  explicit Company(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Company(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_company_2eproto);
-    return ::descriptor_table_company_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -409,19 +419,19 @@ class Company PROTOBUF_FINAL :
   public:
   void clear_rubrics();
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_rubrics(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+  uint64_t _internal_rubrics(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       _internal_rubrics() const;
-  void _internal_add_rubrics(::PROTOBUF_NAMESPACE_ID::uint64 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+  void _internal_add_rubrics(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       _internal_mutable_rubrics();
   public:
-  ::PROTOBUF_NAMESPACE_ID::uint64 rubrics(int index) const;
-  void set_rubrics(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
-  void add_rubrics(::PROTOBUF_NAMESPACE_ID::uint64 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+  uint64_t rubrics(int index) const;
+  void set_rubrics(int index, uint64_t value);
+  void add_rubrics(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       rubrics() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       mutable_rubrics();
 
   // repeated .YellowPages.NearbyStop nearby_stops = 7;
@@ -449,7 +459,7 @@ class Company PROTOBUF_FINAL :
   public:
   void clear_address();
   const ::YellowPages::Address& address() const;
-  ::YellowPages::Address* release_address();
+  PROTOBUF_NODISCARD ::YellowPages::Address* release_address();
   ::YellowPages::Address* mutable_address();
   void set_allocated_address(::YellowPages::Address* address);
   private:
@@ -467,7 +477,7 @@ class Company PROTOBUF_FINAL :
   public:
   void clear_working_time();
   const ::YellowPages::WorkingTime& working_time() const;
-  ::YellowPages::WorkingTime* release_working_time();
+  PROTOBUF_NODISCARD ::YellowPages::WorkingTime* release_working_time();
   ::YellowPages::WorkingTime* mutable_working_time();
   void set_allocated_working_time(::YellowPages::WorkingTime* working_time);
   private:
@@ -485,15 +495,18 @@ class Company PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Name > names_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Phone > phones_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Url > urls_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > rubrics_;
-  mutable std::atomic<int> _rubrics_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::NearbyStop > nearby_stops_;
-  ::YellowPages::Address* address_;
-  ::YellowPages::WorkingTime* working_time_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Name > names_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Phone > phones_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Url > urls_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > rubrics_;
+    mutable std::atomic<int> _rubrics_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::NearbyStop > nearby_stops_;
+    ::YellowPages::Address* address_;
+    ::YellowPages::WorkingTime* working_time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_company_2eproto;
 };
 // ===================================================================
@@ -509,53 +522,38 @@ class Company PROTOBUF_FINAL :
 
 // string name = 1;
 inline void NearbyStop::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& NearbyStop::name() const {
   // @@protoc_insertion_point(field_get:YellowPages.NearbyStop.name)
   return _internal_name();
 }
-inline void NearbyStop::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NearbyStop::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.NearbyStop.name)
 }
 inline std::string* NearbyStop::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:YellowPages.NearbyStop.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& NearbyStop::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void NearbyStop::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void NearbyStop::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.NearbyStop.name)
-}
-inline void NearbyStop::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.NearbyStop.name)
-}
-inline void NearbyStop::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.NearbyStop.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* NearbyStop::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* NearbyStop::release_name() {
   // @@protoc_insertion_point(field_release:YellowPages.NearbyStop.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void NearbyStop::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -563,27 +561,31 @@ inline void NearbyStop::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.NearbyStop.name)
 }
 
 // uint32 meters = 2;
 inline void NearbyStop::clear_meters() {
-  meters_ = 0u;
+  _impl_.meters_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 NearbyStop::_internal_meters() const {
-  return meters_;
+inline uint32_t NearbyStop::_internal_meters() const {
+  return _impl_.meters_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 NearbyStop::meters() const {
+inline uint32_t NearbyStop::meters() const {
   // @@protoc_insertion_point(field_get:YellowPages.NearbyStop.meters)
   return _internal_meters();
 }
-inline void NearbyStop::_internal_set_meters(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void NearbyStop::_internal_set_meters(uint32_t value) {
   
-  meters_ = value;
+  _impl_.meters_ = value;
 }
-inline void NearbyStop::set_meters(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void NearbyStop::set_meters(uint32_t value) {
   _internal_set_meters(value);
   // @@protoc_insertion_point(field_set:YellowPages.NearbyStop.meters)
 }
@@ -594,13 +596,13 @@ inline void NearbyStop::set_meters(::PROTOBUF_NAMESPACE_ID::uint32 value) {
 
 // .YellowPages.Address address = 1;
 inline bool Company::_internal_has_address() const {
-  return this != internal_default_instance() && address_ != nullptr;
+  return this != internal_default_instance() && _impl_.address_ != nullptr;
 }
 inline bool Company::has_address() const {
   return _internal_has_address();
 }
 inline const ::YellowPages::Address& Company::_internal_address() const {
-  const ::YellowPages::Address* p = address_;
+  const ::YellowPages::Address* p = _impl_.address_;
   return p != nullptr ? *p : reinterpret_cast<const ::YellowPages::Address&>(
       ::YellowPages::_Address_default_instance_);
 }
@@ -610,10 +612,10 @@ inline const ::YellowPages::Address& Company::address() const {
 }
 inline void Company::unsafe_arena_set_allocated_address(
     ::YellowPages::Address* address) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(address_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.address_);
   }
-  address_ = address;
+  _impl_.address_ = address;
   if (address) {
     
   } else {
@@ -623,40 +625,48 @@ inline void Company::unsafe_arena_set_allocated_address(
 }
 inline ::YellowPages::Address* Company::release_address() {
   
-  ::YellowPages::Address* temp = address_;
-  address_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::YellowPages::Address* temp = _impl_.address_;
+  _impl_.address_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::YellowPages::Address* Company::unsafe_arena_release_address() {
   // @@protoc_insertion_point(field_release:YellowPages.Company.address)
   
-  ::YellowPages::Address* temp = address_;
-  address_ = nullptr;
+  ::YellowPages::Address* temp = _impl_.address_;
+  _impl_.address_ = nullptr;
   return temp;
 }
 inline ::YellowPages::Address* Company::_internal_mutable_address() {
   
-  if (address_ == nullptr) {
-    auto* p = CreateMaybeMessage<::YellowPages::Address>(GetArena());
-    address_ = p;
+  if (_impl_.address_ == nullptr) {
+    auto* p = CreateMaybeMessage<::YellowPages::Address>(GetArenaForAllocation());
+    _impl_.address_ = p;
   }
-  return address_;
+  return _impl_.address_;
 }
 inline ::YellowPages::Address* Company::mutable_address() {
+  ::YellowPages::Address* _msg = _internal_mutable_address();
   // @@protoc_insertion_point(field_mutable:YellowPages.Company.address)
-  return _internal_mutable_address();
+  return _msg;
 }
 inline void Company::set_allocated_address(::YellowPages::Address* address) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(address_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.address_);
   }
   if (address) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(address)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(address));
     if (message_arena != submessage_arena) {
       address = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, address, submessage_arena);
@@ -665,160 +675,163 @@ inline void Company::set_allocated_address(::YellowPages::Address* address) {
   } else {
     
   }
-  address_ = address;
+  _impl_.address_ = address;
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Company.address)
 }
 
 // repeated .YellowPages.Name names = 2;
 inline int Company::_internal_names_size() const {
-  return names_.size();
+  return _impl_.names_.size();
 }
 inline int Company::names_size() const {
   return _internal_names_size();
 }
 inline ::YellowPages::Name* Company::mutable_names(int index) {
   // @@protoc_insertion_point(field_mutable:YellowPages.Company.names)
-  return names_.Mutable(index);
+  return _impl_.names_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Name >*
 Company::mutable_names() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.Company.names)
-  return &names_;
+  return &_impl_.names_;
 }
 inline const ::YellowPages::Name& Company::_internal_names(int index) const {
-  return names_.Get(index);
+  return _impl_.names_.Get(index);
 }
 inline const ::YellowPages::Name& Company::names(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.Company.names)
   return _internal_names(index);
 }
 inline ::YellowPages::Name* Company::_internal_add_names() {
-  return names_.Add();
+  return _impl_.names_.Add();
 }
 inline ::YellowPages::Name* Company::add_names() {
+  ::YellowPages::Name* _add = _internal_add_names();
   // @@protoc_insertion_point(field_add:YellowPages.Company.names)
-  return _internal_add_names();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Name >&
 Company::names() const {
   // @@protoc_insertion_point(field_list:YellowPages.Company.names)
-  return names_;
+  return _impl_.names_;
 }
 
 // repeated .YellowPages.Phone phones = 3;
 inline int Company::_internal_phones_size() const {
-  return phones_.size();
+  return _impl_.phones_.size();
 }
 inline int Company::phones_size() const {
   return _internal_phones_size();
 }
 inline ::YellowPages::Phone* Company::mutable_phones(int index) {
   // @@protoc_insertion_point(field_mutable:YellowPages.Company.phones)
-  return phones_.Mutable(index);
+  return _impl_.phones_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Phone >*
 Company::mutable_phones() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.Company.phones)
-  return &phones_;
+  return &_impl_.phones_;
 }
 inline const ::YellowPages::Phone& Company::_internal_phones(int index) const {
-  return phones_.Get(index);
+  return _impl_.phones_.Get(index);
 }
 inline const ::YellowPages::Phone& Company::phones(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.Company.phones)
   return _internal_phones(index);
 }
 inline ::YellowPages::Phone* Company::_internal_add_phones() {
-  return phones_.Add();
+  return _impl_.phones_.Add();
 }
 inline ::YellowPages::Phone* Company::add_phones() {
+  ::YellowPages::Phone* _add = _internal_add_phones();
   // @@protoc_insertion_point(field_add:YellowPages.Company.phones)
-  return _internal_add_phones();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Phone >&
 Company::phones() const {
   // @@protoc_insertion_point(field_list:YellowPages.Company.phones)
-  return phones_;
+  return _impl_.phones_;
 }
 
 // repeated .YellowPages.Url urls = 4;
 inline int Company::_internal_urls_size() const {
-  return urls_.size();
+  return _impl_.urls_.size();
 }
 inline int Company::urls_size() const {
   return _internal_urls_size();
 }
 inline ::YellowPages::Url* Company::mutable_urls(int index) {
   // @@protoc_insertion_point(field_mutable:YellowPages.Company.urls)
-  return urls_.Mutable(index);
+  return _impl_.urls_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Url >*
 Company::mutable_urls() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.Company.urls)
-  return &urls_;
+  return &_impl_.urls_;
 }
 inline const ::YellowPages::Url& Company::_internal_urls(int index) const {
-  return urls_.Get(index);
+  return _impl_.urls_.Get(index);
 }
 inline const ::YellowPages::Url& Company::urls(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.Company.urls)
   return _internal_urls(index);
 }
 inline ::YellowPages::Url* Company::_internal_add_urls() {
-  return urls_.Add();
+  return _impl_.urls_.Add();
 }
 inline ::YellowPages::Url* Company::add_urls() {
+  ::YellowPages::Url* _add = _internal_add_urls();
   // @@protoc_insertion_point(field_add:YellowPages.Company.urls)
-  return _internal_add_urls();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Url >&
 Company::urls() const {
   // @@protoc_insertion_point(field_list:YellowPages.Company.urls)
-  return urls_;
+  return _impl_.urls_;
 }
 
 // repeated uint64 rubrics = 5;
 inline int Company::_internal_rubrics_size() const {
-  return rubrics_.size();
+  return _impl_.rubrics_.size();
 }
 inline int Company::rubrics_size() const {
   return _internal_rubrics_size();
 }
 inline void Company::clear_rubrics() {
-  rubrics_.Clear();
+  _impl_.rubrics_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Company::_internal_rubrics(int index) const {
-  return rubrics_.Get(index);
+inline uint64_t Company::_internal_rubrics(int index) const {
+  return _impl_.rubrics_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Company::rubrics(int index) const {
+inline uint64_t Company::rubrics(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.Company.rubrics)
   return _internal_rubrics(index);
 }
-inline void Company::set_rubrics(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  rubrics_.Set(index, value);
+inline void Company::set_rubrics(int index, uint64_t value) {
+  _impl_.rubrics_.Set(index, value);
   // @@protoc_insertion_point(field_set:YellowPages.Company.rubrics)
 }
-inline void Company::_internal_add_rubrics(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  rubrics_.Add(value);
+inline void Company::_internal_add_rubrics(uint64_t value) {
+  _impl_.rubrics_.Add(value);
 }
-inline void Company::add_rubrics(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void Company::add_rubrics(uint64_t value) {
   _internal_add_rubrics(value);
   // @@protoc_insertion_point(field_add:YellowPages.Company.rubrics)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 Company::_internal_rubrics() const {
-  return rubrics_;
+  return _impl_.rubrics_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 Company::rubrics() const {
   // @@protoc_insertion_point(field_list:YellowPages.Company.rubrics)
   return _internal_rubrics();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 Company::_internal_mutable_rubrics() {
-  return &rubrics_;
+  return &_impl_.rubrics_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 Company::mutable_rubrics() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.Company.rubrics)
   return _internal_mutable_rubrics();
@@ -826,13 +839,13 @@ Company::mutable_rubrics() {
 
 // .YellowPages.WorkingTime working_time = 6;
 inline bool Company::_internal_has_working_time() const {
-  return this != internal_default_instance() && working_time_ != nullptr;
+  return this != internal_default_instance() && _impl_.working_time_ != nullptr;
 }
 inline bool Company::has_working_time() const {
   return _internal_has_working_time();
 }
 inline const ::YellowPages::WorkingTime& Company::_internal_working_time() const {
-  const ::YellowPages::WorkingTime* p = working_time_;
+  const ::YellowPages::WorkingTime* p = _impl_.working_time_;
   return p != nullptr ? *p : reinterpret_cast<const ::YellowPages::WorkingTime&>(
       ::YellowPages::_WorkingTime_default_instance_);
 }
@@ -842,10 +855,10 @@ inline const ::YellowPages::WorkingTime& Company::working_time() const {
 }
 inline void Company::unsafe_arena_set_allocated_working_time(
     ::YellowPages::WorkingTime* working_time) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(working_time_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.working_time_);
   }
-  working_time_ = working_time;
+  _impl_.working_time_ = working_time;
   if (working_time) {
     
   } else {
@@ -855,40 +868,48 @@ inline void Company::unsafe_arena_set_allocated_working_time(
 }
 inline ::YellowPages::WorkingTime* Company::release_working_time() {
   
-  ::YellowPages::WorkingTime* temp = working_time_;
-  working_time_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::YellowPages::WorkingTime* temp = _impl_.working_time_;
+  _impl_.working_time_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::YellowPages::WorkingTime* Company::unsafe_arena_release_working_time() {
   // @@protoc_insertion_point(field_release:YellowPages.Company.working_time)
   
-  ::YellowPages::WorkingTime* temp = working_time_;
-  working_time_ = nullptr;
+  ::YellowPages::WorkingTime* temp = _impl_.working_time_;
+  _impl_.working_time_ = nullptr;
   return temp;
 }
 inline ::YellowPages::WorkingTime* Company::_internal_mutable_working_time() {
   
-  if (working_time_ == nullptr) {
-    auto* p = CreateMaybeMessage<::YellowPages::WorkingTime>(GetArena());
-    working_time_ = p;
+  if (_impl_.working_time_ == nullptr) {
+    auto* p = CreateMaybeMessage<::YellowPages::WorkingTime>(GetArenaForAllocation());
+    _impl_.working_time_ = p;
   }
-  return working_time_;
+  return _impl_.working_time_;
 }
 inline ::YellowPages::WorkingTime* Company::mutable_working_time() {
+  ::YellowPages::WorkingTime* _msg = _internal_mutable_working_time();
   // @@protoc_insertion_point(field_mutable:YellowPages.Company.working_time)
-  return _internal_mutable_working_time();
+  return _msg;
 }
 inline void Company::set_allocated_working_time(::YellowPages::WorkingTime* working_time) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(working_time_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.working_time_);
   }
   if (working_time) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(working_time)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(working_time));
     if (message_arena != submessage_arena) {
       working_time = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, working_time, submessage_arena);
@@ -897,47 +918,48 @@ inline void Company::set_allocated_working_time(::YellowPages::WorkingTime* work
   } else {
     
   }
-  working_time_ = working_time;
+  _impl_.working_time_ = working_time;
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Company.working_time)
 }
 
 // repeated .YellowPages.NearbyStop nearby_stops = 7;
 inline int Company::_internal_nearby_stops_size() const {
-  return nearby_stops_.size();
+  return _impl_.nearby_stops_.size();
 }
 inline int Company::nearby_stops_size() const {
   return _internal_nearby_stops_size();
 }
 inline void Company::clear_nearby_stops() {
-  nearby_stops_.Clear();
+  _impl_.nearby_stops_.Clear();
 }
 inline ::YellowPages::NearbyStop* Company::mutable_nearby_stops(int index) {
   // @@protoc_insertion_point(field_mutable:YellowPages.Company.nearby_stops)
-  return nearby_stops_.Mutable(index);
+  return _impl_.nearby_stops_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::NearbyStop >*
 Company::mutable_nearby_stops() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.Company.nearby_stops)
-  return &nearby_stops_;
+  return &_impl_.nearby_stops_;
 }
 inline const ::YellowPages::NearbyStop& Company::_internal_nearby_stops(int index) const {
-  return nearby_stops_.Get(index);
+  return _impl_.nearby_stops_.Get(index);
 }
 inline const ::YellowPages::NearbyStop& Company::nearby_stops(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.Company.nearby_stops)
   return _internal_nearby_stops(index);
 }
 inline ::YellowPages::NearbyStop* Company::_internal_add_nearby_stops() {
-  return nearby_stops_.Add();
+  return _impl_.nearby_stops_.Add();
 }
 inline ::YellowPages::NearbyStop* Company::add_nearby_stops() {
+  ::YellowPages::NearbyStop* _add = _internal_add_nearby_stops();
   // @@protoc_insertion_point(field_add:YellowPages.Company.nearby_stops)
-  return _internal_add_nearby_stops();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::NearbyStop >&
 Company::nearby_stops() const {
   // @@protoc_insertion_point(field_list:YellowPages.Company.nearby_stops)
-  return nearby_stops_;
+  return _impl_.nearby_stops_;
 }
 
 #ifdef __GNUC__
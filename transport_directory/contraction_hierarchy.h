@@ -0,0 +1,364 @@
+#pragma once
+
+#include "graph.h"
+#include "graph.pb.h"
+#include "search_space.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace Graph {
+
+  // Contraction Hierarchies index over a DirectedWeightedGraph.
+  // Vertices are contracted one by one in the order of their importance;
+  // whenever the only shortest path between two neighbours of a contracted
+  // vertex goes through it, a shortcut arc is added. Queries are then answered
+  // by two searches that only move up the hierarchy and meet at the top.
+  //
+  // Arc ids below graph.GetEdgeCount() are the original edges,
+  // the rest are shortcuts, each made of two arcs.
+  template <typename Weight>
+  class ContractionHierarchy {
+  private:
+    using Graph = DirectedWeightedGraph<Weight>;
+    using ArcId = EdgeId;
+
+  public:
+    explicit ContractionHierarchy(const Graph& graph);
+
+    GraphProto::ContractionHierarchy Serialize() const;
+    ContractionHierarchy(const GraphProto::ContractionHierarchy& proto, const Graph& graph);
+
+    // Scratch space of one query, owned by the caller
+    struct QueryBuffers {
+      SearchSpace<Weight> forward_search;
+      SearchSpace<Weight> backward_search;
+      std::vector<ArcId> arc_stack;
+    };
+
+    // Appends the edges of the best route to edges and returns its weight
+    std::optional<Weight> FindRoute(VertexId from, VertexId to,
+                                    QueryBuffers& buffers, std::vector<EdgeId>& edges) const;
+
+  private:
+    const Graph& graph_;
+
+    struct Shortcut {
+      VertexId from;
+      VertexId to;
+      Weight weight;
+      ArcId first;
+      ArcId second;
+    };
+
+    std::vector<uint32_t> ranks_;
+    std::vector<Shortcut> shortcuts_;
+
+    // Arcs leading to higher-ranked vertices, grouped by their tail,
+    // and arcs coming from higher-ranked vertices, grouped by their head
+    std::vector<std::vector<ArcId>> upward_arcs_;
+    std::vector<std::vector<ArcId>> downward_arcs_;
+
+    VertexId GetArcFrom(ArcId arc) const;
+    VertexId GetArcTo(ArcId arc) const;
+    Weight GetArcWeight(ArcId arc) const;
+
+    void BuildSearchGraph();
+    // With reversed set, the edges of the arc are appended from last to first
+    void UnpackArc(ArcId arc, bool reversed, std::vector<ArcId>& stack, std::vector<EdgeId>& edges) const;
+
+    // Preprocessing
+
+    // Witness search gives up after settling this many vertices;
+    // a missed witness only costs a redundant shortcut
+    static constexpr size_t WITNESS_SEARCH_LIMIT = 256;
+
+    struct WorkingArc {
+      VertexId vertex;
+      Weight weight;
+      ArcId arc;
+    };
+    using WorkingArcs = std::vector<std::vector<WorkingArc>>;
+
+    struct Preprocessing {
+      WorkingArcs out_arcs;
+      WorkingArcs in_arcs;
+      std::vector<int> contracted_neighbours;
+      SearchSpace<Weight> witness_search;
+    };
+
+    void Contract(Preprocessing& state);
+    std::vector<Shortcut> FindShortcuts(Preprocessing& state, VertexId vertex) const;
+    int ComputePriority(Preprocessing& state, VertexId vertex) const;
+    void ContractVertex(Preprocessing& state, VertexId vertex);
+    static void AddWorkingArc(std::vector<WorkingArc>& arcs, WorkingArc arc);
+  };
+
+
+  template <typename Weight>
+  ContractionHierarchy<Weight>::ContractionHierarchy(const Graph& graph)
+    : graph_(graph),
+    ranks_(graph.GetVertexCount())
+  {
+    const size_t vertex_count = graph.GetVertexCount();
+    Preprocessing state{
+      .out_arcs = WorkingArcs(vertex_count),
+      .in_arcs = WorkingArcs(vertex_count),
+      .contracted_neighbours = std::vector<int>(vertex_count),
+      .witness_search = SearchSpace<Weight>(),
+    };
+    for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+      const auto& edge = graph.GetEdge(edge_id);
+      assert(edge.weight >= 0);
+      if (edge.from != edge.to) {
+        AddWorkingArc(state.out_arcs[edge.from], { edge.to, edge.weight, edge_id });
+        AddWorkingArc(state.in_arcs[edge.to], { edge.from, edge.weight, edge_id });
+      }
+    }
+    Contract(state);
+    BuildSearchGraph();
+  }
+
+  template <typename Weight>
+  void ContractionHierarchy<Weight>::AddWorkingArc(std::vector<WorkingArc>& arcs, WorkingArc arc) {
+    for (auto& present : arcs) {
+      if (present.vertex == arc.vertex) {
+        if (arc.weight < present.weight) {
+          present = arc;
+        }
+        return;
+      }
+    }
+    arcs.push_back(arc);
+  }
+
+  template <typename Weight>
+  std::vector<typename ContractionHierarchy<Weight>::Shortcut>
+  ContractionHierarchy<Weight>::FindShortcuts(Preprocessing& state, VertexId vertex) const {
+    std::vector<Shortcut> shortcuts;
+    const auto& out_arcs = state.out_arcs[vertex];
+    if (out_arcs.empty()) {
+      return shortcuts;
+    }
+    Weight max_out_weight = out_arcs.front().weight;
+    for (const auto& arc : out_arcs) {
+      max_out_weight = std::max(max_out_weight, arc.weight);
+    }
+
+    auto& search = state.witness_search;
+    for (const auto& in_arc : state.in_arcs[vertex]) {
+      const VertexId source = in_arc.vertex;
+      const Weight limit = in_arc.weight + max_out_weight;
+
+      search.Reset(graph_.GetVertexCount());
+      search.Relax(source, 0, std::nullopt);
+      size_t settled_count = 0;
+      while (const auto nearest = search.PopNearest()) {
+        const auto [weight, current] = *nearest;
+        if (limit < weight || ++settled_count > WITNESS_SEARCH_LIMIT) {
+          break;
+        }
+        for (const auto& arc : state.out_arcs[current]) {
+          if (arc.vertex != vertex) {
+            search.Relax(arc.vertex, weight + arc.weight, std::nullopt);
+          }
+        }
+      }
+
+      for (const auto& out_arc : out_arcs) {
+        const VertexId target = out_arc.vertex;
+        if (target == source) {
+          continue;
+        }
+        const Weight weight = in_arc.weight + out_arc.weight;
+        if (!search.IsReached(target) || weight < search.GetWeight(target)) {
+          shortcuts.push_back({ source, target, weight, in_arc.arc, out_arc.arc });
+        }
+      }
+    }
+    return shortcuts;
+  }
+
+  template <typename Weight>
+  int ContractionHierarchy<Weight>::ComputePriority(Preprocessing& state, VertexId vertex) const {
+    const int shortcut_count = static_cast<int>(FindShortcuts(state, vertex).size());
+    const int removed_count = static_cast<int>(state.in_arcs[vertex].size() + state.out_arcs[vertex].size());
+    return shortcut_count - removed_count + state.contracted_neighbours[vertex];
+  }
+
+  template <typename Weight>
+  void ContractionHierarchy<Weight>::ContractVertex(Preprocessing& state, VertexId vertex) {
+    for (const Shortcut& shortcut : FindShortcuts(state, vertex)) {
+      const ArcId arc = graph_.GetEdgeCount() + shortcuts_.size();
+      shortcuts_.push_back(shortcut);
+      AddWorkingArc(state.out_arcs[shortcut.from], { shortcut.to, shortcut.weight, arc });
+      AddWorkingArc(state.in_arcs[shortcut.to], { shortcut.from, shortcut.weight, arc });
+    }
+
+    const auto detach = [vertex](std::vector<WorkingArc>& arcs) {
+      arcs.erase(
+        std::remove_if(std::begin(arcs), std::end(arcs), [vertex](const WorkingArc& arc) { return arc.vertex == vertex; }),
+        std::end(arcs)
+      );
+    };
+    for (const auto& arc : state.in_arcs[vertex]) {
+      detach(state.out_arcs[arc.vertex]);
+      ++state.contracted_neighbours[arc.vertex];
+    }
+    for (const auto& arc : state.out_arcs[vertex]) {
+      detach(state.in_arcs[arc.vertex]);
+      ++state.contracted_neighbours[arc.vertex];
+    }
+    state.in_arcs[vertex].clear();
+    state.in_arcs[vertex].shrink_to_fit();
+    state.out_arcs[vertex].clear();
+    state.out_arcs[vertex].shrink_to_fit();
+  }
+
+  template <typename Weight>
+  void ContractionHierarchy<Weight>::Contract(Preprocessing& state) {
+    const size_t vertex_count = graph_.GetVertexCount();
+    using QueueItem = std::pair<int, VertexId>;
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<>> queue;
+    for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+      queue.emplace(ComputePriority(state, vertex), vertex);
+    }
+
+    uint32_t next_rank = 0;
+    while (!queue.empty()) {
+      const VertexId vertex = queue.top().second;
+      queue.pop();
+      // Priorities of the remaining vertices change as neighbours get contracted,
+      // so they are refreshed lazily when a vertex reaches the top
+      const int priority = ComputePriority(state, vertex);
+      if (!queue.empty() && priority > queue.top().first) {
+        queue.emplace(priority, vertex);
+        continue;
+      }
+      ContractVertex(state, vertex);
+      ranks_[vertex] = next_rank++;
+    }
+  }
+
+  template <typename Weight>
+  VertexId ContractionHierarchy<Weight>::GetArcFrom(ArcId arc) const {
+    return arc < graph_.GetEdgeCount() ? graph_.GetEdge(arc).from : shortcuts_[arc - graph_.GetEdgeCount()].from;
+  }
+
+  template <typename Weight>
+  VertexId ContractionHierarchy<Weight>::GetArcTo(ArcId arc) const {
+    return arc < graph_.GetEdgeCount() ? graph_.GetEdge(arc).to : shortcuts_[arc - graph_.GetEdgeCount()].to;
+  }
+
+  template <typename Weight>
+  Weight ContractionHierarchy<Weight>::GetArcWeight(ArcId arc) const {
+    return arc < graph_.GetEdgeCount() ? graph_.GetEdge(arc).weight : shortcuts_[arc - graph_.GetEdgeCount()].weight;
+  }
+
+  template <typename Weight>
+  void ContractionHierarchy<Weight>::BuildSearchGraph() {
+    const size_t vertex_count = graph_.GetVertexCount();
+    upward_arcs_.assign(vertex_count, {});
+    downward_arcs_.assign(vertex_count, {});
+    const ArcId arc_count = graph_.GetEdgeCount() + shortcuts_.size();
+    for (ArcId arc = 0; arc < arc_count; ++arc) {
+      const VertexId from = GetArcFrom(arc);
+      const VertexId to = GetArcTo(arc);
+      if (ranks_[from] < ranks_[to]) {
+        upward_arcs_[from].push_back(arc);
+      }
+      else if (ranks_[from] > ranks_[to]) {
+        downward_arcs_[to].push_back(arc);
+      }
+    }
+  }
+
+  template <typename Weight>
+  void ContractionHierarchy<Weight>::UnpackArc(ArcId arc, bool reversed,
+                                               std::vector<ArcId>& stack, std::vector<EdgeId>& edges) const {
+    stack.assign(1, arc);
+    while (!stack.empty()) {
+      const ArcId current = stack.back();
+      stack.pop_back();
+      if (current < graph_.GetEdgeCount()) {
+        edges.push_back(current);
+      }
+      else {
+        const Shortcut& shortcut = shortcuts_[current - graph_.GetEdgeCount()];
+        stack.push_back(reversed ? shortcut.first : shortcut.second);
+        stack.push_back(reversed ? shortcut.second : shortcut.first);
+      }
+    }
+  }
+
+  template <typename Weight>
+  std::optional<Weight> ContractionHierarchy<Weight>::FindRoute(VertexId from, VertexId to,
+                                                                QueryBuffers& buffers,
+                                                                std::vector<EdgeId>& edges) const {
+    auto& forward_search = buffers.forward_search;
+    auto& backward_search = buffers.backward_search;
+    const size_t vertex_count = graph_.GetVertexCount();
+    forward_search.Reset(vertex_count);
+    backward_search.Reset(vertex_count);
+    forward_search.Relax(from, 0, std::nullopt);
+    backward_search.Relax(to, 0, std::nullopt);
+
+    std::optional<Weight> best_weight;
+    VertexId meeting_vertex = from;
+
+    const auto step = [&](SearchSpace<Weight>& search, const SearchSpace<Weight>& opposite,
+                          const std::vector<std::vector<ArcId>>& arcs, bool forward) {
+      const auto [weight, vertex] = *search.PopNearest();
+      if (opposite.IsReached(vertex)) {
+        const Weight candidate_weight = weight + opposite.GetWeight(vertex);
+        if (!best_weight || candidate_weight < *best_weight) {
+          best_weight = candidate_weight;
+          meeting_vertex = vertex;
+        }
+      }
+      for (const ArcId arc : arcs[vertex]) {
+        search.Relax(forward ? GetArcTo(arc) : GetArcFrom(arc), weight + GetArcWeight(arc), arc);
+      }
+    };
+
+    // A direction is finished once its nearest vertex is not closer than the best route
+    const auto is_active = [&best_weight](const SearchSpace<Weight>& search) {
+      return search.HasQueued() && (!best_weight || search.GetNearestWeight() < *best_weight);
+    };
+
+    while (is_active(forward_search) || is_active(backward_search)) {
+      const bool forward_turn = !is_active(backward_search)
+        || (is_active(forward_search) && !(backward_search.GetNearestWeight() < forward_search.GetNearestWeight()));
+      if (forward_turn) {
+        step(forward_search, backward_search, upward_arcs_, true);
+      }
+      else {
+        step(backward_search, forward_search, downward_arcs_, false);
+      }
+    }
+
+    if (!best_weight) {
+      return std::nullopt;
+    }
+
+    // The forward half is walked from the meeting vertex back to the source,
+    // so it is unpacked in reverse and then flipped in place
+    const size_t route_begin = edges.size();
+    for (auto arc = forward_search.GetPrevEdge(meeting_vertex); arc; arc = forward_search.GetPrevEdge(GetArcFrom(*arc))) {
+      UnpackArc(*arc, true, buffers.arc_stack, edges);
+    }
+    std::reverse(std::begin(edges) + route_begin, std::end(edges));
+    for (auto arc = backward_search.GetPrevEdge(meeting_vertex); arc; arc = backward_search.GetPrevEdge(GetArcTo(*arc))) {
+      UnpackArc(*arc, false, buffers.arc_stack, edges);
+    }
+    return best_weight;
+  }
+
+}
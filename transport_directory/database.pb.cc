@@ -14,57 +14,50 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_company_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_Company_company_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_database_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Database_RubricsEntry_DoNotUse_database_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_rubric_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Rubric_rubric_2eproto;
-namespace YellowPages {
-class Database_RubricsEntry_DoNotUseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Database_RubricsEntry_DoNotUse> _instance;
-} _Database_RubricsEntry_DoNotUse_default_instance_;
-class DatabaseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Database> _instance;
-} _Database_default_instance_;
-}  // namespace YellowPages
-static void InitDefaultsscc_info_Database_database_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::YellowPages::_Database_default_instance_;
-    new (ptr) ::YellowPages::Database();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Database_database_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_Database_database_2eproto}, {
-      &scc_info_Company_company_2eproto.base,
-      &scc_info_Database_RubricsEntry_DoNotUse_database_2eproto.base,}};
-
-static void InitDefaultsscc_info_Database_RubricsEntry_DoNotUse_database_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::YellowPages::_Database_RubricsEntry_DoNotUse_default_instance_;
-    new (ptr) ::YellowPages::Database_RubricsEntry_DoNotUse();
-  }
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Database_RubricsEntry_DoNotUse_database_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Database_RubricsEntry_DoNotUse_database_2eproto}, {
-      &scc_info_Rubric_rubric_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_database_2eproto[2];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_database_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_database_2eproto = nullptr;
+namespace YellowPages {
+PROTOBUF_CONSTEXPR Database_RubricsEntry_DoNotUse::Database_RubricsEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct Database_RubricsEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Database_RubricsEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Database_RubricsEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    Database_RubricsEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Database_RubricsEntry_DoNotUseDefaultTypeInternal _Database_RubricsEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR Database::Database(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.companies_)*/{}
+  , /*decltype(_impl_.rubrics_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DatabaseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DatabaseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DatabaseDefaultTypeInternal() {}
+  union {
+    Database _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DatabaseDefaultTypeInternal _Database_default_instance_;
+}  // namespace YellowPages
+static ::_pb::Metadata file_level_metadata_database_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_database_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_database_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_database_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_database_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   PROTOBUF_FIELD_OFFSET(::YellowPages::Database_RubricsEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::YellowPages::Database_RubricsEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::YellowPages::Database_RubricsEntry_DoNotUse, key_),
   PROTOBUF_FIELD_OFFSET(::YellowPages::Database_RubricsEntry_DoNotUse, value_),
   0,
@@ -74,17 +67,18 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_database_2eproto::offsets[] PR
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Database, companies_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::Database, rubrics_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Database, _impl_.companies_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::Database, _impl_.rubrics_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, 7, sizeof(::YellowPages::Database_RubricsEntry_DoNotUse)},
-  { 9, -1, sizeof(::YellowPages::Database)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::YellowPages::Database_RubricsEntry_DoNotUse)},
+  { 10, -1, -1, sizeof(::YellowPages::Database)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::YellowPages::_Database_RubricsEntry_DoNotUse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::YellowPages::_Database_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::YellowPages::_Database_RubricsEntry_DoNotUse_default_instance_._instance,
+  &::YellowPages::_Database_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_database_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -96,24 +90,25 @@ const char descriptor_table_protodef_database_2eproto[] PROTOBUF_SECTION_VARIABL
   "lue\030\002 \001(\0132\023.YellowPages.Rubric:\0028\001b\006prot"
   "o3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_database_2eproto_deps[2] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_database_2eproto_deps[2] = {
   &::descriptor_table_company_2eproto,
   &::descriptor_table_rubric_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_database_2eproto_sccs[2] = {
-  &scc_info_Database_database_2eproto.base,
-  &scc_info_Database_RubricsEntry_DoNotUse_database_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_database_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_database_2eproto = {
-  false, false, descriptor_table_protodef_database_2eproto, "database.proto", 242,
-  &descriptor_table_database_2eproto_once, descriptor_table_database_2eproto_sccs, descriptor_table_database_2eproto_deps, 2, 2,
-  schemas, file_default_instances, TableStruct_database_2eproto::offsets,
-  file_level_metadata_database_2eproto, 2, file_level_enum_descriptors_database_2eproto, file_level_service_descriptors_database_2eproto,
+static ::_pbi::once_flag descriptor_table_database_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_database_2eproto = {
+    false, false, 242, descriptor_table_protodef_database_2eproto,
+    "database.proto",
+    &descriptor_table_database_2eproto_once, descriptor_table_database_2eproto_deps, 2, 2,
+    schemas, file_default_instances, TableStruct_database_2eproto::offsets,
+    file_level_metadata_database_2eproto, file_level_enum_descriptors_database_2eproto,
+    file_level_service_descriptors_database_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_database_2eproto_getter() {
+  return &descriptor_table_database_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_database_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_database_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_database_2eproto(&descriptor_table_database_2eproto);
 namespace YellowPages {
 
 // ===================================================================
@@ -125,13 +120,10 @@ void Database_RubricsEntry_DoNotUse::MergeFrom(const Database_RubricsEntry_DoNot
   MergeFromInternal(other);
 }
 ::PROTOBUF_NAMESPACE_ID::Metadata Database_RubricsEntry_DoNotUse::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_database_2eproto_getter, &descriptor_table_database_2eproto_once,
+      file_level_metadata_database_2eproto[0]);
 }
-void Database_RubricsEntry_DoNotUse::MergeFrom(
-    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
-  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
-}
-
 
 // ===================================================================
 
@@ -140,77 +132,89 @@ class Database::_Internal {
 };
 
 void Database::clear_companies() {
-  companies_.Clear();
+  _impl_.companies_.Clear();
 }
 void Database::clear_rubrics() {
-  rubrics_.Clear();
+  _impl_.rubrics_.Clear();
 }
-Database::Database(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  companies_(arena),
-  rubrics_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Database::Database(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &Database::ArenaDtor);
+  }
   // @@protoc_insertion_point(arena_constructor:YellowPages.Database)
 }
 Database::Database(const Database& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      companies_(from.companies_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Database* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.companies_){from._impl_.companies_}
+    , /*decltype(_impl_.rubrics_)*/{}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rubrics_.MergeFrom(from.rubrics_);
+  _this->_impl_.rubrics_.MergeFrom(from._impl_.rubrics_);
   // @@protoc_insertion_point(copy_constructor:YellowPages.Database)
 }
 
-void Database::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Database_database_2eproto.base);
+inline void Database::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.companies_){arena}
+    , /*decltype(_impl_.rubrics_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Database::~Database() {
   // @@protoc_insertion_point(destructor:YellowPages.Database)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Database::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Database::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.companies_.~RepeatedPtrField();
+  _impl_.rubrics_.Destruct();
+  _impl_.rubrics_.~MapField();
 }
 
 void Database::ArenaDtor(void* object) {
   Database* _this = reinterpret_cast< Database* >(object);
-  (void)_this;
-}
-void Database::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+  _this->_impl_.rubrics_.Destruct();
 }
 void Database::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Database& Database::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Database_database_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Database::Clear() {
 // @@protoc_insertion_point(message_clear_start:YellowPages.Database)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  companies_.Clear();
-  rubrics_.Clear();
+  _impl_.companies_.Clear();
+  _impl_.rubrics_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Database::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Database::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .YellowPages.Company companies = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -218,89 +222,78 @@ const char* Database::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::i
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // map<uint64, .YellowPages.Rubric> rubrics = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&rubrics_, ptr);
+            ptr = ctx->ParseMessage(&_impl_.rubrics_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Database::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Database::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:YellowPages.Database)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .YellowPages.Company companies = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_companies_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_companies_size()); i < n; i++) {
+    const auto& repfield = this->_internal_companies(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_companies(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // map<uint64, .YellowPages.Rubric> rubrics = 2;
   if (!this->_internal_rubrics().empty()) {
-    typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >::const_pointer
-        ConstPtr;
-    typedef ::PROTOBUF_NAMESPACE_ID::internal::SortItem< ::PROTOBUF_NAMESPACE_ID::uint64, ConstPtr > SortItem;
-    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByFirstField<SortItem> Less;
-
-    if (stream->IsSerializationDeterministic() &&
-        this->_internal_rubrics().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->_internal_rubrics().size()]);
-      typedef ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >::size_type size_type;
-      size_type n = 0;
-      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >::const_iterator
-          it = this->_internal_rubrics().begin();
-          it != this->_internal_rubrics().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      for (size_type i = 0; i < n; i++) {
-        target = Database_RubricsEntry_DoNotUse::Funcs::InternalSerialize(2, items[static_cast<ptrdiff_t>(i)].second->first, items[static_cast<ptrdiff_t>(i)].second->second, target, stream);
+    using MapType = ::_pb::Map<uint64_t, ::YellowPages::Rubric>;
+    using WireHelper = Database_RubricsEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_rubrics();
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterFlat<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
       }
     } else {
-      for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >::const_iterator
-          it = this->_internal_rubrics().begin();
-          it != this->_internal_rubrics().end(); ++it) {
-        target = Database_RubricsEntry_DoNotUse::Funcs::InternalSerialize(2, it->first, it->second, target, stream);
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
       }
     }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:YellowPages.Database)
@@ -311,13 +304,13 @@ size_t Database::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:YellowPages.Database)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .YellowPages.Company companies = 1;
   total_size += 1UL * this->_internal_companies_size();
-  for (const auto& msg : this->companies_) {
+  for (const auto& msg : this->_impl_.companies_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
@@ -325,52 +318,33 @@ size_t Database::ByteSizeLong() const {
   // map<uint64, .YellowPages.Rubric> rubrics = 2;
   total_size += 1 *
       ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_rubrics_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >::const_iterator
+  for (::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >::const_iterator
       it = this->_internal_rubrics().begin();
       it != this->_internal_rubrics().end(); ++it) {
     total_size += Database_RubricsEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Database::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:YellowPages.Database)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Database* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Database>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:YellowPages.Database)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:YellowPages.Database)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Database::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Database::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Database::GetClassData() const { return &_class_data_; }
 
-void Database::MergeFrom(const Database& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.Database)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  companies_.MergeFrom(from.companies_);
-  rubrics_.MergeFrom(from.rubrics_);
-}
+void Database::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Database*>(&to_msg);
+  auto& from = static_cast<const Database&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.Database)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Database::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:YellowPages.Database)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.companies_.MergeFrom(from._impl_.companies_);
+  _this->_impl_.rubrics_.MergeFrom(from._impl_.rubrics_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Database::CopyFrom(const Database& from) {
@@ -386,23 +360,26 @@ bool Database::IsInitialized() const {
 
 void Database::InternalSwap(Database* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  companies_.InternalSwap(&other->companies_);
-  rubrics_.Swap(&other->rubrics_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.companies_.InternalSwap(&other->_impl_.companies_);
+  _impl_.rubrics_.InternalSwap(&other->_impl_.rubrics_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Database::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_database_2eproto_getter, &descriptor_table_database_2eproto_once,
+      file_level_metadata_database_2eproto[1]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::YellowPages::Database_RubricsEntry_DoNotUse* Arena::CreateMaybeMessage< ::YellowPages::Database_RubricsEntry_DoNotUse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::YellowPages::Database_RubricsEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::YellowPages::Database_RubricsEntry_DoNotUse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::YellowPages::Database_RubricsEntry_DoNotUse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::YellowPages::Database* Arena::CreateMaybeMessage< ::YellowPages::Database >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::YellowPages::Database*
+Arena::CreateMaybeMessage< ::YellowPages::Database >(Arena* arena) {
   return Arena::CreateMessageInternal< ::YellowPages::Database >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -47,23 +46,15 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_database_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_database_2eproto;
 namespace YellowPages {
 class Database;
-class DatabaseDefaultTypeInternal;
+struct DatabaseDefaultTypeInternal;
 extern DatabaseDefaultTypeInternal _Database_default_instance_;
 class Database_RubricsEntry_DoNotUse;
-class Database_RubricsEntry_DoNotUseDefaultTypeInternal;
+struct Database_RubricsEntry_DoNotUseDefaultTypeInternal;
 extern Database_RubricsEntry_DoNotUseDefaultTypeInternal _Database_RubricsEntry_DoNotUse_default_instance_;
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
@@ -75,38 +66,35 @@ namespace YellowPages {
 // ===================================================================
 
 class Database_RubricsEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Database_RubricsEntry_DoNotUse, 
-    ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric,
+    uint64_t, ::YellowPages::Rubric,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> {
 public:
   typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<Database_RubricsEntry_DoNotUse, 
-    ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric,
+    uint64_t, ::YellowPages::Rubric,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> SuperType;
   Database_RubricsEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR Database_RubricsEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
   explicit Database_RubricsEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   void MergeFrom(const Database_RubricsEntry_DoNotUse& other);
   static const Database_RubricsEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const Database_RubricsEntry_DoNotUse*>(&_Database_RubricsEntry_DoNotUse_default_instance_); }
   static bool ValidateKey(void*) { return true; }
   static bool ValidateValue(void*) { return true; }
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_database_2eproto);
-    return ::descriptor_table_database_2eproto.file_level_metadata[0];
-  }
-
-  public:
+  friend struct ::TableStruct_database_2eproto;
 };
 
 // -------------------------------------------------------------------
 
-class Database PROTOBUF_FINAL :
+class Database final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.Database) */ {
  public:
   inline Database() : Database(nullptr) {}
-  virtual ~Database();
+  ~Database() override;
+  explicit PROTOBUF_CONSTEXPR Database(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Database(const Database& from);
   Database(Database&& from) noexcept
@@ -119,8 +107,13 @@ class Database PROTOBUF_FINAL :
     return *this;
   }
   inline Database& operator=(Database&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -131,13 +124,14 @@ class Database PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Database& default_instance() {
+    return *internal_default_instance();
   }
-  static const Database& default_instance();
-
   static inline const Database* internal_default_instance() {
     return reinterpret_cast<const Database*>(
                &_Database_default_instance_);
@@ -150,7 +144,12 @@ class Database PROTOBUF_FINAL :
   }
   inline void Swap(Database* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -158,56 +157,55 @@ class Database PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Database* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Database* New() const final {
-    return CreateMaybeMessage<Database>(nullptr);
-  }
-
-  Database* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Database* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Database>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Database& from);
-  void MergeFrom(const Database& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Database& from) {
+    Database::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Database* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.Database";
   }
   protected:
-  explicit Database(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Database(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_database_2eproto);
-    return ::descriptor_table_database_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -243,14 +241,14 @@ class Database PROTOBUF_FINAL :
   public:
   void clear_rubrics();
   private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >&
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >&
       _internal_rubrics() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >*
+  ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >*
       _internal_mutable_rubrics();
   public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >&
+  const ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >&
       rubrics() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >*
+  ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >*
       mutable_rubrics();
 
   // @@protoc_insertion_point(class_scope:YellowPages.Database)
@@ -260,13 +258,16 @@ class Database PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Company > companies_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      Database_RubricsEntry_DoNotUse,
-      ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> rubrics_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Company > companies_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        Database_RubricsEntry_DoNotUse,
+        uint64_t, ::YellowPages::Rubric,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_UINT64,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE> rubrics_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_database_2eproto;
 };
 // ===================================================================
@@ -284,61 +285,62 @@ class Database PROTOBUF_FINAL :
 
 // repeated .YellowPages.Company companies = 1;
 inline int Database::_internal_companies_size() const {
-  return companies_.size();
+  return _impl_.companies_.size();
 }
 inline int Database::companies_size() const {
   return _internal_companies_size();
 }
 inline ::YellowPages::Company* Database::mutable_companies(int index) {
   // @@protoc_insertion_point(field_mutable:YellowPages.Database.companies)
-  return companies_.Mutable(index);
+  return _impl_.companies_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Company >*
 Database::mutable_companies() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.Database.companies)
-  return &companies_;
+  return &_impl_.companies_;
 }
 inline const ::YellowPages::Company& Database::_internal_companies(int index) const {
-  return companies_.Get(index);
+  return _impl_.companies_.Get(index);
 }
 inline const ::YellowPages::Company& Database::companies(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.Database.companies)
   return _internal_companies(index);
 }
 inline ::YellowPages::Company* Database::_internal_add_companies() {
-  return companies_.Add();
+  return _impl_.companies_.Add();
 }
 inline ::YellowPages::Company* Database::add_companies() {
+  ::YellowPages::Company* _add = _internal_add_companies();
   // @@protoc_insertion_point(field_add:YellowPages.Database.companies)
-  return _internal_add_companies();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::Company >&
 Database::companies() const {
   // @@protoc_insertion_point(field_list:YellowPages.Database.companies)
-  return companies_;
+  return _impl_.companies_;
 }
 
 // map<uint64, .YellowPages.Rubric> rubrics = 2;
 inline int Database::_internal_rubrics_size() const {
-  return rubrics_.size();
+  return _impl_.rubrics_.size();
 }
 inline int Database::rubrics_size() const {
   return _internal_rubrics_size();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >&
 Database::_internal_rubrics() const {
-  return rubrics_.GetMap();
+  return _impl_.rubrics_.GetMap();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >&
 Database::rubrics() const {
   // @@protoc_insertion_point(field_map:YellowPages.Database.rubrics)
   return _internal_rubrics();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >*
 Database::_internal_mutable_rubrics() {
-  return rubrics_.MutableMap();
+  return _impl_.rubrics_.MutableMap();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< ::PROTOBUF_NAMESPACE_ID::uint64, ::YellowPages::Rubric >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< uint64_t, ::YellowPages::Rubric >*
 Database::mutable_rubrics() {
   // @@protoc_insertion_point(field_mutable_map:YellowPages.Database.rubrics)
   return _internal_mutable_rubrics();
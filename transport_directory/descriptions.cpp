@@ -4,9 +4,9 @@ using namespace std;
 
 namespace Descriptions {
 
-  Stop Stop::ParseFrom(const Json::Dict& attrs) {
+  Stop Stop::ParseFrom(const Json::DictView& attrs) {
     Stop stop = {
-        .name = attrs.at("name").AsString(),
+        .name = string(attrs.at("name").AsString()),
         .position = {
             .latitude = attrs.at("latitude").AsDouble(),
             .longitude = attrs.at("longitude").AsDouble(),
@@ -14,17 +14,17 @@ namespace Descriptions {
     };
     if (attrs.count("road_distances") > 0) {
       for (const auto& [neighbour_stop, distance_node] : attrs.at("road_distances").AsMap()) {
-        stop.distances[neighbour_stop] = distance_node.AsInt();
+        stop.distances[string(neighbour_stop)] = distance_node.AsInt();
       }
     }
     return stop;
   }
 
-  vector<string> ParseStops(const vector<Json::Node>& stop_nodes, bool is_roundtrip) {
+  vector<string> ParseStops(const Json::ArrayView& stop_nodes, bool is_roundtrip) {
     vector<string> stops;
     stops.reserve(stop_nodes.size());
-    for (const Json::Node& stop_node : stop_nodes) {
-      stops.push_back(stop_node.AsString());
+    for (const auto& stop_node : stop_nodes) {
+      stops.emplace_back(stop_node.AsString());
     }
     if (is_roundtrip || stops.size() <= 1) {
       return stops;
@@ -44,18 +44,18 @@ namespace Descriptions {
     }
   }
 
-  Bus Bus::ParseFrom(const Json::Dict& attrs) {
-    const auto& name = attrs.at("name").AsString();
+  Bus Bus::ParseFrom(const Json::DictView& attrs) {
+    string name(attrs.at("name").AsString());
     const auto& stops = attrs.at("stops").AsArray();
     const bool is_rnd = attrs.at("is_roundtrip").AsBool();
     if (stops.empty()) {
-      return Bus{ .name = name, .is_roundtrip = is_rnd };
+      return Bus{ .name = move(name), .is_roundtrip = is_rnd };
     }
     else {
       Bus bus{
-          .name = name,
+          .name = move(name),
           .stops = ParseStops(stops, is_rnd),
-          .endpoints = {stops.front().AsString(), stops.back().AsString()},
+          .endpoints = {string(stops.front().AsString()), string(stops.back().AsString())},
           .is_roundtrip = is_rnd
       };
       if (bus.endpoints.back() == bus.endpoints.front()) {
@@ -65,19 +65,12 @@ namespace Descriptions {
     }
   }
 
-  vector<InputQuery> ReadDescriptions(const vector<Json::Node>& nodes) {
-    vector<InputQuery> result;
-    result.reserve(nodes.size());
-
-    for (const Json::Node& node : nodes) {
-      const auto& node_dict = node.AsMap();
-      if (node_dict.at("type").AsString() == "Bus") {
-        result.push_back(Bus::ParseFrom(node_dict));
-      } else {
-        result.push_back(Stop::ParseFrom(node_dict));
-      }
+  InputQuery ReadDescription(const Json::DictView& attrs) {
+    if (attrs.at("type").AsString() == "Bus") {
+      return Bus::ParseFrom(attrs);
+    } else {
+      return Stop::ParseFrom(attrs);
     }
-    return result;
   }
   
   SetMap DefineNeighbors(const StopsDict& places, const BusesDict& buses) {
@@ -1,8 +1,9 @@
 #pragma once
 
-#include "json.h"
+#include "json_view.h"
 #include "sphere.h"
 
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -16,12 +17,12 @@ namespace Descriptions {
     Sphere::Point position;
     std::unordered_map<std::string, int> distances;
 
-    static Stop ParseFrom(const Json::Dict& attrs);
+    static Stop ParseFrom(const Json::DictView& attrs);
   };
 
   int ComputeStopsDistance(const Stop& lhs, const Stop& rhs);
 
-  std::vector<std::string> ParseStops(const std::vector<Json::Node>& stop_nodes, bool is_roundtrip);
+  std::vector<std::string> ParseStops(const Json::ArrayView& stop_nodes, bool is_roundtrip);
 
   struct Bus {
     std::string name;
@@ -29,12 +30,12 @@ namespace Descriptions {
     std::vector<std::string> endpoints;
     bool is_roundtrip;
 
-    static Bus ParseFrom(const Json::Dict& attrs);
+    static Bus ParseFrom(const Json::DictView& attrs);
   };
 
   using InputQuery = std::variant<Stop, Bus>;
 
-  std::vector<InputQuery> ReadDescriptions(const std::vector<Json::Node>& nodes);
+  InputQuery ReadDescription(const Json::DictView& attrs);
 
   template <typename Object>
   using Dict = std::map<std::string, std::unique_ptr<const Object>>;
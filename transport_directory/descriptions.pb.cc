@@ -14,81 +14,77 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_sphere_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Coords_sphere_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_descriptions_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StopDescription_DistancesEntry_DoNotUse_descriptions_2eproto;
-namespace TCProto {
-class BusDescriptionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BusDescription> _instance;
-} _BusDescription_default_instance_;
-class StopDescription_DistancesEntry_DoNotUseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StopDescription_DistancesEntry_DoNotUse> _instance;
-} _StopDescription_DistancesEntry_DoNotUse_default_instance_;
-class StopDescriptionDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StopDescription> _instance;
-} _StopDescription_default_instance_;
-}  // namespace TCProto
-static void InitDefaultsscc_info_BusDescription_descriptions_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_BusDescription_default_instance_;
-    new (ptr) ::TCProto::BusDescription();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BusDescription_descriptions_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_BusDescription_descriptions_2eproto}, {}};
-
-static void InitDefaultsscc_info_StopDescription_descriptions_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::TCProto::_StopDescription_default_instance_;
-    new (ptr) ::TCProto::StopDescription();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_StopDescription_descriptions_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_StopDescription_descriptions_2eproto}, {
-      &scc_info_Coords_sphere_2eproto.base,
-      &scc_info_StopDescription_DistancesEntry_DoNotUse_descriptions_2eproto.base,}};
-
-static void InitDefaultsscc_info_StopDescription_DistancesEntry_DoNotUse_descriptions_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_StopDescription_DistancesEntry_DoNotUse_default_instance_;
-    new (ptr) ::TCProto::StopDescription_DistancesEntry_DoNotUse();
-  }
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StopDescription_DistancesEntry_DoNotUse_descriptions_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_StopDescription_DistancesEntry_DoNotUse_descriptions_2eproto}, {}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_descriptions_2eproto[3];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_descriptions_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_descriptions_2eproto = nullptr;
+namespace TCProto {
+PROTOBUF_CONSTEXPR BusDescription::BusDescription(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stops_)*/{}
+  , /*decltype(_impl_.endpoints_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.is_roundtrip_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BusDescriptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BusDescriptionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BusDescriptionDefaultTypeInternal() {}
+  union {
+    BusDescription _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BusDescriptionDefaultTypeInternal _BusDescription_default_instance_;
+PROTOBUF_CONSTEXPR StopDescription_DistancesEntry_DoNotUse::StopDescription_DistancesEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct StopDescription_DistancesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StopDescription_DistancesEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StopDescription_DistancesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    StopDescription_DistancesEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopDescription_DistancesEntry_DoNotUseDefaultTypeInternal _StopDescription_DistancesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR StopDescription::StopDescription(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.distances_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.position_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StopDescriptionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StopDescriptionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StopDescriptionDefaultTypeInternal() {}
+  union {
+    StopDescription _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopDescriptionDefaultTypeInternal _StopDescription_default_instance_;
+}  // namespace TCProto
+static ::_pb::Metadata file_level_metadata_descriptions_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_descriptions_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_descriptions_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_descriptions_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_descriptions_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, name_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, stops_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, endpoints_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, is_roundtrip_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, _impl_.stops_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, _impl_.endpoints_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusDescription, _impl_.is_roundtrip_),
   PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription_DistancesEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription_DistancesEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription_DistancesEntry_DoNotUse, key_),
   PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription_DistancesEntry_DoNotUse, value_),
   0,
@@ -98,20 +94,21 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_descriptions_2eproto::offsets[
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription, name_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription, position_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription, distances_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopDescription, _impl_.distances_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::TCProto::BusDescription)},
-  { 9, 16, sizeof(::TCProto::StopDescription_DistancesEntry_DoNotUse)},
-  { 18, -1, sizeof(::TCProto::StopDescription)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::TCProto::BusDescription)},
+  { 10, 18, -1, sizeof(::TCProto::StopDescription_DistancesEntry_DoNotUse)},
+  { 20, -1, -1, sizeof(::TCProto::StopDescription)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_BusDescription_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_StopDescription_DistancesEntry_DoNotUse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_StopDescription_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TCProto::_BusDescription_default_instance_._instance,
+  &::TCProto::_StopDescription_DistancesEntry_DoNotUse_default_instance_._instance,
+  &::TCProto::_StopDescription_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_descriptions_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -125,24 +122,24 @@ const char descriptor_table_protodef_descriptions_2eproto[] PROTOBUF_SECTION_VAR
   "ry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\003:\0028\001b\006prot"
   "o3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_descriptions_2eproto_deps[1] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_descriptions_2eproto_deps[1] = {
   &::descriptor_table_sphere_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_descriptions_2eproto_sccs[3] = {
-  &scc_info_BusDescription_descriptions_2eproto.base,
-  &scc_info_StopDescription_descriptions_2eproto.base,
-  &scc_info_StopDescription_DistancesEntry_DoNotUse_descriptions_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_descriptions_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_descriptions_2eproto = {
-  false, false, descriptor_table_protodef_descriptions_2eproto, "descriptions.proto", 322,
-  &descriptor_table_descriptions_2eproto_once, descriptor_table_descriptions_2eproto_sccs, descriptor_table_descriptions_2eproto_deps, 3, 1,
-  schemas, file_default_instances, TableStruct_descriptions_2eproto::offsets,
-  file_level_metadata_descriptions_2eproto, 3, file_level_enum_descriptors_descriptions_2eproto, file_level_service_descriptors_descriptions_2eproto,
+static ::_pbi::once_flag descriptor_table_descriptions_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_descriptions_2eproto = {
+    false, false, 322, descriptor_table_protodef_descriptions_2eproto,
+    "descriptions.proto",
+    &descriptor_table_descriptions_2eproto_once, descriptor_table_descriptions_2eproto_deps, 1, 3,
+    schemas, file_default_instances, TableStruct_descriptions_2eproto::offsets,
+    file_level_metadata_descriptions_2eproto, file_level_enum_descriptors_descriptions_2eproto,
+    file_level_service_descriptors_descriptions_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_descriptions_2eproto_getter() {
+  return &descriptor_table_descriptions_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_descriptions_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_descriptions_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_descriptions_2eproto(&descriptor_table_descriptions_2eproto);
 namespace TCProto {
 
 // ===================================================================
@@ -151,154 +148,170 @@ class BusDescription::_Internal {
  public:
 };
 
-BusDescription::BusDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  stops_(arena),
-  endpoints_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+BusDescription::BusDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.BusDescription)
 }
 BusDescription::BusDescription(const BusDescription& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      stops_(from.stops_),
-      endpoints_(from.endpoints_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BusDescription* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){from._impl_.stops_}
+    , decltype(_impl_.endpoints_){from._impl_.endpoints_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.is_roundtrip_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
-  is_roundtrip_ = from.is_roundtrip_;
+  _this->_impl_.is_roundtrip_ = from._impl_.is_roundtrip_;
   // @@protoc_insertion_point(copy_constructor:TCProto.BusDescription)
 }
 
-void BusDescription::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BusDescription_descriptions_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  is_roundtrip_ = false;
+inline void BusDescription::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){arena}
+    , decltype(_impl_.endpoints_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.is_roundtrip_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BusDescription::~BusDescription() {
   // @@protoc_insertion_point(destructor:TCProto.BusDescription)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void BusDescription::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void BusDescription::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stops_.~RepeatedPtrField();
+  _impl_.endpoints_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
 }
 
-void BusDescription::ArenaDtor(void* object) {
-  BusDescription* _this = reinterpret_cast< BusDescription* >(object);
-  (void)_this;
-}
-void BusDescription::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void BusDescription::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const BusDescription& BusDescription::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BusDescription_descriptions_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void BusDescription::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.BusDescription)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stops_.Clear();
-  endpoints_.Clear();
-  name_.ClearToEmpty();
-  is_roundtrip_ = false;
+  _impl_.stops_.Clear();
+  _impl_.endpoints_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.is_roundtrip_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BusDescription::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BusDescription::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.BusDescription.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.BusDescription.name"));
+        } else
+          goto handle_unusual;
         continue;
       // repeated string stops = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
             auto str = _internal_add_stops();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.BusDescription.stops"));
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "TCProto.BusDescription.stops"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated string endpoints = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
             auto str = _internal_add_endpoints();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.BusDescription.endpoints"));
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "TCProto.BusDescription.endpoints"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool is_roundtrip = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          is_roundtrip_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.is_roundtrip_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* BusDescription::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* BusDescription::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.BusDescription)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -328,13 +341,13 @@ failure:
   }
 
   // bool is_roundtrip = 4;
-  if (this->is_roundtrip() != 0) {
+  if (this->_internal_is_roundtrip() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(4, this->_internal_is_roundtrip(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_is_roundtrip(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.BusDescription)
@@ -345,84 +358,65 @@ size_t BusDescription::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.BusDescription)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated string stops = 2;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(stops_.size());
-  for (int i = 0, n = stops_.size(); i < n; i++) {
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.stops_.size());
+  for (int i = 0, n = _impl_.stops_.size(); i < n; i++) {
     total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      stops_.Get(i));
+      _impl_.stops_.Get(i));
   }
 
   // repeated string endpoints = 3;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(endpoints_.size());
-  for (int i = 0, n = endpoints_.size(); i < n; i++) {
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.endpoints_.size());
+  for (int i = 0, n = _impl_.endpoints_.size(); i < n; i++) {
     total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      endpoints_.Get(i));
+      _impl_.endpoints_.Get(i));
   }
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
   // bool is_roundtrip = 4;
-  if (this->is_roundtrip() != 0) {
+  if (this->_internal_is_roundtrip() != 0) {
     total_size += 1 + 1;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void BusDescription::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.BusDescription)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BusDescription* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BusDescription>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.BusDescription)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.BusDescription)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BusDescription::MergeFrom(const BusDescription& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BusDescription)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BusDescription::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BusDescription::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BusDescription::GetClassData() const { return &_class_data_; }
+
+
+void BusDescription::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BusDescription*>(&to_msg);
+  auto& from = static_cast<const BusDescription&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BusDescription)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  stops_.MergeFrom(from.stops_);
-  endpoints_.MergeFrom(from.endpoints_);
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
+  _this->_impl_.endpoints_.MergeFrom(from._impl_.endpoints_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.is_roundtrip() != 0) {
-    _internal_set_is_roundtrip(from._internal_is_roundtrip());
+  if (from._internal_is_roundtrip() != 0) {
+    _this->_internal_set_is_roundtrip(from._internal_is_roundtrip());
   }
-}
-
-void BusDescription::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.BusDescription)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BusDescription::CopyFrom(const BusDescription& from) {
@@ -438,18 +432,24 @@ bool BusDescription::IsInitialized() const {
 
 void BusDescription::InternalSwap(BusDescription* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  stops_.InternalSwap(&other->stops_);
-  endpoints_.InternalSwap(&other->endpoints_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(is_roundtrip_, other->is_roundtrip_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stops_.InternalSwap(&other->_impl_.stops_);
+  _impl_.endpoints_.InternalSwap(&other->_impl_.endpoints_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.is_roundtrip_, other->_impl_.is_roundtrip_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata BusDescription::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_descriptions_2eproto_getter, &descriptor_table_descriptions_2eproto_once,
+      file_level_metadata_descriptions_2eproto[0]);
 }
 
-
 // ===================================================================
 
 StopDescription_DistancesEntry_DoNotUse::StopDescription_DistancesEntry_DoNotUse() {}
@@ -459,14 +459,11 @@ void StopDescription_DistancesEntry_DoNotUse::MergeFrom(const StopDescription_Di
   MergeFromInternal(other);
 }
 ::PROTOBUF_NAMESPACE_ID::Metadata StopDescription_DistancesEntry_DoNotUse::GetMetadata() const {
-  return GetMetadataStatic();
-}
-void StopDescription_DistancesEntry_DoNotUse::MergeFrom(
-    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
-  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_descriptions_2eproto_getter, &descriptor_table_descriptions_2eproto_once,
+      file_level_metadata_descriptions_2eproto[1]);
 }
 
-
 // ===================================================================
 
 class StopDescription::_Internal {
@@ -476,151 +473,173 @@ class StopDescription::_Internal {
 
 const ::SphereProto::Coords&
 StopDescription::_Internal::position(const StopDescription* msg) {
-  return *msg->position_;
+  return *msg->_impl_.position_;
 }
 void StopDescription::clear_position() {
-  if (GetArena() == nullptr && position_ != nullptr) {
-    delete position_;
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
 }
-StopDescription::StopDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  distances_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+StopDescription::StopDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &StopDescription::ArenaDtor);
+  }
   // @@protoc_insertion_point(arena_constructor:TCProto.StopDescription)
 }
 StopDescription::StopDescription(const StopDescription& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopDescription* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.distances_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.position_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  distances_.MergeFrom(from.distances_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _this->_impl_.distances_.MergeFrom(from._impl_.distances_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_position()) {
-    position_ = new ::SphereProto::Coords(*from.position_);
-  } else {
-    position_ = nullptr;
+    _this->_impl_.position_ = new ::SphereProto::Coords(*from._impl_.position_);
   }
   // @@protoc_insertion_point(copy_constructor:TCProto.StopDescription)
 }
 
-void StopDescription::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StopDescription_descriptions_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  position_ = nullptr;
+inline void StopDescription::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.distances_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.position_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 StopDescription::~StopDescription() {
   // @@protoc_insertion_point(destructor:TCProto.StopDescription)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void StopDescription::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete position_;
+inline void StopDescription::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.distances_.Destruct();
+  _impl_.distances_.~MapField();
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.position_;
 }
 
 void StopDescription::ArenaDtor(void* object) {
   StopDescription* _this = reinterpret_cast< StopDescription* >(object);
-  (void)_this;
-}
-void StopDescription::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+  _this->_impl_.distances_.Destruct();
 }
 void StopDescription::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const StopDescription& StopDescription::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StopDescription_descriptions_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void StopDescription::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.StopDescription)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  distances_.Clear();
-  name_.ClearToEmpty();
-  if (GetArena() == nullptr && position_ != nullptr) {
-    delete position_;
+  _impl_.distances_.Clear();
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.position_ != nullptr) {
+    delete _impl_.position_;
   }
-  position_ = nullptr;
+  _impl_.position_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StopDescription::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StopDescription::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.StopDescription.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.StopDescription.name"));
+        } else
+          goto handle_unusual;
         continue;
       // .SphereProto.Coords position = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // map<string, int64> distances = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&distances_, ptr);
+            ptr = ctx->ParseMessage(&_impl_.distances_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* StopDescription::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* StopDescription::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.StopDescription)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -630,56 +649,40 @@ failure:
   }
 
   // .SphereProto.Coords position = 2;
-  if (this->has_position()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_position()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::position(this), target, stream);
+      InternalWriteMessage(2, _Internal::position(this),
+        _Internal::position(this).GetCachedSize(), target, stream);
   }
 
   // map<string, int64> distances = 3;
   if (!this->_internal_distances().empty()) {
-    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >::const_pointer
-        ConstPtr;
-    typedef ConstPtr SortItem;
-    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
-    struct Utf8Check {
-      static void Check(ConstPtr p) {
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-          p->first.data(), static_cast<int>(p->first.length()),
-          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-          "TCProto.StopDescription.DistancesEntry.key");
-      }
+    using MapType = ::_pb::Map<std::string, int64_t>;
+    using WireHelper = StopDescription_DistancesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_distances();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "TCProto.StopDescription.DistancesEntry.key");
     };
 
-    if (stream->IsSerializationDeterministic() &&
-        this->_internal_distances().size() > 1) {
-      ::std::unique_ptr<SortItem[]> items(
-          new SortItem[this->_internal_distances().size()]);
-      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >::size_type size_type;
-      size_type n = 0;
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
-          it = this->_internal_distances().begin();
-          it != this->_internal_distances().end(); ++it, ++n) {
-        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
-      }
-      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
-      for (size_type i = 0; i < n; i++) {
-        target = StopDescription_DistancesEntry_DoNotUse::Funcs::InternalSerialize(3, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
-        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     } else {
-      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
-          it = this->_internal_distances().begin();
-          it != this->_internal_distances().end(); ++it) {
-        target = StopDescription_DistancesEntry_DoNotUse::Funcs::InternalSerialize(3, it->first, it->second, target, stream);
-        Utf8Check::Check(&(*it));
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+        check_utf8(entry);
       }
     }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.StopDescription)
@@ -690,78 +693,60 @@ size_t StopDescription::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.StopDescription)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // map<string, int64> distances = 3;
   total_size += 1 *
       ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_distances_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >::const_iterator
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >::const_iterator
       it = this->_internal_distances().begin();
       it != this->_internal_distances().end(); ++it) {
     total_size += StopDescription_DistancesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
   // .SphereProto.Coords position = 2;
-  if (this->has_position()) {
+  if (this->_internal_has_position()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *position_);
+        *_impl_.position_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void StopDescription::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.StopDescription)
-  GOOGLE_DCHECK_NE(&from, this);
-  const StopDescription* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StopDescription>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.StopDescription)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.StopDescription)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void StopDescription::MergeFrom(const StopDescription& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.StopDescription)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopDescription::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StopDescription::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopDescription::GetClassData() const { return &_class_data_; }
+
+
+void StopDescription::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopDescription*>(&to_msg);
+  auto& from = static_cast<const StopDescription&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.StopDescription)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  distances_.MergeFrom(from.distances_);
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  _this->_impl_.distances_.MergeFrom(from._impl_.distances_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.has_position()) {
-    _internal_mutable_position()->::SphereProto::Coords::MergeFrom(from._internal_position());
+  if (from._internal_has_position()) {
+    _this->_internal_mutable_position()->::SphereProto::Coords::MergeFrom(
+        from._internal_position());
   }
-}
-
-void StopDescription::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.StopDescription)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StopDescription::CopyFrom(const StopDescription& from) {
@@ -777,27 +762,36 @@ bool StopDescription::IsInitialized() const {
 
 void StopDescription::InternalSwap(StopDescription* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  distances_.Swap(&other->distances_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(position_, other->position_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.distances_.InternalSwap(&other->_impl_.distances_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.position_, other->_impl_.position_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StopDescription::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_descriptions_2eproto_getter, &descriptor_table_descriptions_2eproto_once,
+      file_level_metadata_descriptions_2eproto[2]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace TCProto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::TCProto::BusDescription* Arena::CreateMaybeMessage< ::TCProto::BusDescription >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::BusDescription*
+Arena::CreateMaybeMessage< ::TCProto::BusDescription >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::BusDescription >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::StopDescription_DistancesEntry_DoNotUse* Arena::CreateMaybeMessage< ::TCProto::StopDescription_DistancesEntry_DoNotUse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::StopDescription_DistancesEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::TCProto::StopDescription_DistancesEntry_DoNotUse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::StopDescription_DistancesEntry_DoNotUse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::StopDescription* Arena::CreateMaybeMessage< ::TCProto::StopDescription >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::StopDescription*
+Arena::CreateMaybeMessage< ::TCProto::StopDescription >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::StopDescription >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -46,26 +45,18 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_descriptions_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_descriptions_2eproto;
 namespace TCProto {
 class BusDescription;
-class BusDescriptionDefaultTypeInternal;
+struct BusDescriptionDefaultTypeInternal;
 extern BusDescriptionDefaultTypeInternal _BusDescription_default_instance_;
 class StopDescription;
-class StopDescriptionDefaultTypeInternal;
+struct StopDescriptionDefaultTypeInternal;
 extern StopDescriptionDefaultTypeInternal _StopDescription_default_instance_;
 class StopDescription_DistancesEntry_DoNotUse;
-class StopDescription_DistancesEntry_DoNotUseDefaultTypeInternal;
+struct StopDescription_DistancesEntry_DoNotUseDefaultTypeInternal;
 extern StopDescription_DistancesEntry_DoNotUseDefaultTypeInternal _StopDescription_DistancesEntry_DoNotUse_default_instance_;
 }  // namespace TCProto
 PROTOBUF_NAMESPACE_OPEN
@@ -77,11 +68,12 @@ namespace TCProto {
 
 // ===================================================================
 
-class BusDescription PROTOBUF_FINAL :
+class BusDescription final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.BusDescription) */ {
  public:
   inline BusDescription() : BusDescription(nullptr) {}
-  virtual ~BusDescription();
+  ~BusDescription() override;
+  explicit PROTOBUF_CONSTEXPR BusDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BusDescription(const BusDescription& from);
   BusDescription(BusDescription&& from) noexcept
@@ -94,8 +86,13 @@ class BusDescription PROTOBUF_FINAL :
     return *this;
   }
   inline BusDescription& operator=(BusDescription&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -106,13 +103,14 @@ class BusDescription PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BusDescription& default_instance() {
+    return *internal_default_instance();
   }
-  static const BusDescription& default_instance();
-
   static inline const BusDescription* internal_default_instance() {
     return reinterpret_cast<const BusDescription*>(
                &_BusDescription_default_instance_);
@@ -125,7 +123,12 @@ class BusDescription PROTOBUF_FINAL :
   }
   inline void Swap(BusDescription* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -133,56 +136,53 @@ class BusDescription PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(BusDescription* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BusDescription* New() const final {
-    return CreateMaybeMessage<BusDescription>(nullptr);
-  }
-
-  BusDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BusDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BusDescription>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BusDescription& from);
-  void MergeFrom(const BusDescription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BusDescription& from) {
+    BusDescription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BusDescription* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.BusDescription";
   }
   protected:
-  explicit BusDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BusDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_descriptions_2eproto);
-    return ::descriptor_table_descriptions_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -245,16 +245,14 @@ class BusDescription PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -274,25 +272,30 @@ class BusDescription PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> stops_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> endpoints_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  bool is_roundtrip_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> stops_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> endpoints_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    bool is_roundtrip_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_descriptions_2eproto;
 };
 // -------------------------------------------------------------------
 
 class StopDescription_DistancesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StopDescription_DistancesEntry_DoNotUse, 
-    std::string, ::PROTOBUF_NAMESPACE_ID::int64,
+    std::string, int64_t,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64> {
 public:
   typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<StopDescription_DistancesEntry_DoNotUse, 
-    std::string, ::PROTOBUF_NAMESPACE_ID::int64,
+    std::string, int64_t,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64> SuperType;
   StopDescription_DistancesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR StopDescription_DistancesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
   explicit StopDescription_DistancesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   void MergeFrom(const StopDescription_DistancesEntry_DoNotUse& other);
   static const StopDescription_DistancesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const StopDescription_DistancesEntry_DoNotUse*>(&_StopDescription_DistancesEntry_DoNotUse_default_instance_); }
@@ -300,24 +303,19 @@ public:
     return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "TCProto.StopDescription.DistancesEntry.key");
  }
   static bool ValidateValue(void*) { return true; }
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_descriptions_2eproto);
-    return ::descriptor_table_descriptions_2eproto.file_level_metadata[1];
-  }
-
-  public:
+  friend struct ::TableStruct_descriptions_2eproto;
 };
 
 // -------------------------------------------------------------------
 
-class StopDescription PROTOBUF_FINAL :
+class StopDescription final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.StopDescription) */ {
  public:
   inline StopDescription() : StopDescription(nullptr) {}
-  virtual ~StopDescription();
+  ~StopDescription() override;
+  explicit PROTOBUF_CONSTEXPR StopDescription(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StopDescription(const StopDescription& from);
   StopDescription(StopDescription&& from) noexcept
@@ -330,8 +328,13 @@ class StopDescription PROTOBUF_FINAL :
     return *this;
   }
   inline StopDescription& operator=(StopDescription&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -342,13 +345,14 @@ class StopDescription PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StopDescription& default_instance() {
+    return *internal_default_instance();
   }
-  static const StopDescription& default_instance();
-
   static inline const StopDescription* internal_default_instance() {
     return reinterpret_cast<const StopDescription*>(
                &_StopDescription_default_instance_);
@@ -361,7 +365,12 @@ class StopDescription PROTOBUF_FINAL :
   }
   inline void Swap(StopDescription* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -369,56 +378,55 @@ class StopDescription PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(StopDescription* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline StopDescription* New() const final {
-    return CreateMaybeMessage<StopDescription>(nullptr);
-  }
-
-  StopDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  StopDescription* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<StopDescription>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StopDescription& from);
-  void MergeFrom(const StopDescription& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StopDescription& from) {
+    StopDescription::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StopDescription* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.StopDescription";
   }
   protected:
-  explicit StopDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit StopDescription(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_descriptions_2eproto);
-    return ::descriptor_table_descriptions_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -437,29 +445,27 @@ class StopDescription PROTOBUF_FINAL :
   public:
   void clear_distances();
   private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >&
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >&
       _internal_distances() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >*
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >*
       _internal_mutable_distances();
   public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >&
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >&
       distances() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >*
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >*
       mutable_distances();
 
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -470,7 +476,7 @@ class StopDescription PROTOBUF_FINAL :
   public:
   void clear_position();
   const ::SphereProto::Coords& position() const;
-  ::SphereProto::Coords* release_position();
+  PROTOBUF_NODISCARD ::SphereProto::Coords* release_position();
   ::SphereProto::Coords* mutable_position();
   void set_allocated_position(::SphereProto::Coords* position);
   private:
@@ -488,14 +494,17 @@ class StopDescription PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      StopDescription_DistancesEntry_DoNotUse,
-      std::string, ::PROTOBUF_NAMESPACE_ID::int64,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64> distances_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::SphereProto::Coords* position_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        StopDescription_DistancesEntry_DoNotUse,
+        std::string, int64_t,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64> distances_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::SphereProto::Coords* position_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_descriptions_2eproto;
 };
 // ===================================================================
@@ -511,53 +520,38 @@ class StopDescription PROTOBUF_FINAL :
 
 // string name = 1;
 inline void BusDescription::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& BusDescription::name() const {
   // @@protoc_insertion_point(field_get:TCProto.BusDescription.name)
   return _internal_name();
 }
-inline void BusDescription::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BusDescription::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.BusDescription.name)
 }
 inline std::string* BusDescription::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:TCProto.BusDescription.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& BusDescription::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void BusDescription::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void BusDescription::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.BusDescription.name)
-}
-inline void BusDescription::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.BusDescription.name)
-}
-inline void BusDescription::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.BusDescription.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BusDescription::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BusDescription::release_name() {
   // @@protoc_insertion_point(field_release:TCProto.BusDescription.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void BusDescription::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -565,27 +559,32 @@ inline void BusDescription::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.BusDescription.name)
 }
 
 // repeated string stops = 2;
 inline int BusDescription::_internal_stops_size() const {
-  return stops_.size();
+  return _impl_.stops_.size();
 }
 inline int BusDescription::stops_size() const {
   return _internal_stops_size();
 }
 inline void BusDescription::clear_stops() {
-  stops_.Clear();
+  _impl_.stops_.Clear();
 }
 inline std::string* BusDescription::add_stops() {
+  std::string* _s = _internal_add_stops();
   // @@protoc_insertion_point(field_add_mutable:TCProto.BusDescription.stops)
-  return _internal_add_stops();
+  return _s;
 }
 inline const std::string& BusDescription::_internal_stops(int index) const {
-  return stops_.Get(index);
+  return _impl_.stops_.Get(index);
 }
 inline const std::string& BusDescription::stops(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.BusDescription.stops)
@@ -593,73 +592,74 @@ inline const std::string& BusDescription::stops(int index) const {
 }
 inline std::string* BusDescription::mutable_stops(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.BusDescription.stops)
-  return stops_.Mutable(index);
+  return _impl_.stops_.Mutable(index);
 }
 inline void BusDescription::set_stops(int index, const std::string& value) {
+  _impl_.stops_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:TCProto.BusDescription.stops)
-  stops_.Mutable(index)->assign(value);
 }
 inline void BusDescription::set_stops(int index, std::string&& value) {
+  _impl_.stops_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:TCProto.BusDescription.stops)
-  stops_.Mutable(index)->assign(std::move(value));
 }
 inline void BusDescription::set_stops(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  stops_.Mutable(index)->assign(value);
+  _impl_.stops_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:TCProto.BusDescription.stops)
 }
 inline void BusDescription::set_stops(int index, const char* value, size_t size) {
-  stops_.Mutable(index)->assign(
+  _impl_.stops_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:TCProto.BusDescription.stops)
 }
 inline std::string* BusDescription::_internal_add_stops() {
-  return stops_.Add();
+  return _impl_.stops_.Add();
 }
 inline void BusDescription::add_stops(const std::string& value) {
-  stops_.Add()->assign(value);
+  _impl_.stops_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:TCProto.BusDescription.stops)
 }
 inline void BusDescription::add_stops(std::string&& value) {
-  stops_.Add(std::move(value));
+  _impl_.stops_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:TCProto.BusDescription.stops)
 }
 inline void BusDescription::add_stops(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  stops_.Add()->assign(value);
+  _impl_.stops_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:TCProto.BusDescription.stops)
 }
 inline void BusDescription::add_stops(const char* value, size_t size) {
-  stops_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.stops_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:TCProto.BusDescription.stops)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 BusDescription::stops() const {
   // @@protoc_insertion_point(field_list:TCProto.BusDescription.stops)
-  return stops_;
+  return _impl_.stops_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 BusDescription::mutable_stops() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.BusDescription.stops)
-  return &stops_;
+  return &_impl_.stops_;
 }
 
 // repeated string endpoints = 3;
 inline int BusDescription::_internal_endpoints_size() const {
-  return endpoints_.size();
+  return _impl_.endpoints_.size();
 }
 inline int BusDescription::endpoints_size() const {
   return _internal_endpoints_size();
 }
 inline void BusDescription::clear_endpoints() {
-  endpoints_.Clear();
+  _impl_.endpoints_.Clear();
 }
 inline std::string* BusDescription::add_endpoints() {
+  std::string* _s = _internal_add_endpoints();
   // @@protoc_insertion_point(field_add_mutable:TCProto.BusDescription.endpoints)
-  return _internal_add_endpoints();
+  return _s;
 }
 inline const std::string& BusDescription::_internal_endpoints(int index) const {
-  return endpoints_.Get(index);
+  return _impl_.endpoints_.Get(index);
 }
 inline const std::string& BusDescription::endpoints(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.BusDescription.endpoints)
@@ -667,63 +667,63 @@ inline const std::string& BusDescription::endpoints(int index) const {
 }
 inline std::string* BusDescription::mutable_endpoints(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.BusDescription.endpoints)
-  return endpoints_.Mutable(index);
+  return _impl_.endpoints_.Mutable(index);
 }
 inline void BusDescription::set_endpoints(int index, const std::string& value) {
+  _impl_.endpoints_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:TCProto.BusDescription.endpoints)
-  endpoints_.Mutable(index)->assign(value);
 }
 inline void BusDescription::set_endpoints(int index, std::string&& value) {
+  _impl_.endpoints_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:TCProto.BusDescription.endpoints)
-  endpoints_.Mutable(index)->assign(std::move(value));
 }
 inline void BusDescription::set_endpoints(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  endpoints_.Mutable(index)->assign(value);
+  _impl_.endpoints_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:TCProto.BusDescription.endpoints)
 }
 inline void BusDescription::set_endpoints(int index, const char* value, size_t size) {
-  endpoints_.Mutable(index)->assign(
+  _impl_.endpoints_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:TCProto.BusDescription.endpoints)
 }
 inline std::string* BusDescription::_internal_add_endpoints() {
-  return endpoints_.Add();
+  return _impl_.endpoints_.Add();
 }
 inline void BusDescription::add_endpoints(const std::string& value) {
-  endpoints_.Add()->assign(value);
+  _impl_.endpoints_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:TCProto.BusDescription.endpoints)
 }
 inline void BusDescription::add_endpoints(std::string&& value) {
-  endpoints_.Add(std::move(value));
+  _impl_.endpoints_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:TCProto.BusDescription.endpoints)
 }
 inline void BusDescription::add_endpoints(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  endpoints_.Add()->assign(value);
+  _impl_.endpoints_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:TCProto.BusDescription.endpoints)
 }
 inline void BusDescription::add_endpoints(const char* value, size_t size) {
-  endpoints_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.endpoints_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:TCProto.BusDescription.endpoints)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 BusDescription::endpoints() const {
   // @@protoc_insertion_point(field_list:TCProto.BusDescription.endpoints)
-  return endpoints_;
+  return _impl_.endpoints_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 BusDescription::mutable_endpoints() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.BusDescription.endpoints)
-  return &endpoints_;
+  return &_impl_.endpoints_;
 }
 
 // bool is_roundtrip = 4;
 inline void BusDescription::clear_is_roundtrip() {
-  is_roundtrip_ = false;
+  _impl_.is_roundtrip_ = false;
 }
 inline bool BusDescription::_internal_is_roundtrip() const {
-  return is_roundtrip_;
+  return _impl_.is_roundtrip_;
 }
 inline bool BusDescription::is_roundtrip() const {
   // @@protoc_insertion_point(field_get:TCProto.BusDescription.is_roundtrip)
@@ -731,7 +731,7 @@ inline bool BusDescription::is_roundtrip() const {
 }
 inline void BusDescription::_internal_set_is_roundtrip(bool value) {
   
-  is_roundtrip_ = value;
+  _impl_.is_roundtrip_ = value;
 }
 inline void BusDescription::set_is_roundtrip(bool value) {
   _internal_set_is_roundtrip(value);
@@ -746,53 +746,38 @@ inline void BusDescription::set_is_roundtrip(bool value) {
 
 // string name = 1;
 inline void StopDescription::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& StopDescription::name() const {
   // @@protoc_insertion_point(field_get:TCProto.StopDescription.name)
   return _internal_name();
 }
-inline void StopDescription::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StopDescription::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.StopDescription.name)
 }
 inline std::string* StopDescription::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:TCProto.StopDescription.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& StopDescription::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void StopDescription::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void StopDescription::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.StopDescription.name)
-}
-inline void StopDescription::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.StopDescription.name)
-}
-inline void StopDescription::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.StopDescription.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* StopDescription::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* StopDescription::release_name() {
   // @@protoc_insertion_point(field_release:TCProto.StopDescription.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void StopDescription::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -800,20 +785,24 @@ inline void StopDescription::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.StopDescription.name)
 }
 
 // .SphereProto.Coords position = 2;
 inline bool StopDescription::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+  return this != internal_default_instance() && _impl_.position_ != nullptr;
 }
 inline bool StopDescription::has_position() const {
   return _internal_has_position();
 }
 inline const ::SphereProto::Coords& StopDescription::_internal_position() const {
-  const ::SphereProto::Coords* p = position_;
+  const ::SphereProto::Coords* p = _impl_.position_;
   return p != nullptr ? *p : reinterpret_cast<const ::SphereProto::Coords&>(
       ::SphereProto::_Coords_default_instance_);
 }
@@ -823,10 +812,10 @@ inline const ::SphereProto::Coords& StopDescription::position() const {
 }
 inline void StopDescription::unsafe_arena_set_allocated_position(
     ::SphereProto::Coords* position) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(position_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
   }
-  position_ = position;
+  _impl_.position_ = position;
   if (position) {
     
   } else {
@@ -836,40 +825,48 @@ inline void StopDescription::unsafe_arena_set_allocated_position(
 }
 inline ::SphereProto::Coords* StopDescription::release_position() {
   
-  ::SphereProto::Coords* temp = position_;
-  position_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::SphereProto::Coords* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::SphereProto::Coords* StopDescription::unsafe_arena_release_position() {
   // @@protoc_insertion_point(field_release:TCProto.StopDescription.position)
   
-  ::SphereProto::Coords* temp = position_;
-  position_ = nullptr;
+  ::SphereProto::Coords* temp = _impl_.position_;
+  _impl_.position_ = nullptr;
   return temp;
 }
 inline ::SphereProto::Coords* StopDescription::_internal_mutable_position() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::SphereProto::Coords>(GetArena());
-    position_ = p;
+  if (_impl_.position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SphereProto::Coords>(GetArenaForAllocation());
+    _impl_.position_ = p;
   }
-  return position_;
+  return _impl_.position_;
 }
 inline ::SphereProto::Coords* StopDescription::mutable_position() {
+  ::SphereProto::Coords* _msg = _internal_mutable_position();
   // @@protoc_insertion_point(field_mutable:TCProto.StopDescription.position)
-  return _internal_mutable_position();
+  return _msg;
 }
 inline void StopDescription::set_allocated_position(::SphereProto::Coords* position) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(position_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.position_);
   }
   if (position) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(position)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(position));
     if (message_arena != submessage_arena) {
       position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, position, submessage_arena);
@@ -878,34 +875,34 @@ inline void StopDescription::set_allocated_position(::SphereProto::Coords* posit
   } else {
     
   }
-  position_ = position;
+  _impl_.position_ = position;
   // @@protoc_insertion_point(field_set_allocated:TCProto.StopDescription.position)
 }
 
 // map<string, int64> distances = 3;
 inline int StopDescription::_internal_distances_size() const {
-  return distances_.size();
+  return _impl_.distances_.size();
 }
 inline int StopDescription::distances_size() const {
   return _internal_distances_size();
 }
 inline void StopDescription::clear_distances() {
-  distances_.Clear();
+  _impl_.distances_.Clear();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >&
 StopDescription::_internal_distances() const {
-  return distances_.GetMap();
+  return _impl_.distances_.GetMap();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >&
 StopDescription::distances() const {
   // @@protoc_insertion_point(field_map:TCProto.StopDescription.distances)
   return _internal_distances();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >*
 StopDescription::_internal_mutable_distances() {
-  return distances_.MutableMap();
+  return _impl_.distances_.MutableMap();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::PROTOBUF_NAMESPACE_ID::int64 >*
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, int64_t >*
 StopDescription::mutable_distances() {
   // @@protoc_insertion_point(field_mutable_map:TCProto.StopDescription.distances)
   return _internal_mutable_distances();
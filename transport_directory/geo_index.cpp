@@ -0,0 +1,178 @@
+#include "geo_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+using namespace std;
+
+namespace {
+  const double METERS_PER_DEGREE = Sphere::ConvertDegreesToRadians(1) * Sphere::EARTH_RADIUS;
+
+  // Length of a degree of longitude at the latitude, in meters
+  double LongitudeDegreeLength(double latitude) {
+    return METERS_PER_DEGREE * cos(Sphere::ConvertDegreesToRadians(latitude));
+  }
+
+  bool ByDistance(const GeoIndex::Neighbour& lhs, const GeoIndex::Neighbour& rhs) {
+    return tie(lhs.distance, lhs.name) < tie(rhs.distance, rhs.name);
+  }
+}
+
+// Cells are about square in meters and hold PLACES_PER_CELL places on average
+GeoIndex::GeoIndex(vector<Place> places) {
+  if (!places.empty()) {
+    const auto [bottom_it, top_it] = minmax_element(begin(places), end(places),
+      [](const Place& lhs, const Place& rhs) { return Sphere::ByLatitude(lhs.position, rhs.position); });
+    const auto [left_it, right_it] = minmax_element(begin(places), end(places),
+      [](const Place& lhs, const Place& rhs) { return Sphere::ByLongitude(lhs.position, rhs.position); });
+    min_latitude_ = bottom_it->position.latitude;
+    min_longitude_ = left_it->position.longitude;
+    const double latitude_extent = top_it->position.latitude - min_latitude_;
+    const double longitude_extent = right_it->position.longitude - min_longitude_;
+
+    const double height = latitude_extent * METERS_PER_DEGREE;
+    const double width = longitude_extent * LongitudeDegreeLength((min_latitude_ + top_it->position.latitude) / 2);
+    const double cell_count = max(1.0, static_cast<double>(places.size()) / PLACES_PER_CELL);
+    const double cell_side = height > 0 && width > 0 ? sqrt(height * width / cell_count) : max(height, width) / cell_count;
+    if (cell_side > 0) {
+      rows_ = clamp<size_t>(static_cast<size_t>(ceil(height / cell_side)), 1, MAX_SIDE);
+      cols_ = clamp<size_t>(static_cast<size_t>(ceil(width / cell_side)), 1, MAX_SIDE);
+    }
+    cell_latitude_ = latitude_extent > 0 ? latitude_extent / rows_ : 1;
+    cell_longitude_ = longitude_extent > 0 ? longitude_extent / cols_ : 1;
+  }
+
+  // Counting sort of the places by cell
+  vector<size_t> place_cells(places.size());
+  cell_starts_.assign(rows_ * cols_ + 1, 0);
+  for (size_t idx = 0; idx < places.size(); ++idx) {
+    place_cells[idx] = RowOf(places[idx].position.latitude) * cols_ + ColOf(places[idx].position.longitude);
+    ++cell_starts_[place_cells[idx] + 1];
+  }
+  for (size_t cell = 1; cell < cell_starts_.size(); ++cell) {
+    cell_starts_[cell] += cell_starts_[cell - 1];
+  }
+  vector<uint32_t> next = cell_starts_;
+  names_.resize(places.size());
+  positions_.resize(places.size());
+  for (size_t idx = 0; idx < places.size(); ++idx) {
+    const uint32_t position = next[place_cells[idx]]++;
+    names_[position] = move(places[idx].name);
+    positions_[position] = places[idx].position;
+  }
+
+  view_ = { cell_starts_.data(), positions_.data() };
+  ComputeMinCellSide();
+}
+
+GeoIndex::ArraysView GeoIndex::GetArrays() const {
+  return view_;
+}
+
+size_t GeoIndex::GetCellCount() const {
+  return rows_ * cols_;
+}
+
+size_t GeoIndex::GetPlaceCount() const {
+  return names_.size();
+}
+
+// Longitude degrees are the shortest at the latitude farthest from the equator
+void GeoIndex::ComputeMinCellSide() {
+  const double max_abs_latitude = max(abs(min_latitude_), abs(min_latitude_ + rows_ * cell_latitude_));
+  min_cell_side_ = min(cell_latitude_ * METERS_PER_DEGREE,
+    cell_longitude_ * max(0.0, LongitudeDegreeLength(min(max_abs_latitude, 90.0))));
+}
+
+size_t GeoIndex::RowOf(double latitude) const {
+  const double row = floor((latitude - min_latitude_) / cell_latitude_);
+  return static_cast<size_t>(clamp(row, 0.0, static_cast<double>(rows_ - 1)));
+}
+
+size_t GeoIndex::ColOf(double longitude) const {
+  const double col = floor((longitude - min_longitude_) / cell_longitude_);
+  return static_cast<size_t>(clamp(col, 0.0, static_cast<double>(cols_ - 1)));
+}
+
+void GeoIndex::CollectCell(size_t row, size_t col, Sphere::Point center, vector<Neighbour>& result) const {
+  const size_t cell = row * cols_ + col;
+  for (uint32_t idx = view_.cell_starts[cell]; idx < view_.cell_starts[cell + 1]; ++idx) {
+    result.push_back({ names_[idx], Sphere::Distance(center, view_.positions[idx]) });
+  }
+}
+
+vector<GeoIndex::Neighbour> GeoIndex::Find(const Query& query) const {
+  if (!query.count) {
+    return FindWithin(query.center, query.radius.value_or(0));
+  }
+  vector<Neighbour> result = FindNearest(query.center, *query.count);
+  if (query.radius) {
+    const double radius = *query.radius;
+    result.erase(find_if(begin(result), end(result), [radius](const Neighbour& item) { return item.distance > radius; }),
+      end(result));
+  }
+  return result;
+}
+
+// Only the cells of the bounding box of the circle are read
+vector<GeoIndex::Neighbour> GeoIndex::FindWithin(Sphere::Point center, double radius) const {
+  vector<Neighbour> result;
+  if (names_.empty() || radius < 0) {
+    return result;
+  }
+  const double latitude_delta = radius / METERS_PER_DEGREE;
+  const double longitude_degree = LongitudeDegreeLength(min(abs(center.latitude) + latitude_delta, 90.0));
+  const double longitude_delta = longitude_degree > radius / 180 ? radius / longitude_degree : 360;
+
+  for (size_t row = RowOf(center.latitude - latitude_delta); row <= RowOf(center.latitude + latitude_delta); ++row) {
+    for (size_t col = ColOf(center.longitude - longitude_delta); col <= ColOf(center.longitude + longitude_delta); ++col) {
+      CollectCell(row, col, center, result);
+    }
+  }
+  result.erase(remove_if(begin(result), end(result), [radius](const Neighbour& item) { return item.distance > radius; }),
+    end(result));
+  sort(begin(result), end(result), ByDistance);
+  return result;
+}
+
+// Rings of cells around the cell of the center are read until the places
+// found are enough and the next ring is sure to be farther than all of them
+vector<GeoIndex::Neighbour> GeoIndex::FindNearest(Sphere::Point center, size_t count) const {
+  vector<Neighbour> result;
+  if (names_.empty() || count == 0) {
+    return result;
+  }
+  const size_t center_row = RowOf(center.latitude);
+  const size_t center_col = ColOf(center.longitude);
+  const size_t max_ring = max({ center_row, rows_ - 1 - center_row, center_col, cols_ - 1 - center_col });
+
+  for (size_t ring = 0; ring <= max_ring; ++ring) {
+    const size_t first_row = center_row >= ring ? center_row - ring : 0;
+    const size_t last_row = min(center_row + ring, rows_ - 1);
+    const size_t first_col = center_col >= ring ? center_col - ring : 0;
+    const size_t last_col = min(center_col + ring, cols_ - 1);
+    for (size_t row = first_row; row <= last_row; ++row) {
+      const bool is_edge_row = row + ring == center_row || row == center_row + ring;
+      for (size_t col = first_col; col <= last_col; ++col) {
+        if (is_edge_row || col + ring == center_col || col == center_col + ring) {
+          CollectCell(row, col, center, result);
+        }
+      }
+    }
+
+    if (result.size() >= count) {
+      nth_element(begin(result), begin(result) + (count - 1), end(result), ByDistance);
+      // Any place of the next rings is at least ring whole cells away
+      if (ring * min_cell_side_ >= result[count - 1].distance) {
+        break;
+      }
+    }
+  }
+
+  sort(begin(result), end(result), ByDistance);
+  if (result.size() > count) {
+    result.resize(count);
+  }
+  return result;
+}
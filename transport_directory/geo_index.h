@@ -0,0 +1,81 @@
+#pragma once
+
+#include "sphere.h"
+#include "transport_catalog.pb.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Finds named places around a point on the sphere. Places are put into a
+// uniform grid over latitude and longitude with a few places per cell, so a
+// query reads only the cells around its point instead of every place.
+class GeoIndex {
+public:
+  struct Place {
+    std::string name;
+    Sphere::Point position;  // in degrees
+  };
+
+  explicit GeoIndex(std::vector<Place> places);
+
+  // The places within radius meters, or the count nearest ones, or the count
+  // nearest ones within radius
+  struct Query {
+    Sphere::Point center;
+    std::optional<double> radius;
+    std::optional<size_t> count;
+  };
+
+  struct Neighbour {
+    std::string_view name;
+    double distance;
+  };
+
+  // Nearest first; places at the same distance are ordered by name
+  std::vector<Neighbour> Find(const Query& query) const;
+
+  // The arrays may be big, so they are stored raw next to the proto
+  // and a loaded index uses them in place
+  struct ArraysView {
+    const uint32_t* cell_starts = nullptr;  // rows * cols + 1 items
+    const Sphere::Point* positions = nullptr;  // an item per name
+  };
+
+  TCProto::GeoIndex Serialize() const;
+  ArraysView GetArrays() const;
+  size_t GetCellCount() const;
+  size_t GetPlaceCount() const;
+  // The arrays must outlive the index
+  GeoIndex(const TCProto::GeoIndex& proto, ArraysView arrays);
+
+private:
+  static constexpr size_t PLACES_PER_CELL = 4;
+  static constexpr size_t MAX_SIDE = 1024;
+
+  double min_latitude_ = 0;
+  double min_longitude_ = 0;
+  double cell_latitude_ = 1;
+  double cell_longitude_ = 1;
+  size_t rows_ = 1;
+  size_t cols_ = 1;
+  // The smallest side of a cell in meters, for the bound of distances to far cells
+  double min_cell_side_ = 0;
+
+  std::vector<std::string> names_;
+  // Filled when the index is built, left empty when it is loaded
+  std::vector<uint32_t> cell_starts_;
+  std::vector<Sphere::Point> positions_;
+  // What queries read: either the vectors above or loaded arrays
+  ArraysView view_;
+
+  void ComputeMinCellSide();
+  size_t RowOf(double latitude) const;
+  size_t ColOf(double longitude) const;
+
+  void CollectCell(size_t row, size_t col, Sphere::Point center, std::vector<Neighbour>& result) const;
+  std::vector<Neighbour> FindWithin(Sphere::Point center, double radius) const;
+  std::vector<Neighbour> FindNearest(Sphere::Point center, size_t count) const;
+};
@@ -14,182 +14,178 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Edge_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IncidenceList_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RouteInternalData_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RoutesInternalDataByTarget_graph_2eproto;
-namespace GraphProto {
-class EdgeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Edge> _instance;
-} _Edge_default_instance_;
-class IncidenceListDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<IncidenceList> _instance;
-} _IncidenceList_default_instance_;
-class DirectedWeightedGraphDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DirectedWeightedGraph> _instance;
-} _DirectedWeightedGraph_default_instance_;
-class RouteInternalDataDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RouteInternalData> _instance;
-} _RouteInternalData_default_instance_;
-class RoutesInternalDataByTargetDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RoutesInternalDataByTarget> _instance;
-} _RoutesInternalDataByTarget_default_instance_;
-class RouterDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Router> _instance;
-} _Router_default_instance_;
-}  // namespace GraphProto
-static void InitDefaultsscc_info_DirectedWeightedGraph_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::GraphProto::_DirectedWeightedGraph_default_instance_;
-    new (ptr) ::GraphProto::DirectedWeightedGraph();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_DirectedWeightedGraph_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_DirectedWeightedGraph_graph_2eproto}, {
-      &scc_info_Edge_graph_2eproto.base,
-      &scc_info_IncidenceList_graph_2eproto.base,}};
-
-static void InitDefaultsscc_info_Edge_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::GraphProto::_Edge_default_instance_;
-    new (ptr) ::GraphProto::Edge();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Edge_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Edge_graph_2eproto}, {}};
 
-static void InitDefaultsscc_info_IncidenceList_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::GraphProto::_IncidenceList_default_instance_;
-    new (ptr) ::GraphProto::IncidenceList();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_IncidenceList_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_IncidenceList_graph_2eproto}, {}};
-
-static void InitDefaultsscc_info_RouteInternalData_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::GraphProto::_RouteInternalData_default_instance_;
-    new (ptr) ::GraphProto::RouteInternalData();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RouteInternalData_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RouteInternalData_graph_2eproto}, {}};
-
-static void InitDefaultsscc_info_Router_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::GraphProto::_Router_default_instance_;
-    new (ptr) ::GraphProto::Router();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Router_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Router_graph_2eproto}, {
-      &scc_info_RoutesInternalDataByTarget_graph_2eproto.base,}};
-
-static void InitDefaultsscc_info_RoutesInternalDataByTarget_graph_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::GraphProto::_RoutesInternalDataByTarget_default_instance_;
-    new (ptr) ::GraphProto::RoutesInternalDataByTarget();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_RoutesInternalDataByTarget_graph_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_RoutesInternalDataByTarget_graph_2eproto}, {
-      &scc_info_RouteInternalData_graph_2eproto.base,}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_graph_2eproto[6];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_graph_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_graph_2eproto = nullptr;
+namespace GraphProto {
+PROTOBUF_CONSTEXPR Edge::Edge(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_)*/0u
+  , /*decltype(_impl_.to_)*/0u
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EdgeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EdgeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EdgeDefaultTypeInternal() {}
+  union {
+    Edge _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeDefaultTypeInternal _Edge_default_instance_;
+PROTOBUF_CONSTEXPR IncidenceList::IncidenceList(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edge_ids_)*/{}
+  , /*decltype(_impl_._edge_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct IncidenceListDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IncidenceListDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IncidenceListDefaultTypeInternal() {}
+  union {
+    IncidenceList _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncidenceListDefaultTypeInternal _IncidenceList_default_instance_;
+PROTOBUF_CONSTEXPR DirectedWeightedGraph::DirectedWeightedGraph(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edges_)*/{}
+  , /*decltype(_impl_.incidence_lists_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DirectedWeightedGraphDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DirectedWeightedGraphDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DirectedWeightedGraphDefaultTypeInternal() {}
+  union {
+    DirectedWeightedGraph _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DirectedWeightedGraphDefaultTypeInternal _DirectedWeightedGraph_default_instance_;
+PROTOBUF_CONSTEXPR Shortcut::Shortcut(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_)*/0u
+  , /*decltype(_impl_.to_)*/0u
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_.first_)*/0u
+  , /*decltype(_impl_.second_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ShortcutDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShortcutDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShortcutDefaultTypeInternal() {}
+  union {
+    Shortcut _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShortcutDefaultTypeInternal _Shortcut_default_instance_;
+PROTOBUF_CONSTEXPR ContractionHierarchy::ContractionHierarchy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ranks_)*/{}
+  , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.shortcuts_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ContractionHierarchyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ContractionHierarchyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ContractionHierarchyDefaultTypeInternal() {}
+  union {
+    ContractionHierarchy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ContractionHierarchyDefaultTypeInternal _ContractionHierarchy_default_instance_;
+PROTOBUF_CONSTEXPR Router::Router(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hierarchy_)*/nullptr
+  , /*decltype(_impl_.strategy_)*/0
+  , /*decltype(_impl_.vertex_count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RouterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RouterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RouterDefaultTypeInternal() {}
+  union {
+    Router _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouterDefaultTypeInternal _Router_default_instance_;
+}  // namespace GraphProto
+static ::_pb::Metadata file_level_metadata_graph_2eproto[6];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_graph_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_graph_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_graph_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_graph_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::GraphProto::Edge, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::GraphProto::Edge, from_),
-  PROTOBUF_FIELD_OFFSET(::GraphProto::Edge, to_),
-  PROTOBUF_FIELD_OFFSET(::GraphProto::Edge, weight_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Edge, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Edge, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Edge, _impl_.weight_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::GraphProto::IncidenceList, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::GraphProto::IncidenceList, edge_ids_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GraphProto::IncidenceList, _impl_.edge_ids_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::GraphProto::DirectedWeightedGraph, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::GraphProto::DirectedWeightedGraph, edges_),
-  PROTOBUF_FIELD_OFFSET(::GraphProto::DirectedWeightedGraph, incidence_lists_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GraphProto::DirectedWeightedGraph, _impl_.edges_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::DirectedWeightedGraph, _impl_.incidence_lists_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::GraphProto::RouteInternalData, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Shortcut, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::GraphProto::RouteInternalData, exists_),
-  PROTOBUF_FIELD_OFFSET(::GraphProto::RouteInternalData, weight_),
-  PROTOBUF_FIELD_OFFSET(::GraphProto::RouteInternalData, has_prev_edge_),
-  PROTOBUF_FIELD_OFFSET(::GraphProto::RouteInternalData, prev_edge_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Shortcut, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Shortcut, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Shortcut, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Shortcut, _impl_.first_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Shortcut, _impl_.second_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::GraphProto::RoutesInternalDataByTarget, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::ContractionHierarchy, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::GraphProto::RoutesInternalDataByTarget, targets_data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GraphProto::ContractionHierarchy, _impl_.ranks_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::ContractionHierarchy, _impl_.shortcuts_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::GraphProto::Router, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::GraphProto::Router, sources_data_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Router, _impl_.strategy_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Router, _impl_.hierarchy_),
+  PROTOBUF_FIELD_OFFSET(::GraphProto::Router, _impl_.vertex_count_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::GraphProto::Edge)},
-  { 8, -1, sizeof(::GraphProto::IncidenceList)},
-  { 14, -1, sizeof(::GraphProto::DirectedWeightedGraph)},
-  { 21, -1, sizeof(::GraphProto::RouteInternalData)},
-  { 30, -1, sizeof(::GraphProto::RoutesInternalDataByTarget)},
-  { 36, -1, sizeof(::GraphProto::Router)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::GraphProto::Edge)},
+  { 9, -1, -1, sizeof(::GraphProto::IncidenceList)},
+  { 16, -1, -1, sizeof(::GraphProto::DirectedWeightedGraph)},
+  { 24, -1, -1, sizeof(::GraphProto::Shortcut)},
+  { 35, -1, -1, sizeof(::GraphProto::ContractionHierarchy)},
+  { 43, -1, -1, sizeof(::GraphProto::Router)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::GraphProto::_Edge_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::GraphProto::_IncidenceList_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::GraphProto::_DirectedWeightedGraph_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::GraphProto::_RouteInternalData_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::GraphProto::_RoutesInternalDataByTarget_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::GraphProto::_Router_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::GraphProto::_Edge_default_instance_._instance,
+  &::GraphProto::_IncidenceList_default_instance_._instance,
+  &::GraphProto::_DirectedWeightedGraph_default_instance_._instance,
+  &::GraphProto::_Shortcut_default_instance_._instance,
+  &::GraphProto::_ContractionHierarchy_default_instance_._instance,
+  &::GraphProto::_Router_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_graph_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -198,35 +194,57 @@ const char descriptor_table_protodef_graph_2eproto[] PROTOBUF_SECTION_VARIABLE(p
   "ncidenceList\022\020\n\010edge_ids\030\001 \003(\r\"l\n\025Direct"
   "edWeightedGraph\022\037\n\005edges\030\001 \003(\0132\020.GraphPr"
   "oto.Edge\0222\n\017incidence_lists\030\002 \003(\0132\031.Grap"
-  "hProto.IncidenceList\"]\n\021RouteInternalDat"
-  "a\022\016\n\006exists\030\001 \001(\010\022\016\n\006weight\030\002 \001(\001\022\025\n\rhas"
-  "_prev_edge\030\003 \001(\010\022\021\n\tprev_edge\030\004 \001(\r\"Q\n\032R"
-  "outesInternalDataByTarget\0223\n\014targets_dat"
-  "a\030\001 \003(\0132\035.GraphProto.RouteInternalData\"F"
-  "\n\006Router\022<\n\014sources_data\030\001 \003(\0132&.GraphPr"
-  "oto.RoutesInternalDataByTargetb\006proto3"
+  "hProto.IncidenceList\"S\n\010Shortcut\022\014\n\004from"
+  "\030\001 \001(\r\022\n\n\002to\030\002 \001(\r\022\016\n\006weight\030\003 \001(\001\022\r\n\005fi"
+  "rst\030\004 \001(\r\022\016\n\006second\030\005 \001(\r\"N\n\024Contraction"
+  "Hierarchy\022\r\n\005ranks\030\001 \003(\r\022\'\n\tshortcuts\030\002 "
+  "\003(\0132\024.GraphProto.Shortcut\"\332\001\n\006Router\022-\n\010"
+  "strategy\030\002 \001(\0162\033.GraphProto.Router.Strat"
+  "egy\0223\n\thierarchy\030\003 \001(\0132 .GraphProto.Cont"
+  "ractionHierarchy\022\024\n\014vertex_count\030\004 \001(\r\"D"
+  "\n\010Strategy\022\r\n\tALL_PAIRS\020\000\022\014\n\010DIJKSTRA\020\001\022"
+  "\033\n\027CONTRACTION_HIERARCHIES\020\002J\004\010\001\020\002J\004\010\005\020\006"
+  "J\004\010\006\020\007b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_graph_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_graph_2eproto_sccs[6] = {
-  &scc_info_DirectedWeightedGraph_graph_2eproto.base,
-  &scc_info_Edge_graph_2eproto.base,
-  &scc_info_IncidenceList_graph_2eproto.base,
-  &scc_info_RouteInternalData_graph_2eproto.base,
-  &scc_info_Router_graph_2eproto.base,
-  &scc_info_RoutesInternalDataByTarget_graph_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_graph_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_graph_2eproto = {
-  false, false, descriptor_table_protodef_graph_2eproto, "graph.proto", 478,
-  &descriptor_table_graph_2eproto_once, descriptor_table_graph_2eproto_sccs, descriptor_table_graph_2eproto_deps, 6, 0,
-  schemas, file_default_instances, TableStruct_graph_2eproto::offsets,
-  file_level_metadata_graph_2eproto, 6, file_level_enum_descriptors_graph_2eproto, file_level_service_descriptors_graph_2eproto,
+static ::_pbi::once_flag descriptor_table_graph_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_graph_2eproto = {
+    false, false, 614, descriptor_table_protodef_graph_2eproto,
+    "graph.proto",
+    &descriptor_table_graph_2eproto_once, nullptr, 0, 6,
+    schemas, file_default_instances, TableStruct_graph_2eproto::offsets,
+    file_level_metadata_graph_2eproto, file_level_enum_descriptors_graph_2eproto,
+    file_level_service_descriptors_graph_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_graph_2eproto_getter() {
+  return &descriptor_table_graph_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_graph_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_graph_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_graph_2eproto(&descriptor_table_graph_2eproto);
 namespace GraphProto {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Router_Strategy_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_graph_2eproto);
+  return file_level_enum_descriptors_graph_2eproto[0];
+}
+bool Router_Strategy_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Router_Strategy Router::ALL_PAIRS;
+constexpr Router_Strategy Router::DIJKSTRA;
+constexpr Router_Strategy Router::CONTRACTION_HIERARCHIES;
+constexpr Router_Strategy Router::Strategy_MIN;
+constexpr Router_Strategy Router::Strategy_MAX;
+constexpr int Router::Strategy_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
@@ -234,141 +252,152 @@ class Edge::_Internal {
  public:
 };
 
-Edge::Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Edge::Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:GraphProto.Edge)
 }
 Edge::Edge(const Edge& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Edge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){}
+    , decltype(_impl_.to_){}
+    , decltype(_impl_.weight_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&from_, &from.from_,
-    static_cast<size_t>(reinterpret_cast<char*>(&weight_) -
-    reinterpret_cast<char*>(&from_)) + sizeof(weight_));
+  ::memcpy(&_impl_.from_, &from._impl_.from_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.weight_) -
+    reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.weight_));
   // @@protoc_insertion_point(copy_constructor:GraphProto.Edge)
 }
 
-void Edge::SharedCtor() {
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&from_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&weight_) -
-      reinterpret_cast<char*>(&from_)) + sizeof(weight_));
+inline void Edge::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){0u}
+    , decltype(_impl_.to_){0u}
+    , decltype(_impl_.weight_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Edge::~Edge() {
   // @@protoc_insertion_point(destructor:GraphProto.Edge)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Edge::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Edge::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Edge::ArenaDtor(void* object) {
-  Edge* _this = reinterpret_cast< Edge* >(object);
-  (void)_this;
-}
-void Edge::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Edge::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Edge& Edge::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Edge_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Edge::Clear() {
 // @@protoc_insertion_point(message_clear_start:GraphProto.Edge)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&from_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&weight_) -
-      reinterpret_cast<char*>(&from_)) + sizeof(weight_));
+  ::memset(&_impl_.from_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.weight_) -
+      reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.weight_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Edge::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Edge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // uint32 from = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 to = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double weight = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25)) {
-          weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Edge::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Edge::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:GraphProto.Edge)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 from = 1;
-  if (this->from() != 0) {
+  if (this->_internal_from() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_from(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_from(), target);
   }
 
   // uint32 to = 2;
-  if (this->to() != 0) {
+  if (this->_internal_to() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_to(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_to(), target);
   }
 
   // double weight = 3;
-  if (!(this->weight() <= 0 && this->weight() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:GraphProto.Edge)
@@ -379,76 +408,61 @@ size_t Edge::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:GraphProto.Edge)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // uint32 from = 1;
-  if (this->from() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_from());
+  if (this->_internal_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from());
   }
 
   // uint32 to = 2;
-  if (this->to() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_to());
+  if (this->_internal_to() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_to());
   }
 
   // double weight = 3;
-  if (!(this->weight() <= 0 && this->weight() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
     total_size += 1 + 8;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Edge::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:GraphProto.Edge)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Edge* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Edge>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:GraphProto.Edge)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:GraphProto.Edge)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Edge::MergeFrom(const Edge& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.Edge)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Edge::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Edge::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Edge::GetClassData() const { return &_class_data_; }
+
+
+void Edge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Edge*>(&to_msg);
+  auto& from = static_cast<const Edge&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.Edge)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.from() != 0) {
-    _internal_set_from(from._internal_from());
+  if (from._internal_from() != 0) {
+    _this->_internal_set_from(from._internal_from());
   }
-  if (from.to() != 0) {
-    _internal_set_to(from._internal_to());
+  if (from._internal_to() != 0) {
+    _this->_internal_set_to(from._internal_to());
   }
-  if (!(from.weight() <= 0 && from.weight() >= 0)) {
-    _internal_set_weight(from._internal_weight());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = from._internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    _this->_internal_set_weight(from._internal_weight());
   }
-}
-
-void Edge::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:GraphProto.Edge)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Edge::CopyFrom(const Edge& from) {
@@ -464,126 +478,133 @@ bool Edge::IsInitialized() const {
 
 void Edge::InternalSwap(Edge* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Edge, weight_)
-      + sizeof(Edge::weight_)
-      - PROTOBUF_FIELD_OFFSET(Edge, from_)>(
-          reinterpret_cast<char*>(&from_),
-          reinterpret_cast<char*>(&other->from_));
+      PROTOBUF_FIELD_OFFSET(Edge, _impl_.weight_)
+      + sizeof(Edge::_impl_.weight_)
+      - PROTOBUF_FIELD_OFFSET(Edge, _impl_.from_)>(
+          reinterpret_cast<char*>(&_impl_.from_),
+          reinterpret_cast<char*>(&other->_impl_.from_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Edge::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[0]);
 }
 
-
 // ===================================================================
 
 class IncidenceList::_Internal {
  public:
 };
 
-IncidenceList::IncidenceList(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  edge_ids_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+IncidenceList::IncidenceList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:GraphProto.IncidenceList)
 }
 IncidenceList::IncidenceList(const IncidenceList& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      edge_ids_(from.edge_ids_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IncidenceList* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_ids_){from._impl_.edge_ids_}
+    , /*decltype(_impl_._edge_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:GraphProto.IncidenceList)
 }
 
-void IncidenceList::SharedCtor() {
+inline void IncidenceList::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_ids_){arena}
+    , /*decltype(_impl_._edge_ids_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 IncidenceList::~IncidenceList() {
   // @@protoc_insertion_point(destructor:GraphProto.IncidenceList)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void IncidenceList::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void IncidenceList::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.edge_ids_.~RepeatedField();
 }
 
-void IncidenceList::ArenaDtor(void* object) {
-  IncidenceList* _this = reinterpret_cast< IncidenceList* >(object);
-  (void)_this;
-}
-void IncidenceList::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void IncidenceList::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const IncidenceList& IncidenceList::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_IncidenceList_graph_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void IncidenceList::Clear() {
 // @@protoc_insertion_point(message_clear_start:GraphProto.IncidenceList)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  edge_ids_.Clear();
+  _impl_.edge_ids_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* IncidenceList::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* IncidenceList::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated uint32 edge_ids = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_edge_ids(), ptr, ctx);
           CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
+        } else if (static_cast<uint8_t>(tag) == 8) {
           _internal_add_edge_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* IncidenceList::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* IncidenceList::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:GraphProto.IncidenceList)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated uint32 edge_ids = 1;
   {
-    int byte_size = _edge_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    int byte_size = _impl_._edge_ids_cached_byte_size_.load(std::memory_order_relaxed);
     if (byte_size > 0) {
       target = stream->WriteUInt32Packed(
           1, _internal_edge_ids(), byte_size, target);
@@ -591,7 +612,7 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:GraphProto.IncidenceList)
@@ -602,64 +623,44 @@ size_t IncidenceList::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:GraphProto.IncidenceList)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated uint32 edge_ids = 1;
   {
-    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      UInt32Size(this->edge_ids_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.edge_ids_);
     if (data_size > 0) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _edge_ids_cached_byte_size_.store(cached_size,
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._edge_ids_cached_byte_size_.store(cached_size,
                                     std::memory_order_relaxed);
     total_size += data_size;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void IncidenceList::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:GraphProto.IncidenceList)
-  GOOGLE_DCHECK_NE(&from, this);
-  const IncidenceList* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<IncidenceList>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:GraphProto.IncidenceList)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:GraphProto.IncidenceList)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void IncidenceList::MergeFrom(const IncidenceList& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.IncidenceList)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IncidenceList::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IncidenceList::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IncidenceList::GetClassData() const { return &_class_data_; }
 
-  edge_ids_.MergeFrom(from.edge_ids_);
-}
 
-void IncidenceList::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:GraphProto.IncidenceList)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void IncidenceList::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IncidenceList*>(&to_msg);
+  auto& from = static_cast<const IncidenceList&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.IncidenceList)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.edge_ids_.MergeFrom(from._impl_.edge_ids_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IncidenceList::CopyFrom(const IncidenceList& from) {
@@ -675,87 +676,90 @@ bool IncidenceList::IsInitialized() const {
 
 void IncidenceList::InternalSwap(IncidenceList* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  edge_ids_.InternalSwap(&other->edge_ids_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.edge_ids_.InternalSwap(&other->_impl_.edge_ids_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata IncidenceList::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[1]);
 }
 
-
 // ===================================================================
 
 class DirectedWeightedGraph::_Internal {
  public:
 };
 
-DirectedWeightedGraph::DirectedWeightedGraph(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  edges_(arena),
-  incidence_lists_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+DirectedWeightedGraph::DirectedWeightedGraph(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:GraphProto.DirectedWeightedGraph)
 }
 DirectedWeightedGraph::DirectedWeightedGraph(const DirectedWeightedGraph& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      edges_(from.edges_),
-      incidence_lists_(from.incidence_lists_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DirectedWeightedGraph* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edges_){from._impl_.edges_}
+    , decltype(_impl_.incidence_lists_){from._impl_.incidence_lists_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:GraphProto.DirectedWeightedGraph)
 }
 
-void DirectedWeightedGraph::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DirectedWeightedGraph_graph_2eproto.base);
+inline void DirectedWeightedGraph::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edges_){arena}
+    , decltype(_impl_.incidence_lists_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DirectedWeightedGraph::~DirectedWeightedGraph() {
   // @@protoc_insertion_point(destructor:GraphProto.DirectedWeightedGraph)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void DirectedWeightedGraph::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void DirectedWeightedGraph::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.edges_.~RepeatedPtrField();
+  _impl_.incidence_lists_.~RepeatedPtrField();
 }
 
-void DirectedWeightedGraph::ArenaDtor(void* object) {
-  DirectedWeightedGraph* _this = reinterpret_cast< DirectedWeightedGraph* >(object);
-  (void)_this;
-}
-void DirectedWeightedGraph::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void DirectedWeightedGraph::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const DirectedWeightedGraph& DirectedWeightedGraph::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DirectedWeightedGraph_graph_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void DirectedWeightedGraph::Clear() {
 // @@protoc_insertion_point(message_clear_start:GraphProto.DirectedWeightedGraph)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  edges_.Clear();
-  incidence_lists_.Clear();
+  _impl_.edges_.Clear();
+  _impl_.incidence_lists_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* DirectedWeightedGraph::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DirectedWeightedGraph::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .GraphProto.Edge edges = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -763,11 +767,12 @@ const char* DirectedWeightedGraph::_InternalParse(const char* ptr, ::PROTOBUF_NA
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .GraphProto.IncidenceList incidence_lists = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -775,54 +780,56 @@ const char* DirectedWeightedGraph::_InternalParse(const char* ptr, ::PROTOBUF_NA
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* DirectedWeightedGraph::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* DirectedWeightedGraph::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:GraphProto.DirectedWeightedGraph)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .GraphProto.Edge edges = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_edges_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_edges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_edges(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_edges(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .GraphProto.IncidenceList incidence_lists = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_incidence_lists_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_incidence_lists_size()); i < n; i++) {
+    const auto& repfield = this->_internal_incidence_lists(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_incidence_lists(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:GraphProto.DirectedWeightedGraph)
@@ -833,64 +840,45 @@ size_t DirectedWeightedGraph::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:GraphProto.DirectedWeightedGraph)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .GraphProto.Edge edges = 1;
   total_size += 1UL * this->_internal_edges_size();
-  for (const auto& msg : this->edges_) {
+  for (const auto& msg : this->_impl_.edges_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .GraphProto.IncidenceList incidence_lists = 2;
   total_size += 1UL * this->_internal_incidence_lists_size();
-  for (const auto& msg : this->incidence_lists_) {
+  for (const auto& msg : this->_impl_.incidence_lists_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void DirectedWeightedGraph::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:GraphProto.DirectedWeightedGraph)
-  GOOGLE_DCHECK_NE(&from, this);
-  const DirectedWeightedGraph* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DirectedWeightedGraph>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:GraphProto.DirectedWeightedGraph)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:GraphProto.DirectedWeightedGraph)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DirectedWeightedGraph::MergeFrom(const DirectedWeightedGraph& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.DirectedWeightedGraph)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DirectedWeightedGraph::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DirectedWeightedGraph::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DirectedWeightedGraph::GetClassData() const { return &_class_data_; }
 
-  edges_.MergeFrom(from.edges_);
-  incidence_lists_.MergeFrom(from.incidence_lists_);
-}
 
-void DirectedWeightedGraph::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:GraphProto.DirectedWeightedGraph)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void DirectedWeightedGraph::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DirectedWeightedGraph*>(&to_msg);
+  auto& from = static_cast<const DirectedWeightedGraph&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.DirectedWeightedGraph)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.edges_.MergeFrom(from._impl_.edges_);
+  _this->_impl_.incidence_lists_.MergeFrom(from._impl_.incidence_lists_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DirectedWeightedGraph::CopyFrom(const DirectedWeightedGraph& from) {
@@ -906,601 +894,703 @@ bool DirectedWeightedGraph::IsInitialized() const {
 
 void DirectedWeightedGraph::InternalSwap(DirectedWeightedGraph* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  edges_.InternalSwap(&other->edges_);
-  incidence_lists_.InternalSwap(&other->incidence_lists_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.edges_.InternalSwap(&other->_impl_.edges_);
+  _impl_.incidence_lists_.InternalSwap(&other->_impl_.incidence_lists_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata DirectedWeightedGraph::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[2]);
 }
 
-
 // ===================================================================
 
-class RouteInternalData::_Internal {
+class Shortcut::_Internal {
  public:
 };
 
-RouteInternalData::RouteInternalData(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:GraphProto.RouteInternalData)
+Shortcut::Shortcut(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:GraphProto.Shortcut)
 }
-RouteInternalData::RouteInternalData(const RouteInternalData& from)
+Shortcut::Shortcut(const Shortcut& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&weight_, &from.weight_,
-    static_cast<size_t>(reinterpret_cast<char*>(&prev_edge_) -
-    reinterpret_cast<char*>(&weight_)) + sizeof(prev_edge_));
-  // @@protoc_insertion_point(copy_constructor:GraphProto.RouteInternalData)
-}
+  Shortcut* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){}
+    , decltype(_impl_.to_){}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.first_){}
+    , decltype(_impl_.second_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-void RouteInternalData::SharedCtor() {
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&weight_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&prev_edge_) -
-      reinterpret_cast<char*>(&weight_)) + sizeof(prev_edge_));
-}
-
-RouteInternalData::~RouteInternalData() {
-  // @@protoc_insertion_point(destructor:GraphProto.RouteInternalData)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.from_, &from._impl_.from_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.second_) -
+    reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.second_));
+  // @@protoc_insertion_point(copy_constructor:GraphProto.Shortcut)
+}
+
+inline void Shortcut::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){0u}
+    , decltype(_impl_.to_){0u}
+    , decltype(_impl_.weight_){0}
+    , decltype(_impl_.first_){0u}
+    , decltype(_impl_.second_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Shortcut::~Shortcut() {
+  // @@protoc_insertion_point(destructor:GraphProto.Shortcut)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RouteInternalData::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Shortcut::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RouteInternalData::ArenaDtor(void* object) {
-  RouteInternalData* _this = reinterpret_cast< RouteInternalData* >(object);
-  (void)_this;
+void Shortcut::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-void RouteInternalData::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void RouteInternalData::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RouteInternalData& RouteInternalData::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RouteInternalData_graph_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void RouteInternalData::Clear() {
-// @@protoc_insertion_point(message_clear_start:GraphProto.RouteInternalData)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Shortcut::Clear() {
+// @@protoc_insertion_point(message_clear_start:GraphProto.Shortcut)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&weight_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&prev_edge_) -
-      reinterpret_cast<char*>(&weight_)) + sizeof(prev_edge_));
+  ::memset(&_impl_.from_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.second_) -
+      reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.second_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RouteInternalData::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Shortcut::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bool exists = 1;
+      // uint32 from = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          exists_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // double weight = 2;
+      // uint32 to = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
-          weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // bool has_prev_edge = 3;
+      // double weight = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          has_prev_edge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
         continue;
-      // uint32 prev_edge = 4;
+      // uint32 first = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          prev_edge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.first_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 second = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.second_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RouteInternalData::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:GraphProto.RouteInternalData)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Shortcut::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:GraphProto.Shortcut)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bool exists = 1;
-  if (this->exists() != 0) {
+  // uint32 from = 1;
+  if (this->_internal_from() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_from(), target);
+  }
+
+  // uint32 to = 2;
+  if (this->_internal_to() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(1, this->_internal_exists(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_to(), target);
   }
 
-  // double weight = 2;
-  if (!(this->weight() <= 0 && this->weight() >= 0)) {
+  // double weight = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_weight(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
   }
 
-  // bool has_prev_edge = 3;
-  if (this->has_prev_edge() != 0) {
+  // uint32 first = 4;
+  if (this->_internal_first() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->_internal_has_prev_edge(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_first(), target);
   }
 
-  // uint32 prev_edge = 4;
-  if (this->prev_edge() != 0) {
+  // uint32 second = 5;
+  if (this->_internal_second() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_prev_edge(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_second(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:GraphProto.RouteInternalData)
+  // @@protoc_insertion_point(serialize_to_array_end:GraphProto.Shortcut)
   return target;
 }
 
-size_t RouteInternalData::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:GraphProto.RouteInternalData)
+size_t Shortcut::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:GraphProto.Shortcut)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // double weight = 2;
-  if (!(this->weight() <= 0 && this->weight() >= 0)) {
-    total_size += 1 + 8;
+  // uint32 from = 1;
+  if (this->_internal_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from());
   }
 
-  // bool exists = 1;
-  if (this->exists() != 0) {
-    total_size += 1 + 1;
+  // uint32 to = 2;
+  if (this->_internal_to() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_to());
   }
 
-  // bool has_prev_edge = 3;
-  if (this->has_prev_edge() != 0) {
-    total_size += 1 + 1;
+  // double weight = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    total_size += 1 + 8;
   }
 
-  // uint32 prev_edge = 4;
-  if (this->prev_edge() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_prev_edge());
+  // uint32 first = 4;
+  if (this->_internal_first() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_first());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void RouteInternalData::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:GraphProto.RouteInternalData)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RouteInternalData* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RouteInternalData>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:GraphProto.RouteInternalData)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:GraphProto.RouteInternalData)
-    MergeFrom(*source);
+  // uint32 second = 5;
+  if (this->_internal_second() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_second());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RouteInternalData::MergeFrom(const RouteInternalData& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.RouteInternalData)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Shortcut::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Shortcut::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Shortcut::GetClassData() const { return &_class_data_; }
+
+
+void Shortcut::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Shortcut*>(&to_msg);
+  auto& from = static_cast<const Shortcut&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.Shortcut)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.weight() <= 0 && from.weight() >= 0)) {
-    _internal_set_weight(from._internal_weight());
+  if (from._internal_from() != 0) {
+    _this->_internal_set_from(from._internal_from());
   }
-  if (from.exists() != 0) {
-    _internal_set_exists(from._internal_exists());
+  if (from._internal_to() != 0) {
+    _this->_internal_set_to(from._internal_to());
   }
-  if (from.has_prev_edge() != 0) {
-    _internal_set_has_prev_edge(from._internal_has_prev_edge());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = from._internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    _this->_internal_set_weight(from._internal_weight());
   }
-  if (from.prev_edge() != 0) {
-    _internal_set_prev_edge(from._internal_prev_edge());
+  if (from._internal_first() != 0) {
+    _this->_internal_set_first(from._internal_first());
   }
+  if (from._internal_second() != 0) {
+    _this->_internal_set_second(from._internal_second());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RouteInternalData::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:GraphProto.RouteInternalData)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void RouteInternalData::CopyFrom(const RouteInternalData& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:GraphProto.RouteInternalData)
+void Shortcut::CopyFrom(const Shortcut& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:GraphProto.Shortcut)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RouteInternalData::IsInitialized() const {
+bool Shortcut::IsInitialized() const {
   return true;
 }
 
-void RouteInternalData::InternalSwap(RouteInternalData* other) {
+void Shortcut::InternalSwap(Shortcut* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RouteInternalData, prev_edge_)
-      + sizeof(RouteInternalData::prev_edge_)
-      - PROTOBUF_FIELD_OFFSET(RouteInternalData, weight_)>(
-          reinterpret_cast<char*>(&weight_),
-          reinterpret_cast<char*>(&other->weight_));
+      PROTOBUF_FIELD_OFFSET(Shortcut, _impl_.second_)
+      + sizeof(Shortcut::_impl_.second_)
+      - PROTOBUF_FIELD_OFFSET(Shortcut, _impl_.from_)>(
+          reinterpret_cast<char*>(&_impl_.from_),
+          reinterpret_cast<char*>(&other->_impl_.from_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RouteInternalData::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Shortcut::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[3]);
 }
 
-
 // ===================================================================
 
-class RoutesInternalDataByTarget::_Internal {
+class ContractionHierarchy::_Internal {
  public:
 };
 
-RoutesInternalDataByTarget::RoutesInternalDataByTarget(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  targets_data_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:GraphProto.RoutesInternalDataByTarget)
-}
-RoutesInternalDataByTarget::RoutesInternalDataByTarget(const RoutesInternalDataByTarget& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      targets_data_(from.targets_data_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:GraphProto.RoutesInternalDataByTarget)
-}
-
-void RoutesInternalDataByTarget::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RoutesInternalDataByTarget_graph_2eproto.base);
+ContractionHierarchy::ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:GraphProto.ContractionHierarchy)
 }
+ContractionHierarchy::ContractionHierarchy(const ContractionHierarchy& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ContractionHierarchy* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ranks_){from._impl_.ranks_}
+    , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+    , decltype(_impl_.shortcuts_){from._impl_.shortcuts_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
-RoutesInternalDataByTarget::~RoutesInternalDataByTarget() {
-  // @@protoc_insertion_point(destructor:GraphProto.RoutesInternalDataByTarget)
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:GraphProto.ContractionHierarchy)
+}
+
+inline void ContractionHierarchy::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ranks_){arena}
+    , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+    , decltype(_impl_.shortcuts_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ContractionHierarchy::~ContractionHierarchy() {
+  // @@protoc_insertion_point(destructor:GraphProto.ContractionHierarchy)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RoutesInternalDataByTarget::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ContractionHierarchy::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ranks_.~RepeatedField();
+  _impl_.shortcuts_.~RepeatedPtrField();
 }
 
-void RoutesInternalDataByTarget::ArenaDtor(void* object) {
-  RoutesInternalDataByTarget* _this = reinterpret_cast< RoutesInternalDataByTarget* >(object);
-  (void)_this;
-}
-void RoutesInternalDataByTarget::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void RoutesInternalDataByTarget::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RoutesInternalDataByTarget& RoutesInternalDataByTarget::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RoutesInternalDataByTarget_graph_2eproto.base);
-  return *internal_default_instance();
+void ContractionHierarchy::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void RoutesInternalDataByTarget::Clear() {
-// @@protoc_insertion_point(message_clear_start:GraphProto.RoutesInternalDataByTarget)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void ContractionHierarchy::Clear() {
+// @@protoc_insertion_point(message_clear_start:GraphProto.ContractionHierarchy)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  targets_data_.Clear();
+  _impl_.ranks_.Clear();
+  _impl_.shortcuts_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RoutesInternalDataByTarget::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ContractionHierarchy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .GraphProto.RouteInternalData targets_data = 1;
+      // repeated uint32 ranks = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_ranks(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_ranks(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .GraphProto.Shortcut shortcuts = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_targets_data(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_shortcuts(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RoutesInternalDataByTarget::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:GraphProto.RoutesInternalDataByTarget)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* ContractionHierarchy::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:GraphProto.ContractionHierarchy)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .GraphProto.RouteInternalData targets_data = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_targets_data_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  // repeated uint32 ranks = 1;
+  {
+    int byte_size = _impl_._ranks_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_ranks(), byte_size, target);
+    }
+  }
+
+  // repeated .GraphProto.Shortcut shortcuts = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_shortcuts_size()); i < n; i++) {
+    const auto& repfield = this->_internal_shortcuts(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_targets_data(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:GraphProto.RoutesInternalDataByTarget)
+  // @@protoc_insertion_point(serialize_to_array_end:GraphProto.ContractionHierarchy)
   return target;
 }
 
-size_t RoutesInternalDataByTarget::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:GraphProto.RoutesInternalDataByTarget)
+size_t ContractionHierarchy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:GraphProto.ContractionHierarchy)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .GraphProto.RouteInternalData targets_data = 1;
-  total_size += 1UL * this->_internal_targets_data_size();
-  for (const auto& msg : this->targets_data_) {
+  // repeated uint32 ranks = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.ranks_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ranks_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .GraphProto.Shortcut shortcuts = 2;
+  total_size += 1UL * this->_internal_shortcuts_size();
+  for (const auto& msg : this->_impl_.shortcuts_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void RoutesInternalDataByTarget::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:GraphProto.RoutesInternalDataByTarget)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RoutesInternalDataByTarget* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RoutesInternalDataByTarget>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:GraphProto.RoutesInternalDataByTarget)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:GraphProto.RoutesInternalDataByTarget)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RoutesInternalDataByTarget::MergeFrom(const RoutesInternalDataByTarget& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.RoutesInternalDataByTarget)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ContractionHierarchy::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ContractionHierarchy::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ContractionHierarchy::GetClassData() const { return &_class_data_; }
 
-  targets_data_.MergeFrom(from.targets_data_);
-}
 
-void RoutesInternalDataByTarget::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:GraphProto.RoutesInternalDataByTarget)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void ContractionHierarchy::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ContractionHierarchy*>(&to_msg);
+  auto& from = static_cast<const ContractionHierarchy&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.ContractionHierarchy)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ranks_.MergeFrom(from._impl_.ranks_);
+  _this->_impl_.shortcuts_.MergeFrom(from._impl_.shortcuts_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RoutesInternalDataByTarget::CopyFrom(const RoutesInternalDataByTarget& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:GraphProto.RoutesInternalDataByTarget)
+void ContractionHierarchy::CopyFrom(const ContractionHierarchy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:GraphProto.ContractionHierarchy)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RoutesInternalDataByTarget::IsInitialized() const {
+bool ContractionHierarchy::IsInitialized() const {
   return true;
 }
 
-void RoutesInternalDataByTarget::InternalSwap(RoutesInternalDataByTarget* other) {
+void ContractionHierarchy::InternalSwap(ContractionHierarchy* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  targets_data_.InternalSwap(&other->targets_data_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ranks_.InternalSwap(&other->_impl_.ranks_);
+  _impl_.shortcuts_.InternalSwap(&other->_impl_.shortcuts_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RoutesInternalDataByTarget::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata ContractionHierarchy::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[4]);
 }
 
-
 // ===================================================================
 
 class Router::_Internal {
  public:
+  static const ::GraphProto::ContractionHierarchy& hierarchy(const Router* msg);
 };
 
-Router::Router(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  sources_data_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+const ::GraphProto::ContractionHierarchy&
+Router::_Internal::hierarchy(const Router* msg) {
+  return *msg->_impl_.hierarchy_;
+}
+Router::Router(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:GraphProto.Router)
 }
 Router::Router(const Router& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      sources_data_(from.sources_data_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Router* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hierarchy_){nullptr}
+    , decltype(_impl_.strategy_){}
+    , decltype(_impl_.vertex_count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_hierarchy()) {
+    _this->_impl_.hierarchy_ = new ::GraphProto::ContractionHierarchy(*from._impl_.hierarchy_);
+  }
+  ::memcpy(&_impl_.strategy_, &from._impl_.strategy_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.vertex_count_) -
+    reinterpret_cast<char*>(&_impl_.strategy_)) + sizeof(_impl_.vertex_count_));
   // @@protoc_insertion_point(copy_constructor:GraphProto.Router)
 }
 
-void Router::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Router_graph_2eproto.base);
+inline void Router::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hierarchy_){nullptr}
+    , decltype(_impl_.strategy_){0}
+    , decltype(_impl_.vertex_count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Router::~Router() {
   // @@protoc_insertion_point(destructor:GraphProto.Router)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Router::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Router::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.hierarchy_;
 }
 
-void Router::ArenaDtor(void* object) {
-  Router* _this = reinterpret_cast< Router* >(object);
-  (void)_this;
-}
-void Router::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Router::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Router& Router::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Router_graph_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Router::Clear() {
 // @@protoc_insertion_point(message_clear_start:GraphProto.Router)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  sources_data_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.hierarchy_ != nullptr) {
+    delete _impl_.hierarchy_;
+  }
+  _impl_.hierarchy_ = nullptr;
+  ::memset(&_impl_.strategy_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.vertex_count_) -
+      reinterpret_cast<char*>(&_impl_.strategy_)) + sizeof(_impl_.vertex_count_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Router::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Router::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .GraphProto.RoutesInternalDataByTarget sources_data = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_sources_data(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+      // .GraphProto.Router.Strategy strategy = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_strategy(static_cast<::GraphProto::Router_Strategy>(val));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .GraphProto.ContractionHierarchy hierarchy = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hierarchy(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint32 vertex_count = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.vertex_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Router::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Router::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:GraphProto.Router)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .GraphProto.RoutesInternalDataByTarget sources_data = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_sources_data_size()); i < n; i++) {
+  // .GraphProto.Router.Strategy strategy = 2;
+  if (this->_internal_strategy() != 0) {
     target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_strategy(), target);
+  }
+
+  // .GraphProto.ContractionHierarchy hierarchy = 3;
+  if (this->_internal_has_hierarchy()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_sources_data(i), target, stream);
+      InternalWriteMessage(3, _Internal::hierarchy(this),
+        _Internal::hierarchy(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 vertex_count = 4;
+  if (this->_internal_vertex_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_vertex_count(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:GraphProto.Router)
@@ -1511,56 +1601,57 @@ size_t Router::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:GraphProto.Router)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .GraphProto.RoutesInternalDataByTarget sources_data = 1;
-  total_size += 1UL * this->_internal_sources_data_size();
-  for (const auto& msg : this->sources_data_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // .GraphProto.ContractionHierarchy hierarchy = 3;
+  if (this->_internal_has_hierarchy()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.hierarchy_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // .GraphProto.Router.Strategy strategy = 2;
+  if (this->_internal_strategy() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_strategy());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Router::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:GraphProto.Router)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Router* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Router>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:GraphProto.Router)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:GraphProto.Router)
-    MergeFrom(*source);
+
+  // uint32 vertex_count = 4;
+  if (this->_internal_vertex_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vertex_count());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Router::MergeFrom(const Router& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.Router)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Router::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Router::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Router::GetClassData() const { return &_class_data_; }
 
-  sources_data_.MergeFrom(from.sources_data_);
-}
 
-void Router::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:GraphProto.Router)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void Router::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Router*>(&to_msg);
+  auto& from = static_cast<const Router&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:GraphProto.Router)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_hierarchy()) {
+    _this->_internal_mutable_hierarchy()->::GraphProto::ContractionHierarchy::MergeFrom(
+        from._internal_hierarchy());
+  }
+  if (from._internal_strategy() != 0) {
+    _this->_internal_set_strategy(from._internal_strategy());
+  }
+  if (from._internal_vertex_count() != 0) {
+    _this->_internal_set_vertex_count(from._internal_vertex_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Router::CopyFrom(const Router& from) {
@@ -1576,34 +1667,46 @@ bool Router::IsInitialized() const {
 
 void Router::InternalSwap(Router* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  sources_data_.InternalSwap(&other->sources_data_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Router, _impl_.vertex_count_)
+      + sizeof(Router::_impl_.vertex_count_)
+      - PROTOBUF_FIELD_OFFSET(Router, _impl_.hierarchy_)>(
+          reinterpret_cast<char*>(&_impl_.hierarchy_),
+          reinterpret_cast<char*>(&other->_impl_.hierarchy_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Router::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[5]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace GraphProto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::GraphProto::Edge* Arena::CreateMaybeMessage< ::GraphProto::Edge >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::GraphProto::Edge*
+Arena::CreateMaybeMessage< ::GraphProto::Edge >(Arena* arena) {
   return Arena::CreateMessageInternal< ::GraphProto::Edge >(arena);
 }
-template<> PROTOBUF_NOINLINE ::GraphProto::IncidenceList* Arena::CreateMaybeMessage< ::GraphProto::IncidenceList >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::GraphProto::IncidenceList*
+Arena::CreateMaybeMessage< ::GraphProto::IncidenceList >(Arena* arena) {
   return Arena::CreateMessageInternal< ::GraphProto::IncidenceList >(arena);
 }
-template<> PROTOBUF_NOINLINE ::GraphProto::DirectedWeightedGraph* Arena::CreateMaybeMessage< ::GraphProto::DirectedWeightedGraph >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::GraphProto::DirectedWeightedGraph*
+Arena::CreateMaybeMessage< ::GraphProto::DirectedWeightedGraph >(Arena* arena) {
   return Arena::CreateMessageInternal< ::GraphProto::DirectedWeightedGraph >(arena);
 }
-template<> PROTOBUF_NOINLINE ::GraphProto::RouteInternalData* Arena::CreateMaybeMessage< ::GraphProto::RouteInternalData >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::GraphProto::RouteInternalData >(arena);
+template<> PROTOBUF_NOINLINE ::GraphProto::Shortcut*
+Arena::CreateMaybeMessage< ::GraphProto::Shortcut >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::GraphProto::Shortcut >(arena);
 }
-template<> PROTOBUF_NOINLINE ::GraphProto::RoutesInternalDataByTarget* Arena::CreateMaybeMessage< ::GraphProto::RoutesInternalDataByTarget >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::GraphProto::RoutesInternalDataByTarget >(arena);
+template<> PROTOBUF_NOINLINE ::GraphProto::ContractionHierarchy*
+Arena::CreateMaybeMessage< ::GraphProto::ContractionHierarchy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::GraphProto::ContractionHierarchy >(arena);
 }
-template<> PROTOBUF_NOINLINE ::GraphProto::Router* Arena::CreateMaybeMessage< ::GraphProto::Router >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::GraphProto::Router*
+Arena::CreateMaybeMessage< ::GraphProto::Router >(Arena* arena) {
   return Arena::CreateMessageInternal< ::GraphProto::Router >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,13 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -42,54 +42,73 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_graph_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[6]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_graph_2eproto;
 namespace GraphProto {
+class ContractionHierarchy;
+struct ContractionHierarchyDefaultTypeInternal;
+extern ContractionHierarchyDefaultTypeInternal _ContractionHierarchy_default_instance_;
 class DirectedWeightedGraph;
-class DirectedWeightedGraphDefaultTypeInternal;
+struct DirectedWeightedGraphDefaultTypeInternal;
 extern DirectedWeightedGraphDefaultTypeInternal _DirectedWeightedGraph_default_instance_;
 class Edge;
-class EdgeDefaultTypeInternal;
+struct EdgeDefaultTypeInternal;
 extern EdgeDefaultTypeInternal _Edge_default_instance_;
 class IncidenceList;
-class IncidenceListDefaultTypeInternal;
+struct IncidenceListDefaultTypeInternal;
 extern IncidenceListDefaultTypeInternal _IncidenceList_default_instance_;
-class RouteInternalData;
-class RouteInternalDataDefaultTypeInternal;
-extern RouteInternalDataDefaultTypeInternal _RouteInternalData_default_instance_;
 class Router;
-class RouterDefaultTypeInternal;
+struct RouterDefaultTypeInternal;
 extern RouterDefaultTypeInternal _Router_default_instance_;
-class RoutesInternalDataByTarget;
-class RoutesInternalDataByTargetDefaultTypeInternal;
-extern RoutesInternalDataByTargetDefaultTypeInternal _RoutesInternalDataByTarget_default_instance_;
+class Shortcut;
+struct ShortcutDefaultTypeInternal;
+extern ShortcutDefaultTypeInternal _Shortcut_default_instance_;
 }  // namespace GraphProto
 PROTOBUF_NAMESPACE_OPEN
+template<> ::GraphProto::ContractionHierarchy* Arena::CreateMaybeMessage<::GraphProto::ContractionHierarchy>(Arena*);
 template<> ::GraphProto::DirectedWeightedGraph* Arena::CreateMaybeMessage<::GraphProto::DirectedWeightedGraph>(Arena*);
 template<> ::GraphProto::Edge* Arena::CreateMaybeMessage<::GraphProto::Edge>(Arena*);
 template<> ::GraphProto::IncidenceList* Arena::CreateMaybeMessage<::GraphProto::IncidenceList>(Arena*);
-template<> ::GraphProto::RouteInternalData* Arena::CreateMaybeMessage<::GraphProto::RouteInternalData>(Arena*);
 template<> ::GraphProto::Router* Arena::CreateMaybeMessage<::GraphProto::Router>(Arena*);
-template<> ::GraphProto::RoutesInternalDataByTarget* Arena::CreateMaybeMessage<::GraphProto::RoutesInternalDataByTarget>(Arena*);
+template<> ::GraphProto::Shortcut* Arena::CreateMaybeMessage<::GraphProto::Shortcut>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace GraphProto {
 
+enum Router_Strategy : int {
+  Router_Strategy_ALL_PAIRS = 0,
+  Router_Strategy_DIJKSTRA = 1,
+  Router_Strategy_CONTRACTION_HIERARCHIES = 2,
+  Router_Strategy_Router_Strategy_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Router_Strategy_Router_Strategy_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Router_Strategy_IsValid(int value);
+constexpr Router_Strategy Router_Strategy_Strategy_MIN = Router_Strategy_ALL_PAIRS;
+constexpr Router_Strategy Router_Strategy_Strategy_MAX = Router_Strategy_CONTRACTION_HIERARCHIES;
+constexpr int Router_Strategy_Strategy_ARRAYSIZE = Router_Strategy_Strategy_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Router_Strategy_descriptor();
+template<typename T>
+inline const std::string& Router_Strategy_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Router_Strategy>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Router_Strategy_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Router_Strategy_descriptor(), enum_t_value);
+}
+inline bool Router_Strategy_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Router_Strategy* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Router_Strategy>(
+    Router_Strategy_descriptor(), name, value);
+}
 // ===================================================================
 
-class Edge PROTOBUF_FINAL :
+class Edge final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GraphProto.Edge) */ {
  public:
   inline Edge() : Edge(nullptr) {}
-  virtual ~Edge();
+  ~Edge() override;
+  explicit PROTOBUF_CONSTEXPR Edge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Edge(const Edge& from);
   Edge(Edge&& from) noexcept
@@ -102,8 +121,13 @@ class Edge PROTOBUF_FINAL :
     return *this;
   }
   inline Edge& operator=(Edge&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -114,13 +138,14 @@ class Edge PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Edge& default_instance() {
+    return *internal_default_instance();
   }
-  static const Edge& default_instance();
-
   static inline const Edge* internal_default_instance() {
     return reinterpret_cast<const Edge*>(
                &_Edge_default_instance_);
@@ -133,7 +158,12 @@ class Edge PROTOBUF_FINAL :
   }
   inline void Swap(Edge* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -141,56 +171,53 @@ class Edge PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Edge* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Edge* New() const final {
-    return CreateMaybeMessage<Edge>(nullptr);
-  }
-
-  Edge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Edge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Edge>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Edge& from);
-  void MergeFrom(const Edge& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Edge& from) {
+    Edge::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Edge* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "GraphProto.Edge";
   }
   protected:
-  explicit Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_graph_2eproto);
-    return ::descriptor_table_graph_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -203,20 +230,20 @@ class Edge PROTOBUF_FINAL :
   };
   // uint32 from = 1;
   void clear_from();
-  ::PROTOBUF_NAMESPACE_ID::uint32 from() const;
-  void set_from(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t from() const;
+  void set_from(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_from() const;
-  void _internal_set_from(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_from() const;
+  void _internal_set_from(uint32_t value);
   public:
 
   // uint32 to = 2;
   void clear_to();
-  ::PROTOBUF_NAMESPACE_ID::uint32 to() const;
-  void set_to(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t to() const;
+  void set_to(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_to() const;
-  void _internal_set_to(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_to() const;
+  void _internal_set_to(uint32_t value);
   public:
 
   // double weight = 3;
@@ -235,19 +262,23 @@ class Edge PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 from_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 to_;
-  double weight_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t from_;
+    uint32_t to_;
+    double weight_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
 
-class IncidenceList PROTOBUF_FINAL :
+class IncidenceList final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GraphProto.IncidenceList) */ {
  public:
   inline IncidenceList() : IncidenceList(nullptr) {}
-  virtual ~IncidenceList();
+  ~IncidenceList() override;
+  explicit PROTOBUF_CONSTEXPR IncidenceList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   IncidenceList(const IncidenceList& from);
   IncidenceList(IncidenceList&& from) noexcept
@@ -260,8 +291,13 @@ class IncidenceList PROTOBUF_FINAL :
     return *this;
   }
   inline IncidenceList& operator=(IncidenceList&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -272,13 +308,14 @@ class IncidenceList PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IncidenceList& default_instance() {
+    return *internal_default_instance();
   }
-  static const IncidenceList& default_instance();
-
   static inline const IncidenceList* internal_default_instance() {
     return reinterpret_cast<const IncidenceList*>(
                &_IncidenceList_default_instance_);
@@ -291,7 +328,12 @@ class IncidenceList PROTOBUF_FINAL :
   }
   inline void Swap(IncidenceList* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -299,56 +341,53 @@ class IncidenceList PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(IncidenceList* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline IncidenceList* New() const final {
-    return CreateMaybeMessage<IncidenceList>(nullptr);
-  }
-
-  IncidenceList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  IncidenceList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<IncidenceList>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IncidenceList& from);
-  void MergeFrom(const IncidenceList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IncidenceList& from) {
+    IncidenceList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(IncidenceList* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "GraphProto.IncidenceList";
   }
   protected:
-  explicit IncidenceList(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit IncidenceList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_graph_2eproto);
-    return ::descriptor_table_graph_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -364,19 +403,19 @@ class IncidenceList PROTOBUF_FINAL :
   public:
   void clear_edge_ids();
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_edge_ids(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+  uint32_t _internal_edge_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       _internal_edge_ids() const;
-  void _internal_add_edge_ids(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+  void _internal_add_edge_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       _internal_mutable_edge_ids();
   public:
-  ::PROTOBUF_NAMESPACE_ID::uint32 edge_ids(int index) const;
-  void set_edge_ids(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
-  void add_edge_ids(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+  uint32_t edge_ids(int index) const;
+  void set_edge_ids(int index, uint32_t value);
+  void add_edge_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       edge_ids() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_edge_ids();
 
   // @@protoc_insertion_point(class_scope:GraphProto.IncidenceList)
@@ -386,18 +425,22 @@ class IncidenceList PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > edge_ids_;
-  mutable std::atomic<int> _edge_ids_cached_byte_size_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > edge_ids_;
+    mutable std::atomic<int> _edge_ids_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DirectedWeightedGraph PROTOBUF_FINAL :
+class DirectedWeightedGraph final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GraphProto.DirectedWeightedGraph) */ {
  public:
   inline DirectedWeightedGraph() : DirectedWeightedGraph(nullptr) {}
-  virtual ~DirectedWeightedGraph();
+  ~DirectedWeightedGraph() override;
+  explicit PROTOBUF_CONSTEXPR DirectedWeightedGraph(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DirectedWeightedGraph(const DirectedWeightedGraph& from);
   DirectedWeightedGraph(DirectedWeightedGraph&& from) noexcept
@@ -410,8 +453,13 @@ class DirectedWeightedGraph PROTOBUF_FINAL :
     return *this;
   }
   inline DirectedWeightedGraph& operator=(DirectedWeightedGraph&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -422,13 +470,14 @@ class DirectedWeightedGraph PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DirectedWeightedGraph& default_instance() {
+    return *internal_default_instance();
   }
-  static const DirectedWeightedGraph& default_instance();
-
   static inline const DirectedWeightedGraph* internal_default_instance() {
     return reinterpret_cast<const DirectedWeightedGraph*>(
                &_DirectedWeightedGraph_default_instance_);
@@ -441,7 +490,12 @@ class DirectedWeightedGraph PROTOBUF_FINAL :
   }
   inline void Swap(DirectedWeightedGraph* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -449,56 +503,53 @@ class DirectedWeightedGraph PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(DirectedWeightedGraph* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DirectedWeightedGraph* New() const final {
-    return CreateMaybeMessage<DirectedWeightedGraph>(nullptr);
-  }
-
-  DirectedWeightedGraph* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DirectedWeightedGraph* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DirectedWeightedGraph>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DirectedWeightedGraph& from);
-  void MergeFrom(const DirectedWeightedGraph& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DirectedWeightedGraph& from) {
+    DirectedWeightedGraph::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(DirectedWeightedGraph* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "GraphProto.DirectedWeightedGraph";
   }
   protected:
-  explicit DirectedWeightedGraph(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit DirectedWeightedGraph(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_graph_2eproto);
-    return ::descriptor_table_graph_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -551,32 +602,41 @@ class DirectedWeightedGraph PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Edge > edges_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::IncidenceList > incidence_lists_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Edge > edges_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::IncidenceList > incidence_lists_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RouteInternalData PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GraphProto.RouteInternalData) */ {
+class Shortcut final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GraphProto.Shortcut) */ {
  public:
-  inline RouteInternalData() : RouteInternalData(nullptr) {}
-  virtual ~RouteInternalData();
+  inline Shortcut() : Shortcut(nullptr) {}
+  ~Shortcut() override;
+  explicit PROTOBUF_CONSTEXPR Shortcut(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RouteInternalData(const RouteInternalData& from);
-  RouteInternalData(RouteInternalData&& from) noexcept
-    : RouteInternalData() {
+  Shortcut(const Shortcut& from);
+  Shortcut(Shortcut&& from) noexcept
+    : Shortcut() {
     *this = ::std::move(from);
   }
 
-  inline RouteInternalData& operator=(const RouteInternalData& from) {
+  inline Shortcut& operator=(const Shortcut& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RouteInternalData& operator=(RouteInternalData&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline Shortcut& operator=(Shortcut&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -587,95 +647,117 @@ class RouteInternalData PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RouteInternalData& default_instance();
-
-  static inline const RouteInternalData* internal_default_instance() {
-    return reinterpret_cast<const RouteInternalData*>(
-               &_RouteInternalData_default_instance_);
+  static const Shortcut& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Shortcut* internal_default_instance() {
+    return reinterpret_cast<const Shortcut*>(
+               &_Shortcut_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     3;
 
-  friend void swap(RouteInternalData& a, RouteInternalData& b) {
+  friend void swap(Shortcut& a, Shortcut& b) {
     a.Swap(&b);
   }
-  inline void Swap(RouteInternalData* other) {
+  inline void Swap(Shortcut* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RouteInternalData* other) {
+  void UnsafeArenaSwap(Shortcut* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RouteInternalData* New() const final {
-    return CreateMaybeMessage<RouteInternalData>(nullptr);
+  Shortcut* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Shortcut>(arena);
   }
-
-  RouteInternalData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RouteInternalData>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Shortcut& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Shortcut& from) {
+    Shortcut::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RouteInternalData& from);
-  void MergeFrom(const RouteInternalData& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RouteInternalData* other);
+  void InternalSwap(Shortcut* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "GraphProto.RouteInternalData";
+    return "GraphProto.Shortcut";
   }
   protected:
-  explicit RouteInternalData(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Shortcut(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_graph_2eproto);
-    return ::descriptor_table_graph_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kWeightFieldNumber = 2,
-    kExistsFieldNumber = 1,
-    kHasPrevEdgeFieldNumber = 3,
-    kPrevEdgeFieldNumber = 4,
+    kFromFieldNumber = 1,
+    kToFieldNumber = 2,
+    kWeightFieldNumber = 3,
+    kFirstFieldNumber = 4,
+    kSecondFieldNumber = 5,
   };
-  // double weight = 2;
+  // uint32 from = 1;
+  void clear_from();
+  uint32_t from() const;
+  void set_from(uint32_t value);
+  private:
+  uint32_t _internal_from() const;
+  void _internal_set_from(uint32_t value);
+  public:
+
+  // uint32 to = 2;
+  void clear_to();
+  uint32_t to() const;
+  void set_to(uint32_t value);
+  private:
+  uint32_t _internal_to() const;
+  void _internal_set_to(uint32_t value);
+  public:
+
+  // double weight = 3;
   void clear_weight();
   double weight() const;
   void set_weight(double value);
@@ -684,68 +766,69 @@ class RouteInternalData PROTOBUF_FINAL :
   void _internal_set_weight(double value);
   public:
 
-  // bool exists = 1;
-  void clear_exists();
-  bool exists() const;
-  void set_exists(bool value);
+  // uint32 first = 4;
+  void clear_first();
+  uint32_t first() const;
+  void set_first(uint32_t value);
   private:
-  bool _internal_exists() const;
-  void _internal_set_exists(bool value);
+  uint32_t _internal_first() const;
+  void _internal_set_first(uint32_t value);
   public:
 
-  // bool has_prev_edge = 3;
-  void clear_has_prev_edge();
-  bool has_prev_edge() const;
-  void set_has_prev_edge(bool value);
+  // uint32 second = 5;
+  void clear_second();
+  uint32_t second() const;
+  void set_second(uint32_t value);
   private:
-  bool _internal_has_prev_edge() const;
-  void _internal_set_has_prev_edge(bool value);
+  uint32_t _internal_second() const;
+  void _internal_set_second(uint32_t value);
   public:
 
-  // uint32 prev_edge = 4;
-  void clear_prev_edge();
-  ::PROTOBUF_NAMESPACE_ID::uint32 prev_edge() const;
-  void set_prev_edge(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_prev_edge() const;
-  void _internal_set_prev_edge(::PROTOBUF_NAMESPACE_ID::uint32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:GraphProto.RouteInternalData)
+  // @@protoc_insertion_point(class_scope:GraphProto.Shortcut)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double weight_;
-  bool exists_;
-  bool has_prev_edge_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 prev_edge_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t from_;
+    uint32_t to_;
+    double weight_;
+    uint32_t first_;
+    uint32_t second_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoutesInternalDataByTarget PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GraphProto.RoutesInternalDataByTarget) */ {
+class ContractionHierarchy final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GraphProto.ContractionHierarchy) */ {
  public:
-  inline RoutesInternalDataByTarget() : RoutesInternalDataByTarget(nullptr) {}
-  virtual ~RoutesInternalDataByTarget();
+  inline ContractionHierarchy() : ContractionHierarchy(nullptr) {}
+  ~ContractionHierarchy() override;
+  explicit PROTOBUF_CONSTEXPR ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RoutesInternalDataByTarget(const RoutesInternalDataByTarget& from);
-  RoutesInternalDataByTarget(RoutesInternalDataByTarget&& from) noexcept
-    : RoutesInternalDataByTarget() {
+  ContractionHierarchy(const ContractionHierarchy& from);
+  ContractionHierarchy(ContractionHierarchy&& from) noexcept
+    : ContractionHierarchy() {
     *this = ::std::move(from);
   }
 
-  inline RoutesInternalDataByTarget& operator=(const RoutesInternalDataByTarget& from) {
+  inline ContractionHierarchy& operator=(const ContractionHierarchy& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RoutesInternalDataByTarget& operator=(RoutesInternalDataByTarget&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline ContractionHierarchy& operator=(ContractionHierarchy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -756,127 +839,159 @@ class RoutesInternalDataByTarget PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RoutesInternalDataByTarget& default_instance();
-
-  static inline const RoutesInternalDataByTarget* internal_default_instance() {
-    return reinterpret_cast<const RoutesInternalDataByTarget*>(
-               &_RoutesInternalDataByTarget_default_instance_);
+  static const ContractionHierarchy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ContractionHierarchy* internal_default_instance() {
+    return reinterpret_cast<const ContractionHierarchy*>(
+               &_ContractionHierarchy_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(RoutesInternalDataByTarget& a, RoutesInternalDataByTarget& b) {
+  friend void swap(ContractionHierarchy& a, ContractionHierarchy& b) {
     a.Swap(&b);
   }
-  inline void Swap(RoutesInternalDataByTarget* other) {
+  inline void Swap(ContractionHierarchy* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RoutesInternalDataByTarget* other) {
+  void UnsafeArenaSwap(ContractionHierarchy* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RoutesInternalDataByTarget* New() const final {
-    return CreateMaybeMessage<RoutesInternalDataByTarget>(nullptr);
+  ContractionHierarchy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ContractionHierarchy>(arena);
   }
-
-  RoutesInternalDataByTarget* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RoutesInternalDataByTarget>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ContractionHierarchy& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ContractionHierarchy& from) {
+    ContractionHierarchy::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RoutesInternalDataByTarget& from);
-  void MergeFrom(const RoutesInternalDataByTarget& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RoutesInternalDataByTarget* other);
+  void InternalSwap(ContractionHierarchy* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "GraphProto.RoutesInternalDataByTarget";
+    return "GraphProto.ContractionHierarchy";
   }
   protected:
-  explicit RoutesInternalDataByTarget(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_graph_2eproto);
-    return ::descriptor_table_graph_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kTargetsDataFieldNumber = 1,
+    kRanksFieldNumber = 1,
+    kShortcutsFieldNumber = 2,
   };
-  // repeated .GraphProto.RouteInternalData targets_data = 1;
-  int targets_data_size() const;
+  // repeated uint32 ranks = 1;
+  int ranks_size() const;
   private:
-  int _internal_targets_data_size() const;
+  int _internal_ranks_size() const;
   public:
-  void clear_targets_data();
-  ::GraphProto::RouteInternalData* mutable_targets_data(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RouteInternalData >*
-      mutable_targets_data();
+  void clear_ranks();
   private:
-  const ::GraphProto::RouteInternalData& _internal_targets_data(int index) const;
-  ::GraphProto::RouteInternalData* _internal_add_targets_data();
+  uint32_t _internal_ranks(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ranks() const;
+  void _internal_add_ranks(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ranks();
   public:
-  const ::GraphProto::RouteInternalData& targets_data(int index) const;
-  ::GraphProto::RouteInternalData* add_targets_data();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RouteInternalData >&
-      targets_data() const;
+  uint32_t ranks(int index) const;
+  void set_ranks(int index, uint32_t value);
+  void add_ranks(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ranks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ranks();
+
+  // repeated .GraphProto.Shortcut shortcuts = 2;
+  int shortcuts_size() const;
+  private:
+  int _internal_shortcuts_size() const;
+  public:
+  void clear_shortcuts();
+  ::GraphProto::Shortcut* mutable_shortcuts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Shortcut >*
+      mutable_shortcuts();
+  private:
+  const ::GraphProto::Shortcut& _internal_shortcuts(int index) const;
+  ::GraphProto::Shortcut* _internal_add_shortcuts();
+  public:
+  const ::GraphProto::Shortcut& shortcuts(int index) const;
+  ::GraphProto::Shortcut* add_shortcuts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Shortcut >&
+      shortcuts() const;
 
-  // @@protoc_insertion_point(class_scope:GraphProto.RoutesInternalDataByTarget)
+  // @@protoc_insertion_point(class_scope:GraphProto.ContractionHierarchy)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RouteInternalData > targets_data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ranks_;
+    mutable std::atomic<int> _ranks_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Shortcut > shortcuts_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Router PROTOBUF_FINAL :
+class Router final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:GraphProto.Router) */ {
  public:
   inline Router() : Router(nullptr) {}
-  virtual ~Router();
+  ~Router() override;
+  explicit PROTOBUF_CONSTEXPR Router(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Router(const Router& from);
   Router(Router&& from) noexcept
@@ -889,8 +1004,13 @@ class Router PROTOBUF_FINAL :
     return *this;
   }
   inline Router& operator=(Router&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -901,13 +1021,14 @@ class Router PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Router& default_instance() {
+    return *internal_default_instance();
   }
-  static const Router& default_instance();
-
   static inline const Router* internal_default_instance() {
     return reinterpret_cast<const Router*>(
                &_Router_default_instance_);
@@ -920,7 +1041,12 @@ class Router PROTOBUF_FINAL :
   }
   inline void Swap(Router* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -928,81 +1054,130 @@ class Router PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Router* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Router* New() const final {
-    return CreateMaybeMessage<Router>(nullptr);
-  }
-
-  Router* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Router* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Router>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Router& from);
-  void MergeFrom(const Router& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Router& from) {
+    Router::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Router* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "GraphProto.Router";
   }
   protected:
-  explicit Router(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Router(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_graph_2eproto);
-    return ::descriptor_table_graph_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
+  typedef Router_Strategy Strategy;
+  static constexpr Strategy ALL_PAIRS =
+    Router_Strategy_ALL_PAIRS;
+  static constexpr Strategy DIJKSTRA =
+    Router_Strategy_DIJKSTRA;
+  static constexpr Strategy CONTRACTION_HIERARCHIES =
+    Router_Strategy_CONTRACTION_HIERARCHIES;
+  static inline bool Strategy_IsValid(int value) {
+    return Router_Strategy_IsValid(value);
+  }
+  static constexpr Strategy Strategy_MIN =
+    Router_Strategy_Strategy_MIN;
+  static constexpr Strategy Strategy_MAX =
+    Router_Strategy_Strategy_MAX;
+  static constexpr int Strategy_ARRAYSIZE =
+    Router_Strategy_Strategy_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Strategy_descriptor() {
+    return Router_Strategy_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Strategy_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Strategy>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Strategy_Name.");
+    return Router_Strategy_Name(enum_t_value);
+  }
+  static inline bool Strategy_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Strategy* value) {
+    return Router_Strategy_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kSourcesDataFieldNumber = 1,
+    kHierarchyFieldNumber = 3,
+    kStrategyFieldNumber = 2,
+    kVertexCountFieldNumber = 4,
   };
-  // repeated .GraphProto.RoutesInternalDataByTarget sources_data = 1;
-  int sources_data_size() const;
+  // .GraphProto.ContractionHierarchy hierarchy = 3;
+  bool has_hierarchy() const;
   private:
-  int _internal_sources_data_size() const;
+  bool _internal_has_hierarchy() const;
   public:
-  void clear_sources_data();
-  ::GraphProto::RoutesInternalDataByTarget* mutable_sources_data(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RoutesInternalDataByTarget >*
-      mutable_sources_data();
+  void clear_hierarchy();
+  const ::GraphProto::ContractionHierarchy& hierarchy() const;
+  PROTOBUF_NODISCARD ::GraphProto::ContractionHierarchy* release_hierarchy();
+  ::GraphProto::ContractionHierarchy* mutable_hierarchy();
+  void set_allocated_hierarchy(::GraphProto::ContractionHierarchy* hierarchy);
+  private:
+  const ::GraphProto::ContractionHierarchy& _internal_hierarchy() const;
+  ::GraphProto::ContractionHierarchy* _internal_mutable_hierarchy();
+  public:
+  void unsafe_arena_set_allocated_hierarchy(
+      ::GraphProto::ContractionHierarchy* hierarchy);
+  ::GraphProto::ContractionHierarchy* unsafe_arena_release_hierarchy();
+
+  // .GraphProto.Router.Strategy strategy = 2;
+  void clear_strategy();
+  ::GraphProto::Router_Strategy strategy() const;
+  void set_strategy(::GraphProto::Router_Strategy value);
+  private:
+  ::GraphProto::Router_Strategy _internal_strategy() const;
+  void _internal_set_strategy(::GraphProto::Router_Strategy value);
+  public:
+
+  // uint32 vertex_count = 4;
+  void clear_vertex_count();
+  uint32_t vertex_count() const;
+  void set_vertex_count(uint32_t value);
   private:
-  const ::GraphProto::RoutesInternalDataByTarget& _internal_sources_data(int index) const;
-  ::GraphProto::RoutesInternalDataByTarget* _internal_add_sources_data();
+  uint32_t _internal_vertex_count() const;
+  void _internal_set_vertex_count(uint32_t value);
   public:
-  const ::GraphProto::RoutesInternalDataByTarget& sources_data(int index) const;
-  ::GraphProto::RoutesInternalDataByTarget* add_sources_data();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RoutesInternalDataByTarget >&
-      sources_data() const;
 
   // @@protoc_insertion_point(class_scope:GraphProto.Router)
  private:
@@ -1011,8 +1186,13 @@ class Router PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RoutesInternalDataByTarget > sources_data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::GraphProto::ContractionHierarchy* hierarchy_;
+    int strategy_;
+    uint32_t vertex_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_graph_2eproto;
 };
 // ===================================================================
@@ -1028,50 +1208,50 @@ class Router PROTOBUF_FINAL :
 
 // uint32 from = 1;
 inline void Edge::clear_from() {
-  from_ = 0u;
+  _impl_.from_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Edge::_internal_from() const {
-  return from_;
+inline uint32_t Edge::_internal_from() const {
+  return _impl_.from_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Edge::from() const {
+inline uint32_t Edge::from() const {
   // @@protoc_insertion_point(field_get:GraphProto.Edge.from)
   return _internal_from();
 }
-inline void Edge::_internal_set_from(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Edge::_internal_set_from(uint32_t value) {
   
-  from_ = value;
+  _impl_.from_ = value;
 }
-inline void Edge::set_from(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Edge::set_from(uint32_t value) {
   _internal_set_from(value);
   // @@protoc_insertion_point(field_set:GraphProto.Edge.from)
 }
 
 // uint32 to = 2;
 inline void Edge::clear_to() {
-  to_ = 0u;
+  _impl_.to_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Edge::_internal_to() const {
-  return to_;
+inline uint32_t Edge::_internal_to() const {
+  return _impl_.to_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Edge::to() const {
+inline uint32_t Edge::to() const {
   // @@protoc_insertion_point(field_get:GraphProto.Edge.to)
   return _internal_to();
 }
-inline void Edge::_internal_set_to(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Edge::_internal_set_to(uint32_t value) {
   
-  to_ = value;
+  _impl_.to_ = value;
 }
-inline void Edge::set_to(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Edge::set_to(uint32_t value) {
   _internal_set_to(value);
   // @@protoc_insertion_point(field_set:GraphProto.Edge.to)
 }
 
 // double weight = 3;
 inline void Edge::clear_weight() {
-  weight_ = 0;
+  _impl_.weight_ = 0;
 }
 inline double Edge::_internal_weight() const {
-  return weight_;
+  return _impl_.weight_;
 }
 inline double Edge::weight() const {
   // @@protoc_insertion_point(field_get:GraphProto.Edge.weight)
@@ -1079,7 +1259,7 @@ inline double Edge::weight() const {
 }
 inline void Edge::_internal_set_weight(double value) {
   
-  weight_ = value;
+  _impl_.weight_ = value;
 }
 inline void Edge::set_weight(double value) {
   _internal_set_weight(value);
@@ -1092,46 +1272,46 @@ inline void Edge::set_weight(double value) {
 
 // repeated uint32 edge_ids = 1;
 inline int IncidenceList::_internal_edge_ids_size() const {
-  return edge_ids_.size();
+  return _impl_.edge_ids_.size();
 }
 inline int IncidenceList::edge_ids_size() const {
   return _internal_edge_ids_size();
 }
 inline void IncidenceList::clear_edge_ids() {
-  edge_ids_.Clear();
+  _impl_.edge_ids_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 IncidenceList::_internal_edge_ids(int index) const {
-  return edge_ids_.Get(index);
+inline uint32_t IncidenceList::_internal_edge_ids(int index) const {
+  return _impl_.edge_ids_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 IncidenceList::edge_ids(int index) const {
+inline uint32_t IncidenceList::edge_ids(int index) const {
   // @@protoc_insertion_point(field_get:GraphProto.IncidenceList.edge_ids)
   return _internal_edge_ids(index);
 }
-inline void IncidenceList::set_edge_ids(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  edge_ids_.Set(index, value);
+inline void IncidenceList::set_edge_ids(int index, uint32_t value) {
+  _impl_.edge_ids_.Set(index, value);
   // @@protoc_insertion_point(field_set:GraphProto.IncidenceList.edge_ids)
 }
-inline void IncidenceList::_internal_add_edge_ids(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  edge_ids_.Add(value);
+inline void IncidenceList::_internal_add_edge_ids(uint32_t value) {
+  _impl_.edge_ids_.Add(value);
 }
-inline void IncidenceList::add_edge_ids(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void IncidenceList::add_edge_ids(uint32_t value) {
   _internal_add_edge_ids(value);
   // @@protoc_insertion_point(field_add:GraphProto.IncidenceList.edge_ids)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 IncidenceList::_internal_edge_ids() const {
-  return edge_ids_;
+  return _impl_.edge_ids_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 IncidenceList::edge_ids() const {
   // @@protoc_insertion_point(field_list:GraphProto.IncidenceList.edge_ids)
   return _internal_edge_ids();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 IncidenceList::_internal_mutable_edge_ids() {
-  return &edge_ids_;
+  return &_impl_.edge_ids_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 IncidenceList::mutable_edge_ids() {
   // @@protoc_insertion_point(field_mutable_list:GraphProto.IncidenceList.edge_ids)
   return _internal_mutable_edge_ids();
@@ -1143,250 +1323,411 @@ IncidenceList::mutable_edge_ids() {
 
 // repeated .GraphProto.Edge edges = 1;
 inline int DirectedWeightedGraph::_internal_edges_size() const {
-  return edges_.size();
+  return _impl_.edges_.size();
 }
 inline int DirectedWeightedGraph::edges_size() const {
   return _internal_edges_size();
 }
 inline void DirectedWeightedGraph::clear_edges() {
-  edges_.Clear();
+  _impl_.edges_.Clear();
 }
 inline ::GraphProto::Edge* DirectedWeightedGraph::mutable_edges(int index) {
   // @@protoc_insertion_point(field_mutable:GraphProto.DirectedWeightedGraph.edges)
-  return edges_.Mutable(index);
+  return _impl_.edges_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Edge >*
 DirectedWeightedGraph::mutable_edges() {
   // @@protoc_insertion_point(field_mutable_list:GraphProto.DirectedWeightedGraph.edges)
-  return &edges_;
+  return &_impl_.edges_;
 }
 inline const ::GraphProto::Edge& DirectedWeightedGraph::_internal_edges(int index) const {
-  return edges_.Get(index);
+  return _impl_.edges_.Get(index);
 }
 inline const ::GraphProto::Edge& DirectedWeightedGraph::edges(int index) const {
   // @@protoc_insertion_point(field_get:GraphProto.DirectedWeightedGraph.edges)
   return _internal_edges(index);
 }
 inline ::GraphProto::Edge* DirectedWeightedGraph::_internal_add_edges() {
-  return edges_.Add();
+  return _impl_.edges_.Add();
 }
 inline ::GraphProto::Edge* DirectedWeightedGraph::add_edges() {
+  ::GraphProto::Edge* _add = _internal_add_edges();
   // @@protoc_insertion_point(field_add:GraphProto.DirectedWeightedGraph.edges)
-  return _internal_add_edges();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Edge >&
 DirectedWeightedGraph::edges() const {
   // @@protoc_insertion_point(field_list:GraphProto.DirectedWeightedGraph.edges)
-  return edges_;
+  return _impl_.edges_;
 }
 
 // repeated .GraphProto.IncidenceList incidence_lists = 2;
 inline int DirectedWeightedGraph::_internal_incidence_lists_size() const {
-  return incidence_lists_.size();
+  return _impl_.incidence_lists_.size();
 }
 inline int DirectedWeightedGraph::incidence_lists_size() const {
   return _internal_incidence_lists_size();
 }
 inline void DirectedWeightedGraph::clear_incidence_lists() {
-  incidence_lists_.Clear();
+  _impl_.incidence_lists_.Clear();
 }
 inline ::GraphProto::IncidenceList* DirectedWeightedGraph::mutable_incidence_lists(int index) {
   // @@protoc_insertion_point(field_mutable:GraphProto.DirectedWeightedGraph.incidence_lists)
-  return incidence_lists_.Mutable(index);
+  return _impl_.incidence_lists_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::IncidenceList >*
 DirectedWeightedGraph::mutable_incidence_lists() {
   // @@protoc_insertion_point(field_mutable_list:GraphProto.DirectedWeightedGraph.incidence_lists)
-  return &incidence_lists_;
+  return &_impl_.incidence_lists_;
 }
 inline const ::GraphProto::IncidenceList& DirectedWeightedGraph::_internal_incidence_lists(int index) const {
-  return incidence_lists_.Get(index);
+  return _impl_.incidence_lists_.Get(index);
 }
 inline const ::GraphProto::IncidenceList& DirectedWeightedGraph::incidence_lists(int index) const {
   // @@protoc_insertion_point(field_get:GraphProto.DirectedWeightedGraph.incidence_lists)
   return _internal_incidence_lists(index);
 }
 inline ::GraphProto::IncidenceList* DirectedWeightedGraph::_internal_add_incidence_lists() {
-  return incidence_lists_.Add();
+  return _impl_.incidence_lists_.Add();
 }
 inline ::GraphProto::IncidenceList* DirectedWeightedGraph::add_incidence_lists() {
+  ::GraphProto::IncidenceList* _add = _internal_add_incidence_lists();
   // @@protoc_insertion_point(field_add:GraphProto.DirectedWeightedGraph.incidence_lists)
-  return _internal_add_incidence_lists();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::IncidenceList >&
 DirectedWeightedGraph::incidence_lists() const {
   // @@protoc_insertion_point(field_list:GraphProto.DirectedWeightedGraph.incidence_lists)
-  return incidence_lists_;
+  return _impl_.incidence_lists_;
 }
 
 // -------------------------------------------------------------------
 
-// RouteInternalData
+// Shortcut
 
-// bool exists = 1;
-inline void RouteInternalData::clear_exists() {
-  exists_ = false;
+// uint32 from = 1;
+inline void Shortcut::clear_from() {
+  _impl_.from_ = 0u;
 }
-inline bool RouteInternalData::_internal_exists() const {
-  return exists_;
+inline uint32_t Shortcut::_internal_from() const {
+  return _impl_.from_;
 }
-inline bool RouteInternalData::exists() const {
-  // @@protoc_insertion_point(field_get:GraphProto.RouteInternalData.exists)
-  return _internal_exists();
+inline uint32_t Shortcut::from() const {
+  // @@protoc_insertion_point(field_get:GraphProto.Shortcut.from)
+  return _internal_from();
 }
-inline void RouteInternalData::_internal_set_exists(bool value) {
+inline void Shortcut::_internal_set_from(uint32_t value) {
   
-  exists_ = value;
+  _impl_.from_ = value;
 }
-inline void RouteInternalData::set_exists(bool value) {
-  _internal_set_exists(value);
-  // @@protoc_insertion_point(field_set:GraphProto.RouteInternalData.exists)
+inline void Shortcut::set_from(uint32_t value) {
+  _internal_set_from(value);
+  // @@protoc_insertion_point(field_set:GraphProto.Shortcut.from)
 }
 
-// double weight = 2;
-inline void RouteInternalData::clear_weight() {
-  weight_ = 0;
+// uint32 to = 2;
+inline void Shortcut::clear_to() {
+  _impl_.to_ = 0u;
+}
+inline uint32_t Shortcut::_internal_to() const {
+  return _impl_.to_;
 }
-inline double RouteInternalData::_internal_weight() const {
-  return weight_;
+inline uint32_t Shortcut::to() const {
+  // @@protoc_insertion_point(field_get:GraphProto.Shortcut.to)
+  return _internal_to();
+}
+inline void Shortcut::_internal_set_to(uint32_t value) {
+  
+  _impl_.to_ = value;
+}
+inline void Shortcut::set_to(uint32_t value) {
+  _internal_set_to(value);
+  // @@protoc_insertion_point(field_set:GraphProto.Shortcut.to)
 }
-inline double RouteInternalData::weight() const {
-  // @@protoc_insertion_point(field_get:GraphProto.RouteInternalData.weight)
+
+// double weight = 3;
+inline void Shortcut::clear_weight() {
+  _impl_.weight_ = 0;
+}
+inline double Shortcut::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline double Shortcut::weight() const {
+  // @@protoc_insertion_point(field_get:GraphProto.Shortcut.weight)
   return _internal_weight();
 }
-inline void RouteInternalData::_internal_set_weight(double value) {
+inline void Shortcut::_internal_set_weight(double value) {
   
-  weight_ = value;
+  _impl_.weight_ = value;
 }
-inline void RouteInternalData::set_weight(double value) {
+inline void Shortcut::set_weight(double value) {
   _internal_set_weight(value);
-  // @@protoc_insertion_point(field_set:GraphProto.RouteInternalData.weight)
+  // @@protoc_insertion_point(field_set:GraphProto.Shortcut.weight)
 }
 
-// bool has_prev_edge = 3;
-inline void RouteInternalData::clear_has_prev_edge() {
-  has_prev_edge_ = false;
+// uint32 first = 4;
+inline void Shortcut::clear_first() {
+  _impl_.first_ = 0u;
 }
-inline bool RouteInternalData::_internal_has_prev_edge() const {
-  return has_prev_edge_;
+inline uint32_t Shortcut::_internal_first() const {
+  return _impl_.first_;
 }
-inline bool RouteInternalData::has_prev_edge() const {
-  // @@protoc_insertion_point(field_get:GraphProto.RouteInternalData.has_prev_edge)
-  return _internal_has_prev_edge();
+inline uint32_t Shortcut::first() const {
+  // @@protoc_insertion_point(field_get:GraphProto.Shortcut.first)
+  return _internal_first();
 }
-inline void RouteInternalData::_internal_set_has_prev_edge(bool value) {
+inline void Shortcut::_internal_set_first(uint32_t value) {
   
-  has_prev_edge_ = value;
+  _impl_.first_ = value;
 }
-inline void RouteInternalData::set_has_prev_edge(bool value) {
-  _internal_set_has_prev_edge(value);
-  // @@protoc_insertion_point(field_set:GraphProto.RouteInternalData.has_prev_edge)
+inline void Shortcut::set_first(uint32_t value) {
+  _internal_set_first(value);
+  // @@protoc_insertion_point(field_set:GraphProto.Shortcut.first)
 }
 
-// uint32 prev_edge = 4;
-inline void RouteInternalData::clear_prev_edge() {
-  prev_edge_ = 0u;
+// uint32 second = 5;
+inline void Shortcut::clear_second() {
+  _impl_.second_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 RouteInternalData::_internal_prev_edge() const {
-  return prev_edge_;
+inline uint32_t Shortcut::_internal_second() const {
+  return _impl_.second_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 RouteInternalData::prev_edge() const {
-  // @@protoc_insertion_point(field_get:GraphProto.RouteInternalData.prev_edge)
-  return _internal_prev_edge();
+inline uint32_t Shortcut::second() const {
+  // @@protoc_insertion_point(field_get:GraphProto.Shortcut.second)
+  return _internal_second();
 }
-inline void RouteInternalData::_internal_set_prev_edge(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Shortcut::_internal_set_second(uint32_t value) {
   
-  prev_edge_ = value;
+  _impl_.second_ = value;
 }
-inline void RouteInternalData::set_prev_edge(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_prev_edge(value);
-  // @@protoc_insertion_point(field_set:GraphProto.RouteInternalData.prev_edge)
+inline void Shortcut::set_second(uint32_t value) {
+  _internal_set_second(value);
+  // @@protoc_insertion_point(field_set:GraphProto.Shortcut.second)
 }
 
 // -------------------------------------------------------------------
 
-// RoutesInternalDataByTarget
+// ContractionHierarchy
+
+// repeated uint32 ranks = 1;
+inline int ContractionHierarchy::_internal_ranks_size() const {
+  return _impl_.ranks_.size();
+}
+inline int ContractionHierarchy::ranks_size() const {
+  return _internal_ranks_size();
+}
+inline void ContractionHierarchy::clear_ranks() {
+  _impl_.ranks_.Clear();
+}
+inline uint32_t ContractionHierarchy::_internal_ranks(int index) const {
+  return _impl_.ranks_.Get(index);
+}
+inline uint32_t ContractionHierarchy::ranks(int index) const {
+  // @@protoc_insertion_point(field_get:GraphProto.ContractionHierarchy.ranks)
+  return _internal_ranks(index);
+}
+inline void ContractionHierarchy::set_ranks(int index, uint32_t value) {
+  _impl_.ranks_.Set(index, value);
+  // @@protoc_insertion_point(field_set:GraphProto.ContractionHierarchy.ranks)
+}
+inline void ContractionHierarchy::_internal_add_ranks(uint32_t value) {
+  _impl_.ranks_.Add(value);
+}
+inline void ContractionHierarchy::add_ranks(uint32_t value) {
+  _internal_add_ranks(value);
+  // @@protoc_insertion_point(field_add:GraphProto.ContractionHierarchy.ranks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_ranks() const {
+  return _impl_.ranks_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::ranks() const {
+  // @@protoc_insertion_point(field_list:GraphProto.ContractionHierarchy.ranks)
+  return _internal_ranks();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_ranks() {
+  return &_impl_.ranks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_ranks() {
+  // @@protoc_insertion_point(field_mutable_list:GraphProto.ContractionHierarchy.ranks)
+  return _internal_mutable_ranks();
+}
 
-// repeated .GraphProto.RouteInternalData targets_data = 1;
-inline int RoutesInternalDataByTarget::_internal_targets_data_size() const {
-  return targets_data_.size();
+// repeated .GraphProto.Shortcut shortcuts = 2;
+inline int ContractionHierarchy::_internal_shortcuts_size() const {
+  return _impl_.shortcuts_.size();
 }
-inline int RoutesInternalDataByTarget::targets_data_size() const {
-  return _internal_targets_data_size();
+inline int ContractionHierarchy::shortcuts_size() const {
+  return _internal_shortcuts_size();
 }
-inline void RoutesInternalDataByTarget::clear_targets_data() {
-  targets_data_.Clear();
+inline void ContractionHierarchy::clear_shortcuts() {
+  _impl_.shortcuts_.Clear();
 }
-inline ::GraphProto::RouteInternalData* RoutesInternalDataByTarget::mutable_targets_data(int index) {
-  // @@protoc_insertion_point(field_mutable:GraphProto.RoutesInternalDataByTarget.targets_data)
-  return targets_data_.Mutable(index);
+inline ::GraphProto::Shortcut* ContractionHierarchy::mutable_shortcuts(int index) {
+  // @@protoc_insertion_point(field_mutable:GraphProto.ContractionHierarchy.shortcuts)
+  return _impl_.shortcuts_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RouteInternalData >*
-RoutesInternalDataByTarget::mutable_targets_data() {
-  // @@protoc_insertion_point(field_mutable_list:GraphProto.RoutesInternalDataByTarget.targets_data)
-  return &targets_data_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Shortcut >*
+ContractionHierarchy::mutable_shortcuts() {
+  // @@protoc_insertion_point(field_mutable_list:GraphProto.ContractionHierarchy.shortcuts)
+  return &_impl_.shortcuts_;
 }
-inline const ::GraphProto::RouteInternalData& RoutesInternalDataByTarget::_internal_targets_data(int index) const {
-  return targets_data_.Get(index);
+inline const ::GraphProto::Shortcut& ContractionHierarchy::_internal_shortcuts(int index) const {
+  return _impl_.shortcuts_.Get(index);
 }
-inline const ::GraphProto::RouteInternalData& RoutesInternalDataByTarget::targets_data(int index) const {
-  // @@protoc_insertion_point(field_get:GraphProto.RoutesInternalDataByTarget.targets_data)
-  return _internal_targets_data(index);
+inline const ::GraphProto::Shortcut& ContractionHierarchy::shortcuts(int index) const {
+  // @@protoc_insertion_point(field_get:GraphProto.ContractionHierarchy.shortcuts)
+  return _internal_shortcuts(index);
 }
-inline ::GraphProto::RouteInternalData* RoutesInternalDataByTarget::_internal_add_targets_data() {
-  return targets_data_.Add();
+inline ::GraphProto::Shortcut* ContractionHierarchy::_internal_add_shortcuts() {
+  return _impl_.shortcuts_.Add();
 }
-inline ::GraphProto::RouteInternalData* RoutesInternalDataByTarget::add_targets_data() {
-  // @@protoc_insertion_point(field_add:GraphProto.RoutesInternalDataByTarget.targets_data)
-  return _internal_add_targets_data();
+inline ::GraphProto::Shortcut* ContractionHierarchy::add_shortcuts() {
+  ::GraphProto::Shortcut* _add = _internal_add_shortcuts();
+  // @@protoc_insertion_point(field_add:GraphProto.ContractionHierarchy.shortcuts)
+  return _add;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RouteInternalData >&
-RoutesInternalDataByTarget::targets_data() const {
-  // @@protoc_insertion_point(field_list:GraphProto.RoutesInternalDataByTarget.targets_data)
-  return targets_data_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::Shortcut >&
+ContractionHierarchy::shortcuts() const {
+  // @@protoc_insertion_point(field_list:GraphProto.ContractionHierarchy.shortcuts)
+  return _impl_.shortcuts_;
 }
 
 // -------------------------------------------------------------------
 
 // Router
 
-// repeated .GraphProto.RoutesInternalDataByTarget sources_data = 1;
-inline int Router::_internal_sources_data_size() const {
-  return sources_data_.size();
+// .GraphProto.Router.Strategy strategy = 2;
+inline void Router::clear_strategy() {
+  _impl_.strategy_ = 0;
 }
-inline int Router::sources_data_size() const {
-  return _internal_sources_data_size();
+inline ::GraphProto::Router_Strategy Router::_internal_strategy() const {
+  return static_cast< ::GraphProto::Router_Strategy >(_impl_.strategy_);
 }
-inline void Router::clear_sources_data() {
-  sources_data_.Clear();
+inline ::GraphProto::Router_Strategy Router::strategy() const {
+  // @@protoc_insertion_point(field_get:GraphProto.Router.strategy)
+  return _internal_strategy();
 }
-inline ::GraphProto::RoutesInternalDataByTarget* Router::mutable_sources_data(int index) {
-  // @@protoc_insertion_point(field_mutable:GraphProto.Router.sources_data)
-  return sources_data_.Mutable(index);
+inline void Router::_internal_set_strategy(::GraphProto::Router_Strategy value) {
+  
+  _impl_.strategy_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RoutesInternalDataByTarget >*
-Router::mutable_sources_data() {
-  // @@protoc_insertion_point(field_mutable_list:GraphProto.Router.sources_data)
-  return &sources_data_;
+inline void Router::set_strategy(::GraphProto::Router_Strategy value) {
+  _internal_set_strategy(value);
+  // @@protoc_insertion_point(field_set:GraphProto.Router.strategy)
 }
-inline const ::GraphProto::RoutesInternalDataByTarget& Router::_internal_sources_data(int index) const {
-  return sources_data_.Get(index);
+
+// .GraphProto.ContractionHierarchy hierarchy = 3;
+inline bool Router::_internal_has_hierarchy() const {
+  return this != internal_default_instance() && _impl_.hierarchy_ != nullptr;
 }
-inline const ::GraphProto::RoutesInternalDataByTarget& Router::sources_data(int index) const {
-  // @@protoc_insertion_point(field_get:GraphProto.Router.sources_data)
-  return _internal_sources_data(index);
+inline bool Router::has_hierarchy() const {
+  return _internal_has_hierarchy();
 }
-inline ::GraphProto::RoutesInternalDataByTarget* Router::_internal_add_sources_data() {
-  return sources_data_.Add();
+inline void Router::clear_hierarchy() {
+  if (GetArenaForAllocation() == nullptr && _impl_.hierarchy_ != nullptr) {
+    delete _impl_.hierarchy_;
+  }
+  _impl_.hierarchy_ = nullptr;
 }
-inline ::GraphProto::RoutesInternalDataByTarget* Router::add_sources_data() {
-  // @@protoc_insertion_point(field_add:GraphProto.Router.sources_data)
-  return _internal_add_sources_data();
+inline const ::GraphProto::ContractionHierarchy& Router::_internal_hierarchy() const {
+  const ::GraphProto::ContractionHierarchy* p = _impl_.hierarchy_;
+  return p != nullptr ? *p : reinterpret_cast<const ::GraphProto::ContractionHierarchy&>(
+      ::GraphProto::_ContractionHierarchy_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::GraphProto::RoutesInternalDataByTarget >&
-Router::sources_data() const {
-  // @@protoc_insertion_point(field_list:GraphProto.Router.sources_data)
-  return sources_data_;
+inline const ::GraphProto::ContractionHierarchy& Router::hierarchy() const {
+  // @@protoc_insertion_point(field_get:GraphProto.Router.hierarchy)
+  return _internal_hierarchy();
+}
+inline void Router::unsafe_arena_set_allocated_hierarchy(
+    ::GraphProto::ContractionHierarchy* hierarchy) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hierarchy_);
+  }
+  _impl_.hierarchy_ = hierarchy;
+  if (hierarchy) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:GraphProto.Router.hierarchy)
+}
+inline ::GraphProto::ContractionHierarchy* Router::release_hierarchy() {
+  
+  ::GraphProto::ContractionHierarchy* temp = _impl_.hierarchy_;
+  _impl_.hierarchy_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::GraphProto::ContractionHierarchy* Router::unsafe_arena_release_hierarchy() {
+  // @@protoc_insertion_point(field_release:GraphProto.Router.hierarchy)
+  
+  ::GraphProto::ContractionHierarchy* temp = _impl_.hierarchy_;
+  _impl_.hierarchy_ = nullptr;
+  return temp;
+}
+inline ::GraphProto::ContractionHierarchy* Router::_internal_mutable_hierarchy() {
+  
+  if (_impl_.hierarchy_ == nullptr) {
+    auto* p = CreateMaybeMessage<::GraphProto::ContractionHierarchy>(GetArenaForAllocation());
+    _impl_.hierarchy_ = p;
+  }
+  return _impl_.hierarchy_;
+}
+inline ::GraphProto::ContractionHierarchy* Router::mutable_hierarchy() {
+  ::GraphProto::ContractionHierarchy* _msg = _internal_mutable_hierarchy();
+  // @@protoc_insertion_point(field_mutable:GraphProto.Router.hierarchy)
+  return _msg;
+}
+inline void Router::set_allocated_hierarchy(::GraphProto::ContractionHierarchy* hierarchy) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hierarchy_;
+  }
+  if (hierarchy) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hierarchy);
+    if (message_arena != submessage_arena) {
+      hierarchy = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hierarchy, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.hierarchy_ = hierarchy;
+  // @@protoc_insertion_point(field_set_allocated:GraphProto.Router.hierarchy)
+}
+
+// uint32 vertex_count = 4;
+inline void Router::clear_vertex_count() {
+  _impl_.vertex_count_ = 0u;
+}
+inline uint32_t Router::_internal_vertex_count() const {
+  return _impl_.vertex_count_;
+}
+inline uint32_t Router::vertex_count() const {
+  // @@protoc_insertion_point(field_get:GraphProto.Router.vertex_count)
+  return _internal_vertex_count();
+}
+inline void Router::_internal_set_vertex_count(uint32_t value) {
+  
+  _impl_.vertex_count_ = value;
+}
+inline void Router::set_vertex_count(uint32_t value) {
+  _internal_set_vertex_count(value);
+  // @@protoc_insertion_point(field_set:GraphProto.Router.vertex_count)
 }
 
 #ifdef __GNUC__
@@ -1407,6 +1748,16 @@ Router::sources_data() const {
 
 }  // namespace GraphProto
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::GraphProto::Router_Strategy> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::GraphProto::Router_Strategy>() {
+  return ::GraphProto::Router_Strategy_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
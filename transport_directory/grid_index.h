@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+// Uniform grid over a rectangle for finding the items near a place. An item
+// is registered in every cell its bounding box touches, so a query looks only
+// at the cells under the query box. Several boxes may share one id, e.g. the
+// segments of a line.
+class GridIndex {
+public:
+  struct Box {
+    double min_x = 0;
+    double min_y = 0;
+    double max_x = 0;
+    double max_y = 0;
+
+    bool Intersects(const Box& other) const {
+      return min_x <= other.max_x && other.min_x <= max_x
+        && min_y <= other.max_y && other.min_y <= max_y;
+    }
+  };
+
+  GridIndex() = default;
+
+  // The grid gets about ITEMS_PER_CELL boxes per cell if they are spread evenly.
+  // Boxes out of bounds are still found, they just fall into the border cells.
+  GridIndex(const Box& bounds, size_t box_count)
+    : bounds_(bounds),
+    side_(std::clamp<size_t>(static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(box_count) / ITEMS_PER_CELL))), 1, MAX_SIDE)),
+    cell_width_(CellSize(bounds.max_x - bounds.min_x)),
+    cell_height_(CellSize(bounds.max_y - bounds.min_y)),
+    cells_(side_ * side_)
+  {
+  }
+
+  void Insert(size_t id, const Box& box) {
+    const size_t entry = entries_.size();
+    entries_.push_back({ id, box });
+    const auto [first_col, last_col] = Columns(box);
+    const auto [first_row, last_row] = Rows(box);
+    for (size_t row = first_row; row <= last_row; ++row) {
+      for (size_t col = first_col; col <= last_col; ++col) {
+        cells_[row * side_ + col].push_back(entry);
+      }
+    }
+  }
+
+  // Ids of the boxes intersecting box, ascending and without repeats
+  std::vector<size_t> Query(const Box& box) const {
+    std::vector<size_t> result;
+    if (cells_.empty()) {
+      return result;
+    }
+    const auto [first_col, last_col] = Columns(box);
+    const auto [first_row, last_row] = Rows(box);
+    for (size_t row = first_row; row <= last_row; ++row) {
+      for (size_t col = first_col; col <= last_col; ++col) {
+        for (const size_t entry : cells_[row * side_ + col]) {
+          if (entries_[entry].box.Intersects(box)) {
+            result.push_back(entries_[entry].id);
+          }
+        }
+      }
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+  }
+
+private:
+  static constexpr size_t ITEMS_PER_CELL = 4;
+  static constexpr size_t MAX_SIDE = 1024;
+
+  struct Entry {
+    size_t id;
+    Box box;
+  };
+
+  Box bounds_;
+  size_t side_ = 0;
+  double cell_width_ = 1;
+  double cell_height_ = 1;
+  std::vector<std::vector<size_t>> cells_;
+  std::vector<Entry> entries_;
+
+  double CellSize(double extent) const {
+    return extent > 0 ? extent / side_ : 1;
+  }
+
+  size_t CellOf(double value, double min, double cell_size) const {
+    const double cell = std::floor((value - min) / cell_size);
+    return static_cast<size_t>(std::clamp(cell, 0.0, static_cast<double>(side_ - 1)));
+  }
+
+  std::pair<size_t, size_t> Columns(const Box& box) const {
+    return { CellOf(box.min_x, bounds_.min_x, cell_width_), CellOf(box.max_x, bounds_.min_x, cell_width_) };
+  }
+
+  std::pair<size_t, size_t> Rows(const Box& box) const {
+    return { CellOf(box.min_y, bounds_.min_y, cell_height_), CellOf(box.max_y, bounds_.min_y, cell_height_) };
+  }
+};
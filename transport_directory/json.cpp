@@ -1,153 +1,68 @@
 #include "json.h"
+#include "json_scanner.h"
+
+#include <charconv>
+#include <string_view>
 
 using namespace std;
 
 namespace Json {
 
-  Node LoadArray(istream& input) {
-    vector<Node> result;
-
-    for (char c; input >> c && c != ']'; ) {
-      if (c != ',') {
-        input.putback(c);
+  namespace {
+
+    Node ParseNode(Scanner& scanner, string& buffer) {
+      switch (scanner.NextToken()) {
+      case '[': {
+        scanner.Expect('[');
+        vector<Node> result;
+        if (scanner.Skip(']')) {
+          return Node(move(result));
+        }
+        do {
+          result.push_back(ParseNode(scanner, buffer));
+        } while (scanner.Skip(','));
+        scanner.Expect(']');
+        return Node(move(result));
       }
-      result.push_back(LoadNode(input));
-    }
-
-    return Node(move(result));
-  }
-
-  Node LoadBool(istream& input) {
-    string s;
-    while (isalpha(input.peek())) {
-      s.push_back(input.get());
-    }
-    return Node(s == "true");
-  }
-
-  Node LoadNumber(istream& input) {
-    bool is_negative = false;
-    if (input.peek() == '-') {
-      is_negative = true;
-      input.get();
-    }
-    int int_part = 0;
-    while (isdigit(input.peek())) {
-      int_part *= 10;
-      int_part += input.get() - '0';
-    }
-    if (input.peek() != '.') {
-      return Node(int_part * (is_negative ? -1 : 1));
-    }
-    input.get();  // '.'
-    double result = int_part;
-    double frac_mult = 0.1;
-    while (isdigit(input.peek())) {
-      result += frac_mult * (input.get() - '0');
-      frac_mult /= 10;
-    }
-    return Node(result * (is_negative ? -1 : 1));
-  }
-
-  Node LoadString(istream& input) {
-    string line;
-    getline(input, line, '"');
-    return Node(move(line));
-  }
-
-  Node LoadDict(istream& input) {
-    Dict result;
-
-    for (char c; input >> c && c != '}'; ) {
-      if (c == ',') {
-        input >> c;
+      case '{': {
+        scanner.Expect('{');
+        Dict result;
+        if (scanner.Skip('}')) {
+          return Node(move(result));
+        }
+        do {
+          string key(scanner.ReadString(buffer));
+          scanner.Expect(':');
+          result.emplace(move(key), ParseNode(scanner, buffer));
+        } while (scanner.Skip(','));
+        scanner.Expect('}');
+        return Node(move(result));
       }
-
-      string key = LoadString(input).AsString();
-      input >> c;
-      result.emplace(move(key), LoadNode(input));
-    }
-
-    return Node(move(result));
-  }
-
-  Node LoadNode(istream& input) {
-    char c;
-    input >> c;
-
-    if (c == '[') {
-      return LoadArray(input);
-    } else if (c == '{') {
-      return LoadDict(input);
-    } else if (c == '"') {
-      return LoadString(input);
-    } else if (c == 't' || c == 'f') {
-      input.putback(c);
-      return LoadBool(input);
-    } else {
-      input.putback(c);
-      return LoadNumber(input);
-    }
-  }
-
-  Document Load(istream& input) {
-    return Document{LoadNode(input)};
-  }
-
-  template <>
-  void PrintValue<string>(const string& value, ostream& output) {
-    output << '"';
-    for (const char c : value) {
-      if (c == '"' || c == '\\') {
-        output << '\\';
+      case '"':
+        return Node(string(scanner.ReadString(buffer)));
+      case 't':
+      case 'f':
+        return Node(scanner.ReadBool());
+      default:
+        return visit([](auto value) { return Node(value); }, scanner.ReadNumber());
       }
-      output << c;
     }
-    output << '"';
-  }
 
-  template <>
-  void PrintValue<bool>(const bool& value, std::ostream& output) {
-    output << std::boolalpha << value;
   }
 
-  template <>
-  void PrintValue<std::vector<Node>>(const std::vector<Node>& nodes, std::ostream& output) {
-    output << '[';
-    bool first = true;
-    for (const Node& node : nodes) {
-      if (!first) {
-        output << ", ";
-      }
-      first = false;
-      PrintNode(node, output);
-    }
-    output << ']';
+  Document Load(string_view input) {
+    Scanner scanner(input);
+    string buffer;
+    return Document{ParseNode(scanner, buffer)};
   }
 
-  template <>
-  void PrintValue<Dict>(const Dict& dict, std::ostream& output) {
-    output << '{';
-    bool first = true;
-    for (const auto& [key, node]: dict) {
-      if (!first) {
-        output << ", ";
-      }
-      first = false;
-      PrintValue(key, output);
-      output << ": ";
-      PrintNode(node, output);
-    }
-    output << '}';
-  }
-
-  void PrintNode(const Json::Node& node, ostream& output) {
-    visit([&output](const auto& value) { PrintValue(value, output); },
-          node.GetBase());
+  Document Load(istream& input) {
+    return Load(ReadAll(input));
   }
 
-  void Print(const Document& document, ostream& output) {
-    PrintNode(document.GetRoot(), output);
+  string_view FormatDouble(double value, char* buffer) {
+    const auto result = to_chars(buffer, buffer + DOUBLE_BUFFER_SIZE, value);
+    return { buffer, static_cast<size_t>(result.ptr - buffer) };
   }
 
 }
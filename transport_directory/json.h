@@ -3,6 +3,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -39,30 +40,15 @@ namespace Json {
     Node root;
   };
 
-  Node LoadNode(std::istream& input);
-
+  // The whole input is parsed from one contiguous buffer
+  Document Load(std::string_view input);
   Document Load(std::istream& input);
 
-  void PrintNode(const Node& node, std::ostream& output);
-
-  template <typename Value>
-  void PrintValue(const Value& value, std::ostream& output) {
-    output << value;
-  }
-
-  template <>
-  void PrintValue<std::string>(const std::string& value, std::ostream& output);
-
-  template <>
-  void PrintValue<bool>(const bool& value, std::ostream& output);
-
-  template <>
-  void PrintValue<std::vector<Node>>(const std::vector<Node>& nodes, std::ostream& output);
-
-  template <>
-  void PrintValue<Dict>(const Dict& dict, std::ostream& output);
+  // Enough for any double printed by FormatDouble
+  constexpr size_t DOUBLE_BUFFER_SIZE = 32;
 
-  void Print(const Document& document, std::ostream& output);
+  // Writes the shortest text that reads back to the same value into buffer
+  std::string_view FormatDouble(double value, char* buffer);
 
 }
 
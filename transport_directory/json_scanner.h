@@ -0,0 +1,268 @@
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+
+namespace Json {
+
+  // Reads the rest of the stream into one buffer for the scanner
+  inline std::string ReadAll(std::istream& input) {
+    std::string data;
+    char buffer[1 << 16];
+    while (input.read(buffer, sizeof(buffer)) || input.gcount() > 0) {
+      data.append(buffer, input.gcount());
+    }
+    return data;
+  }
+
+  // Tokenizer over a contiguous buffer shared by the JSON readers.
+  // It knows the lexical rules only; building values is up to the caller.
+  class Scanner {
+  public:
+    explicit Scanner(std::string_view input) : pos_(input.data()), end_(input.data() + input.size()) {}
+
+    // Skips whitespace and returns the next character without consuming it
+    char NextToken() {
+      while (pos_ != end_ && IsSpace(*pos_)) {
+        ++pos_;
+      }
+      if (pos_ == end_) {
+        throw std::runtime_error("Unexpected end of JSON input");
+      }
+      return *pos_;
+    }
+
+    // Consumes the next character if it is c
+    bool Skip(char c) {
+      if (NextToken() != c) {
+        return false;
+      }
+      ++pos_;
+      return true;
+    }
+
+    void Expect(char c) {
+      if (!Skip(c)) {
+        throw std::runtime_error(std::string("Expected '") + c + "' in JSON input");
+      }
+    }
+
+    // Reads a string starting with the opening quote. Without escapes the result
+    // points into the input; otherwise it is decoded into buffer and points there.
+    std::string_view ReadString(std::string& buffer) {
+      Expect('"');
+      const char* begin = pos_;
+      const char* chunk_end = FindChunkEnd();
+      if (*chunk_end == '"') {
+        pos_ = chunk_end + 1;
+        return { begin, static_cast<size_t>(chunk_end - begin) };
+      }
+      buffer.clear();
+      while (true) {
+        buffer.append(pos_, chunk_end);
+        pos_ = chunk_end;
+        if (*pos_++ == '"') {
+          return buffer;
+        }
+        ReadEscape(buffer);
+        chunk_end = FindChunkEnd();
+      }
+    }
+
+    bool ReadBool() {
+      NextToken();
+      const std::string_view rest(pos_, end_ - pos_);
+      if (rest.substr(0, 4) == "true") {
+        pos_ += 4;
+        return true;
+      }
+      if (rest.substr(0, 5) == "false") {
+        pos_ += 5;
+        return false;
+      }
+      throw std::runtime_error("Bad literal in JSON input");
+    }
+
+    // Numbers without a fraction or an exponent are ints. Doubles are parsed
+    // with from_chars, so they are rounded correctly.
+    std::variant<int, double> ReadNumber() {
+      NextToken();
+      const char* begin = pos_;
+      bool is_integer = true;
+      while (pos_ != end_) {
+        const char c = *pos_;
+        if (c == '.' || c == 'e' || c == 'E') {
+          is_integer = false;
+        } else if (!IsDigit(c) && c != '-' && c != '+') {
+          break;
+        }
+        ++pos_;
+      }
+      if (is_integer) {
+        return ParseNumber<int>(begin);
+      }
+      return ParseNumber<double>(begin);
+    }
+
+    // Skips the next value without decoding it
+    void SkipValue() {
+      size_t depth = 0;
+      do {
+        switch (NextToken()) {
+        case '[':
+        case '{':
+          ++pos_;
+          ++depth;
+          break;
+        case ']':
+        case '}':
+          if (depth == 0) {
+            throw std::runtime_error("Unbalanced brackets in JSON input");
+          }
+          ++pos_;
+          --depth;
+          break;
+        case ',':
+        case ':':
+          ++pos_;
+          break;
+        case '"':
+          SkipString();
+          break;
+        case 't':
+        case 'f':
+          ReadBool();
+          break;
+        default:
+          if (*pos_ != '-' && !IsDigit(*pos_)) {
+            throw std::runtime_error("Unexpected character in JSON input");
+          }
+          ReadNumber();
+        }
+      } while (depth > 0);
+    }
+
+  private:
+    const char* pos_;
+    const char* end_;
+
+    static bool IsSpace(char c) {
+      return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    template <typename Number>
+    Number ParseNumber(const char* begin) const {
+      Number result;
+      const auto [end, error] = std::from_chars(begin, pos_, result);
+      if (error != std::errc() || end != pos_) {
+        throw std::runtime_error("Bad number in JSON input: " + std::string(begin, pos_));
+      }
+      return result;
+    }
+
+    static bool IsDigit(char c) {
+      return static_cast<unsigned char>(c - '0') < 10;
+    }
+
+    // Finds the closing quote or the first backslash before it with memchr
+    const char* FindChunkEnd() const {
+      const auto* quote = static_cast<const char*>(std::memchr(pos_, '"', end_ - pos_));
+      if (!quote) {
+        throw std::runtime_error("Unterminated string in JSON input");
+      }
+      const auto* backslash = static_cast<const char*>(std::memchr(pos_, '\\', quote - pos_));
+      return backslash ? backslash : quote;
+    }
+
+    void SkipString() {
+      Expect('"');
+      while (true) {
+        const char* chunk_end = FindChunkEnd();
+        pos_ = chunk_end + 1;
+        if (*chunk_end == '"') {
+          return;
+        }
+        if (pos_ == end_) {
+          throw std::runtime_error("Unterminated string in JSON input");
+        }
+        ++pos_;  // the escaped character
+      }
+    }
+
+    void ReadEscape(std::string& result) {
+      if (pos_ == end_) {
+        throw std::runtime_error("Unterminated string in JSON input");
+      }
+      switch (const char c = *pos_++) {
+      case 'n': result.push_back('\n'); break;
+      case 't': result.push_back('\t'); break;
+      case 'r': result.push_back('\r'); break;
+      case 'b': result.push_back('\b'); break;
+      case 'f': result.push_back('\f'); break;
+      case 'u': AppendUtf8(result, ReadCodePoint()); break;
+      default: result.push_back(c);
+      }
+    }
+
+    uint32_t ReadHex4() {
+      if (end_ - pos_ < 4) {
+        throw std::runtime_error("Bad unicode escape in JSON input");
+      }
+      uint32_t code = 0;
+      for (int i = 0; i < 4; ++i) {
+        const char c = *pos_++;
+        code <<= 4;
+        if (IsDigit(c)) code |= c - '0';
+        else if (c >= 'a' && c <= 'f') code |= c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') code |= c - 'A' + 10;
+        else throw std::runtime_error("Bad unicode escape in JSON input");
+      }
+      return code;
+    }
+
+    // Characters beyond the basic plane are escaped as a surrogate pair, \uD83D\uDE00
+    uint32_t ReadCodePoint() {
+      const uint32_t code = ReadHex4();
+      if (code >= 0xDC00 && code <= 0xDFFF) {
+        throw std::runtime_error("Unpaired surrogate in JSON input");
+      }
+      if (code < 0xD800 || code > 0xDBFF) {
+        return code;
+      }
+      if (end_ - pos_ < 2 || pos_[0] != '\\' || pos_[1] != 'u') {
+        throw std::runtime_error("Unpaired surrogate in JSON input");
+      }
+      pos_ += 2;
+      const uint32_t low = ReadHex4();
+      if (low < 0xDC00 || low > 0xDFFF) {
+        throw std::runtime_error("Unpaired surrogate in JSON input");
+      }
+      return 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+    }
+
+    static void AppendUtf8(std::string& result, uint32_t code) {
+      if (code < 0x80) {
+        result.push_back(static_cast<char>(code));
+      } else if (code < 0x800) {
+        result.push_back(static_cast<char>(0xC0 | (code >> 6)));
+        result.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+      } else if (code < 0x10000) {
+        result.push_back(static_cast<char>(0xE0 | (code >> 12)));
+        result.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+      } else {
+        result.push_back(static_cast<char>(0xF0 | (code >> 18)));
+        result.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+      }
+    }
+  };
+
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "json_scanner.h"
+#include "json_view.h"
+
+#include <string>
+#include <string_view>
+
+namespace Json {
+
+  // Event-driven reader of a big document. The caller is called back for every
+  // member of an object or item of an array and reads just that value, so the
+  // document never exists as a whole tree. The input must outlive the reader.
+  class StreamReader {
+  public:
+    explicit StreamReader(std::string_view input) : input_(input), scanner_(input) {}
+
+    // Calls on_member(key) for every member of the next object. The handler
+    // must read or skip the value; key is valid until then.
+    template <typename Handler>
+    void ReadObject(Handler on_member) {
+      scanner_.Expect('{');
+      if (scanner_.Skip('}')) {
+        return;
+      }
+      do {
+        const std::string key(scanner_.ReadString(buffer_));
+        scanner_.Expect(':');
+        on_member(std::string_view(key));
+      } while (scanner_.Skip(','));
+      scanner_.Expect('}');
+    }
+
+    // Calls on_item() for every item of the next array; the handler must read or skip it
+    template <typename Handler>
+    void ReadArray(Handler on_item) {
+      scanner_.Expect('[');
+      if (scanner_.Skip(']')) {
+        return;
+      }
+      do {
+        on_item();
+      } while (scanner_.Skip(','));
+      scanner_.Expect(']');
+    }
+
+    // The view is valid until the arena is reset
+    NodeView ReadView(Arena& arena) {
+      return ParseView(scanner_, input_, arena);
+    }
+
+    void SkipValue() {
+      scanner_.SkipValue();
+    }
+
+  private:
+    std::string_view input_;
+    Scanner scanner_;
+    std::string buffer_;
+  };
+
+}
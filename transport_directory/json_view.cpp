@@ -0,0 +1,232 @@
+#include "json_view.h"
+#include "json_scanner.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace Json {
+
+  void* Arena::AllocateBytes(size_t size, size_t alignment) {
+    size_t padding = pos_ ? (alignment - reinterpret_cast<uintptr_t>(pos_) % alignment) % alignment : 0;
+    if (!pos_ || padding + size > left_) {
+      const size_t block_size = max(BLOCK_SIZE, size + alignment);
+      blocks_.push_back(make_unique<byte[]>(block_size));
+      pos_ = blocks_.back().get();
+      left_ = block_size;
+      padding = (alignment - reinterpret_cast<uintptr_t>(pos_) % alignment) % alignment;
+    }
+    void* result = pos_ + padding;
+    pos_ += padding + size;
+    left_ -= padding + size;
+    return result;
+  }
+
+
+  void Arena::Reset() {
+    if (blocks_.empty()) {
+      return;
+    }
+    blocks_.resize(1);
+    pos_ = blocks_.front().get();
+    left_ = BLOCK_SIZE;  // blocks are never smaller than that
+  }
+
+
+  // Children of the containers being parsed are collected on shared stacks
+  // and moved to the arena in one piece when their container is closed
+  class ViewBuilder {
+  public:
+    ViewBuilder(Scanner& scanner, string_view input, Arena& arena) : input_(input), scanner_(scanner), arena_(arena) {}
+
+    NodeView Build() {
+      return ParseNode();
+    }
+
+  private:
+    string_view input_;
+    Scanner& scanner_;
+    Arena& arena_;
+    string buffer_;
+    vector<NodeView> items_;
+    vector<NodeView::Member> members_;
+
+    NodeView ParseNode() {
+      NodeView node;
+      switch (scanner_.NextToken()) {
+      case '[':
+        ParseArray(node);
+        break;
+      case '{':
+        ParseDict(node);
+        break;
+      case '"':
+        node.type_ = NodeView::Type::STRING;
+        SetString(node, ReadString());
+        break;
+      case 't':
+      case 'f':
+        node.type_ = NodeView::Type::BOOL;
+        node.bool_ = scanner_.ReadBool();
+        break;
+      default:
+        if (const auto number = scanner_.ReadNumber(); holds_alternative<int>(number)) {
+          node.type_ = NodeView::Type::INT;
+          node.int_ = get<int>(number);
+        } else {
+          node.type_ = NodeView::Type::DOUBLE;
+          node.double_ = get<double>(number);
+        }
+      }
+      return node;
+    }
+
+    void ParseArray(NodeView& node) {
+      scanner_.Expect('[');
+      const size_t first = items_.size();
+      if (!scanner_.Skip(']')) {
+        do {
+          NodeView item = ParseNode();
+          items_.push_back(item);
+        } while (scanner_.Skip(','));
+        scanner_.Expect(']');
+      }
+      node.type_ = NodeView::Type::ARRAY;
+      node.size_ = items_.size() - first;
+      NodeView* items = arena_.Allocate<NodeView>(node.size_);
+      uninitialized_copy(items_.begin() + first, items_.end(), items);
+      items_.resize(first);
+      node.items_ = items;
+    }
+
+    // Duplicate keys keep the first value, as with emplace into Json::Dict
+    void ParseDict(NodeView& node) {
+      scanner_.Expect('{');
+      const size_t first = members_.size();
+      if (!scanner_.Skip('}')) {
+        do {
+          const string_view key = ReadString();
+          scanner_.Expect(':');
+          NodeView value = ParseNode();
+          members_.emplace_back(key, value);
+        } while (scanner_.Skip(','));
+        scanner_.Expect('}');
+      }
+      const auto begin = members_.begin() + first;
+      stable_sort(begin, members_.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+      const auto end = unique(begin, members_.end(), [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first; });
+      node.type_ = NodeView::Type::DICT;
+      node.size_ = end - begin;
+      NodeView::Member* members = arena_.Allocate<NodeView::Member>(node.size_);
+      uninitialized_copy(begin, end, members);
+      members_.resize(first);
+      node.members_ = members;
+    }
+
+    // Strings without escapes stay in the input, decoded ones are copied to the arena
+    string_view ReadString() {
+      const string_view value = scanner_.ReadString(buffer_);
+      if (value.data() >= input_.data() && value.data() < input_.data() + input_.size()) {
+        return value;
+      }
+      char* chars = arena_.Allocate<char>(value.size());
+      copy(value.begin(), value.end(), chars);
+      return { chars, value.size() };
+    }
+
+    static void SetString(NodeView& node, string_view value) {
+      node.chars_ = value.data();
+      node.size_ = value.size();
+    }
+  };
+
+
+  void NodeView::CheckType(Type type) const {
+    if (type_ != type) {
+      throw runtime_error("Unexpected JSON value type");
+    }
+  }
+
+  ArrayView NodeView::AsArray() const {
+    CheckType(Type::ARRAY);
+    return { items_, size_ };
+  }
+
+  DictView NodeView::AsMap() const {
+    CheckType(Type::DICT);
+    return { members_, size_ };
+  }
+
+  bool NodeView::AsBool() const {
+    CheckType(Type::BOOL);
+    return bool_;
+  }
+
+  int NodeView::AsInt() const {
+    CheckType(Type::INT);
+    return int_;
+  }
+
+  double NodeView::AsDouble() const {
+    if (type_ == Type::INT) {
+      return int_;
+    }
+    CheckType(Type::DOUBLE);
+    return double_;
+  }
+
+  string_view NodeView::AsString() const {
+    CheckType(Type::STRING);
+    return { chars_, size_ };
+  }
+
+  Node NodeView::ToNode() const {
+    switch (type_) {
+    case Type::ARRAY: {
+      vector<Node> result;
+      result.reserve(size_);
+      for (const NodeView& item : AsArray()) {
+        result.push_back(item.ToNode());
+      }
+      return Node(move(result));
+    }
+    case Type::DICT: {
+      Dict result;
+      for (const auto& [key, value] : AsMap()) {
+        result.emplace_hint(result.end(), string(key), value.ToNode());
+      }
+      return Node(move(result));
+    }
+    case Type::BOOL:
+      return Node(bool_);
+    case Type::INT:
+      return Node(int_);
+    case Type::DOUBLE:
+      return Node(double_);
+    default:
+      return Node(string(AsString()));
+    }
+  }
+
+
+  const NodeView* DictView::Find(string_view key) const {
+    const auto it = lower_bound(begin(), end(), key, [](const Member& member, string_view key) {
+      return member.first < key;
+    });
+    return it != end() && it->first == key ? &it->second : nullptr;
+  }
+
+  const NodeView& DictView::at(string_view key) const {
+    if (const NodeView* value = Find(key)) {
+      return *value;
+    }
+    throw out_of_range("No key " + string(key) + " in JSON object");
+  }
+
+
+  NodeView ParseView(Scanner& scanner, string_view input, Arena& arena) {
+    return ViewBuilder(scanner, input, arena).Build();
+  }
+
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "json.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Read-only JSON tree for big inputs. All nodes of a document live in one
+// monotonic arena, objects are flat arrays of members sorted by key, and
+// strings point into the input unless they had escapes. Parsing and
+// destruction cost a few large allocations instead of one per node.
+namespace Json {
+
+  class Arena {
+  public:
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena(Arena&&) = default;
+    Arena& operator=(Arena&&) = default;
+
+    // Only trivially destructible objects are allowed, the arena never calls destructors
+    template <typename T>
+    T* Allocate(size_t count) {
+      return static_cast<T*>(AllocateBytes(count * sizeof(T), alignof(T)));
+    }
+
+    // Frees everything allocated so far but keeps the first block for reuse
+    void Reset();
+
+  private:
+    static constexpr size_t BLOCK_SIZE = 1 << 20;
+
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    std::byte* pos_ = nullptr;
+    size_t left_ = 0;
+
+    void* AllocateBytes(size_t size, size_t alignment);
+  };
+
+  class ArrayView;
+  class DictView;
+  class Scanner;
+
+  class NodeView {
+  public:
+    enum class Type : uint8_t { ARRAY, DICT, BOOL, INT, DOUBLE, STRING };
+
+    Type GetType() const { return type_; }
+
+    ArrayView AsArray() const;
+    DictView AsMap() const;
+    bool AsBool() const;
+    int AsInt() const;
+    double AsDouble() const;
+    std::string_view AsString() const;
+
+    // Deep copy into the regular tree, for consumers that need Json::Node
+    Node ToNode() const;
+
+  private:
+    friend class ViewBuilder;
+    using Member = std::pair<std::string_view, NodeView>;
+
+    Type type_ = Type::INT;
+    uint32_t size_ = 0;  // items of an array, members of a dict or chars of a string
+    union {
+      const NodeView* items_;
+      const Member* members_;
+      const char* chars_;
+      bool bool_;
+      int int_;
+      double double_ = 0;
+    };
+
+    void CheckType(Type type) const;
+  };
+
+  class ArrayView {
+  public:
+    ArrayView(const NodeView* items, size_t size) : items_(items), size_(size) {}
+
+    const NodeView* begin() const { return items_; }
+    const NodeView* end() const { return items_ + size_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const NodeView& operator[](size_t idx) const { return items_[idx]; }
+    const NodeView& front() const { return items_[0]; }
+    const NodeView& back() const { return items_[size_ - 1]; }
+
+  private:
+    const NodeView* items_;
+    size_t size_;
+  };
+
+  // Members are sorted by key, so lookups are binary searches
+  class DictView {
+  public:
+    using Member = std::pair<std::string_view, NodeView>;
+
+    DictView(const Member* members, size_t size) : members_(members), size_(size) {}
+
+    const Member* begin() const { return members_; }
+    const Member* end() const { return members_ + size_; }
+    size_t size() const { return size_; }
+
+    const NodeView* Find(std::string_view key) const;
+    size_t count(std::string_view key) const { return Find(key) ? 1 : 0; }
+    const NodeView& at(std::string_view key) const;
+
+  private:
+    const Member* members_;
+    size_t size_;
+  };
+
+  // Parses the next value of the scanner into the arena. Strings without escapes
+  // point into input, which is the buffer the scanner reads.
+  NodeView ParseView(Scanner& scanner, std::string_view input, Arena& arena);
+
+}
@@ -0,0 +1,140 @@
+#include "json_writer.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace Json {
+
+  Writer& Writer::BeginObject() {
+    BeginValue();
+    output_ += '{';
+    needs_separator_ = false;
+    return *this;
+  }
+
+  Writer& Writer::EndObject() {
+    output_ += '}';
+    needs_separator_ = true;
+    return *this;
+  }
+
+  Writer& Writer::BeginArray() {
+    BeginValue();
+    output_ += '[';
+    needs_separator_ = false;
+    return *this;
+  }
+
+  Writer& Writer::EndArray() {
+    output_ += ']';
+    needs_separator_ = true;
+    return *this;
+  }
+
+  Writer& Writer::Key(string_view key) {
+    BeginValue();
+    AppendString(key);
+    output_ += ": ";
+    needs_separator_ = false;
+    return *this;
+  }
+
+  Writer& Writer::Value(string_view value) {
+    BeginValue();
+    AppendString(value);
+    needs_separator_ = true;
+    return *this;
+  }
+
+  Writer& Writer::Value(int value) {
+    BeginValue();
+    output_ += to_string(value);
+    needs_separator_ = true;
+    return *this;
+  }
+
+  Writer& Writer::Value(double value) {
+    BeginValue();
+    char buffer[DOUBLE_BUFFER_SIZE];
+    output_.append(FormatDouble(value, buffer));
+    needs_separator_ = true;
+    return *this;
+  }
+
+  Writer& Writer::Value(bool value) {
+    BeginValue();
+    output_ += value ? "true" : "false";
+    needs_separator_ = true;
+    return *this;
+  }
+
+  Writer& Writer::Value(const Node& node) {
+    visit([this](const auto& value) {
+      using ValueType = decay_t<decltype(value)>;
+      if constexpr (is_same_v<ValueType, vector<Node>>) {
+        BeginArray();
+        for (const Node& item : value) {
+          Value(item);
+        }
+        EndArray();
+      } else if constexpr (is_same_v<ValueType, Dict>) {
+        BeginObject();
+        for (const auto& [key, item] : value) {
+          Key(key).Value(item);
+        }
+        EndObject();
+      } else {
+        Value(value);
+      }
+    }, node.GetBase());
+    return *this;
+  }
+
+  Writer& Writer::RawMembers(string_view members) {
+    if (!members.empty()) {
+      BeginValue();
+      output_.append(members);
+      needs_separator_ = true;
+    }
+    return *this;
+  }
+
+  void Writer::BeginValue() {
+    if (needs_separator_) {
+      output_ += ", ";
+    }
+  }
+
+  // Runs without characters to escape are appended in one piece. All control
+  // characters are escaped too, so a response always fits on one line.
+  void Writer::AppendString(string_view value) {
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+    output_ += '"';
+    while (!value.empty()) {
+      const auto special = find_if(value.begin(), value.end(), [](char c) {
+        return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+      });
+      output_.append(value.begin(), special);
+      if (special == value.end()) {
+        break;
+      }
+      output_ += '\\';
+      switch (*special) {
+      case '\n': output_ += 'n'; break;
+      case '\r': output_ += 'r'; break;
+      case '\t': output_ += 't'; break;
+      case '\b': output_ += 'b'; break;
+      case '\f': output_ += 'f'; break;
+      case '"': case '\\': output_ += *special; break;
+      default:
+        output_ += "u00";
+        output_ += HEX_DIGITS[static_cast<unsigned char>(*special) >> 4];
+        output_ += HEX_DIGITS[static_cast<unsigned char>(*special) & 0xF];
+      }
+      value.remove_prefix(special - value.begin() + 1);
+    }
+    output_ += '"';
+  }
+
+}
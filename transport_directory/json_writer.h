@@ -0,0 +1,42 @@
+#pragma once
+
+#include "json.h"
+
+#include <string>
+#include <string_view>
+
+namespace Json {
+
+  // Appends JSON straight to a string without building Json::Node first.
+  // Separators are inserted automatically: ", " between items and ": " after keys.
+  class Writer {
+  public:
+    explicit Writer(std::string& output) : output_(output) {}
+
+    Writer& BeginObject();
+    Writer& EndObject();
+    Writer& BeginArray();
+    Writer& EndArray();
+
+    Writer& Key(std::string_view key);
+
+    Writer& Value(std::string_view value);
+    Writer& Value(const char* value) { return Value(std::string_view(value)); }
+    Writer& Value(const std::string& value) { return Value(std::string_view(value)); }
+    Writer& Value(int value);
+    Writer& Value(double value);
+    Writer& Value(bool value);
+    Writer& Value(const Node& node);
+
+    // Appends members of an object serialized by another writer
+    Writer& RawMembers(std::string_view members);
+
+  private:
+    std::string& output_;
+    bool needs_separator_ = false;
+
+    void BeginValue();
+    void AppendString(std::string_view value);
+  };
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+// Thread-safe LRU cache split into shards by key hash, so that concurrent
+// lookups of different keys rarely wait for each other. Entries are charged
+// EntrySize{}(key, value) bytes, and every shard keeps at most
+// capacity / SHARD_COUNT bytes; an entry bigger than that is not kept.
+// Values are copied out, so big values should be held by shared_ptr.
+template <typename Key, typename Value, typename EntrySize, typename Hash = std::hash<Key>>
+class ShardedLruCache {
+public:
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+  };
+
+  explicit ShardedLruCache(size_t capacity)
+    : shard_capacity_(capacity / SHARD_COUNT) {}
+
+  std::optional<Value> Get(const Key& key) {
+    Shard& shard = GetShard(key);
+    std::lock_guard lock(shard.mutex);
+    const auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+      ++misses_;
+      return std::nullopt;
+    }
+    ++hits_;
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    return it->second->second;
+  }
+
+  void Put(Key key, Value value) {
+    const size_t size = EntrySize{}(key, value);
+    Shard& shard = GetShard(key);
+    std::lock_guard lock(shard.mutex);
+    if (const auto it = shard.index.find(key); it != shard.index.end()) {
+      shard.size -= EntrySize{}(it->second->first, it->second->second);
+      shard.entries.erase(it->second);
+      shard.index.erase(it);
+    }
+    if (size > shard_capacity_) {
+      return;
+    }
+    while (shard.size + size > shard_capacity_) {
+      const auto& [oldest_key, oldest_value] = shard.entries.back();
+      shard.size -= EntrySize{}(oldest_key, oldest_value);
+      shard.index.erase(oldest_key);
+      shard.entries.pop_back();
+    }
+    shard.entries.emplace_front(std::move(key), std::move(value));
+    shard.index.emplace(shard.entries.front().first, shard.entries.begin());
+    shard.size += size;
+  }
+
+  Stats GetStats() const {
+    return { hits_.load(), misses_.load() };
+  }
+
+private:
+  static constexpr size_t SHARD_COUNT = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    std::list<std::pair<Key, Value>> entries;  // most recently used first
+    std::unordered_map<Key, typename std::list<std::pair<Key, Value>>::iterator, Hash> index;
+    size_t size = 0;  // in bytes, by EntrySize
+  };
+
+  size_t shard_capacity_;
+  std::array<Shard, SHARD_COUNT> shards_;
+  std::atomic<size_t> hits_ = 0;
+  std::atomic<size_t> misses_ = 0;
+
+  Shard& GetShard(const Key& key) {
+    return shards_[Hash{}(key) % SHARD_COUNT];
+  }
+};
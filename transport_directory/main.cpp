@@ -1,56 +1,173 @@
+#include "catalog_holder.h"
+#include "companies_catalog.h"
 #include "descriptions.h"
 #include "json.h"
+#include "json_stream.h"
 #include "requests.h"
+#include "server.h"
 #include "transport_catalog.h"
 
+#include <filesystem>
 #include <iostream>
 #include <fstream>
 #include <string_view>
+#include <memory>
+#include <thread>
 
 using namespace std;
 
-string ReadFileData(const string& file_name) {
-  ifstream file(file_name, ios::binary | ios::ate);
-  const ifstream::pos_type end_pos = file.tellg();
-  file.seekg(0, ios::beg);
+// "processing_settings": {"threads": N} limits the threads answering stat_requests
+size_t ReadProcessingThreadCount(const Json::DictView& processing_settings) {
+  const Json::NodeView* threads = processing_settings.Find("threads");
+  if (!threads) {
+    return max(thread::hardware_concurrency(), 1u);
+  }
+  const int thread_count = threads->AsInt();
+  if (thread_count < 1) {
+    throw runtime_error("Invalid processing thread count");
+  }
+  return thread_count;
+}
+
+struct ProcessingSettings {
+  string file;
+  size_t thread_count = max(thread::hardware_concurrency(), 1u);
+};
 
-  string data(end_pos, '\0');
-  file.read(&data[0], end_pos);
-  return data;
+// The settings may come after stat_requests, so they are looked up in a
+// separate pass that skips everything else without parsing it
+ProcessingSettings ReadProcessingSettings(string_view input) {
+  ProcessingSettings result;
+  Json::StreamReader reader(input);
+  Json::Arena arena;
+  reader.ReadObject([&](string_view key) {
+    if (key == "serialization_settings") {
+      result.file = reader.ReadView(arena).AsMap().at("file").AsString();
+    } else if (key == "processing_settings") {
+      result.thread_count = ReadProcessingThreadCount(reader.ReadView(arena).AsMap());
+    } else {
+      reader.SkipValue();
+    }
+  });
+  return result;
+}
+
+// Every request is answered and printed while the rest of them are still unparsed
+void ProcessRequests(string_view input, const TransportCatalog& db, size_t thread_count, ostream& output) {
+  Requests::ResponseStream responses(db, output, thread_count);
+  Json::StreamReader reader(input);
+  Json::Arena arena;
+  reader.ReadObject([&](string_view key) {
+    if (key == "stat_requests") {
+      reader.ReadArray([&] {
+        arena.Reset();
+        responses.Add(reader.ReadView(arena).ToNode());
+      });
+    } else {
+      reader.SkipValue();
+    }
+  });
+  responses.Finish();
+}
+
+struct BaseInput {
+  string file;
+  vector<Descriptions::InputQuery> base_requests;
+  Json::Dict routing_settings;
+  Json::Dict render_settings;
+  unique_ptr<CompaniesCatalog> companies;
+};
+
+// Stops, buses and companies are converted one by one as they are parsed, so at
+// most one of them exists as a JSON tree at a time; the settings are small and
+// are copied to Json::Node
+BaseInput ReadBaseInput(string_view input) {
+  BaseInput result;
+  Json::StreamReader reader(input);
+  Json::Arena arena;
+
+  Json::Dict rubrics;
+  vector<YellowPages::Company> companies;
+  const auto read_yellow_pages = [&](string_view key) {
+    if (key == "rubrics") {
+      rubrics = reader.ReadView(arena).ToNode().AsMap();
+    } else if (key == "companies") {
+      reader.ReadArray([&] {
+        arena.Reset();
+        companies.push_back(ReadCompany(reader.ReadView(arena).ToNode().AsMap()));
+      });
+    } else {
+      reader.SkipValue();
+    }
+  };
+
+  reader.ReadObject([&](string_view key) {
+    arena.Reset();
+    if (key == "serialization_settings") {
+      result.file = reader.ReadView(arena).AsMap().at("file").AsString();
+    } else if (key == "base_requests") {
+      reader.ReadArray([&] {
+        arena.Reset();
+        result.base_requests.push_back(Descriptions::ReadDescription(reader.ReadView(arena).AsMap()));
+      });
+    } else if (key == "routing_settings") {
+      result.routing_settings = reader.ReadView(arena).ToNode().AsMap();
+    } else if (key == "render_settings") {
+      result.render_settings = reader.ReadView(arena).ToNode().AsMap();
+    } else if (key == "yellow_pages") {
+      reader.ReadObject(read_yellow_pages);
+    } else {
+      reader.SkipValue();
+    }
+  });
+
+  result.companies = make_unique<CompaniesCatalog>(rubrics, move(companies));
+  return result;
 }
 
 int main(int argc, const char* argv[]) {
-  if (argc != 2) {
-    cerr << "Usage: transport_catalog_part_o [make_base|process_requests]\n";
+  const string_view mode(argc > 1 ? argv[1] : "");
+  const bool has_valid_args = mode == "serve" ? argc == 3 || argc == 4 : argc == 2;
+  if (!has_valid_args) {
+    cerr << "Usage: transport_catalog_part_o [make_base|process_requests|serve <base file> [<socket path>]]\n";
     return 5;
   }
 
-  const string_view mode(argv[1]);
   //ifstream in("example1_process_requests.json");
   //ofstream out("example_output.txt");
-  const auto input_doc = Json::Load(cin);
-  const auto& input_map = input_doc.GetRoot().AsMap();
-  const string file = input_map.at("serialization_settings").AsMap().at("file").AsString();
-
   if (mode == "make_base") {
+    BaseInput input = ReadBaseInput(Json::ReadAll(cin));
     TransportCatalog db(
-      Descriptions::ReadDescriptions(input_map.at("base_requests").AsArray()),
-      input_map.at("routing_settings").AsMap(),
-      input_map.at("render_settings").AsMap(),
-      input_map.at("yellow_pages").AsMap()
+      move(input.base_requests),
+      input.routing_settings,
+      input.render_settings,
+      move(input.companies)
     );
-    ofstream out(file, ios::binary);
-    db.Serialize(out);
+    // The base is written aside and renamed over the old one, so that a server
+    // still reading the old file keeps it intact until it reloads
+    const string temp_file = input.file + ".tmp";
+    {
+      ofstream out(temp_file, ios::binary);
+      db.Serialize(out);
+    }
+    filesystem::rename(temp_file, input.file);
   }
   else if (mode == "process_requests") {
-    istringstream in(ReadFileData(file));
-    TransportCatalog db(in);
-    Json::PrintValue(
-      Requests::ProcessAll(db, input_map.at("stat_requests").AsArray()),
-      cout
-    );
+    const string input = Json::ReadAll(cin);
+    const ProcessingSettings settings = ReadProcessingSettings(input);
+    TransportCatalog db(settings.file);
+    ProcessRequests(input, db, settings.thread_count, cout);
     cout << endl;
   }
+  else if (mode == "serve") {
+    // Requests come one per line from the socket clients or, without a socket, from stdin
+    CatalogHolder catalog(argv[2]);
+    if (argc == 4) {
+      Server::ServeUnixSocket(catalog, argv[3], max(thread::hardware_concurrency(), 1u));
+    } else {
+      Server::ServePipe(catalog, cin, cout);
+    }
+  }
 
   return 0;
 }
@@ -2,7 +2,7 @@
 #include "aligner.h"
 
 #include <algorithm>
-#include <sstream>
+#include <stdexcept>
 #include <map>
 #include <unordered_set>
 #include <optional>
@@ -112,17 +112,27 @@ namespace Paint {
     return bus_colors;
   }
 
+  void Painter::PaintMoveLine(Svg::Document& svg, const string& bus_name) const {
+    const auto& stops = buses_dict_->at(bus_name)->stops;
+    if (stops.empty()) {
+      return;
+    }
+    auto line = PaintBaseLine(bus_name);
+    for (const auto& stop_name : stops) {
+      line.AddPoint(places_coords_.at(stop_name));
+    }
+    svg.Add(line);
+  }
+
   void Painter::PaintMoveLines(Svg::Document& svg) const {
-    for (const auto& [bus_name, bus] : *buses_dict_) {
-      const auto& stops = bus->stops;
-      if (stops.empty()) {
-        continue;
-      }
-      auto line = PaintBaseLine(bus_name);
-      for (const auto& stop_name : stops) {
-        line.AddPoint(places_coords_.at(stop_name));
-      }
-      svg.Add(line);
+    for (const auto& [bus_name, _] : *buses_dict_) {
+      PaintMoveLine(svg, bus_name);
+    }
+  }
+
+  void Painter::PaintMoveLines(Svg::Document& svg, const TileObjects& objects) const {
+    for (const string* bus_name : objects.bus_names) {
+      PaintMoveLine(svg, *bus_name);
     }
   }
 
@@ -149,15 +159,26 @@ namespace Paint {
     }
   }
 
-  void Painter::PaintMoveLabels(Svg::Document& svg) const {
-    for (const auto& [bus_name, bus] : *buses_dict_) {
-      if (!bus->stops.empty()) {
-        for (const string& endpoint : bus->endpoints) {
-          PaintMoveLabel(svg, places_coords_.at(endpoint), bus_name);
-        }
+  void Painter::PaintMoveEndpointLabels(Svg::Document& svg, const string& bus_name) const {
+    const auto& bus = buses_dict_->at(bus_name);
+    if (!bus->stops.empty()) {
+      for (const string& endpoint : bus->endpoints) {
+        PaintMoveLabel(svg, places_coords_.at(endpoint), bus_name);
       }
     }
   }
+
+  void Painter::PaintMoveLabels(Svg::Document& svg) const {
+    for (const auto& [bus_name, _] : *buses_dict_) {
+      PaintMoveEndpointLabels(svg, bus_name);
+    }
+  }
+
+  void Painter::PaintMoveLabels(Svg::Document& svg, const TileObjects& objects) const {
+    for (const string* bus_name : objects.bus_names) {
+      PaintMoveEndpointLabels(svg, *bus_name);
+    }
+  }
   //!!!
   void Painter::PaintMoveLabels(Svg::Document& svg, const Route::Items<Route::Bus>& buses) const {
     for (const auto& [bus, start, finish] : buses) {
@@ -180,6 +201,12 @@ namespace Paint {
     }
   }
 
+  void Painter::PaintPlacePoints(Svg::Document& svg, const TileObjects& objects) const {
+    for (const string* stop_name : objects.stop_names) {
+      PaintPlacePoint(svg, places_coords_.at(*stop_name));
+    }
+  }
+
   void Painter::PaintPlacePoints(Svg::Document& svg, const Route::Items<Route::Bus>& buses) const {
     for (const auto& [bus, start, finish] : buses) {
       const auto& stops = buses_dict_->at(bus)->stops;
@@ -203,6 +230,11 @@ namespace Paint {
       PaintPlaceLabel(svg, places_coords_.at(stop_name), stop_name);
     }
   }
+  void Painter::PaintPlaceLabels(Svg::Document& svg, const TileObjects& objects) const {
+    for (const string* stop_name : objects.stop_names) {
+      PaintPlaceLabel(svg, places_coords_.at(*stop_name), *stop_name);
+    }
+  }
   //!!!
   void Painter::PaintPlaceLabels(Svg::Document& svg, const Route::Items<Route::Bus>& buses) const {
     if (buses.empty()) return;
@@ -291,6 +323,86 @@ namespace Paint {
     return doc;
   }
 
+  static Viewport GetPointBox(Svg::Point pos, double radius) {
+    return { pos.x - radius, pos.y - radius, pos.x + radius, pos.y + radius };
+  }
+
+  static Viewport GetSegmentBox(Svg::Point from, Svg::Point to, double half_width) {
+    return {
+      min(from.x, to.x) - half_width, min(from.y, to.y) - half_width,
+      max(from.x, to.x) + half_width, max(from.y, to.y) + half_width
+    };
+  }
+
+  // Glyphs are not measured, so the box is a bound: a glyph is taken to be at most
+  // font_size wide, with the underlayer stroke around
+  Viewport Painter::GetLabelBox(Svg::Point pos, Svg::Point offset, int font_size, const string& text) const {
+    const double x = pos.x + offset.x;
+    const double y = pos.y + offset.y;
+    const double stroke = settings_.underlayer_width / 2;
+    return {
+      x - stroke, y - font_size - stroke,
+      x + static_cast<double>(text.size()) * font_size + stroke, y + font_size / 2.0 + stroke
+    };
+  }
+
+  Painter::TileIndex Painter::BuildTileIndex() const {
+    size_t bus_box_count = 0;
+    for (const auto& [_, bus] : *buses_dict_) {
+      bus_box_count += bus->stops.size() + bus->endpoints.size();
+    }
+    const Viewport bounds = GetTileViewport(0, 0, 0);
+    TileIndex index{
+      .bus_names = {},
+      .stop_names = {},
+      .buses = GridIndex(bounds, bus_box_count),
+      .stops = GridIndex(bounds, 2 * stops_dict_->size()),
+    };
+
+    const double half_line_width = settings_.line_width / 2;
+    for (const auto& [bus_name, bus] : *buses_dict_) {
+      const size_t id = index.bus_names.size();
+      index.bus_names.push_back(&bus_name);
+      const auto& stops = bus->stops;
+      if (stops.empty()) {
+        continue;
+      }
+      index.buses.Insert(id, GetPointBox(places_coords_.at(stops.front()), half_line_width));
+      for (size_t stop_idx = 1; stop_idx < stops.size(); ++stop_idx) {
+        index.buses.Insert(id, GetSegmentBox(
+          places_coords_.at(stops[stop_idx - 1]), places_coords_.at(stops[stop_idx]), half_line_width));
+      }
+      for (const string& endpoint : bus->endpoints) {
+        index.buses.Insert(id, GetLabelBox(
+          places_coords_.at(endpoint), settings_.bus_label_offset, settings_.bus_label_font_size, bus_name));
+      }
+    }
+
+    for (const auto& [stop_name, _] : *stops_dict_) {
+      const size_t id = index.stop_names.size();
+      index.stop_names.push_back(&stop_name);
+      const Svg::Point pos = places_coords_.at(stop_name);
+      index.stops.Insert(id, GetPointBox(pos, settings_.stop_radius));
+      index.stops.Insert(id, GetLabelBox(pos, settings_.stop_label_offset, settings_.stop_label_font_size, stop_name));
+    }
+    return index;
+  }
+
+  Viewport Painter::GetTileViewport(int zoom, int x, int y) const {
+    if (zoom < 0 || zoom > MAX_TILE_ZOOM) {
+      throw runtime_error("Tile zoom out of range: " + to_string(zoom));
+    }
+    const int tile_count = 1 << zoom;
+    if (x < 0 || x >= tile_count || y < 0 || y >= tile_count) {
+      throw runtime_error("Tile out of range: " + to_string(x) + ", " + to_string(y));
+    }
+    const double tile_width = (settings_.width + 2 * settings_.outer_margin) / tile_count;
+    const double tile_height = (settings_.height + 2 * settings_.outer_margin) / tile_count;
+    const double min_x = -settings_.outer_margin + x * tile_width;
+    const double min_y = -settings_.outer_margin + y * tile_height;
+    return { min_x, min_y, min_x + tile_width, min_y + tile_height };
+  }
+
   const unordered_map<string, void (Painter::*)(Svg::Document&) const> Painter::LAYER_ACTIONS = {
       {"bus_lines",   static_cast<void (Painter::*)(Svg::Document&) const>(&Painter::PaintMoveLines)},
       {"bus_labels",  static_cast<void (Painter::*)(Svg::Document&) const>(&Painter::PaintMoveLabels)},
@@ -298,6 +410,14 @@ namespace Paint {
       {"stop_labels", static_cast<void (Painter::*)(Svg::Document&) const>(&Painter::PaintPlaceLabels)},
   };
 
+  const unordered_map<
+    string, void (Painter::*)(Svg::Document&, const Painter::TileObjects&) const> Painter::TILE_LAYER_ACTIONS = {
+      {"bus_lines",   static_cast<void (Painter::*)(Svg::Document&, const TileObjects&) const>(&Painter::PaintMoveLines)},
+      {"bus_labels",  static_cast<void (Painter::*)(Svg::Document&, const TileObjects&) const>(&Painter::PaintMoveLabels)},
+      {"stop_points", static_cast<void (Painter::*)(Svg::Document&, const TileObjects&) const>(&Painter::PaintPlacePoints)},
+      {"stop_labels", static_cast<void (Painter::*)(Svg::Document&, const TileObjects&) const>(&Painter::PaintPlaceLabels)},
+  };
+
   const unordered_map<
     string, void (Painter::*)(Svg::Document&, const Route::Items<Route::Bus>&) const> Painter::MOVE_LAYER_ACTIONS = {
       {"bus_lines",   static_cast<void (Painter::*)(Svg::Document&, const Route::Items<Route::Bus>&) const>(&Painter::PaintMoveLines)},
@@ -314,6 +434,12 @@ namespace Paint {
   };
 
 
+  string RenderDocument(const Svg::Document& document) {
+    string result;
+    document.Render(result);
+    return result;
+  }
+
   Painter::Painter(const Json::Dict& render_settings_json,
     shared_ptr<Descriptions::BusesDict> buses,
     shared_ptr<Descriptions::StopsDict> stops,
@@ -323,38 +449,76 @@ namespace Paint {
     stops_dict_(stops),
     places_coords_(ComputePlacesCoords(*stops, *buses, companies, settings_)),
     bus_colors_(ChooseBusColors(*buses, settings_)),
-    base_map_(MakeDocument())
+    tile_index_(BuildTileIndex()),
+    base_map_svg_(CheckBaseMap(RenderDocument(MakeDocument())))
   {
   };
 
-  string Painter::Paint(std::optional<Route> route) const {
-    Svg::Document route_map = base_map_;
-    if (route.has_value()) {
-      route_map.Add(
-        Svg::Rectangle{}
-        .SetCorner({ -settings_.outer_margin, -settings_.outer_margin })
-        .SetWidth(settings_.width + 2 * settings_.outer_margin)
-        .SetHeight(settings_.height + 2 * settings_.outer_margin)
-        .SetFillColor(settings_.underlayer_color)
-      );
-
-      string stop_from;
-      if (route->buses.empty() && !route->walks.empty())
-        stop_from = route->walks.front().stop_from;
-
-      for (const auto& layer : settings_.layers) {
-        if (!stop_from.empty() && layer == "stop_labels") {
-          PaintPlaceLabel(route_map, places_coords_.at(stop_from), stop_from);
-        }
-        else if (MOVE_LAYER_ACTIONS.count(layer))
-          (this->*MOVE_LAYER_ACTIONS.at(layer))(route_map, route->buses);
-        else
-          (this->*WALK_LAYER_ACTIONS.at(layer))(route_map, route->walks);
+  string Painter::CheckBaseMap(string svg) {
+    const string_view footer = Svg::Document::FOOTER;
+    if (svg.size() < footer.size() || string_view(svg).substr(svg.size() - footer.size()) != footer) {
+      throw runtime_error("Base map does not end with the SVG footer");
+    }
+    return svg;
+  }
+
+  const string& Painter::PaintMap() const {
+    return base_map_svg_;
+  }
+
+  // Only the route layers are rendered; they are put into a copy of the
+  // rendered base map right before its footer
+  string Painter::PaintRoute(const Route& route) const {
+    Svg::Document route_map;
+    route_map.Add(
+      Svg::Rectangle{}
+      .SetCorner({ -settings_.outer_margin, -settings_.outer_margin })
+      .SetWidth(settings_.width + 2 * settings_.outer_margin)
+      .SetHeight(settings_.height + 2 * settings_.outer_margin)
+      .SetFillColor(settings_.underlayer_color)
+    );
+
+    string stop_from;
+    if (route.buses.empty() && !route.walks.empty())
+      stop_from = route.walks.front().stop_from;
+
+    for (const auto& layer : settings_.layers) {
+      if (!stop_from.empty() && layer == "stop_labels") {
+        PaintPlaceLabel(route_map, places_coords_.at(stop_from), stop_from);
       }
+      else if (MOVE_LAYER_ACTIONS.count(layer))
+        (this->*MOVE_LAYER_ACTIONS.at(layer))(route_map, route.buses);
+      else
+        (this->*WALK_LAYER_ACTIONS.at(layer))(route_map, route.walks);
+    }
+
+    string overlay;
+    route_map.RenderObjects(overlay);
+    const string_view base_body = string_view(base_map_svg_).substr(0, base_map_svg_.size() - Svg::Document::FOOTER.size());
+    string result;
+    result.reserve(base_body.size() + overlay.size() + Svg::Document::FOOTER.size());
+    result.append(base_body);
+    result.append(overlay);
+    result.append(Svg::Document::FOOTER);
+    return result;
+  }
+
+  string Painter::PaintTile(const Viewport& viewport) const {
+    TileObjects objects;
+    for (const size_t id : tile_index_.buses.Query(viewport)) {
+      objects.bus_names.push_back(tile_index_.bus_names[id]);
+    }
+    for (const size_t id : tile_index_.stops.Query(viewport)) {
+      objects.stop_names.push_back(tile_index_.stop_names[id]);
+    }
+
+    Svg::Document tile;
+    tile.SetViewBox({ viewport.min_x, viewport.min_y }, viewport.max_x - viewport.min_x, viewport.max_y - viewport.min_y);
+    for (const auto& layer : settings_.layers) {
+      if (TILE_LAYER_ACTIONS.count(layer))
+        (this->*TILE_LAYER_ACTIONS.at(layer))(tile, objects);
     }
-    ostringstream result;
-    route_map.Render(result);
-    return result.str();
+    return RenderDocument(tile);
   }
 
 }
\ No newline at end of file
@@ -6,12 +6,14 @@
 #include "painter.pb.h"
 #include "company.pb.h"
 #include "utils.h"
+#include "grid_index.h"
 
 #include <map>
 #include <vector>
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <optional>
 #include <variant>
 
 namespace Paint {
@@ -55,6 +57,11 @@ namespace Paint {
   };
 
 
+  // Area of the map in the coordinates of its SVG
+  using Viewport = GridIndex::Box;
+
+  std::string RenderDocument(const Svg::Document& document);
+
   class Painter {
   public:
     Painter() = default;
@@ -64,32 +71,69 @@ namespace Paint {
       const std::vector<YellowPages::Company>& companies);
 
     TCProto::Painter Serialize() const;
-    Painter(const TCProto::Painter& painter);
+    // base_map_svg is the map rendered by make_base; without it the map is rendered here
+    Painter(const TCProto::Painter& painter, std::optional<std::string> base_map_svg = std::nullopt);
+
+    // The whole map is rendered once, so every request gets the same string
+    const std::string& PaintMap() const;
+    std::string PaintRoute(const Route& route) const;
+
+    // The objects of the map intersecting viewport; the viewport becomes the view box
+    std::string PaintTile(const Viewport& viewport) const;
+    // The map with its outer margin is split into 2^zoom x 2^zoom tiles, x to the right and y down
+    Viewport GetTileViewport(int zoom, int x, int y) const;
 
-    std::string Paint(std::optional<Route> = std::nullopt) const;
+    static constexpr int MAX_TILE_ZOOM = 20;
   private:
+    // Finds the objects of the map in a viewport. Buses are indexed by their
+    // line segments and labels, stops by their points and labels; ids are
+    // positions in the dicts, so found objects keep the order of the map.
+    struct TileIndex {
+      std::vector<const std::string*> bus_names;
+      std::vector<const std::string*> stop_names;
+      GridIndex buses;
+      GridIndex stops;
+    };
+
+    struct TileObjects {
+      std::vector<const std::string*> bus_names;
+      std::vector<const std::string*> stop_names;
+    };
+
     const RenderSettings settings_;
     const std::shared_ptr<Descriptions::BusesDict> buses_dict_;
     const std::shared_ptr<Descriptions::StopsDict> stops_dict_;
     const std::map<std::string, Svg::Point> places_coords_;
     const std::unordered_map<std::string, Svg::Color> bus_colors_;
+    const TileIndex tile_index_;
+
+    // PaintRoute puts the route right before the footer of the base map
+    const std::string base_map_svg_;
 
-    const Svg::Document base_map_;
+    // Throws if the map does not end with the SVG footer
+    static std::string CheckBaseMap(std::string svg);
 
     void PaintMoveLines(Svg::Document& svg) const;
     void PaintMoveLines(Svg::Document& svg, const Route::Items<Route::Bus>& buses) const;
     void PaintMoveLines(Svg::Document& svg, const Route::Items<Route::Walk>& walks) const;
+    void PaintMoveLines(Svg::Document& svg, const TileObjects& objects) const;
 
     void PaintMoveLabels(Svg::Document& svg) const;
     void PaintMoveLabels(Svg::Document& svg, const Route::Items<Route::Bus>& buses) const;
+    void PaintMoveLabels(Svg::Document& svg, const TileObjects& objects) const;
 
     void PaintPlacePoints(Svg::Document& svg) const;
     void PaintPlacePoints(Svg::Document& svg, const Route::Items<Route::Bus>& buses) const;
     void PaintPlacePoints(Svg::Document& svg, const Route::Items<Route::Walk>& walks) const;
+    void PaintPlacePoints(Svg::Document& svg, const TileObjects& objects) const;
 
     void PaintPlaceLabels(Svg::Document& svg) const;
     void PaintPlaceLabels(Svg::Document& svg, const Route::Items<Route::Bus>& buses) const;
     void PaintPlaceLabels(Svg::Document& svg, const Route::Items<Route::Walk>& walks) const;
+    void PaintPlaceLabels(Svg::Document& svg, const TileObjects& objects) const;
+
+    void PaintMoveLine(Svg::Document& svg, const std::string& bus_name) const;
+    void PaintMoveEndpointLabels(Svg::Document& svg, const std::string& bus_name) const;
 
     void PaintMoveLabel(Svg::Document& svg, Svg::Point pos, const std::string& name) const;
     void PaintPlaceLabel(Svg::Document& svg, Svg::Point pos, const std::string& name) const;
@@ -98,6 +142,9 @@ namespace Paint {
 
     Svg::Document MakeDocument() const;
 
+    TileIndex BuildTileIndex() const;
+    Viewport GetLabelBox(Svg::Point pos, Svg::Point offset, int font_size, const std::string& text) const;
+
     static const std::unordered_map<
       std::string, void (Painter::*)(Svg::Document&) const
     > LAYER_ACTIONS;
@@ -109,6 +156,10 @@ namespace Paint {
     static const std::unordered_map<
       std::string, void (Painter::*)(Svg::Document&, const Route::Items<Route::Walk>&) const
     > WALK_LAYER_ACTIONS;
+
+    static const std::unordered_map<
+      std::string, void (Painter::*)(Svg::Document&, const TileObjects&) const
+    > TILE_LAYER_ACTIONS;
   };
 
 }
\ No newline at end of file
@@ -14,155 +14,154 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_svg_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Color_svg_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_svg_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Point_svg_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_painter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BusColor_painter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_descriptions_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BusDescription_descriptions_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_painter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_RenderSettings_painter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_painter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StopCoords_painter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_descriptions_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_StopDescription_descriptions_2eproto;
-namespace TCProto {
-class RenderSettingsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RenderSettings> _instance;
-} _RenderSettings_default_instance_;
-class StopCoordsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StopCoords> _instance;
-} _StopCoords_default_instance_;
-class BusColorDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BusColor> _instance;
-} _BusColor_default_instance_;
-class PainterDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Painter> _instance;
-} _Painter_default_instance_;
-}  // namespace TCProto
-static void InitDefaultsscc_info_BusColor_painter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_BusColor_default_instance_;
-    new (ptr) ::TCProto::BusColor();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BusColor_painter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_BusColor_painter_2eproto}, {
-      &scc_info_Color_svg_2eproto.base,}};
-
-static void InitDefaultsscc_info_Painter_painter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_Painter_default_instance_;
-    new (ptr) ::TCProto::Painter();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Painter_painter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_Painter_painter_2eproto}, {
-      &scc_info_RenderSettings_painter_2eproto.base,
-      &scc_info_StopCoords_painter_2eproto.base,
-      &scc_info_BusColor_painter_2eproto.base,
-      &scc_info_BusDescription_descriptions_2eproto.base,
-      &scc_info_StopDescription_descriptions_2eproto.base,}};
-
-static void InitDefaultsscc_info_RenderSettings_painter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_RenderSettings_default_instance_;
-    new (ptr) ::TCProto::RenderSettings();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_RenderSettings_painter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_RenderSettings_painter_2eproto}, {
-      &scc_info_Color_svg_2eproto.base,
-      &scc_info_Point_svg_2eproto.base,}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-static void InitDefaultsscc_info_StopCoords_painter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-  {
-    void* ptr = &::TCProto::_StopCoords_default_instance_;
-    new (ptr) ::TCProto::StopCoords();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_StopCoords_painter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_StopCoords_painter_2eproto}, {
-      &scc_info_Point_svg_2eproto.base,}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_painter_2eproto[4];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_painter_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_painter_2eproto = nullptr;
+namespace TCProto {
+PROTOBUF_CONSTEXPR RenderSettings::RenderSettings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.palette_)*/{}
+  , /*decltype(_impl_.layers_)*/{}
+  , /*decltype(_impl_.underlayer_color_)*/nullptr
+  , /*decltype(_impl_.bus_label_offset_)*/nullptr
+  , /*decltype(_impl_.stop_label_offset_)*/nullptr
+  , /*decltype(_impl_.max_width_)*/0
+  , /*decltype(_impl_.max_height_)*/0
+  , /*decltype(_impl_.padding_)*/0
+  , /*decltype(_impl_.outer_margin_)*/0
+  , /*decltype(_impl_.line_width_)*/0
+  , /*decltype(_impl_.underlayer_width_)*/0
+  , /*decltype(_impl_.stop_radius_)*/0
+  , /*decltype(_impl_.bus_label_font_size_)*/0
+  , /*decltype(_impl_.stop_label_font_size_)*/0
+  , /*decltype(_impl_.company_line_width_)*/0
+  , /*decltype(_impl_.company_radius_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RenderSettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RenderSettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RenderSettingsDefaultTypeInternal() {}
+  union {
+    RenderSettings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RenderSettingsDefaultTypeInternal _RenderSettings_default_instance_;
+PROTOBUF_CONSTEXPR StopCoords::StopCoords(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.point_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StopCoordsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StopCoordsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StopCoordsDefaultTypeInternal() {}
+  union {
+    StopCoords _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopCoordsDefaultTypeInternal _StopCoords_default_instance_;
+PROTOBUF_CONSTEXPR BusColor::BusColor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.color_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BusColorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BusColorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BusColorDefaultTypeInternal() {}
+  union {
+    BusColor _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BusColorDefaultTypeInternal _BusColor_default_instance_;
+PROTOBUF_CONSTEXPR Painter::Painter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stops_coords_)*/{}
+  , /*decltype(_impl_.bus_colors_)*/{}
+  , /*decltype(_impl_.bus_descriptions_)*/{}
+  , /*decltype(_impl_.stop_descriptions_)*/{}
+  , /*decltype(_impl_.render_settings_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PainterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PainterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PainterDefaultTypeInternal() {}
+  union {
+    Painter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PainterDefaultTypeInternal _Painter_default_instance_;
+}  // namespace TCProto
+static ::_pb::Metadata file_level_metadata_painter_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_painter_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_painter_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_painter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_painter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, max_width_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, max_height_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, padding_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, outer_margin_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, palette_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, line_width_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, company_line_width_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, underlayer_color_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, underlayer_width_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, stop_radius_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, company_radius_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, bus_label_offset_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, bus_label_font_size_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, stop_label_offset_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, stop_label_font_size_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, layers_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.max_width_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.max_height_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.padding_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.outer_margin_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.palette_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.line_width_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.company_line_width_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.underlayer_color_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.underlayer_width_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.stop_radius_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.company_radius_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.bus_label_offset_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.bus_label_font_size_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.stop_label_offset_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.stop_label_font_size_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RenderSettings, _impl_.layers_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::StopCoords, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopCoords, name_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopCoords, point_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopCoords, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopCoords, _impl_.point_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::BusColor, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusColor, name_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusColor, color_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusColor, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusColor, _impl_.color_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::Painter, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, render_settings_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, stops_coords_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, bus_colors_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, bus_descriptions_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, stop_descriptions_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, _impl_.render_settings_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, _impl_.stops_coords_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, _impl_.bus_colors_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, _impl_.bus_descriptions_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::Painter, _impl_.stop_descriptions_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::TCProto::RenderSettings)},
-  { 21, -1, sizeof(::TCProto::StopCoords)},
-  { 28, -1, sizeof(::TCProto::BusColor)},
-  { 35, -1, sizeof(::TCProto::Painter)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::TCProto::RenderSettings)},
+  { 22, -1, -1, sizeof(::TCProto::StopCoords)},
+  { 30, -1, -1, sizeof(::TCProto::BusColor)},
+  { 38, -1, -1, sizeof(::TCProto::Painter)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_RenderSettings_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_StopCoords_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_BusColor_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_Painter_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TCProto::_RenderSettings_default_instance_._instance,
+  &::TCProto::_StopCoords_default_instance_._instance,
+  &::TCProto::_BusColor_default_instance_._instance,
+  &::TCProto::_Painter_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_painter_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -190,26 +189,25 @@ const char descriptor_table_protodef_painter_2eproto[] PROTOBUF_SECTION_VARIABLE
   "ions\030\005 \003(\0132\030.TCProto.StopDescriptionb\006pr"
   "oto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_painter_2eproto_deps[2] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_painter_2eproto_deps[2] = {
   &::descriptor_table_descriptions_2eproto,
   &::descriptor_table_svg_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_painter_2eproto_sccs[4] = {
-  &scc_info_BusColor_painter_2eproto.base,
-  &scc_info_Painter_painter_2eproto.base,
-  &scc_info_RenderSettings_painter_2eproto.base,
-  &scc_info_StopCoords_painter_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_painter_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_painter_2eproto = {
-  false, false, descriptor_table_protodef_painter_2eproto, "painter.proto", 884,
-  &descriptor_table_painter_2eproto_once, descriptor_table_painter_2eproto_sccs, descriptor_table_painter_2eproto_deps, 4, 2,
-  schemas, file_default_instances, TableStruct_painter_2eproto::offsets,
-  file_level_metadata_painter_2eproto, 4, file_level_enum_descriptors_painter_2eproto, file_level_service_descriptors_painter_2eproto,
+static ::_pbi::once_flag descriptor_table_painter_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_painter_2eproto = {
+    false, false, 884, descriptor_table_protodef_painter_2eproto,
+    "painter.proto",
+    &descriptor_table_painter_2eproto_once, descriptor_table_painter_2eproto_deps, 2, 4,
+    schemas, file_default_instances, TableStruct_painter_2eproto::offsets,
+    file_level_metadata_painter_2eproto, file_level_enum_descriptors_painter_2eproto,
+    file_level_service_descriptors_painter_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_painter_2eproto_getter() {
+  return &descriptor_table_painter_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_painter_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_painter_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_painter_2eproto(&descriptor_table_painter_2eproto);
 namespace TCProto {
 
 // ===================================================================
@@ -223,171 +221,195 @@ class RenderSettings::_Internal {
 
 const ::SvgProto::Color&
 RenderSettings::_Internal::underlayer_color(const RenderSettings* msg) {
-  return *msg->underlayer_color_;
+  return *msg->_impl_.underlayer_color_;
 }
 const ::SvgProto::Point&
 RenderSettings::_Internal::bus_label_offset(const RenderSettings* msg) {
-  return *msg->bus_label_offset_;
+  return *msg->_impl_.bus_label_offset_;
 }
 const ::SvgProto::Point&
 RenderSettings::_Internal::stop_label_offset(const RenderSettings* msg) {
-  return *msg->stop_label_offset_;
+  return *msg->_impl_.stop_label_offset_;
 }
 void RenderSettings::clear_palette() {
-  palette_.Clear();
+  _impl_.palette_.Clear();
 }
 void RenderSettings::clear_underlayer_color() {
-  if (GetArena() == nullptr && underlayer_color_ != nullptr) {
-    delete underlayer_color_;
+  if (GetArenaForAllocation() == nullptr && _impl_.underlayer_color_ != nullptr) {
+    delete _impl_.underlayer_color_;
   }
-  underlayer_color_ = nullptr;
+  _impl_.underlayer_color_ = nullptr;
 }
 void RenderSettings::clear_bus_label_offset() {
-  if (GetArena() == nullptr && bus_label_offset_ != nullptr) {
-    delete bus_label_offset_;
+  if (GetArenaForAllocation() == nullptr && _impl_.bus_label_offset_ != nullptr) {
+    delete _impl_.bus_label_offset_;
   }
-  bus_label_offset_ = nullptr;
+  _impl_.bus_label_offset_ = nullptr;
 }
 void RenderSettings::clear_stop_label_offset() {
-  if (GetArena() == nullptr && stop_label_offset_ != nullptr) {
-    delete stop_label_offset_;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_label_offset_ != nullptr) {
+    delete _impl_.stop_label_offset_;
   }
-  stop_label_offset_ = nullptr;
+  _impl_.stop_label_offset_ = nullptr;
 }
-RenderSettings::RenderSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  palette_(arena),
-  layers_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+RenderSettings::RenderSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.RenderSettings)
 }
 RenderSettings::RenderSettings(const RenderSettings& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      palette_(from.palette_),
-      layers_(from.layers_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RenderSettings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.palette_){from._impl_.palette_}
+    , decltype(_impl_.layers_){from._impl_.layers_}
+    , decltype(_impl_.underlayer_color_){nullptr}
+    , decltype(_impl_.bus_label_offset_){nullptr}
+    , decltype(_impl_.stop_label_offset_){nullptr}
+    , decltype(_impl_.max_width_){}
+    , decltype(_impl_.max_height_){}
+    , decltype(_impl_.padding_){}
+    , decltype(_impl_.outer_margin_){}
+    , decltype(_impl_.line_width_){}
+    , decltype(_impl_.underlayer_width_){}
+    , decltype(_impl_.stop_radius_){}
+    , decltype(_impl_.bus_label_font_size_){}
+    , decltype(_impl_.stop_label_font_size_){}
+    , decltype(_impl_.company_line_width_){}
+    , decltype(_impl_.company_radius_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_underlayer_color()) {
-    underlayer_color_ = new ::SvgProto::Color(*from.underlayer_color_);
-  } else {
-    underlayer_color_ = nullptr;
+    _this->_impl_.underlayer_color_ = new ::SvgProto::Color(*from._impl_.underlayer_color_);
   }
   if (from._internal_has_bus_label_offset()) {
-    bus_label_offset_ = new ::SvgProto::Point(*from.bus_label_offset_);
-  } else {
-    bus_label_offset_ = nullptr;
+    _this->_impl_.bus_label_offset_ = new ::SvgProto::Point(*from._impl_.bus_label_offset_);
   }
   if (from._internal_has_stop_label_offset()) {
-    stop_label_offset_ = new ::SvgProto::Point(*from.stop_label_offset_);
-  } else {
-    stop_label_offset_ = nullptr;
+    _this->_impl_.stop_label_offset_ = new ::SvgProto::Point(*from._impl_.stop_label_offset_);
   }
-  ::memcpy(&max_width_, &from.max_width_,
-    static_cast<size_t>(reinterpret_cast<char*>(&company_radius_) -
-    reinterpret_cast<char*>(&max_width_)) + sizeof(company_radius_));
+  ::memcpy(&_impl_.max_width_, &from._impl_.max_width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.company_radius_) -
+    reinterpret_cast<char*>(&_impl_.max_width_)) + sizeof(_impl_.company_radius_));
   // @@protoc_insertion_point(copy_constructor:TCProto.RenderSettings)
 }
 
-void RenderSettings::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RenderSettings_painter_2eproto.base);
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&underlayer_color_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&company_radius_) -
-      reinterpret_cast<char*>(&underlayer_color_)) + sizeof(company_radius_));
+inline void RenderSettings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.palette_){arena}
+    , decltype(_impl_.layers_){arena}
+    , decltype(_impl_.underlayer_color_){nullptr}
+    , decltype(_impl_.bus_label_offset_){nullptr}
+    , decltype(_impl_.stop_label_offset_){nullptr}
+    , decltype(_impl_.max_width_){0}
+    , decltype(_impl_.max_height_){0}
+    , decltype(_impl_.padding_){0}
+    , decltype(_impl_.outer_margin_){0}
+    , decltype(_impl_.line_width_){0}
+    , decltype(_impl_.underlayer_width_){0}
+    , decltype(_impl_.stop_radius_){0}
+    , decltype(_impl_.bus_label_font_size_){0}
+    , decltype(_impl_.stop_label_font_size_){0}
+    , decltype(_impl_.company_line_width_){0}
+    , decltype(_impl_.company_radius_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RenderSettings::~RenderSettings() {
   // @@protoc_insertion_point(destructor:TCProto.RenderSettings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RenderSettings::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete underlayer_color_;
-  if (this != internal_default_instance()) delete bus_label_offset_;
-  if (this != internal_default_instance()) delete stop_label_offset_;
+inline void RenderSettings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.palette_.~RepeatedPtrField();
+  _impl_.layers_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.underlayer_color_;
+  if (this != internal_default_instance()) delete _impl_.bus_label_offset_;
+  if (this != internal_default_instance()) delete _impl_.stop_label_offset_;
 }
 
-void RenderSettings::ArenaDtor(void* object) {
-  RenderSettings* _this = reinterpret_cast< RenderSettings* >(object);
-  (void)_this;
-}
-void RenderSettings::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void RenderSettings::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const RenderSettings& RenderSettings::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RenderSettings_painter_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RenderSettings::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.RenderSettings)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  palette_.Clear();
-  layers_.Clear();
-  if (GetArena() == nullptr && underlayer_color_ != nullptr) {
-    delete underlayer_color_;
+  _impl_.palette_.Clear();
+  _impl_.layers_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.underlayer_color_ != nullptr) {
+    delete _impl_.underlayer_color_;
   }
-  underlayer_color_ = nullptr;
-  if (GetArena() == nullptr && bus_label_offset_ != nullptr) {
-    delete bus_label_offset_;
+  _impl_.underlayer_color_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.bus_label_offset_ != nullptr) {
+    delete _impl_.bus_label_offset_;
   }
-  bus_label_offset_ = nullptr;
-  if (GetArena() == nullptr && stop_label_offset_ != nullptr) {
-    delete stop_label_offset_;
+  _impl_.bus_label_offset_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_label_offset_ != nullptr) {
+    delete _impl_.stop_label_offset_;
   }
-  stop_label_offset_ = nullptr;
-  ::memset(&max_width_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&company_radius_) -
-      reinterpret_cast<char*>(&max_width_)) + sizeof(company_radius_));
+  _impl_.stop_label_offset_ = nullptr;
+  ::memset(&_impl_.max_width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.company_radius_) -
+      reinterpret_cast<char*>(&_impl_.max_width_)) + sizeof(_impl_.company_radius_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RenderSettings::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RenderSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // double max_width = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          max_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.max_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double max_height = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
-          max_height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.max_height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double padding = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25)) {
-          padding_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.padding_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double outer_margin = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 33)) {
-          outer_margin_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.outer_margin_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .SvgProto.Color palette = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -395,204 +417,242 @@ const char* RenderSettings::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double line_width = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 49)) {
-          line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .SvgProto.Color underlayer_color = 7;
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
           ptr = ctx->ParseMessage(_internal_mutable_underlayer_color(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double underlayer_width = 8;
       case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 65)) {
-          underlayer_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.underlayer_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double stop_radius = 9;
       case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 73)) {
-          stop_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _impl_.stop_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .SvgProto.Point bus_label_offset = 10;
       case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
           ptr = ctx->ParseMessage(_internal_mutable_bus_label_offset(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 bus_label_font_size = 11;
       case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
-          bus_label_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.bus_label_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .SvgProto.Point stop_label_offset = 12;
       case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
           ptr = ctx->ParseMessage(_internal_mutable_stop_label_offset(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 stop_label_font_size = 13;
       case 13:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 104)) {
-          stop_label_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.stop_label_font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated string layers = 14;
       case 14:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
           ptr -= 1;
           do {
             ptr += 1;
             auto str = _internal_add_layers();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.RenderSettings.layers"));
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "TCProto.RenderSettings.layers"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double company_line_width = 15;
       case 15:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 121)) {
-          company_line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 121)) {
+          _impl_.company_line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double company_radius = 16;
       case 16:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 129)) {
-          company_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 129)) {
+          _impl_.company_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RenderSettings::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* RenderSettings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.RenderSettings)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // double max_width = 1;
-  if (!(this->max_width() <= 0 && this->max_width() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_width = this->_internal_max_width();
+  uint64_t raw_max_width;
+  memcpy(&raw_max_width, &tmp_max_width, sizeof(tmp_max_width));
+  if (raw_max_width != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_max_width(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_max_width(), target);
   }
 
   // double max_height = 2;
-  if (!(this->max_height() <= 0 && this->max_height() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_height = this->_internal_max_height();
+  uint64_t raw_max_height;
+  memcpy(&raw_max_height, &tmp_max_height, sizeof(tmp_max_height));
+  if (raw_max_height != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_max_height(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_max_height(), target);
   }
 
   // double padding = 3;
-  if (!(this->padding() <= 0 && this->padding() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_padding = this->_internal_padding();
+  uint64_t raw_padding;
+  memcpy(&raw_padding, &tmp_padding, sizeof(tmp_padding));
+  if (raw_padding != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_padding(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_padding(), target);
   }
 
   // double outer_margin = 4;
-  if (!(this->outer_margin() <= 0 && this->outer_margin() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_outer_margin = this->_internal_outer_margin();
+  uint64_t raw_outer_margin;
+  memcpy(&raw_outer_margin, &tmp_outer_margin, sizeof(tmp_outer_margin));
+  if (raw_outer_margin != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(4, this->_internal_outer_margin(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_outer_margin(), target);
   }
 
   // repeated .SvgProto.Color palette = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_palette_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_palette_size()); i < n; i++) {
+    const auto& repfield = this->_internal_palette(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_palette(i), target, stream);
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // double line_width = 6;
-  if (!(this->line_width() <= 0 && this->line_width() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_line_width = this->_internal_line_width();
+  uint64_t raw_line_width;
+  memcpy(&raw_line_width, &tmp_line_width, sizeof(tmp_line_width));
+  if (raw_line_width != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(6, this->_internal_line_width(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_line_width(), target);
   }
 
   // .SvgProto.Color underlayer_color = 7;
-  if (this->has_underlayer_color()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_underlayer_color()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        7, _Internal::underlayer_color(this), target, stream);
+      InternalWriteMessage(7, _Internal::underlayer_color(this),
+        _Internal::underlayer_color(this).GetCachedSize(), target, stream);
   }
 
   // double underlayer_width = 8;
-  if (!(this->underlayer_width() <= 0 && this->underlayer_width() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_underlayer_width = this->_internal_underlayer_width();
+  uint64_t raw_underlayer_width;
+  memcpy(&raw_underlayer_width, &tmp_underlayer_width, sizeof(tmp_underlayer_width));
+  if (raw_underlayer_width != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(8, this->_internal_underlayer_width(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_underlayer_width(), target);
   }
 
   // double stop_radius = 9;
-  if (!(this->stop_radius() <= 0 && this->stop_radius() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_radius = this->_internal_stop_radius();
+  uint64_t raw_stop_radius;
+  memcpy(&raw_stop_radius, &tmp_stop_radius, sizeof(tmp_stop_radius));
+  if (raw_stop_radius != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(9, this->_internal_stop_radius(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_stop_radius(), target);
   }
 
   // .SvgProto.Point bus_label_offset = 10;
-  if (this->has_bus_label_offset()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_bus_label_offset()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        10, _Internal::bus_label_offset(this), target, stream);
+      InternalWriteMessage(10, _Internal::bus_label_offset(this),
+        _Internal::bus_label_offset(this).GetCachedSize(), target, stream);
   }
 
   // int32 bus_label_font_size = 11;
-  if (this->bus_label_font_size() != 0) {
+  if (this->_internal_bus_label_font_size() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(11, this->_internal_bus_label_font_size(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(11, this->_internal_bus_label_font_size(), target);
   }
 
   // .SvgProto.Point stop_label_offset = 12;
-  if (this->has_stop_label_offset()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_stop_label_offset()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        12, _Internal::stop_label_offset(this), target, stream);
+      InternalWriteMessage(12, _Internal::stop_label_offset(this),
+        _Internal::stop_label_offset(this).GetCachedSize(), target, stream);
   }
 
   // int32 stop_label_font_size = 13;
-  if (this->stop_label_font_size() != 0) {
+  if (this->_internal_stop_label_font_size() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(13, this->_internal_stop_label_font_size(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(13, this->_internal_stop_label_font_size(), target);
   }
 
   // repeated string layers = 14;
@@ -606,19 +666,27 @@ failure:
   }
 
   // double company_line_width = 15;
-  if (!(this->company_line_width() <= 0 && this->company_line_width() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_company_line_width = this->_internal_company_line_width();
+  uint64_t raw_company_line_width;
+  memcpy(&raw_company_line_width, &tmp_company_line_width, sizeof(tmp_company_line_width));
+  if (raw_company_line_width != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(15, this->_internal_company_line_width(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(15, this->_internal_company_line_width(), target);
   }
 
   // double company_radius = 16;
-  if (!(this->company_radius() <= 0 && this->company_radius() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_company_radius = this->_internal_company_radius();
+  uint64_t raw_company_radius;
+  memcpy(&raw_company_radius, &tmp_company_radius, sizeof(tmp_company_radius));
+  if (raw_company_radius != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(16, this->_internal_company_radius(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(16, this->_internal_company_radius(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.RenderSettings)
@@ -629,187 +697,239 @@ size_t RenderSettings::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.RenderSettings)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .SvgProto.Color palette = 5;
   total_size += 1UL * this->_internal_palette_size();
-  for (const auto& msg : this->palette_) {
+  for (const auto& msg : this->_impl_.palette_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated string layers = 14;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(layers_.size());
-  for (int i = 0, n = layers_.size(); i < n; i++) {
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.layers_.size());
+  for (int i = 0, n = _impl_.layers_.size(); i < n; i++) {
     total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      layers_.Get(i));
+      _impl_.layers_.Get(i));
   }
 
   // .SvgProto.Color underlayer_color = 7;
-  if (this->has_underlayer_color()) {
+  if (this->_internal_has_underlayer_color()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *underlayer_color_);
+        *_impl_.underlayer_color_);
   }
 
   // .SvgProto.Point bus_label_offset = 10;
-  if (this->has_bus_label_offset()) {
+  if (this->_internal_has_bus_label_offset()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bus_label_offset_);
+        *_impl_.bus_label_offset_);
   }
 
   // .SvgProto.Point stop_label_offset = 12;
-  if (this->has_stop_label_offset()) {
+  if (this->_internal_has_stop_label_offset()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *stop_label_offset_);
+        *_impl_.stop_label_offset_);
   }
 
   // double max_width = 1;
-  if (!(this->max_width() <= 0 && this->max_width() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_width = this->_internal_max_width();
+  uint64_t raw_max_width;
+  memcpy(&raw_max_width, &tmp_max_width, sizeof(tmp_max_width));
+  if (raw_max_width != 0) {
     total_size += 1 + 8;
   }
 
   // double max_height = 2;
-  if (!(this->max_height() <= 0 && this->max_height() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_height = this->_internal_max_height();
+  uint64_t raw_max_height;
+  memcpy(&raw_max_height, &tmp_max_height, sizeof(tmp_max_height));
+  if (raw_max_height != 0) {
     total_size += 1 + 8;
   }
 
   // double padding = 3;
-  if (!(this->padding() <= 0 && this->padding() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_padding = this->_internal_padding();
+  uint64_t raw_padding;
+  memcpy(&raw_padding, &tmp_padding, sizeof(tmp_padding));
+  if (raw_padding != 0) {
     total_size += 1 + 8;
   }
 
   // double outer_margin = 4;
-  if (!(this->outer_margin() <= 0 && this->outer_margin() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_outer_margin = this->_internal_outer_margin();
+  uint64_t raw_outer_margin;
+  memcpy(&raw_outer_margin, &tmp_outer_margin, sizeof(tmp_outer_margin));
+  if (raw_outer_margin != 0) {
     total_size += 1 + 8;
   }
 
   // double line_width = 6;
-  if (!(this->line_width() <= 0 && this->line_width() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_line_width = this->_internal_line_width();
+  uint64_t raw_line_width;
+  memcpy(&raw_line_width, &tmp_line_width, sizeof(tmp_line_width));
+  if (raw_line_width != 0) {
     total_size += 1 + 8;
   }
 
   // double underlayer_width = 8;
-  if (!(this->underlayer_width() <= 0 && this->underlayer_width() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_underlayer_width = this->_internal_underlayer_width();
+  uint64_t raw_underlayer_width;
+  memcpy(&raw_underlayer_width, &tmp_underlayer_width, sizeof(tmp_underlayer_width));
+  if (raw_underlayer_width != 0) {
     total_size += 1 + 8;
   }
 
   // double stop_radius = 9;
-  if (!(this->stop_radius() <= 0 && this->stop_radius() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_radius = this->_internal_stop_radius();
+  uint64_t raw_stop_radius;
+  memcpy(&raw_stop_radius, &tmp_stop_radius, sizeof(tmp_stop_radius));
+  if (raw_stop_radius != 0) {
     total_size += 1 + 8;
   }
 
   // int32 bus_label_font_size = 11;
-  if (this->bus_label_font_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_bus_label_font_size());
+  if (this->_internal_bus_label_font_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_bus_label_font_size());
   }
 
   // int32 stop_label_font_size = 13;
-  if (this->stop_label_font_size() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_stop_label_font_size());
+  if (this->_internal_stop_label_font_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_stop_label_font_size());
   }
 
   // double company_line_width = 15;
-  if (!(this->company_line_width() <= 0 && this->company_line_width() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_company_line_width = this->_internal_company_line_width();
+  uint64_t raw_company_line_width;
+  memcpy(&raw_company_line_width, &tmp_company_line_width, sizeof(tmp_company_line_width));
+  if (raw_company_line_width != 0) {
     total_size += 1 + 8;
   }
 
   // double company_radius = 16;
-  if (!(this->company_radius() <= 0 && this->company_radius() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_company_radius = this->_internal_company_radius();
+  uint64_t raw_company_radius;
+  memcpy(&raw_company_radius, &tmp_company_radius, sizeof(tmp_company_radius));
+  if (raw_company_radius != 0) {
     total_size += 2 + 8;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RenderSettings::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.RenderSettings)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RenderSettings* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RenderSettings>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.RenderSettings)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.RenderSettings)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RenderSettings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RenderSettings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RenderSettings::GetClassData() const { return &_class_data_; }
 
-void RenderSettings::MergeFrom(const RenderSettings& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.RenderSettings)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void RenderSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RenderSettings*>(&to_msg);
+  auto& from = static_cast<const RenderSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.RenderSettings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  palette_.MergeFrom(from.palette_);
-  layers_.MergeFrom(from.layers_);
-  if (from.has_underlayer_color()) {
-    _internal_mutable_underlayer_color()->::SvgProto::Color::MergeFrom(from._internal_underlayer_color());
-  }
-  if (from.has_bus_label_offset()) {
-    _internal_mutable_bus_label_offset()->::SvgProto::Point::MergeFrom(from._internal_bus_label_offset());
-  }
-  if (from.has_stop_label_offset()) {
-    _internal_mutable_stop_label_offset()->::SvgProto::Point::MergeFrom(from._internal_stop_label_offset());
-  }
-  if (!(from.max_width() <= 0 && from.max_width() >= 0)) {
-    _internal_set_max_width(from._internal_max_width());
-  }
-  if (!(from.max_height() <= 0 && from.max_height() >= 0)) {
-    _internal_set_max_height(from._internal_max_height());
-  }
-  if (!(from.padding() <= 0 && from.padding() >= 0)) {
-    _internal_set_padding(from._internal_padding());
-  }
-  if (!(from.outer_margin() <= 0 && from.outer_margin() >= 0)) {
-    _internal_set_outer_margin(from._internal_outer_margin());
-  }
-  if (!(from.line_width() <= 0 && from.line_width() >= 0)) {
-    _internal_set_line_width(from._internal_line_width());
-  }
-  if (!(from.underlayer_width() <= 0 && from.underlayer_width() >= 0)) {
-    _internal_set_underlayer_width(from._internal_underlayer_width());
-  }
-  if (!(from.stop_radius() <= 0 && from.stop_radius() >= 0)) {
-    _internal_set_stop_radius(from._internal_stop_radius());
-  }
-  if (from.bus_label_font_size() != 0) {
-    _internal_set_bus_label_font_size(from._internal_bus_label_font_size());
-  }
-  if (from.stop_label_font_size() != 0) {
-    _internal_set_stop_label_font_size(from._internal_stop_label_font_size());
-  }
-  if (!(from.company_line_width() <= 0 && from.company_line_width() >= 0)) {
-    _internal_set_company_line_width(from._internal_company_line_width());
+  _this->_impl_.palette_.MergeFrom(from._impl_.palette_);
+  _this->_impl_.layers_.MergeFrom(from._impl_.layers_);
+  if (from._internal_has_underlayer_color()) {
+    _this->_internal_mutable_underlayer_color()->::SvgProto::Color::MergeFrom(
+        from._internal_underlayer_color());
   }
-  if (!(from.company_radius() <= 0 && from.company_radius() >= 0)) {
-    _internal_set_company_radius(from._internal_company_radius());
+  if (from._internal_has_bus_label_offset()) {
+    _this->_internal_mutable_bus_label_offset()->::SvgProto::Point::MergeFrom(
+        from._internal_bus_label_offset());
   }
-}
-
-void RenderSettings::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.RenderSettings)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_has_stop_label_offset()) {
+    _this->_internal_mutable_stop_label_offset()->::SvgProto::Point::MergeFrom(
+        from._internal_stop_label_offset());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_width = from._internal_max_width();
+  uint64_t raw_max_width;
+  memcpy(&raw_max_width, &tmp_max_width, sizeof(tmp_max_width));
+  if (raw_max_width != 0) {
+    _this->_internal_set_max_width(from._internal_max_width());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_max_height = from._internal_max_height();
+  uint64_t raw_max_height;
+  memcpy(&raw_max_height, &tmp_max_height, sizeof(tmp_max_height));
+  if (raw_max_height != 0) {
+    _this->_internal_set_max_height(from._internal_max_height());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_padding = from._internal_padding();
+  uint64_t raw_padding;
+  memcpy(&raw_padding, &tmp_padding, sizeof(tmp_padding));
+  if (raw_padding != 0) {
+    _this->_internal_set_padding(from._internal_padding());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_outer_margin = from._internal_outer_margin();
+  uint64_t raw_outer_margin;
+  memcpy(&raw_outer_margin, &tmp_outer_margin, sizeof(tmp_outer_margin));
+  if (raw_outer_margin != 0) {
+    _this->_internal_set_outer_margin(from._internal_outer_margin());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_line_width = from._internal_line_width();
+  uint64_t raw_line_width;
+  memcpy(&raw_line_width, &tmp_line_width, sizeof(tmp_line_width));
+  if (raw_line_width != 0) {
+    _this->_internal_set_line_width(from._internal_line_width());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_underlayer_width = from._internal_underlayer_width();
+  uint64_t raw_underlayer_width;
+  memcpy(&raw_underlayer_width, &tmp_underlayer_width, sizeof(tmp_underlayer_width));
+  if (raw_underlayer_width != 0) {
+    _this->_internal_set_underlayer_width(from._internal_underlayer_width());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_radius = from._internal_stop_radius();
+  uint64_t raw_stop_radius;
+  memcpy(&raw_stop_radius, &tmp_stop_radius, sizeof(tmp_stop_radius));
+  if (raw_stop_radius != 0) {
+    _this->_internal_set_stop_radius(from._internal_stop_radius());
+  }
+  if (from._internal_bus_label_font_size() != 0) {
+    _this->_internal_set_bus_label_font_size(from._internal_bus_label_font_size());
+  }
+  if (from._internal_stop_label_font_size() != 0) {
+    _this->_internal_set_stop_label_font_size(from._internal_stop_label_font_size());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_company_line_width = from._internal_company_line_width();
+  uint64_t raw_company_line_width;
+  memcpy(&raw_company_line_width, &tmp_company_line_width, sizeof(tmp_company_line_width));
+  if (raw_company_line_width != 0) {
+    _this->_internal_set_company_line_width(from._internal_company_line_width());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_company_radius = from._internal_company_radius();
+  uint64_t raw_company_radius;
+  memcpy(&raw_company_radius, &tmp_company_radius, sizeof(tmp_company_radius));
+  if (raw_company_radius != 0) {
+    _this->_internal_set_company_radius(from._internal_company_radius());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RenderSettings::CopyFrom(const RenderSettings& from) {
@@ -825,22 +945,23 @@ bool RenderSettings::IsInitialized() const {
 
 void RenderSettings::InternalSwap(RenderSettings* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  palette_.InternalSwap(&other->palette_);
-  layers_.InternalSwap(&other->layers_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.palette_.InternalSwap(&other->_impl_.palette_);
+  _impl_.layers_.InternalSwap(&other->_impl_.layers_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RenderSettings, company_radius_)
-      + sizeof(RenderSettings::company_radius_)
-      - PROTOBUF_FIELD_OFFSET(RenderSettings, underlayer_color_)>(
-          reinterpret_cast<char*>(&underlayer_color_),
-          reinterpret_cast<char*>(&other->underlayer_color_));
+      PROTOBUF_FIELD_OFFSET(RenderSettings, _impl_.company_radius_)
+      + sizeof(RenderSettings::_impl_.company_radius_)
+      - PROTOBUF_FIELD_OFFSET(RenderSettings, _impl_.underlayer_color_)>(
+          reinterpret_cast<char*>(&_impl_.underlayer_color_),
+          reinterpret_cast<char*>(&other->_impl_.underlayer_color_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RenderSettings::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_painter_2eproto_getter, &descriptor_table_painter_2eproto_once,
+      file_level_metadata_painter_2eproto[0]);
 }
 
-
 // ===================================================================
 
 class StopCoords::_Internal {
@@ -850,136 +971,146 @@ class StopCoords::_Internal {
 
 const ::SvgProto::Point&
 StopCoords::_Internal::point(const StopCoords* msg) {
-  return *msg->point_;
+  return *msg->_impl_.point_;
 }
 void StopCoords::clear_point() {
-  if (GetArena() == nullptr && point_ != nullptr) {
-    delete point_;
+  if (GetArenaForAllocation() == nullptr && _impl_.point_ != nullptr) {
+    delete _impl_.point_;
   }
-  point_ = nullptr;
+  _impl_.point_ = nullptr;
 }
-StopCoords::StopCoords(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+StopCoords::StopCoords(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.StopCoords)
 }
 StopCoords::StopCoords(const StopCoords& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopCoords* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.point_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_point()) {
-    point_ = new ::SvgProto::Point(*from.point_);
-  } else {
-    point_ = nullptr;
+    _this->_impl_.point_ = new ::SvgProto::Point(*from._impl_.point_);
   }
   // @@protoc_insertion_point(copy_constructor:TCProto.StopCoords)
 }
 
-void StopCoords::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StopCoords_painter_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  point_ = nullptr;
+inline void StopCoords::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.point_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 StopCoords::~StopCoords() {
   // @@protoc_insertion_point(destructor:TCProto.StopCoords)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void StopCoords::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete point_;
+inline void StopCoords::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.point_;
 }
 
-void StopCoords::ArenaDtor(void* object) {
-  StopCoords* _this = reinterpret_cast< StopCoords* >(object);
-  (void)_this;
-}
-void StopCoords::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void StopCoords::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const StopCoords& StopCoords::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StopCoords_painter_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void StopCoords::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.StopCoords)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmpty();
-  if (GetArena() == nullptr && point_ != nullptr) {
-    delete point_;
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.point_ != nullptr) {
+    delete _impl_.point_;
   }
-  point_ = nullptr;
+  _impl_.point_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StopCoords::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StopCoords::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.StopCoords.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.StopCoords.name"));
+        } else
+          goto handle_unusual;
         continue;
       // .SvgProto.Point point = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_point(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* StopCoords::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* StopCoords::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.StopCoords)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -989,15 +1120,14 @@ failure:
   }
 
   // .SvgProto.Point point = 2;
-  if (this->has_point()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_point()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::point(this), target, stream);
+      InternalWriteMessage(2, _Internal::point(this),
+        _Internal::point(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.StopCoords)
@@ -1008,68 +1138,50 @@ size_t StopCoords::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.StopCoords)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
   // .SvgProto.Point point = 2;
-  if (this->has_point()) {
+  if (this->_internal_has_point()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *point_);
+        *_impl_.point_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void StopCoords::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.StopCoords)
-  GOOGLE_DCHECK_NE(&from, this);
-  const StopCoords* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StopCoords>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.StopCoords)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.StopCoords)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopCoords::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StopCoords::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopCoords::GetClassData() const { return &_class_data_; }
 
-void StopCoords::MergeFrom(const StopCoords& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.StopCoords)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void StopCoords::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopCoords*>(&to_msg);
+  auto& from = static_cast<const StopCoords&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.StopCoords)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.has_point()) {
-    _internal_mutable_point()->::SvgProto::Point::MergeFrom(from._internal_point());
+  if (from._internal_has_point()) {
+    _this->_internal_mutable_point()->::SvgProto::Point::MergeFrom(
+        from._internal_point());
   }
-}
-
-void StopCoords::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.StopCoords)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StopCoords::CopyFrom(const StopCoords& from) {
@@ -1085,16 +1197,22 @@ bool StopCoords::IsInitialized() const {
 
 void StopCoords::InternalSwap(StopCoords* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(point_, other->point_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.point_, other->_impl_.point_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StopCoords::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_painter_2eproto_getter, &descriptor_table_painter_2eproto_once,
+      file_level_metadata_painter_2eproto[1]);
 }
 
-
 // ===================================================================
 
 class BusColor::_Internal {
@@ -1104,136 +1222,146 @@ class BusColor::_Internal {
 
 const ::SvgProto::Color&
 BusColor::_Internal::color(const BusColor* msg) {
-  return *msg->color_;
+  return *msg->_impl_.color_;
 }
 void BusColor::clear_color() {
-  if (GetArena() == nullptr && color_ != nullptr) {
-    delete color_;
+  if (GetArenaForAllocation() == nullptr && _impl_.color_ != nullptr) {
+    delete _impl_.color_;
   }
-  color_ = nullptr;
+  _impl_.color_ = nullptr;
 }
-BusColor::BusColor(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+BusColor::BusColor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.BusColor)
 }
 BusColor::BusColor(const BusColor& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BusColor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.color_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   if (from._internal_has_color()) {
-    color_ = new ::SvgProto::Color(*from.color_);
-  } else {
-    color_ = nullptr;
+    _this->_impl_.color_ = new ::SvgProto::Color(*from._impl_.color_);
   }
   // @@protoc_insertion_point(copy_constructor:TCProto.BusColor)
 }
 
-void BusColor::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BusColor_painter_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  color_ = nullptr;
+inline void BusColor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.color_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BusColor::~BusColor() {
   // @@protoc_insertion_point(destructor:TCProto.BusColor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void BusColor::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete color_;
+inline void BusColor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.color_;
 }
 
-void BusColor::ArenaDtor(void* object) {
-  BusColor* _this = reinterpret_cast< BusColor* >(object);
-  (void)_this;
-}
-void BusColor::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void BusColor::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const BusColor& BusColor::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BusColor_painter_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void BusColor::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.BusColor)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmpty();
-  if (GetArena() == nullptr && color_ != nullptr) {
-    delete color_;
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.color_ != nullptr) {
+    delete _impl_.color_;
   }
-  color_ = nullptr;
+  _impl_.color_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BusColor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BusColor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.BusColor.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.BusColor.name"));
+        } else
+          goto handle_unusual;
         continue;
       // .SvgProto.Color color = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_color(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* BusColor::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* BusColor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.BusColor)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1243,15 +1371,14 @@ failure:
   }
 
   // .SvgProto.Color color = 2;
-  if (this->has_color()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_color()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::color(this), target, stream);
+      InternalWriteMessage(2, _Internal::color(this),
+        _Internal::color(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.BusColor)
@@ -1262,68 +1389,50 @@ size_t BusColor::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.BusColor)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
   // .SvgProto.Color color = 2;
-  if (this->has_color()) {
+  if (this->_internal_has_color()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *color_);
+        *_impl_.color_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BusColor::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.BusColor)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BusColor* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BusColor>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.BusColor)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.BusColor)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BusColor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BusColor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BusColor::GetClassData() const { return &_class_data_; }
 
-void BusColor::MergeFrom(const BusColor& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BusColor)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void BusColor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BusColor*>(&to_msg);
+  auto& from = static_cast<const BusColor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BusColor)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.has_color()) {
-    _internal_mutable_color()->::SvgProto::Color::MergeFrom(from._internal_color());
+  if (from._internal_has_color()) {
+    _this->_internal_mutable_color()->::SvgProto::Color::MergeFrom(
+        from._internal_color());
   }
-}
-
-void BusColor::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.BusColor)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BusColor::CopyFrom(const BusColor& from) {
@@ -1339,16 +1448,22 @@ bool BusColor::IsInitialized() const {
 
 void BusColor::InternalSwap(BusColor* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(color_, other->color_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.color_, other->_impl_.color_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata BusColor::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_painter_2eproto_getter, &descriptor_table_painter_2eproto_once,
+      file_level_metadata_painter_2eproto[2]);
 }
 
-
 // ===================================================================
 
 class Painter::_Internal {
@@ -1358,104 +1473,108 @@ class Painter::_Internal {
 
 const ::TCProto::RenderSettings&
 Painter::_Internal::render_settings(const Painter* msg) {
-  return *msg->render_settings_;
+  return *msg->_impl_.render_settings_;
 }
 void Painter::clear_bus_descriptions() {
-  bus_descriptions_.Clear();
+  _impl_.bus_descriptions_.Clear();
 }
 void Painter::clear_stop_descriptions() {
-  stop_descriptions_.Clear();
-}
-Painter::Painter(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  stops_coords_(arena),
-  bus_colors_(arena),
-  bus_descriptions_(arena),
-  stop_descriptions_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+  _impl_.stop_descriptions_.Clear();
+}
+Painter::Painter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.Painter)
 }
 Painter::Painter(const Painter& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      stops_coords_(from.stops_coords_),
-      bus_colors_(from.bus_colors_),
-      bus_descriptions_(from.bus_descriptions_),
-      stop_descriptions_(from.stop_descriptions_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Painter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_coords_){from._impl_.stops_coords_}
+    , decltype(_impl_.bus_colors_){from._impl_.bus_colors_}
+    , decltype(_impl_.bus_descriptions_){from._impl_.bus_descriptions_}
+    , decltype(_impl_.stop_descriptions_){from._impl_.stop_descriptions_}
+    , decltype(_impl_.render_settings_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_render_settings()) {
-    render_settings_ = new ::TCProto::RenderSettings(*from.render_settings_);
-  } else {
-    render_settings_ = nullptr;
+    _this->_impl_.render_settings_ = new ::TCProto::RenderSettings(*from._impl_.render_settings_);
   }
   // @@protoc_insertion_point(copy_constructor:TCProto.Painter)
 }
 
-void Painter::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Painter_painter_2eproto.base);
-  render_settings_ = nullptr;
+inline void Painter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_coords_){arena}
+    , decltype(_impl_.bus_colors_){arena}
+    , decltype(_impl_.bus_descriptions_){arena}
+    , decltype(_impl_.stop_descriptions_){arena}
+    , decltype(_impl_.render_settings_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Painter::~Painter() {
   // @@protoc_insertion_point(destructor:TCProto.Painter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Painter::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete render_settings_;
+inline void Painter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stops_coords_.~RepeatedPtrField();
+  _impl_.bus_colors_.~RepeatedPtrField();
+  _impl_.bus_descriptions_.~RepeatedPtrField();
+  _impl_.stop_descriptions_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.render_settings_;
 }
 
-void Painter::ArenaDtor(void* object) {
-  Painter* _this = reinterpret_cast< Painter* >(object);
-  (void)_this;
-}
-void Painter::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Painter::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Painter& Painter::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Painter_painter_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Painter::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.Painter)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stops_coords_.Clear();
-  bus_colors_.Clear();
-  bus_descriptions_.Clear();
-  stop_descriptions_.Clear();
-  if (GetArena() == nullptr && render_settings_ != nullptr) {
-    delete render_settings_;
+  _impl_.stops_coords_.Clear();
+  _impl_.bus_colors_.Clear();
+  _impl_.bus_descriptions_.Clear();
+  _impl_.stop_descriptions_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.render_settings_ != nullptr) {
+    delete _impl_.render_settings_;
   }
-  render_settings_ = nullptr;
+  _impl_.render_settings_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Painter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Painter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .TCProto.RenderSettings render_settings = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_render_settings(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .TCProto.StopCoords stops_coords = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1463,11 +1582,12 @@ const char* Painter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .TCProto.BusColor bus_colors = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1475,11 +1595,12 @@ const char* Painter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .TCProto.BusDescription bus_descriptions = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1487,11 +1608,12 @@ const char* Painter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .TCProto.StopDescription stop_descriptions = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1499,78 +1621,79 @@ const char* Painter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Painter::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Painter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.Painter)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .TCProto.RenderSettings render_settings = 1;
-  if (this->has_render_settings()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_render_settings()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::render_settings(this), target, stream);
+      InternalWriteMessage(1, _Internal::render_settings(this),
+        _Internal::render_settings(this).GetCachedSize(), target, stream);
   }
 
   // repeated .TCProto.StopCoords stops_coords = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_stops_coords_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stops_coords_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stops_coords(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_stops_coords(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .TCProto.BusColor bus_colors = 3;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_bus_colors_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bus_colors_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bus_colors(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, this->_internal_bus_colors(i), target, stream);
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .TCProto.BusDescription bus_descriptions = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_bus_descriptions_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bus_descriptions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bus_descriptions(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, this->_internal_bus_descriptions(i), target, stream);
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .TCProto.StopDescription stop_descriptions = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_stop_descriptions_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stop_descriptions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stop_descriptions(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_stop_descriptions(i), target, stream);
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.Painter)
@@ -1581,90 +1704,72 @@ size_t Painter::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.Painter)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .TCProto.StopCoords stops_coords = 2;
   total_size += 1UL * this->_internal_stops_coords_size();
-  for (const auto& msg : this->stops_coords_) {
+  for (const auto& msg : this->_impl_.stops_coords_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .TCProto.BusColor bus_colors = 3;
   total_size += 1UL * this->_internal_bus_colors_size();
-  for (const auto& msg : this->bus_colors_) {
+  for (const auto& msg : this->_impl_.bus_colors_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .TCProto.BusDescription bus_descriptions = 4;
   total_size += 1UL * this->_internal_bus_descriptions_size();
-  for (const auto& msg : this->bus_descriptions_) {
+  for (const auto& msg : this->_impl_.bus_descriptions_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .TCProto.StopDescription stop_descriptions = 5;
   total_size += 1UL * this->_internal_stop_descriptions_size();
-  for (const auto& msg : this->stop_descriptions_) {
+  for (const auto& msg : this->_impl_.stop_descriptions_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // .TCProto.RenderSettings render_settings = 1;
-  if (this->has_render_settings()) {
+  if (this->_internal_has_render_settings()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *render_settings_);
+        *_impl_.render_settings_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Painter::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.Painter)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Painter* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Painter>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.Painter)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.Painter)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Painter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Painter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Painter::GetClassData() const { return &_class_data_; }
 
-void Painter::MergeFrom(const Painter& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.Painter)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Painter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Painter*>(&to_msg);
+  auto& from = static_cast<const Painter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.Painter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  stops_coords_.MergeFrom(from.stops_coords_);
-  bus_colors_.MergeFrom(from.bus_colors_);
-  bus_descriptions_.MergeFrom(from.bus_descriptions_);
-  stop_descriptions_.MergeFrom(from.stop_descriptions_);
-  if (from.has_render_settings()) {
-    _internal_mutable_render_settings()->::TCProto::RenderSettings::MergeFrom(from._internal_render_settings());
+  _this->_impl_.stops_coords_.MergeFrom(from._impl_.stops_coords_);
+  _this->_impl_.bus_colors_.MergeFrom(from._impl_.bus_colors_);
+  _this->_impl_.bus_descriptions_.MergeFrom(from._impl_.bus_descriptions_);
+  _this->_impl_.stop_descriptions_.MergeFrom(from._impl_.stop_descriptions_);
+  if (from._internal_has_render_settings()) {
+    _this->_internal_mutable_render_settings()->::TCProto::RenderSettings::MergeFrom(
+        from._internal_render_settings());
   }
-}
-
-void Painter::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.Painter)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Painter::CopyFrom(const Painter& from) {
@@ -1680,32 +1785,37 @@ bool Painter::IsInitialized() const {
 
 void Painter::InternalSwap(Painter* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  stops_coords_.InternalSwap(&other->stops_coords_);
-  bus_colors_.InternalSwap(&other->bus_colors_);
-  bus_descriptions_.InternalSwap(&other->bus_descriptions_);
-  stop_descriptions_.InternalSwap(&other->stop_descriptions_);
-  swap(render_settings_, other->render_settings_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stops_coords_.InternalSwap(&other->_impl_.stops_coords_);
+  _impl_.bus_colors_.InternalSwap(&other->_impl_.bus_colors_);
+  _impl_.bus_descriptions_.InternalSwap(&other->_impl_.bus_descriptions_);
+  _impl_.stop_descriptions_.InternalSwap(&other->_impl_.stop_descriptions_);
+  swap(_impl_.render_settings_, other->_impl_.render_settings_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Painter::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_painter_2eproto_getter, &descriptor_table_painter_2eproto_once,
+      file_level_metadata_painter_2eproto[3]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace TCProto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::TCProto::RenderSettings* Arena::CreateMaybeMessage< ::TCProto::RenderSettings >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::RenderSettings*
+Arena::CreateMaybeMessage< ::TCProto::RenderSettings >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::RenderSettings >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::StopCoords* Arena::CreateMaybeMessage< ::TCProto::StopCoords >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::StopCoords*
+Arena::CreateMaybeMessage< ::TCProto::StopCoords >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::StopCoords >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::BusColor* Arena::CreateMaybeMessage< ::TCProto::BusColor >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::BusColor*
+Arena::CreateMaybeMessage< ::TCProto::BusColor >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::BusColor >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::Painter* Arena::CreateMaybeMessage< ::TCProto::Painter >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::Painter*
+Arena::CreateMaybeMessage< ::TCProto::Painter >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::Painter >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -44,29 +43,21 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_painter_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_painter_2eproto;
 namespace TCProto {
 class BusColor;
-class BusColorDefaultTypeInternal;
+struct BusColorDefaultTypeInternal;
 extern BusColorDefaultTypeInternal _BusColor_default_instance_;
 class Painter;
-class PainterDefaultTypeInternal;
+struct PainterDefaultTypeInternal;
 extern PainterDefaultTypeInternal _Painter_default_instance_;
 class RenderSettings;
-class RenderSettingsDefaultTypeInternal;
+struct RenderSettingsDefaultTypeInternal;
 extern RenderSettingsDefaultTypeInternal _RenderSettings_default_instance_;
 class StopCoords;
-class StopCoordsDefaultTypeInternal;
+struct StopCoordsDefaultTypeInternal;
 extern StopCoordsDefaultTypeInternal _StopCoords_default_instance_;
 }  // namespace TCProto
 PROTOBUF_NAMESPACE_OPEN
@@ -79,11 +70,12 @@ namespace TCProto {
 
 // ===================================================================
 
-class RenderSettings PROTOBUF_FINAL :
+class RenderSettings final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.RenderSettings) */ {
  public:
   inline RenderSettings() : RenderSettings(nullptr) {}
-  virtual ~RenderSettings();
+  ~RenderSettings() override;
+  explicit PROTOBUF_CONSTEXPR RenderSettings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RenderSettings(const RenderSettings& from);
   RenderSettings(RenderSettings&& from) noexcept
@@ -96,8 +88,13 @@ class RenderSettings PROTOBUF_FINAL :
     return *this;
   }
   inline RenderSettings& operator=(RenderSettings&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -108,13 +105,14 @@ class RenderSettings PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RenderSettings& default_instance() {
+    return *internal_default_instance();
   }
-  static const RenderSettings& default_instance();
-
   static inline const RenderSettings* internal_default_instance() {
     return reinterpret_cast<const RenderSettings*>(
                &_RenderSettings_default_instance_);
@@ -127,7 +125,12 @@ class RenderSettings PROTOBUF_FINAL :
   }
   inline void Swap(RenderSettings* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -135,56 +138,53 @@ class RenderSettings PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RenderSettings* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RenderSettings* New() const final {
-    return CreateMaybeMessage<RenderSettings>(nullptr);
-  }
-
-  RenderSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RenderSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RenderSettings>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RenderSettings& from);
-  void MergeFrom(const RenderSettings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RenderSettings& from) {
+    RenderSettings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RenderSettings* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.RenderSettings";
   }
   protected:
-  explicit RenderSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RenderSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_painter_2eproto);
-    return ::descriptor_table_painter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -257,7 +257,7 @@ class RenderSettings PROTOBUF_FINAL :
   public:
   void clear_underlayer_color();
   const ::SvgProto::Color& underlayer_color() const;
-  ::SvgProto::Color* release_underlayer_color();
+  PROTOBUF_NODISCARD ::SvgProto::Color* release_underlayer_color();
   ::SvgProto::Color* mutable_underlayer_color();
   void set_allocated_underlayer_color(::SvgProto::Color* underlayer_color);
   private:
@@ -275,7 +275,7 @@ class RenderSettings PROTOBUF_FINAL :
   public:
   void clear_bus_label_offset();
   const ::SvgProto::Point& bus_label_offset() const;
-  ::SvgProto::Point* release_bus_label_offset();
+  PROTOBUF_NODISCARD ::SvgProto::Point* release_bus_label_offset();
   ::SvgProto::Point* mutable_bus_label_offset();
   void set_allocated_bus_label_offset(::SvgProto::Point* bus_label_offset);
   private:
@@ -293,7 +293,7 @@ class RenderSettings PROTOBUF_FINAL :
   public:
   void clear_stop_label_offset();
   const ::SvgProto::Point& stop_label_offset() const;
-  ::SvgProto::Point* release_stop_label_offset();
+  PROTOBUF_NODISCARD ::SvgProto::Point* release_stop_label_offset();
   ::SvgProto::Point* mutable_stop_label_offset();
   void set_allocated_stop_label_offset(::SvgProto::Point* stop_label_offset);
   private:
@@ -369,20 +369,20 @@ class RenderSettings PROTOBUF_FINAL :
 
   // int32 bus_label_font_size = 11;
   void clear_bus_label_font_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 bus_label_font_size() const;
-  void set_bus_label_font_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t bus_label_font_size() const;
+  void set_bus_label_font_size(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_bus_label_font_size() const;
-  void _internal_set_bus_label_font_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_bus_label_font_size() const;
+  void _internal_set_bus_label_font_size(int32_t value);
   public:
 
   // int32 stop_label_font_size = 13;
   void clear_stop_label_font_size();
-  ::PROTOBUF_NAMESPACE_ID::int32 stop_label_font_size() const;
-  void set_stop_label_font_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t stop_label_font_size() const;
+  void set_stop_label_font_size(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_stop_label_font_size() const;
-  void _internal_set_stop_label_font_size(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_stop_label_font_size() const;
+  void _internal_set_stop_label_font_size(int32_t value);
   public:
 
   // double company_line_width = 15;
@@ -410,32 +410,36 @@ class RenderSettings PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SvgProto::Color > palette_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> layers_;
-  ::SvgProto::Color* underlayer_color_;
-  ::SvgProto::Point* bus_label_offset_;
-  ::SvgProto::Point* stop_label_offset_;
-  double max_width_;
-  double max_height_;
-  double padding_;
-  double outer_margin_;
-  double line_width_;
-  double underlayer_width_;
-  double stop_radius_;
-  ::PROTOBUF_NAMESPACE_ID::int32 bus_label_font_size_;
-  ::PROTOBUF_NAMESPACE_ID::int32 stop_label_font_size_;
-  double company_line_width_;
-  double company_radius_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SvgProto::Color > palette_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> layers_;
+    ::SvgProto::Color* underlayer_color_;
+    ::SvgProto::Point* bus_label_offset_;
+    ::SvgProto::Point* stop_label_offset_;
+    double max_width_;
+    double max_height_;
+    double padding_;
+    double outer_margin_;
+    double line_width_;
+    double underlayer_width_;
+    double stop_radius_;
+    int32_t bus_label_font_size_;
+    int32_t stop_label_font_size_;
+    double company_line_width_;
+    double company_radius_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_painter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class StopCoords PROTOBUF_FINAL :
+class StopCoords final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.StopCoords) */ {
  public:
   inline StopCoords() : StopCoords(nullptr) {}
-  virtual ~StopCoords();
+  ~StopCoords() override;
+  explicit PROTOBUF_CONSTEXPR StopCoords(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StopCoords(const StopCoords& from);
   StopCoords(StopCoords&& from) noexcept
@@ -448,8 +452,13 @@ class StopCoords PROTOBUF_FINAL :
     return *this;
   }
   inline StopCoords& operator=(StopCoords&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -460,13 +469,14 @@ class StopCoords PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StopCoords& default_instance() {
+    return *internal_default_instance();
   }
-  static const StopCoords& default_instance();
-
   static inline const StopCoords* internal_default_instance() {
     return reinterpret_cast<const StopCoords*>(
                &_StopCoords_default_instance_);
@@ -479,7 +489,12 @@ class StopCoords PROTOBUF_FINAL :
   }
   inline void Swap(StopCoords* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -487,56 +502,53 @@ class StopCoords PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(StopCoords* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline StopCoords* New() const final {
-    return CreateMaybeMessage<StopCoords>(nullptr);
-  }
-
-  StopCoords* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  StopCoords* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<StopCoords>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StopCoords& from);
-  void MergeFrom(const StopCoords& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StopCoords& from) {
+    StopCoords::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StopCoords* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.StopCoords";
   }
   protected:
-  explicit StopCoords(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit StopCoords(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_painter_2eproto);
-    return ::descriptor_table_painter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -549,16 +561,14 @@ class StopCoords PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -569,7 +579,7 @@ class StopCoords PROTOBUF_FINAL :
   public:
   void clear_point();
   const ::SvgProto::Point& point() const;
-  ::SvgProto::Point* release_point();
+  PROTOBUF_NODISCARD ::SvgProto::Point* release_point();
   ::SvgProto::Point* mutable_point();
   void set_allocated_point(::SvgProto::Point* point);
   private:
@@ -587,18 +597,22 @@ class StopCoords PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::SvgProto::Point* point_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::SvgProto::Point* point_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_painter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BusColor PROTOBUF_FINAL :
+class BusColor final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.BusColor) */ {
  public:
   inline BusColor() : BusColor(nullptr) {}
-  virtual ~BusColor();
+  ~BusColor() override;
+  explicit PROTOBUF_CONSTEXPR BusColor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BusColor(const BusColor& from);
   BusColor(BusColor&& from) noexcept
@@ -611,8 +625,13 @@ class BusColor PROTOBUF_FINAL :
     return *this;
   }
   inline BusColor& operator=(BusColor&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -623,13 +642,14 @@ class BusColor PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BusColor& default_instance() {
+    return *internal_default_instance();
   }
-  static const BusColor& default_instance();
-
   static inline const BusColor* internal_default_instance() {
     return reinterpret_cast<const BusColor*>(
                &_BusColor_default_instance_);
@@ -642,7 +662,12 @@ class BusColor PROTOBUF_FINAL :
   }
   inline void Swap(BusColor* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -650,56 +675,53 @@ class BusColor PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(BusColor* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BusColor* New() const final {
-    return CreateMaybeMessage<BusColor>(nullptr);
-  }
-
-  BusColor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BusColor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BusColor>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BusColor& from);
-  void MergeFrom(const BusColor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BusColor& from) {
+    BusColor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BusColor* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.BusColor";
   }
   protected:
-  explicit BusColor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BusColor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_painter_2eproto);
-    return ::descriptor_table_painter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -712,16 +734,14 @@ class BusColor PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -732,7 +752,7 @@ class BusColor PROTOBUF_FINAL :
   public:
   void clear_color();
   const ::SvgProto::Color& color() const;
-  ::SvgProto::Color* release_color();
+  PROTOBUF_NODISCARD ::SvgProto::Color* release_color();
   ::SvgProto::Color* mutable_color();
   void set_allocated_color(::SvgProto::Color* color);
   private:
@@ -750,18 +770,22 @@ class BusColor PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::SvgProto::Color* color_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::SvgProto::Color* color_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_painter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Painter PROTOBUF_FINAL :
+class Painter final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.Painter) */ {
  public:
   inline Painter() : Painter(nullptr) {}
-  virtual ~Painter();
+  ~Painter() override;
+  explicit PROTOBUF_CONSTEXPR Painter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Painter(const Painter& from);
   Painter(Painter&& from) noexcept
@@ -774,8 +798,13 @@ class Painter PROTOBUF_FINAL :
     return *this;
   }
   inline Painter& operator=(Painter&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -786,13 +815,14 @@ class Painter PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Painter& default_instance() {
+    return *internal_default_instance();
   }
-  static const Painter& default_instance();
-
   static inline const Painter* internal_default_instance() {
     return reinterpret_cast<const Painter*>(
                &_Painter_default_instance_);
@@ -805,7 +835,12 @@ class Painter PROTOBUF_FINAL :
   }
   inline void Swap(Painter* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -813,56 +848,53 @@ class Painter PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Painter* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Painter* New() const final {
-    return CreateMaybeMessage<Painter>(nullptr);
-  }
-
-  Painter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Painter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Painter>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Painter& from);
-  void MergeFrom(const Painter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Painter& from) {
+    Painter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Painter* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.Painter";
   }
   protected:
-  explicit Painter(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Painter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_painter_2eproto);
-    return ::descriptor_table_painter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -954,7 +986,7 @@ class Painter PROTOBUF_FINAL :
   public:
   void clear_render_settings();
   const ::TCProto::RenderSettings& render_settings() const;
-  ::TCProto::RenderSettings* release_render_settings();
+  PROTOBUF_NODISCARD ::TCProto::RenderSettings* release_render_settings();
   ::TCProto::RenderSettings* mutable_render_settings();
   void set_allocated_render_settings(::TCProto::RenderSettings* render_settings);
   private:
@@ -972,12 +1004,15 @@ class Painter PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopCoords > stops_coords_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusColor > bus_colors_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusDescription > bus_descriptions_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopDescription > stop_descriptions_;
-  ::TCProto::RenderSettings* render_settings_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopCoords > stops_coords_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusColor > bus_colors_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusDescription > bus_descriptions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopDescription > stop_descriptions_;
+    ::TCProto::RenderSettings* render_settings_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_painter_2eproto;
 };
 // ===================================================================
@@ -993,10 +1028,10 @@ class Painter PROTOBUF_FINAL :
 
 // double max_width = 1;
 inline void RenderSettings::clear_max_width() {
-  max_width_ = 0;
+  _impl_.max_width_ = 0;
 }
 inline double RenderSettings::_internal_max_width() const {
-  return max_width_;
+  return _impl_.max_width_;
 }
 inline double RenderSettings::max_width() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.max_width)
@@ -1004,7 +1039,7 @@ inline double RenderSettings::max_width() const {
 }
 inline void RenderSettings::_internal_set_max_width(double value) {
   
-  max_width_ = value;
+  _impl_.max_width_ = value;
 }
 inline void RenderSettings::set_max_width(double value) {
   _internal_set_max_width(value);
@@ -1013,10 +1048,10 @@ inline void RenderSettings::set_max_width(double value) {
 
 // double max_height = 2;
 inline void RenderSettings::clear_max_height() {
-  max_height_ = 0;
+  _impl_.max_height_ = 0;
 }
 inline double RenderSettings::_internal_max_height() const {
-  return max_height_;
+  return _impl_.max_height_;
 }
 inline double RenderSettings::max_height() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.max_height)
@@ -1024,7 +1059,7 @@ inline double RenderSettings::max_height() const {
 }
 inline void RenderSettings::_internal_set_max_height(double value) {
   
-  max_height_ = value;
+  _impl_.max_height_ = value;
 }
 inline void RenderSettings::set_max_height(double value) {
   _internal_set_max_height(value);
@@ -1033,10 +1068,10 @@ inline void RenderSettings::set_max_height(double value) {
 
 // double padding = 3;
 inline void RenderSettings::clear_padding() {
-  padding_ = 0;
+  _impl_.padding_ = 0;
 }
 inline double RenderSettings::_internal_padding() const {
-  return padding_;
+  return _impl_.padding_;
 }
 inline double RenderSettings::padding() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.padding)
@@ -1044,7 +1079,7 @@ inline double RenderSettings::padding() const {
 }
 inline void RenderSettings::_internal_set_padding(double value) {
   
-  padding_ = value;
+  _impl_.padding_ = value;
 }
 inline void RenderSettings::set_padding(double value) {
   _internal_set_padding(value);
@@ -1053,10 +1088,10 @@ inline void RenderSettings::set_padding(double value) {
 
 // double outer_margin = 4;
 inline void RenderSettings::clear_outer_margin() {
-  outer_margin_ = 0;
+  _impl_.outer_margin_ = 0;
 }
 inline double RenderSettings::_internal_outer_margin() const {
-  return outer_margin_;
+  return _impl_.outer_margin_;
 }
 inline double RenderSettings::outer_margin() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.outer_margin)
@@ -1064,7 +1099,7 @@ inline double RenderSettings::outer_margin() const {
 }
 inline void RenderSettings::_internal_set_outer_margin(double value) {
   
-  outer_margin_ = value;
+  _impl_.outer_margin_ = value;
 }
 inline void RenderSettings::set_outer_margin(double value) {
   _internal_set_outer_margin(value);
@@ -1073,46 +1108,47 @@ inline void RenderSettings::set_outer_margin(double value) {
 
 // repeated .SvgProto.Color palette = 5;
 inline int RenderSettings::_internal_palette_size() const {
-  return palette_.size();
+  return _impl_.palette_.size();
 }
 inline int RenderSettings::palette_size() const {
   return _internal_palette_size();
 }
 inline ::SvgProto::Color* RenderSettings::mutable_palette(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.RenderSettings.palette)
-  return palette_.Mutable(index);
+  return _impl_.palette_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SvgProto::Color >*
 RenderSettings::mutable_palette() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.RenderSettings.palette)
-  return &palette_;
+  return &_impl_.palette_;
 }
 inline const ::SvgProto::Color& RenderSettings::_internal_palette(int index) const {
-  return palette_.Get(index);
+  return _impl_.palette_.Get(index);
 }
 inline const ::SvgProto::Color& RenderSettings::palette(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.palette)
   return _internal_palette(index);
 }
 inline ::SvgProto::Color* RenderSettings::_internal_add_palette() {
-  return palette_.Add();
+  return _impl_.palette_.Add();
 }
 inline ::SvgProto::Color* RenderSettings::add_palette() {
+  ::SvgProto::Color* _add = _internal_add_palette();
   // @@protoc_insertion_point(field_add:TCProto.RenderSettings.palette)
-  return _internal_add_palette();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::SvgProto::Color >&
 RenderSettings::palette() const {
   // @@protoc_insertion_point(field_list:TCProto.RenderSettings.palette)
-  return palette_;
+  return _impl_.palette_;
 }
 
 // double line_width = 6;
 inline void RenderSettings::clear_line_width() {
-  line_width_ = 0;
+  _impl_.line_width_ = 0;
 }
 inline double RenderSettings::_internal_line_width() const {
-  return line_width_;
+  return _impl_.line_width_;
 }
 inline double RenderSettings::line_width() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.line_width)
@@ -1120,7 +1156,7 @@ inline double RenderSettings::line_width() const {
 }
 inline void RenderSettings::_internal_set_line_width(double value) {
   
-  line_width_ = value;
+  _impl_.line_width_ = value;
 }
 inline void RenderSettings::set_line_width(double value) {
   _internal_set_line_width(value);
@@ -1129,10 +1165,10 @@ inline void RenderSettings::set_line_width(double value) {
 
 // double company_line_width = 15;
 inline void RenderSettings::clear_company_line_width() {
-  company_line_width_ = 0;
+  _impl_.company_line_width_ = 0;
 }
 inline double RenderSettings::_internal_company_line_width() const {
-  return company_line_width_;
+  return _impl_.company_line_width_;
 }
 inline double RenderSettings::company_line_width() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.company_line_width)
@@ -1140,7 +1176,7 @@ inline double RenderSettings::company_line_width() const {
 }
 inline void RenderSettings::_internal_set_company_line_width(double value) {
   
-  company_line_width_ = value;
+  _impl_.company_line_width_ = value;
 }
 inline void RenderSettings::set_company_line_width(double value) {
   _internal_set_company_line_width(value);
@@ -1149,13 +1185,13 @@ inline void RenderSettings::set_company_line_width(double value) {
 
 // .SvgProto.Color underlayer_color = 7;
 inline bool RenderSettings::_internal_has_underlayer_color() const {
-  return this != internal_default_instance() && underlayer_color_ != nullptr;
+  return this != internal_default_instance() && _impl_.underlayer_color_ != nullptr;
 }
 inline bool RenderSettings::has_underlayer_color() const {
   return _internal_has_underlayer_color();
 }
 inline const ::SvgProto::Color& RenderSettings::_internal_underlayer_color() const {
-  const ::SvgProto::Color* p = underlayer_color_;
+  const ::SvgProto::Color* p = _impl_.underlayer_color_;
   return p != nullptr ? *p : reinterpret_cast<const ::SvgProto::Color&>(
       ::SvgProto::_Color_default_instance_);
 }
@@ -1165,10 +1201,10 @@ inline const ::SvgProto::Color& RenderSettings::underlayer_color() const {
 }
 inline void RenderSettings::unsafe_arena_set_allocated_underlayer_color(
     ::SvgProto::Color* underlayer_color) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(underlayer_color_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.underlayer_color_);
   }
-  underlayer_color_ = underlayer_color;
+  _impl_.underlayer_color_ = underlayer_color;
   if (underlayer_color) {
     
   } else {
@@ -1178,40 +1214,48 @@ inline void RenderSettings::unsafe_arena_set_allocated_underlayer_color(
 }
 inline ::SvgProto::Color* RenderSettings::release_underlayer_color() {
   
-  ::SvgProto::Color* temp = underlayer_color_;
-  underlayer_color_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::SvgProto::Color* temp = _impl_.underlayer_color_;
+  _impl_.underlayer_color_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::SvgProto::Color* RenderSettings::unsafe_arena_release_underlayer_color() {
   // @@protoc_insertion_point(field_release:TCProto.RenderSettings.underlayer_color)
   
-  ::SvgProto::Color* temp = underlayer_color_;
-  underlayer_color_ = nullptr;
+  ::SvgProto::Color* temp = _impl_.underlayer_color_;
+  _impl_.underlayer_color_ = nullptr;
   return temp;
 }
 inline ::SvgProto::Color* RenderSettings::_internal_mutable_underlayer_color() {
   
-  if (underlayer_color_ == nullptr) {
-    auto* p = CreateMaybeMessage<::SvgProto::Color>(GetArena());
-    underlayer_color_ = p;
+  if (_impl_.underlayer_color_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SvgProto::Color>(GetArenaForAllocation());
+    _impl_.underlayer_color_ = p;
   }
-  return underlayer_color_;
+  return _impl_.underlayer_color_;
 }
 inline ::SvgProto::Color* RenderSettings::mutable_underlayer_color() {
+  ::SvgProto::Color* _msg = _internal_mutable_underlayer_color();
   // @@protoc_insertion_point(field_mutable:TCProto.RenderSettings.underlayer_color)
-  return _internal_mutable_underlayer_color();
+  return _msg;
 }
 inline void RenderSettings::set_allocated_underlayer_color(::SvgProto::Color* underlayer_color) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(underlayer_color_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.underlayer_color_);
   }
   if (underlayer_color) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(underlayer_color)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(underlayer_color));
     if (message_arena != submessage_arena) {
       underlayer_color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, underlayer_color, submessage_arena);
@@ -1220,16 +1264,16 @@ inline void RenderSettings::set_allocated_underlayer_color(::SvgProto::Color* un
   } else {
     
   }
-  underlayer_color_ = underlayer_color;
+  _impl_.underlayer_color_ = underlayer_color;
   // @@protoc_insertion_point(field_set_allocated:TCProto.RenderSettings.underlayer_color)
 }
 
 // double underlayer_width = 8;
 inline void RenderSettings::clear_underlayer_width() {
-  underlayer_width_ = 0;
+  _impl_.underlayer_width_ = 0;
 }
 inline double RenderSettings::_internal_underlayer_width() const {
-  return underlayer_width_;
+  return _impl_.underlayer_width_;
 }
 inline double RenderSettings::underlayer_width() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.underlayer_width)
@@ -1237,7 +1281,7 @@ inline double RenderSettings::underlayer_width() const {
 }
 inline void RenderSettings::_internal_set_underlayer_width(double value) {
   
-  underlayer_width_ = value;
+  _impl_.underlayer_width_ = value;
 }
 inline void RenderSettings::set_underlayer_width(double value) {
   _internal_set_underlayer_width(value);
@@ -1246,10 +1290,10 @@ inline void RenderSettings::set_underlayer_width(double value) {
 
 // double stop_radius = 9;
 inline void RenderSettings::clear_stop_radius() {
-  stop_radius_ = 0;
+  _impl_.stop_radius_ = 0;
 }
 inline double RenderSettings::_internal_stop_radius() const {
-  return stop_radius_;
+  return _impl_.stop_radius_;
 }
 inline double RenderSettings::stop_radius() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.stop_radius)
@@ -1257,7 +1301,7 @@ inline double RenderSettings::stop_radius() const {
 }
 inline void RenderSettings::_internal_set_stop_radius(double value) {
   
-  stop_radius_ = value;
+  _impl_.stop_radius_ = value;
 }
 inline void RenderSettings::set_stop_radius(double value) {
   _internal_set_stop_radius(value);
@@ -1266,10 +1310,10 @@ inline void RenderSettings::set_stop_radius(double value) {
 
 // double company_radius = 16;
 inline void RenderSettings::clear_company_radius() {
-  company_radius_ = 0;
+  _impl_.company_radius_ = 0;
 }
 inline double RenderSettings::_internal_company_radius() const {
-  return company_radius_;
+  return _impl_.company_radius_;
 }
 inline double RenderSettings::company_radius() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.company_radius)
@@ -1277,7 +1321,7 @@ inline double RenderSettings::company_radius() const {
 }
 inline void RenderSettings::_internal_set_company_radius(double value) {
   
-  company_radius_ = value;
+  _impl_.company_radius_ = value;
 }
 inline void RenderSettings::set_company_radius(double value) {
   _internal_set_company_radius(value);
@@ -1286,13 +1330,13 @@ inline void RenderSettings::set_company_radius(double value) {
 
 // .SvgProto.Point bus_label_offset = 10;
 inline bool RenderSettings::_internal_has_bus_label_offset() const {
-  return this != internal_default_instance() && bus_label_offset_ != nullptr;
+  return this != internal_default_instance() && _impl_.bus_label_offset_ != nullptr;
 }
 inline bool RenderSettings::has_bus_label_offset() const {
   return _internal_has_bus_label_offset();
 }
 inline const ::SvgProto::Point& RenderSettings::_internal_bus_label_offset() const {
-  const ::SvgProto::Point* p = bus_label_offset_;
+  const ::SvgProto::Point* p = _impl_.bus_label_offset_;
   return p != nullptr ? *p : reinterpret_cast<const ::SvgProto::Point&>(
       ::SvgProto::_Point_default_instance_);
 }
@@ -1302,10 +1346,10 @@ inline const ::SvgProto::Point& RenderSettings::bus_label_offset() const {
 }
 inline void RenderSettings::unsafe_arena_set_allocated_bus_label_offset(
     ::SvgProto::Point* bus_label_offset) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bus_label_offset_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bus_label_offset_);
   }
-  bus_label_offset_ = bus_label_offset;
+  _impl_.bus_label_offset_ = bus_label_offset;
   if (bus_label_offset) {
     
   } else {
@@ -1315,40 +1359,48 @@ inline void RenderSettings::unsafe_arena_set_allocated_bus_label_offset(
 }
 inline ::SvgProto::Point* RenderSettings::release_bus_label_offset() {
   
-  ::SvgProto::Point* temp = bus_label_offset_;
-  bus_label_offset_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::SvgProto::Point* temp = _impl_.bus_label_offset_;
+  _impl_.bus_label_offset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::SvgProto::Point* RenderSettings::unsafe_arena_release_bus_label_offset() {
   // @@protoc_insertion_point(field_release:TCProto.RenderSettings.bus_label_offset)
   
-  ::SvgProto::Point* temp = bus_label_offset_;
-  bus_label_offset_ = nullptr;
+  ::SvgProto::Point* temp = _impl_.bus_label_offset_;
+  _impl_.bus_label_offset_ = nullptr;
   return temp;
 }
 inline ::SvgProto::Point* RenderSettings::_internal_mutable_bus_label_offset() {
   
-  if (bus_label_offset_ == nullptr) {
-    auto* p = CreateMaybeMessage<::SvgProto::Point>(GetArena());
-    bus_label_offset_ = p;
+  if (_impl_.bus_label_offset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SvgProto::Point>(GetArenaForAllocation());
+    _impl_.bus_label_offset_ = p;
   }
-  return bus_label_offset_;
+  return _impl_.bus_label_offset_;
 }
 inline ::SvgProto::Point* RenderSettings::mutable_bus_label_offset() {
+  ::SvgProto::Point* _msg = _internal_mutable_bus_label_offset();
   // @@protoc_insertion_point(field_mutable:TCProto.RenderSettings.bus_label_offset)
-  return _internal_mutable_bus_label_offset();
+  return _msg;
 }
 inline void RenderSettings::set_allocated_bus_label_offset(::SvgProto::Point* bus_label_offset) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(bus_label_offset_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bus_label_offset_);
   }
   if (bus_label_offset) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bus_label_offset)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bus_label_offset));
     if (message_arena != submessage_arena) {
       bus_label_offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, bus_label_offset, submessage_arena);
@@ -1357,39 +1409,39 @@ inline void RenderSettings::set_allocated_bus_label_offset(::SvgProto::Point* bu
   } else {
     
   }
-  bus_label_offset_ = bus_label_offset;
+  _impl_.bus_label_offset_ = bus_label_offset;
   // @@protoc_insertion_point(field_set_allocated:TCProto.RenderSettings.bus_label_offset)
 }
 
 // int32 bus_label_font_size = 11;
 inline void RenderSettings::clear_bus_label_font_size() {
-  bus_label_font_size_ = 0;
+  _impl_.bus_label_font_size_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RenderSettings::_internal_bus_label_font_size() const {
-  return bus_label_font_size_;
+inline int32_t RenderSettings::_internal_bus_label_font_size() const {
+  return _impl_.bus_label_font_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RenderSettings::bus_label_font_size() const {
+inline int32_t RenderSettings::bus_label_font_size() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.bus_label_font_size)
   return _internal_bus_label_font_size();
 }
-inline void RenderSettings::_internal_set_bus_label_font_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RenderSettings::_internal_set_bus_label_font_size(int32_t value) {
   
-  bus_label_font_size_ = value;
+  _impl_.bus_label_font_size_ = value;
 }
-inline void RenderSettings::set_bus_label_font_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RenderSettings::set_bus_label_font_size(int32_t value) {
   _internal_set_bus_label_font_size(value);
   // @@protoc_insertion_point(field_set:TCProto.RenderSettings.bus_label_font_size)
 }
 
 // .SvgProto.Point stop_label_offset = 12;
 inline bool RenderSettings::_internal_has_stop_label_offset() const {
-  return this != internal_default_instance() && stop_label_offset_ != nullptr;
+  return this != internal_default_instance() && _impl_.stop_label_offset_ != nullptr;
 }
 inline bool RenderSettings::has_stop_label_offset() const {
   return _internal_has_stop_label_offset();
 }
 inline const ::SvgProto::Point& RenderSettings::_internal_stop_label_offset() const {
-  const ::SvgProto::Point* p = stop_label_offset_;
+  const ::SvgProto::Point* p = _impl_.stop_label_offset_;
   return p != nullptr ? *p : reinterpret_cast<const ::SvgProto::Point&>(
       ::SvgProto::_Point_default_instance_);
 }
@@ -1399,10 +1451,10 @@ inline const ::SvgProto::Point& RenderSettings::stop_label_offset() const {
 }
 inline void RenderSettings::unsafe_arena_set_allocated_stop_label_offset(
     ::SvgProto::Point* stop_label_offset) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_label_offset_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_label_offset_);
   }
-  stop_label_offset_ = stop_label_offset;
+  _impl_.stop_label_offset_ = stop_label_offset;
   if (stop_label_offset) {
     
   } else {
@@ -1412,40 +1464,48 @@ inline void RenderSettings::unsafe_arena_set_allocated_stop_label_offset(
 }
 inline ::SvgProto::Point* RenderSettings::release_stop_label_offset() {
   
-  ::SvgProto::Point* temp = stop_label_offset_;
-  stop_label_offset_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::SvgProto::Point* temp = _impl_.stop_label_offset_;
+  _impl_.stop_label_offset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::SvgProto::Point* RenderSettings::unsafe_arena_release_stop_label_offset() {
   // @@protoc_insertion_point(field_release:TCProto.RenderSettings.stop_label_offset)
   
-  ::SvgProto::Point* temp = stop_label_offset_;
-  stop_label_offset_ = nullptr;
+  ::SvgProto::Point* temp = _impl_.stop_label_offset_;
+  _impl_.stop_label_offset_ = nullptr;
   return temp;
 }
 inline ::SvgProto::Point* RenderSettings::_internal_mutable_stop_label_offset() {
   
-  if (stop_label_offset_ == nullptr) {
-    auto* p = CreateMaybeMessage<::SvgProto::Point>(GetArena());
-    stop_label_offset_ = p;
+  if (_impl_.stop_label_offset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SvgProto::Point>(GetArenaForAllocation());
+    _impl_.stop_label_offset_ = p;
   }
-  return stop_label_offset_;
+  return _impl_.stop_label_offset_;
 }
 inline ::SvgProto::Point* RenderSettings::mutable_stop_label_offset() {
+  ::SvgProto::Point* _msg = _internal_mutable_stop_label_offset();
   // @@protoc_insertion_point(field_mutable:TCProto.RenderSettings.stop_label_offset)
-  return _internal_mutable_stop_label_offset();
+  return _msg;
 }
 inline void RenderSettings::set_allocated_stop_label_offset(::SvgProto::Point* stop_label_offset) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_label_offset_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_label_offset_);
   }
   if (stop_label_offset) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_label_offset)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(stop_label_offset));
     if (message_arena != submessage_arena) {
       stop_label_offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, stop_label_offset, submessage_arena);
@@ -1454,46 +1514,47 @@ inline void RenderSettings::set_allocated_stop_label_offset(::SvgProto::Point* s
   } else {
     
   }
-  stop_label_offset_ = stop_label_offset;
+  _impl_.stop_label_offset_ = stop_label_offset;
   // @@protoc_insertion_point(field_set_allocated:TCProto.RenderSettings.stop_label_offset)
 }
 
 // int32 stop_label_font_size = 13;
 inline void RenderSettings::clear_stop_label_font_size() {
-  stop_label_font_size_ = 0;
+  _impl_.stop_label_font_size_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RenderSettings::_internal_stop_label_font_size() const {
-  return stop_label_font_size_;
+inline int32_t RenderSettings::_internal_stop_label_font_size() const {
+  return _impl_.stop_label_font_size_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RenderSettings::stop_label_font_size() const {
+inline int32_t RenderSettings::stop_label_font_size() const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.stop_label_font_size)
   return _internal_stop_label_font_size();
 }
-inline void RenderSettings::_internal_set_stop_label_font_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RenderSettings::_internal_set_stop_label_font_size(int32_t value) {
   
-  stop_label_font_size_ = value;
+  _impl_.stop_label_font_size_ = value;
 }
-inline void RenderSettings::set_stop_label_font_size(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RenderSettings::set_stop_label_font_size(int32_t value) {
   _internal_set_stop_label_font_size(value);
   // @@protoc_insertion_point(field_set:TCProto.RenderSettings.stop_label_font_size)
 }
 
 // repeated string layers = 14;
 inline int RenderSettings::_internal_layers_size() const {
-  return layers_.size();
+  return _impl_.layers_.size();
 }
 inline int RenderSettings::layers_size() const {
   return _internal_layers_size();
 }
 inline void RenderSettings::clear_layers() {
-  layers_.Clear();
+  _impl_.layers_.Clear();
 }
 inline std::string* RenderSettings::add_layers() {
+  std::string* _s = _internal_add_layers();
   // @@protoc_insertion_point(field_add_mutable:TCProto.RenderSettings.layers)
-  return _internal_add_layers();
+  return _s;
 }
 inline const std::string& RenderSettings::_internal_layers(int index) const {
-  return layers_.Get(index);
+  return _impl_.layers_.Get(index);
 }
 inline const std::string& RenderSettings::layers(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.RenderSettings.layers)
@@ -1501,55 +1562,55 @@ inline const std::string& RenderSettings::layers(int index) const {
 }
 inline std::string* RenderSettings::mutable_layers(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.RenderSettings.layers)
-  return layers_.Mutable(index);
+  return _impl_.layers_.Mutable(index);
 }
 inline void RenderSettings::set_layers(int index, const std::string& value) {
+  _impl_.layers_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:TCProto.RenderSettings.layers)
-  layers_.Mutable(index)->assign(value);
 }
 inline void RenderSettings::set_layers(int index, std::string&& value) {
+  _impl_.layers_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:TCProto.RenderSettings.layers)
-  layers_.Mutable(index)->assign(std::move(value));
 }
 inline void RenderSettings::set_layers(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  layers_.Mutable(index)->assign(value);
+  _impl_.layers_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:TCProto.RenderSettings.layers)
 }
 inline void RenderSettings::set_layers(int index, const char* value, size_t size) {
-  layers_.Mutable(index)->assign(
+  _impl_.layers_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:TCProto.RenderSettings.layers)
 }
 inline std::string* RenderSettings::_internal_add_layers() {
-  return layers_.Add();
+  return _impl_.layers_.Add();
 }
 inline void RenderSettings::add_layers(const std::string& value) {
-  layers_.Add()->assign(value);
+  _impl_.layers_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:TCProto.RenderSettings.layers)
 }
 inline void RenderSettings::add_layers(std::string&& value) {
-  layers_.Add(std::move(value));
+  _impl_.layers_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:TCProto.RenderSettings.layers)
 }
 inline void RenderSettings::add_layers(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  layers_.Add()->assign(value);
+  _impl_.layers_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:TCProto.RenderSettings.layers)
 }
 inline void RenderSettings::add_layers(const char* value, size_t size) {
-  layers_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.layers_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:TCProto.RenderSettings.layers)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 RenderSettings::layers() const {
   // @@protoc_insertion_point(field_list:TCProto.RenderSettings.layers)
-  return layers_;
+  return _impl_.layers_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 RenderSettings::mutable_layers() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.RenderSettings.layers)
-  return &layers_;
+  return &_impl_.layers_;
 }
 
 // -------------------------------------------------------------------
@@ -1558,53 +1619,38 @@ RenderSettings::mutable_layers() {
 
 // string name = 1;
 inline void StopCoords::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& StopCoords::name() const {
   // @@protoc_insertion_point(field_get:TCProto.StopCoords.name)
   return _internal_name();
 }
-inline void StopCoords::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StopCoords::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.StopCoords.name)
 }
 inline std::string* StopCoords::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:TCProto.StopCoords.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& StopCoords::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void StopCoords::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void StopCoords::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.StopCoords.name)
-}
-inline void StopCoords::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.StopCoords.name)
-}
-inline void StopCoords::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.StopCoords.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* StopCoords::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* StopCoords::release_name() {
   // @@protoc_insertion_point(field_release:TCProto.StopCoords.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void StopCoords::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -1612,20 +1658,24 @@ inline void StopCoords::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.StopCoords.name)
 }
 
 // .SvgProto.Point point = 2;
 inline bool StopCoords::_internal_has_point() const {
-  return this != internal_default_instance() && point_ != nullptr;
+  return this != internal_default_instance() && _impl_.point_ != nullptr;
 }
 inline bool StopCoords::has_point() const {
   return _internal_has_point();
 }
 inline const ::SvgProto::Point& StopCoords::_internal_point() const {
-  const ::SvgProto::Point* p = point_;
+  const ::SvgProto::Point* p = _impl_.point_;
   return p != nullptr ? *p : reinterpret_cast<const ::SvgProto::Point&>(
       ::SvgProto::_Point_default_instance_);
 }
@@ -1635,10 +1685,10 @@ inline const ::SvgProto::Point& StopCoords::point() const {
 }
 inline void StopCoords::unsafe_arena_set_allocated_point(
     ::SvgProto::Point* point) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(point_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.point_);
   }
-  point_ = point;
+  _impl_.point_ = point;
   if (point) {
     
   } else {
@@ -1648,40 +1698,48 @@ inline void StopCoords::unsafe_arena_set_allocated_point(
 }
 inline ::SvgProto::Point* StopCoords::release_point() {
   
-  ::SvgProto::Point* temp = point_;
-  point_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::SvgProto::Point* temp = _impl_.point_;
+  _impl_.point_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::SvgProto::Point* StopCoords::unsafe_arena_release_point() {
   // @@protoc_insertion_point(field_release:TCProto.StopCoords.point)
   
-  ::SvgProto::Point* temp = point_;
-  point_ = nullptr;
+  ::SvgProto::Point* temp = _impl_.point_;
+  _impl_.point_ = nullptr;
   return temp;
 }
 inline ::SvgProto::Point* StopCoords::_internal_mutable_point() {
   
-  if (point_ == nullptr) {
-    auto* p = CreateMaybeMessage<::SvgProto::Point>(GetArena());
-    point_ = p;
+  if (_impl_.point_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SvgProto::Point>(GetArenaForAllocation());
+    _impl_.point_ = p;
   }
-  return point_;
+  return _impl_.point_;
 }
 inline ::SvgProto::Point* StopCoords::mutable_point() {
+  ::SvgProto::Point* _msg = _internal_mutable_point();
   // @@protoc_insertion_point(field_mutable:TCProto.StopCoords.point)
-  return _internal_mutable_point();
+  return _msg;
 }
 inline void StopCoords::set_allocated_point(::SvgProto::Point* point) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(point_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.point_);
   }
   if (point) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(point)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(point));
     if (message_arena != submessage_arena) {
       point = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, point, submessage_arena);
@@ -1690,7 +1748,7 @@ inline void StopCoords::set_allocated_point(::SvgProto::Point* point) {
   } else {
     
   }
-  point_ = point;
+  _impl_.point_ = point;
   // @@protoc_insertion_point(field_set_allocated:TCProto.StopCoords.point)
 }
 
@@ -1700,53 +1758,38 @@ inline void StopCoords::set_allocated_point(::SvgProto::Point* point) {
 
 // string name = 1;
 inline void BusColor::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& BusColor::name() const {
   // @@protoc_insertion_point(field_get:TCProto.BusColor.name)
   return _internal_name();
 }
-inline void BusColor::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BusColor::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.BusColor.name)
 }
 inline std::string* BusColor::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:TCProto.BusColor.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& BusColor::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void BusColor::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void BusColor::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.BusColor.name)
-}
-inline void BusColor::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.BusColor.name)
-}
-inline void BusColor::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.BusColor.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BusColor::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BusColor::release_name() {
   // @@protoc_insertion_point(field_release:TCProto.BusColor.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void BusColor::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -1754,20 +1797,24 @@ inline void BusColor::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.BusColor.name)
 }
 
 // .SvgProto.Color color = 2;
 inline bool BusColor::_internal_has_color() const {
-  return this != internal_default_instance() && color_ != nullptr;
+  return this != internal_default_instance() && _impl_.color_ != nullptr;
 }
 inline bool BusColor::has_color() const {
   return _internal_has_color();
 }
 inline const ::SvgProto::Color& BusColor::_internal_color() const {
-  const ::SvgProto::Color* p = color_;
+  const ::SvgProto::Color* p = _impl_.color_;
   return p != nullptr ? *p : reinterpret_cast<const ::SvgProto::Color&>(
       ::SvgProto::_Color_default_instance_);
 }
@@ -1777,10 +1824,10 @@ inline const ::SvgProto::Color& BusColor::color() const {
 }
 inline void BusColor::unsafe_arena_set_allocated_color(
     ::SvgProto::Color* color) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(color_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
   }
-  color_ = color;
+  _impl_.color_ = color;
   if (color) {
     
   } else {
@@ -1790,40 +1837,48 @@ inline void BusColor::unsafe_arena_set_allocated_color(
 }
 inline ::SvgProto::Color* BusColor::release_color() {
   
-  ::SvgProto::Color* temp = color_;
-  color_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::SvgProto::Color* temp = _impl_.color_;
+  _impl_.color_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::SvgProto::Color* BusColor::unsafe_arena_release_color() {
   // @@protoc_insertion_point(field_release:TCProto.BusColor.color)
   
-  ::SvgProto::Color* temp = color_;
-  color_ = nullptr;
+  ::SvgProto::Color* temp = _impl_.color_;
+  _impl_.color_ = nullptr;
   return temp;
 }
 inline ::SvgProto::Color* BusColor::_internal_mutable_color() {
   
-  if (color_ == nullptr) {
-    auto* p = CreateMaybeMessage<::SvgProto::Color>(GetArena());
-    color_ = p;
+  if (_impl_.color_ == nullptr) {
+    auto* p = CreateMaybeMessage<::SvgProto::Color>(GetArenaForAllocation());
+    _impl_.color_ = p;
   }
-  return color_;
+  return _impl_.color_;
 }
 inline ::SvgProto::Color* BusColor::mutable_color() {
+  ::SvgProto::Color* _msg = _internal_mutable_color();
   // @@protoc_insertion_point(field_mutable:TCProto.BusColor.color)
-  return _internal_mutable_color();
+  return _msg;
 }
 inline void BusColor::set_allocated_color(::SvgProto::Color* color) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(color_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_);
   }
   if (color) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(color)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(color));
     if (message_arena != submessage_arena) {
       color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, color, submessage_arena);
@@ -1832,7 +1887,7 @@ inline void BusColor::set_allocated_color(::SvgProto::Color* color) {
   } else {
     
   }
-  color_ = color;
+  _impl_.color_ = color;
   // @@protoc_insertion_point(field_set_allocated:TCProto.BusColor.color)
 }
 
@@ -1842,19 +1897,19 @@ inline void BusColor::set_allocated_color(::SvgProto::Color* color) {
 
 // .TCProto.RenderSettings render_settings = 1;
 inline bool Painter::_internal_has_render_settings() const {
-  return this != internal_default_instance() && render_settings_ != nullptr;
+  return this != internal_default_instance() && _impl_.render_settings_ != nullptr;
 }
 inline bool Painter::has_render_settings() const {
   return _internal_has_render_settings();
 }
 inline void Painter::clear_render_settings() {
-  if (GetArena() == nullptr && render_settings_ != nullptr) {
-    delete render_settings_;
+  if (GetArenaForAllocation() == nullptr && _impl_.render_settings_ != nullptr) {
+    delete _impl_.render_settings_;
   }
-  render_settings_ = nullptr;
+  _impl_.render_settings_ = nullptr;
 }
 inline const ::TCProto::RenderSettings& Painter::_internal_render_settings() const {
-  const ::TCProto::RenderSettings* p = render_settings_;
+  const ::TCProto::RenderSettings* p = _impl_.render_settings_;
   return p != nullptr ? *p : reinterpret_cast<const ::TCProto::RenderSettings&>(
       ::TCProto::_RenderSettings_default_instance_);
 }
@@ -1864,10 +1919,10 @@ inline const ::TCProto::RenderSettings& Painter::render_settings() const {
 }
 inline void Painter::unsafe_arena_set_allocated_render_settings(
     ::TCProto::RenderSettings* render_settings) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(render_settings_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.render_settings_);
   }
-  render_settings_ = render_settings;
+  _impl_.render_settings_ = render_settings;
   if (render_settings) {
     
   } else {
@@ -1877,40 +1932,47 @@ inline void Painter::unsafe_arena_set_allocated_render_settings(
 }
 inline ::TCProto::RenderSettings* Painter::release_render_settings() {
   
-  ::TCProto::RenderSettings* temp = render_settings_;
-  render_settings_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::TCProto::RenderSettings* temp = _impl_.render_settings_;
+  _impl_.render_settings_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::TCProto::RenderSettings* Painter::unsafe_arena_release_render_settings() {
   // @@protoc_insertion_point(field_release:TCProto.Painter.render_settings)
   
-  ::TCProto::RenderSettings* temp = render_settings_;
-  render_settings_ = nullptr;
+  ::TCProto::RenderSettings* temp = _impl_.render_settings_;
+  _impl_.render_settings_ = nullptr;
   return temp;
 }
 inline ::TCProto::RenderSettings* Painter::_internal_mutable_render_settings() {
   
-  if (render_settings_ == nullptr) {
-    auto* p = CreateMaybeMessage<::TCProto::RenderSettings>(GetArena());
-    render_settings_ = p;
+  if (_impl_.render_settings_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TCProto::RenderSettings>(GetArenaForAllocation());
+    _impl_.render_settings_ = p;
   }
-  return render_settings_;
+  return _impl_.render_settings_;
 }
 inline ::TCProto::RenderSettings* Painter::mutable_render_settings() {
+  ::TCProto::RenderSettings* _msg = _internal_mutable_render_settings();
   // @@protoc_insertion_point(field_mutable:TCProto.Painter.render_settings)
-  return _internal_mutable_render_settings();
+  return _msg;
 }
 inline void Painter::set_allocated_render_settings(::TCProto::RenderSettings* render_settings) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete render_settings_;
+    delete _impl_.render_settings_;
   }
   if (render_settings) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(render_settings);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(render_settings);
     if (message_arena != submessage_arena) {
       render_settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, render_settings, submessage_arena);
@@ -1919,158 +1981,162 @@ inline void Painter::set_allocated_render_settings(::TCProto::RenderSettings* re
   } else {
     
   }
-  render_settings_ = render_settings;
+  _impl_.render_settings_ = render_settings;
   // @@protoc_insertion_point(field_set_allocated:TCProto.Painter.render_settings)
 }
 
 // repeated .TCProto.StopCoords stops_coords = 2;
 inline int Painter::_internal_stops_coords_size() const {
-  return stops_coords_.size();
+  return _impl_.stops_coords_.size();
 }
 inline int Painter::stops_coords_size() const {
   return _internal_stops_coords_size();
 }
 inline void Painter::clear_stops_coords() {
-  stops_coords_.Clear();
+  _impl_.stops_coords_.Clear();
 }
 inline ::TCProto::StopCoords* Painter::mutable_stops_coords(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.Painter.stops_coords)
-  return stops_coords_.Mutable(index);
+  return _impl_.stops_coords_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopCoords >*
 Painter::mutable_stops_coords() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.Painter.stops_coords)
-  return &stops_coords_;
+  return &_impl_.stops_coords_;
 }
 inline const ::TCProto::StopCoords& Painter::_internal_stops_coords(int index) const {
-  return stops_coords_.Get(index);
+  return _impl_.stops_coords_.Get(index);
 }
 inline const ::TCProto::StopCoords& Painter::stops_coords(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.Painter.stops_coords)
   return _internal_stops_coords(index);
 }
 inline ::TCProto::StopCoords* Painter::_internal_add_stops_coords() {
-  return stops_coords_.Add();
+  return _impl_.stops_coords_.Add();
 }
 inline ::TCProto::StopCoords* Painter::add_stops_coords() {
+  ::TCProto::StopCoords* _add = _internal_add_stops_coords();
   // @@protoc_insertion_point(field_add:TCProto.Painter.stops_coords)
-  return _internal_add_stops_coords();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopCoords >&
 Painter::stops_coords() const {
   // @@protoc_insertion_point(field_list:TCProto.Painter.stops_coords)
-  return stops_coords_;
+  return _impl_.stops_coords_;
 }
 
 // repeated .TCProto.BusColor bus_colors = 3;
 inline int Painter::_internal_bus_colors_size() const {
-  return bus_colors_.size();
+  return _impl_.bus_colors_.size();
 }
 inline int Painter::bus_colors_size() const {
   return _internal_bus_colors_size();
 }
 inline void Painter::clear_bus_colors() {
-  bus_colors_.Clear();
+  _impl_.bus_colors_.Clear();
 }
 inline ::TCProto::BusColor* Painter::mutable_bus_colors(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.Painter.bus_colors)
-  return bus_colors_.Mutable(index);
+  return _impl_.bus_colors_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusColor >*
 Painter::mutable_bus_colors() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.Painter.bus_colors)
-  return &bus_colors_;
+  return &_impl_.bus_colors_;
 }
 inline const ::TCProto::BusColor& Painter::_internal_bus_colors(int index) const {
-  return bus_colors_.Get(index);
+  return _impl_.bus_colors_.Get(index);
 }
 inline const ::TCProto::BusColor& Painter::bus_colors(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.Painter.bus_colors)
   return _internal_bus_colors(index);
 }
 inline ::TCProto::BusColor* Painter::_internal_add_bus_colors() {
-  return bus_colors_.Add();
+  return _impl_.bus_colors_.Add();
 }
 inline ::TCProto::BusColor* Painter::add_bus_colors() {
+  ::TCProto::BusColor* _add = _internal_add_bus_colors();
   // @@protoc_insertion_point(field_add:TCProto.Painter.bus_colors)
-  return _internal_add_bus_colors();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusColor >&
 Painter::bus_colors() const {
   // @@protoc_insertion_point(field_list:TCProto.Painter.bus_colors)
-  return bus_colors_;
+  return _impl_.bus_colors_;
 }
 
 // repeated .TCProto.BusDescription bus_descriptions = 4;
 inline int Painter::_internal_bus_descriptions_size() const {
-  return bus_descriptions_.size();
+  return _impl_.bus_descriptions_.size();
 }
 inline int Painter::bus_descriptions_size() const {
   return _internal_bus_descriptions_size();
 }
 inline ::TCProto::BusDescription* Painter::mutable_bus_descriptions(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.Painter.bus_descriptions)
-  return bus_descriptions_.Mutable(index);
+  return _impl_.bus_descriptions_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusDescription >*
 Painter::mutable_bus_descriptions() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.Painter.bus_descriptions)
-  return &bus_descriptions_;
+  return &_impl_.bus_descriptions_;
 }
 inline const ::TCProto::BusDescription& Painter::_internal_bus_descriptions(int index) const {
-  return bus_descriptions_.Get(index);
+  return _impl_.bus_descriptions_.Get(index);
 }
 inline const ::TCProto::BusDescription& Painter::bus_descriptions(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.Painter.bus_descriptions)
   return _internal_bus_descriptions(index);
 }
 inline ::TCProto::BusDescription* Painter::_internal_add_bus_descriptions() {
-  return bus_descriptions_.Add();
+  return _impl_.bus_descriptions_.Add();
 }
 inline ::TCProto::BusDescription* Painter::add_bus_descriptions() {
+  ::TCProto::BusDescription* _add = _internal_add_bus_descriptions();
   // @@protoc_insertion_point(field_add:TCProto.Painter.bus_descriptions)
-  return _internal_add_bus_descriptions();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusDescription >&
 Painter::bus_descriptions() const {
   // @@protoc_insertion_point(field_list:TCProto.Painter.bus_descriptions)
-  return bus_descriptions_;
+  return _impl_.bus_descriptions_;
 }
 
 // repeated .TCProto.StopDescription stop_descriptions = 5;
 inline int Painter::_internal_stop_descriptions_size() const {
-  return stop_descriptions_.size();
+  return _impl_.stop_descriptions_.size();
 }
 inline int Painter::stop_descriptions_size() const {
   return _internal_stop_descriptions_size();
 }
 inline ::TCProto::StopDescription* Painter::mutable_stop_descriptions(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.Painter.stop_descriptions)
-  return stop_descriptions_.Mutable(index);
+  return _impl_.stop_descriptions_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopDescription >*
 Painter::mutable_stop_descriptions() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.Painter.stop_descriptions)
-  return &stop_descriptions_;
+  return &_impl_.stop_descriptions_;
 }
 inline const ::TCProto::StopDescription& Painter::_internal_stop_descriptions(int index) const {
-  return stop_descriptions_.Get(index);
+  return _impl_.stop_descriptions_.Get(index);
 }
 inline const ::TCProto::StopDescription& Painter::stop_descriptions(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.Painter.stop_descriptions)
   return _internal_stop_descriptions(index);
 }
 inline ::TCProto::StopDescription* Painter::_internal_add_stop_descriptions() {
-  return stop_descriptions_.Add();
+  return _impl_.stop_descriptions_.Add();
 }
 inline ::TCProto::StopDescription* Painter::add_stop_descriptions() {
+  ::TCProto::StopDescription* _add = _internal_add_stop_descriptions();
   // @@protoc_insertion_point(field_add:TCProto.Painter.stop_descriptions)
-  return _internal_add_stop_descriptions();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopDescription >&
 Painter::stop_descriptions() const {
   // @@protoc_insertion_point(field_list:TCProto.Painter.stop_descriptions)
-  return stop_descriptions_;
+  return _impl_.stop_descriptions_;
 }
 
 #ifdef __GNUC__
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,20 +42,12 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_phone_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_phone_2eproto;
 namespace YellowPages {
 class Phone;
-class PhoneDefaultTypeInternal;
+struct PhoneDefaultTypeInternal;
 extern PhoneDefaultTypeInternal _Phone_default_instance_;
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
@@ -67,8 +58,8 @@ namespace YellowPages {
 enum Phone_Type : int {
   Phone_Type_PHONE = 0,
   Phone_Type_FAX = 1,
-  Phone_Type_Phone_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  Phone_Type_Phone_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  Phone_Type_Phone_Type_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Phone_Type_Phone_Type_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool Phone_Type_IsValid(int value);
 constexpr Phone_Type Phone_Type_Type_MIN = Phone_Type_PHONE;
@@ -91,11 +82,12 @@ inline bool Phone_Type_Parse(
 }
 // ===================================================================
 
-class Phone PROTOBUF_FINAL :
+class Phone final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.Phone) */ {
  public:
   inline Phone() : Phone(nullptr) {}
-  virtual ~Phone();
+  ~Phone() override;
+  explicit PROTOBUF_CONSTEXPR Phone(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Phone(const Phone& from);
   Phone(Phone&& from) noexcept
@@ -108,8 +100,13 @@ class Phone PROTOBUF_FINAL :
     return *this;
   }
   inline Phone& operator=(Phone&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -120,13 +117,14 @@ class Phone PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Phone& default_instance() {
+    return *internal_default_instance();
   }
-  static const Phone& default_instance();
-
   static inline const Phone* internal_default_instance() {
     return reinterpret_cast<const Phone*>(
                &_Phone_default_instance_);
@@ -139,7 +137,12 @@ class Phone PROTOBUF_FINAL :
   }
   inline void Swap(Phone* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -147,56 +150,53 @@ class Phone PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Phone* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Phone* New() const final {
-    return CreateMaybeMessage<Phone>(nullptr);
-  }
-
-  Phone* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Phone* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Phone>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Phone& from);
-  void MergeFrom(const Phone& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Phone& from) {
+    Phone::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Phone* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.Phone";
   }
   protected:
-  explicit Phone(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Phone(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_phone_2eproto);
-    return ::descriptor_table_phone_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -244,96 +244,84 @@ class Phone PROTOBUF_FINAL :
   // string formatted = 1;
   void clear_formatted();
   const std::string& formatted() const;
-  void set_formatted(const std::string& value);
-  void set_formatted(std::string&& value);
-  void set_formatted(const char* value);
-  void set_formatted(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_formatted(ArgT0&& arg0, ArgT... args);
   std::string* mutable_formatted();
-  std::string* release_formatted();
+  PROTOBUF_NODISCARD std::string* release_formatted();
   void set_allocated_formatted(std::string* formatted);
   private:
   const std::string& _internal_formatted() const;
-  void _internal_set_formatted(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_formatted(const std::string& value);
   std::string* _internal_mutable_formatted();
   public:
 
   // string country_code = 3;
   void clear_country_code();
   const std::string& country_code() const;
-  void set_country_code(const std::string& value);
-  void set_country_code(std::string&& value);
-  void set_country_code(const char* value);
-  void set_country_code(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_country_code(ArgT0&& arg0, ArgT... args);
   std::string* mutable_country_code();
-  std::string* release_country_code();
+  PROTOBUF_NODISCARD std::string* release_country_code();
   void set_allocated_country_code(std::string* country_code);
   private:
   const std::string& _internal_country_code() const;
-  void _internal_set_country_code(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_country_code(const std::string& value);
   std::string* _internal_mutable_country_code();
   public:
 
   // string local_code = 4;
   void clear_local_code();
   const std::string& local_code() const;
-  void set_local_code(const std::string& value);
-  void set_local_code(std::string&& value);
-  void set_local_code(const char* value);
-  void set_local_code(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_local_code(ArgT0&& arg0, ArgT... args);
   std::string* mutable_local_code();
-  std::string* release_local_code();
+  PROTOBUF_NODISCARD std::string* release_local_code();
   void set_allocated_local_code(std::string* local_code);
   private:
   const std::string& _internal_local_code() const;
-  void _internal_set_local_code(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_local_code(const std::string& value);
   std::string* _internal_mutable_local_code();
   public:
 
   // string number = 5;
   void clear_number();
   const std::string& number() const;
-  void set_number(const std::string& value);
-  void set_number(std::string&& value);
-  void set_number(const char* value);
-  void set_number(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_number(ArgT0&& arg0, ArgT... args);
   std::string* mutable_number();
-  std::string* release_number();
+  PROTOBUF_NODISCARD std::string* release_number();
   void set_allocated_number(std::string* number);
   private:
   const std::string& _internal_number() const;
-  void _internal_set_number(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_number(const std::string& value);
   std::string* _internal_mutable_number();
   public:
 
   // string extension = 6;
   void clear_extension();
   const std::string& extension() const;
-  void set_extension(const std::string& value);
-  void set_extension(std::string&& value);
-  void set_extension(const char* value);
-  void set_extension(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_extension(ArgT0&& arg0, ArgT... args);
   std::string* mutable_extension();
-  std::string* release_extension();
+  PROTOBUF_NODISCARD std::string* release_extension();
   void set_allocated_extension(std::string* extension);
   private:
   const std::string& _internal_extension() const;
-  void _internal_set_extension(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_extension(const std::string& value);
   std::string* _internal_mutable_extension();
   public:
 
   // string description = 7;
   void clear_description();
   const std::string& description() const;
-  void set_description(const std::string& value);
-  void set_description(std::string&& value);
-  void set_description(const char* value);
-  void set_description(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_description(ArgT0&& arg0, ArgT... args);
   std::string* mutable_description();
-  std::string* release_description();
+  PROTOBUF_NODISCARD std::string* release_description();
   void set_allocated_description(std::string* description);
   private:
   const std::string& _internal_description() const;
-  void _internal_set_description(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_description(const std::string& value);
   std::string* _internal_mutable_description();
   public:
 
@@ -353,14 +341,17 @@ class Phone PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr formatted_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr country_code_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr local_code_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr number_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr extension_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
-  int type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr formatted_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr country_code_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr local_code_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr number_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr extension_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_phone_2eproto;
 };
 // ===================================================================
@@ -376,53 +367,38 @@ class Phone PROTOBUF_FINAL :
 
 // string formatted = 1;
 inline void Phone::clear_formatted() {
-  formatted_.ClearToEmpty();
+  _impl_.formatted_.ClearToEmpty();
 }
 inline const std::string& Phone::formatted() const {
   // @@protoc_insertion_point(field_get:YellowPages.Phone.formatted)
   return _internal_formatted();
 }
-inline void Phone::set_formatted(const std::string& value) {
-  _internal_set_formatted(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Phone::set_formatted(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.formatted_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Phone.formatted)
 }
 inline std::string* Phone::mutable_formatted() {
+  std::string* _s = _internal_mutable_formatted();
   // @@protoc_insertion_point(field_mutable:YellowPages.Phone.formatted)
-  return _internal_mutable_formatted();
+  return _s;
 }
 inline const std::string& Phone::_internal_formatted() const {
-  return formatted_.Get();
+  return _impl_.formatted_.Get();
 }
 inline void Phone::_internal_set_formatted(const std::string& value) {
   
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Phone::set_formatted(std::string&& value) {
-  
-  formatted_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Phone.formatted)
-}
-inline void Phone::set_formatted(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Phone.formatted)
-}
-inline void Phone::set_formatted(const char* value,
-    size_t size) {
-  
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Phone.formatted)
+  _impl_.formatted_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Phone::_internal_mutable_formatted() {
   
-  return formatted_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.formatted_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Phone::release_formatted() {
   // @@protoc_insertion_point(field_release:YellowPages.Phone.formatted)
-  return formatted_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.formatted_.Release();
 }
 inline void Phone::set_allocated_formatted(std::string* formatted) {
   if (formatted != nullptr) {
@@ -430,17 +406,21 @@ inline void Phone::set_allocated_formatted(std::string* formatted) {
   } else {
     
   }
-  formatted_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), formatted,
-      GetArena());
+  _impl_.formatted_.SetAllocated(formatted, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.formatted_.IsDefault()) {
+    _impl_.formatted_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Phone.formatted)
 }
 
 // .YellowPages.Phone.Type type = 2;
 inline void Phone::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
 }
 inline ::YellowPages::Phone_Type Phone::_internal_type() const {
-  return static_cast< ::YellowPages::Phone_Type >(type_);
+  return static_cast< ::YellowPages::Phone_Type >(_impl_.type_);
 }
 inline ::YellowPages::Phone_Type Phone::type() const {
   // @@protoc_insertion_point(field_get:YellowPages.Phone.type)
@@ -448,7 +428,7 @@ inline ::YellowPages::Phone_Type Phone::type() const {
 }
 inline void Phone::_internal_set_type(::YellowPages::Phone_Type value) {
   
-  type_ = value;
+  _impl_.type_ = value;
 }
 inline void Phone::set_type(::YellowPages::Phone_Type value) {
   _internal_set_type(value);
@@ -457,53 +437,38 @@ inline void Phone::set_type(::YellowPages::Phone_Type value) {
 
 // string country_code = 3;
 inline void Phone::clear_country_code() {
-  country_code_.ClearToEmpty();
+  _impl_.country_code_.ClearToEmpty();
 }
 inline const std::string& Phone::country_code() const {
   // @@protoc_insertion_point(field_get:YellowPages.Phone.country_code)
   return _internal_country_code();
 }
-inline void Phone::set_country_code(const std::string& value) {
-  _internal_set_country_code(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Phone::set_country_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.country_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Phone.country_code)
 }
 inline std::string* Phone::mutable_country_code() {
+  std::string* _s = _internal_mutable_country_code();
   // @@protoc_insertion_point(field_mutable:YellowPages.Phone.country_code)
-  return _internal_mutable_country_code();
+  return _s;
 }
 inline const std::string& Phone::_internal_country_code() const {
-  return country_code_.Get();
+  return _impl_.country_code_.Get();
 }
 inline void Phone::_internal_set_country_code(const std::string& value) {
   
-  country_code_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Phone::set_country_code(std::string&& value) {
-  
-  country_code_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Phone.country_code)
-}
-inline void Phone::set_country_code(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  country_code_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Phone.country_code)
-}
-inline void Phone::set_country_code(const char* value,
-    size_t size) {
-  
-  country_code_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Phone.country_code)
+  _impl_.country_code_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Phone::_internal_mutable_country_code() {
   
-  return country_code_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.country_code_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Phone::release_country_code() {
   // @@protoc_insertion_point(field_release:YellowPages.Phone.country_code)
-  return country_code_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.country_code_.Release();
 }
 inline void Phone::set_allocated_country_code(std::string* country_code) {
   if (country_code != nullptr) {
@@ -511,60 +476,49 @@ inline void Phone::set_allocated_country_code(std::string* country_code) {
   } else {
     
   }
-  country_code_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), country_code,
-      GetArena());
+  _impl_.country_code_.SetAllocated(country_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.country_code_.IsDefault()) {
+    _impl_.country_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Phone.country_code)
 }
 
 // string local_code = 4;
 inline void Phone::clear_local_code() {
-  local_code_.ClearToEmpty();
+  _impl_.local_code_.ClearToEmpty();
 }
 inline const std::string& Phone::local_code() const {
   // @@protoc_insertion_point(field_get:YellowPages.Phone.local_code)
   return _internal_local_code();
 }
-inline void Phone::set_local_code(const std::string& value) {
-  _internal_set_local_code(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Phone::set_local_code(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.local_code_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Phone.local_code)
 }
 inline std::string* Phone::mutable_local_code() {
+  std::string* _s = _internal_mutable_local_code();
   // @@protoc_insertion_point(field_mutable:YellowPages.Phone.local_code)
-  return _internal_mutable_local_code();
+  return _s;
 }
 inline const std::string& Phone::_internal_local_code() const {
-  return local_code_.Get();
+  return _impl_.local_code_.Get();
 }
 inline void Phone::_internal_set_local_code(const std::string& value) {
   
-  local_code_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Phone::set_local_code(std::string&& value) {
-  
-  local_code_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Phone.local_code)
-}
-inline void Phone::set_local_code(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  local_code_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Phone.local_code)
-}
-inline void Phone::set_local_code(const char* value,
-    size_t size) {
-  
-  local_code_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Phone.local_code)
+  _impl_.local_code_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Phone::_internal_mutable_local_code() {
   
-  return local_code_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.local_code_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Phone::release_local_code() {
   // @@protoc_insertion_point(field_release:YellowPages.Phone.local_code)
-  return local_code_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.local_code_.Release();
 }
 inline void Phone::set_allocated_local_code(std::string* local_code) {
   if (local_code != nullptr) {
@@ -572,60 +526,49 @@ inline void Phone::set_allocated_local_code(std::string* local_code) {
   } else {
     
   }
-  local_code_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), local_code,
-      GetArena());
+  _impl_.local_code_.SetAllocated(local_code, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.local_code_.IsDefault()) {
+    _impl_.local_code_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Phone.local_code)
 }
 
 // string number = 5;
 inline void Phone::clear_number() {
-  number_.ClearToEmpty();
+  _impl_.number_.ClearToEmpty();
 }
 inline const std::string& Phone::number() const {
   // @@protoc_insertion_point(field_get:YellowPages.Phone.number)
   return _internal_number();
 }
-inline void Phone::set_number(const std::string& value) {
-  _internal_set_number(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Phone::set_number(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.number_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Phone.number)
 }
 inline std::string* Phone::mutable_number() {
+  std::string* _s = _internal_mutable_number();
   // @@protoc_insertion_point(field_mutable:YellowPages.Phone.number)
-  return _internal_mutable_number();
+  return _s;
 }
 inline const std::string& Phone::_internal_number() const {
-  return number_.Get();
+  return _impl_.number_.Get();
 }
 inline void Phone::_internal_set_number(const std::string& value) {
   
-  number_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Phone::set_number(std::string&& value) {
-  
-  number_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Phone.number)
-}
-inline void Phone::set_number(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  number_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Phone.number)
-}
-inline void Phone::set_number(const char* value,
-    size_t size) {
-  
-  number_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Phone.number)
+  _impl_.number_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Phone::_internal_mutable_number() {
   
-  return number_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.number_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Phone::release_number() {
   // @@protoc_insertion_point(field_release:YellowPages.Phone.number)
-  return number_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.number_.Release();
 }
 inline void Phone::set_allocated_number(std::string* number) {
   if (number != nullptr) {
@@ -633,60 +576,49 @@ inline void Phone::set_allocated_number(std::string* number) {
   } else {
     
   }
-  number_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), number,
-      GetArena());
+  _impl_.number_.SetAllocated(number, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.number_.IsDefault()) {
+    _impl_.number_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Phone.number)
 }
 
 // string extension = 6;
 inline void Phone::clear_extension() {
-  extension_.ClearToEmpty();
+  _impl_.extension_.ClearToEmpty();
 }
 inline const std::string& Phone::extension() const {
   // @@protoc_insertion_point(field_get:YellowPages.Phone.extension)
   return _internal_extension();
 }
-inline void Phone::set_extension(const std::string& value) {
-  _internal_set_extension(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Phone::set_extension(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.extension_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Phone.extension)
 }
 inline std::string* Phone::mutable_extension() {
+  std::string* _s = _internal_mutable_extension();
   // @@protoc_insertion_point(field_mutable:YellowPages.Phone.extension)
-  return _internal_mutable_extension();
+  return _s;
 }
 inline const std::string& Phone::_internal_extension() const {
-  return extension_.Get();
+  return _impl_.extension_.Get();
 }
 inline void Phone::_internal_set_extension(const std::string& value) {
   
-  extension_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Phone::set_extension(std::string&& value) {
-  
-  extension_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Phone.extension)
-}
-inline void Phone::set_extension(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  extension_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Phone.extension)
-}
-inline void Phone::set_extension(const char* value,
-    size_t size) {
-  
-  extension_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Phone.extension)
+  _impl_.extension_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Phone::_internal_mutable_extension() {
   
-  return extension_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.extension_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Phone::release_extension() {
   // @@protoc_insertion_point(field_release:YellowPages.Phone.extension)
-  return extension_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.extension_.Release();
 }
 inline void Phone::set_allocated_extension(std::string* extension) {
   if (extension != nullptr) {
@@ -694,60 +626,49 @@ inline void Phone::set_allocated_extension(std::string* extension) {
   } else {
     
   }
-  extension_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), extension,
-      GetArena());
+  _impl_.extension_.SetAllocated(extension, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.extension_.IsDefault()) {
+    _impl_.extension_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Phone.extension)
 }
 
 // string description = 7;
 inline void Phone::clear_description() {
-  description_.ClearToEmpty();
+  _impl_.description_.ClearToEmpty();
 }
 inline const std::string& Phone::description() const {
   // @@protoc_insertion_point(field_get:YellowPages.Phone.description)
   return _internal_description();
 }
-inline void Phone::set_description(const std::string& value) {
-  _internal_set_description(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Phone::set_description(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Phone.description)
 }
 inline std::string* Phone::mutable_description() {
+  std::string* _s = _internal_mutable_description();
   // @@protoc_insertion_point(field_mutable:YellowPages.Phone.description)
-  return _internal_mutable_description();
+  return _s;
 }
 inline const std::string& Phone::_internal_description() const {
-  return description_.Get();
+  return _impl_.description_.Get();
 }
 inline void Phone::_internal_set_description(const std::string& value) {
   
-  description_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Phone::set_description(std::string&& value) {
-  
-  description_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Phone.description)
-}
-inline void Phone::set_description(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  description_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Phone.description)
-}
-inline void Phone::set_description(const char* value,
-    size_t size) {
-  
-  description_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Phone.description)
+  _impl_.description_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Phone::_internal_mutable_description() {
   
-  return description_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.description_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Phone::release_description() {
   // @@protoc_insertion_point(field_release:YellowPages.Phone.description)
-  return description_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.description_.Release();
 }
 inline void Phone::set_allocated_description(std::string* description) {
   if (description != nullptr) {
@@ -755,8 +676,12 @@ inline void Phone::set_allocated_description(std::string* description) {
   } else {
     
   }
-  description_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), description,
-      GetArena());
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Phone.description)
 }
 
@@ -3,76 +3,72 @@
 #include "companies_catalog.h"
 #include "utils.h"
 
+#include <stdexcept>
 #include <vector>
 
 using namespace std;
 
 namespace Requests {
 
-  Json::Dict Stop::Process(const TransportCatalog& db) const {
+  void Stop::Process(const TransportCatalog& db, Json::Writer& out) const {
     const auto* stop = db.GetStop(name);
-    Json::Dict dict;
     if (!stop) {
-      dict["error_message"] = Json::Node("not found"s);
+      out.Key("error_message").Value("not found");
     }
     else {
-      vector<Json::Node> bus_nodes;
-      bus_nodes.reserve(stop->bus_names.size());
+      out.Key("buses").BeginArray();
       for (const auto& bus_name : stop->bus_names) {
-        bus_nodes.emplace_back(bus_name);
+        out.Value(bus_name);
       }
-      dict["buses"] = Json::Node(move(bus_nodes));
+      out.EndArray();
     }
-    return dict;
   }
 
-  Json::Dict Bus::Process(const TransportCatalog& db) const {
+  void Bus::Process(const TransportCatalog& db, Json::Writer& out) const {
     const auto* bus = db.GetBus(name);
-    Json::Dict dict;
     if (!bus) {
-      dict["error_message"] = Json::Node("not found"s);
+      out.Key("error_message").Value("not found");
     }
     else {
-      dict = {
-          {"stop_count", Json::Node(static_cast<int>(bus->stop_count))},
-          {"unique_stop_count", Json::Node(static_cast<int>(bus->unique_stop_count))},
-          {"route_length", Json::Node(bus->road_route_length)},
-          {"curvature", Json::Node(bus->road_route_length / bus->geo_route_length)},
-      };
+      out.Key("stop_count").Value(static_cast<int>(bus->stop_count));
+      out.Key("unique_stop_count").Value(static_cast<int>(bus->unique_stop_count));
+      out.Key("route_length").Value(bus->road_route_length);
+      out.Key("curvature").Value(bus->road_route_length / bus->geo_route_length);
     }
-    return dict;
   }
 
-  struct RouteItemResponseBuilder {
-    Json::Dict operator()(const TransportRouter::RouteInfo::BusItem& bus_item) const {
-      return Json::Dict{
-          {"type", Json::Node("RideBus"s)},
-          {"bus", Json::Node(bus_item.bus_name)},
-          {"time", Json::Node(bus_item.time)},
-          {"span_count", Json::Node(static_cast<int>(bus_item.span_count))}
-      };
+  struct RouteItemResponseWriter {
+    Json::Writer& out;
+
+    void operator()(const TransportRouter::RouteInfo::BusItem& bus_item) const {
+      out.BeginObject()
+        .Key("type").Value("RideBus")
+        .Key("bus").Value(bus_item.bus_name)
+        .Key("time").Value(bus_item.time)
+        .Key("span_count").Value(static_cast<int>(bus_item.span_count))
+        .EndObject();
     }
-    Json::Dict operator()(const TransportRouter::RouteInfo::WaitItem& wait_item) const {
-      return Json::Dict{
-          {"type", Json::Node("WaitBus"s)},
-          {"stop_name", Json::Node(wait_item.stop_name)},
-          {"time", Json::Node(wait_item.time)},
-      };
+    void operator()(const TransportRouter::RouteInfo::WaitItem& wait_item) const {
+      out.BeginObject()
+        .Key("type").Value("WaitBus")
+        .Key("stop_name").Value(wait_item.stop_name)
+        .Key("time").Value(wait_item.time)
+        .EndObject();
     }
-    Json::Dict operator()(const TransportRouter::RouteInfo::WalkToCompany& walk_item) const {
-      return Json::Dict{
-        {"type", Json::Node("WalkToCompany"s)},
-        {"time", Json::Node(walk_item.time)},
-        {"stop_name", Json::Node(walk_item.stop_from)},
-        {"company", Json::Node(walk_item.company_name)},
-      };
+    void operator()(const TransportRouter::RouteInfo::WalkToCompany& walk_item) const {
+      out.BeginObject()
+        .Key("type").Value("WalkToCompany")
+        .Key("time").Value(walk_item.time)
+        .Key("stop_name").Value(walk_item.stop_from)
+        .Key("company").Value(walk_item.company_name)
+        .EndObject();
     }
-    Json::Dict operator()(const TransportRouter::RouteInfo::WaitCompany& wait_item) const {
-      return Json::Dict{
-        {"type", Json::Node("WaitCompany"s)},
-        {"time", Json::Node(wait_item.time)},
-        {"company", Json::Node(wait_item.company_name)},
-      };
+    void operator()(const TransportRouter::RouteInfo::WaitCompany& wait_item) const {
+      out.BeginObject()
+        .Key("type").Value("WaitCompany")
+        .Key("time").Value(wait_item.time)
+        .Key("company").Value(wait_item.company_name)
+        .EndObject();
     }
   };
 
@@ -94,70 +90,202 @@ namespace Requests {
     }
   };
 
-  Json::Dict Route::Process(const TransportCatalog& db) const {
-    Json::Dict dict;
-    const auto route = db.FindRoute(stop_from, stop_to);
+  void WriteRoute(const TransportCatalog& db, const optional<TransportRouter::RouteInfo>& route, Json::Writer& out) {
     if (!route) {
-      dict["error_message"] = Json::Node("not found"s);
+      out.Key("error_message").Value("not found");
+      return;
     }
-    else {
-      dict["total_time"] = Json::Node(route->total_time);
-      vector<Json::Node> items;
-      items.reserve(route->items.size());
-
-      RouteForPainterBuilder builder;
-      for (const auto& item : route->items) {
-        items.push_back(visit(RouteItemResponseBuilder{}, item));
-        visit(builder, item);
+    out.Key("total_time").Value(route->total_time);
+
+    RouteForPainterBuilder builder;
+    out.Key("items").BeginArray();
+    for (const auto& item : route->items) {
+      visit(RouteItemResponseWriter{out}, item);
+      visit(builder, item);
+    }
+    out.EndArray();
+
+    out.Key("map").Value(db.RenderRoute(builder.result));
+  }
+
+  // Members written by write_members are kept in the catalog's cache by key
+  template <typename WriteMembers>
+  void WriteCached(const TransportCatalog& db, string key, Json::Writer& out, WriteMembers write_members) {
+    auto& cache = db.GetResponseCache();
+    auto members = cache.Get(key);
+    if (!members) {
+      string buffer;
+      Json::Writer members_out(buffer);
+      write_members(members_out);
+      members = make_shared<const string>(move(buffer));
+      cache.Put(move(key), *members);
+    }
+    out.RawMembers(**members);
+  }
+
+  // Fields are separated by zero bytes and lists are prefixed with their sizes,
+  // so different requests never get the same key
+  class CacheKeyBuilder {
+  public:
+    explicit CacheKeyBuilder(string_view type) {
+      Add(type);
+    }
+
+    CacheKeyBuilder& Add(string_view field) {
+      key_.append(field);
+      key_ += '\0';
+      return *this;
+    }
+
+    CacheKeyBuilder& Add(const vector<string>& fields) {
+      Add(to_string(fields.size()));
+      for (const string& field : fields) {
+        Add(field);
       }
+      return *this;
+    }
+
+    CacheKeyBuilder& Add(const CompanyQuery::Company& model) {
+      Add(model.names).Add(model.urls).Add(model.rubrics);
+      Add(to_string(model.phones.size()));
+      for (const auto& phone : model.phones) {
+        Add(phone.has_type ? "1" : "0").Add(phone.phone.SerializeAsString());
+      }
+      return *this;
+    }
 
-      dict["map"] = Json::Node{ db.RenderRoute(builder.result) };
-      dict["items"] = move(items);
+    string Build() {
+      return move(key_);
     }
 
-    return dict;
+  private:
+    string key_;
+  };
+
+  void Route::Process(const TransportCatalog& db, Json::Writer& out) const {
+    string key = CacheKeyBuilder("Route").Add(stop_from).Add(stop_to).Build();
+    WriteCached(db, move(key), out, [&](Json::Writer& members_out) {
+      WriteRoute(db, db.FindRoute(stop_from, stop_to), members_out);
+    });
   }
 
-  Json::Dict Map::Process(const TransportCatalog& db) const {
-    return Json::Dict{ {"map", db.RenderMap()} };
+  void Map::Process(const TransportCatalog& db, Json::Writer& out) const {
+    out.Key("map").Value(db.RenderMap());
   }
 
-  Json::Dict FindCompanies::Process(const TransportCatalog& db) const {
-    vector<Json::Node> companies;
-    auto found = db.FindCompanies(model);
-    companies.reserve(found.size());
-    for (const auto& company : found) {
-      companies.push_back(Json::Node{ company });
+  // Tiles are few and requested by many clients, so they are cached; arbitrary viewports are not
+  void MapTile::Process(const TransportCatalog& db, Json::Writer& out) const {
+    if (viewport) {
+      out.Key("map").Value(db.RenderTile(*viewport));
+      return;
     }
-    Json::Dict dict;
-    dict["companies"] = move(companies);
-    return dict;
+    string key = CacheKeyBuilder("MapTile").Add(to_string(zoom)).Add(to_string(x)).Add(to_string(y)).Build();
+    WriteCached(db, move(key), out, [&](Json::Writer& members_out) {
+      members_out.Key("map").Value(db.RenderTile(db.GetTileViewport(zoom, x, y)));
+    });
   }
 
-  Json::Dict RouteToCompany::Process(const TransportCatalog& db) const {
-    const auto route = db.RouteToCompany(from, static_cast<double>(datetime), model);
-    Json::Dict dict;
-    if (!route) {
-      dict["error_message"] = Json::Node("not found"s);
+  void FindCompanies::Process(const TransportCatalog& db, Json::Writer& out) const {
+    out.Key("companies").BeginArray();
+    for (const auto& company : db.FindCompanies(model)) {
+      out.Value(company);
     }
-    else {
-      dict["total_time"] = Json::Node(route->total_time);
-      vector<Json::Node> items;
-      items.reserve(route->items.size());
-
-      RouteForPainterBuilder builder;
-      for (const auto& item : route->items) {
-        items.push_back(visit(RouteItemResponseBuilder{}, item));
-        visit(builder, item);
+    out.EndArray();
+  }
+
+  void RouteToCompany::Process(const TransportCatalog& db, Json::Writer& out) const {
+    string key = CacheKeyBuilder("RouteToCompany").Add(from).Add(to_string(datetime)).Add(model).Build();
+    WriteCached(db, move(key), out, [&](Json::Writer& members_out) {
+      WriteRoute(db, db.RouteToCompany(from, static_cast<double>(datetime), model), members_out);
+    });
+  }
+
+  GeoIndex::Query ReadNearbyQuery(const Json::Dict& attrs) {
+    GeoIndex::Query query{
+      .center = { attrs.at("latitude").AsDouble(), attrs.at("longitude").AsDouble() },
+      .radius = nullopt,
+      .count = nullopt,
+    };
+    if (const auto it = attrs.find("radius"); it != attrs.end()) {
+      const double radius = it->second.AsDouble();
+      if (!(radius >= 0)) {
+        throw invalid_argument("Nearby radius must not be negative");
+      }
+      query.radius = radius;
+    }
+    if (const auto it = attrs.find("count"); it != attrs.end()) {
+      const int count = it->second.AsInt();
+      if (count < 0) {
+        throw invalid_argument("Nearby count must not be negative");
+      }
+      query.count = static_cast<size_t>(count);
+    }
+    if (!query.radius && !query.count) {
+      throw invalid_argument("Nearby request needs radius or count");
+    }
+    return query;
+  }
+
+  MapTile ReadMapTile(const Json::Dict& attrs) {
+    if (const auto it = attrs.find("viewport"); it != attrs.end()) {
+      const auto& viewport = it->second.AsMap();
+      const double x = viewport.at("x").AsDouble();
+      const double y = viewport.at("y").AsDouble();
+      const double width = viewport.at("width").AsDouble();
+      const double height = viewport.at("height").AsDouble();
+      if (!(width > 0 && height > 0)) {
+        throw invalid_argument("Viewport must have positive width and height");
       }
+      return MapTile{
+        .viewport = Paint::Viewport{ x, y, x + width, y + height },
+        .zoom = 0,
+        .x = 0,
+        .y = 0,
+      };
+    }
+    const int zoom = attrs.at("zoom").AsInt();
+    const int x = attrs.at("x").AsInt();
+    const int y = attrs.at("y").AsInt();
+    if (zoom < 0 || zoom > Paint::Painter::MAX_TILE_ZOOM) {
+      throw invalid_argument("Tile zoom must be from 0 to " + to_string(Paint::Painter::MAX_TILE_ZOOM));
+    }
+    if (x < 0 || x >= (1 << zoom) || y < 0 || y >= (1 << zoom)) {
+      throw invalid_argument("Tile x and y must be from 0 to " + to_string((1 << zoom) - 1));
+    }
+    return MapTile{
+      .viewport = nullopt,
+      .zoom = zoom,
+      .x = x,
+      .y = y,
+    };
+  }
 
-      dict["map"] = Json::Node{ db.RenderRoute(builder.result) };
-      dict["items"] = move(items);
+  void WriteNeighbours(const vector<GeoIndex::Neighbour>& neighbours, Json::Writer& out) {
+    out.BeginArray();
+    for (const auto& [name, distance] : neighbours) {
+      out.BeginObject();
+      out.Key("name").Value(name);
+      out.Key("distance").Value(distance);
+      out.EndObject();
     }
-    return dict;
+    out.EndArray();
+  }
+
+  void NearbyStops::Process(const TransportCatalog& db, Json::Writer& out) const {
+    WriteNeighbours(db.FindNearbyStops(query), out.Key("stops"));
+  }
+
+  void NearbyCompanies::Process(const TransportCatalog& db, Json::Writer& out) const {
+    WriteNeighbours(db.FindNearbyCompanies(query), out.Key("companies"));
   }
 
-  variant<Stop, Bus, Route, Map, FindCompanies, RouteToCompany> Read(const Json::Dict& attrs) {
+  void CacheStats::Process(const TransportCatalog& db, Json::Writer& out) const {
+    const auto stats = db.GetResponseCache().GetStats();
+    out.Key("hits").Value(static_cast<int>(stats.hits));
+    out.Key("misses").Value(static_cast<int>(stats.misses));
+  }
+
+  Request Read(const Json::Dict& attrs) {
     const string& type = attrs.at("type").AsString();
     if (type == "Bus") {
       return Bus{ attrs.at("name").AsString() };
@@ -171,6 +299,18 @@ namespace Requests {
     else if (type == "Map") {
       return Map{};
     }
+    else if (type == "MapTile") {
+      return ReadMapTile(attrs);
+    }
+    else if (type == "NearbyStops") {
+      return NearbyStops{ ReadNearbyQuery(attrs) };
+    }
+    else if (type == "NearbyCompanies") {
+      return NearbyCompanies{ ReadNearbyQuery(attrs) };
+    }
+    else if (type == "CacheStats") {
+      return CacheStats{};
+    }
     else if (type == "FindCompanies") {
       return FindCompanies{ .model = CompanyQuery::ReadCompany(attrs) };
     }
@@ -183,18 +323,64 @@ namespace Requests {
     };
   }
 
-  vector<Json::Node> ProcessAll(const TransportCatalog& db, const vector<Json::Node>& requests) {
-    vector<Json::Node> responses;
-    responses.reserve(requests.size());
-    for (const Json::Node& request_node : requests) {
-      Json::Dict dict = visit([&db](const auto& request) {
-        return request.Process(db);
+  void ProcessOne(const TransportCatalog& db, const Json::Node& request_node, Json::Writer& out) {
+    out.BeginObject();
+    out.Key("request_id").Value(request_node.AsMap().at("id").AsInt());
+    optional<Request> request;
+    try {
+      request = Requests::Read(request_node.AsMap());
+    } catch (const invalid_argument& error) {
+      out.Key("error_message").Value(error.what());
+    }
+    if (request) {
+      visit([&db, &out](const auto& request) {
+        request.Process(db, out);
         },
-        Requests::Read(request_node.AsMap()));
-      dict["request_id"] = Json::Node(request_node.AsMap().at("id").AsInt());
-      responses.push_back(Json::Node(dict));
+        *request);
     }
+    out.EndObject();
+  }
+
+  vector<string> ProcessAll(const TransportCatalog& db, const vector<Json::Node>& requests, ThreadPool& pool) {
+    // Every response goes to the slot of its request, so the order does not depend on scheduling
+    vector<string> responses(requests.size());
+    pool.ParallelFor(requests.size(), [&](size_t idx) {
+      Json::Writer out(responses[idx]);
+      ProcessOne(db, requests[idx], out);
+    });
     return responses;
   }
 
+
+  ResponseStream::ResponseStream(const TransportCatalog& db, ostream& output, size_t thread_count)
+    : db_(db), output_(output), pool_(thread_count)
+  {
+    batch_.reserve(pool_.GetThreadCount() * BATCH_SIZE_PER_THREAD);
+    output_ << '[';
+  }
+
+  void ResponseStream::Add(Json::Node request) {
+    batch_.push_back(move(request));
+    if (batch_.size() == pool_.GetThreadCount() * BATCH_SIZE_PER_THREAD) {
+      Flush();
+    }
+  }
+
+  void ResponseStream::Finish() {
+    Flush();
+    output_ << ']';
+  }
+
+  void ResponseStream::Flush() {
+    for (const string& response : ProcessAll(db_, batch_, pool_)) {
+      if (!is_first_) {
+        output_ << ", ";
+      }
+      is_first_ = false;
+      output_ << response;
+    }
+    output_.flush();
+    batch_.clear();
+  }
+
 }
@@ -1,40 +1,56 @@
 #pragma once
 
 #include "json.h"
+#include "json_writer.h"
 #include "transport_catalog.h"
+#include "utils.h"
 
+#include <optional>
+#include <ostream>
 #include <string>
 #include <variant>
+#include <vector>
 
 
 namespace Requests {
   struct Stop {
     std::string name;
 
-    Json::Dict Process(const TransportCatalog& db) const;
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
   };
 
   struct Bus {
     std::string name;
 
-    Json::Dict Process(const TransportCatalog& db) const;
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
   };
 
   struct Route {
     std::string stop_from;
     std::string stop_to;
 
-    Json::Dict Process(const TransportCatalog& db) const;
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
   };
 
   struct Map {
-    Json::Dict Process(const TransportCatalog& db) const;
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
+  };
+
+  // A part of the map: either the viewport {"x", "y", "width", "height"}
+  // in the coordinates of the map, or the tile "x", "y" of the level "zoom"
+  struct MapTile {
+    std::optional<Paint::Viewport> viewport;
+    int zoom = 0;
+    int x = 0;
+    int y = 0;
+
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
   };
 
   struct FindCompanies {
     CompanyQuery::Company model;
 
-    Json::Dict Process(const TransportCatalog& db) const;
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
   };
 
   struct RouteToCompany {
@@ -42,11 +58,64 @@ namespace Requests {
     int datetime;
     CompanyQuery::Company model;
 
-    Json::Dict Process(const TransportCatalog& db) const;
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
+  };
+
+  // Places around "latitude" and "longitude": within "radius" meters,
+  // or the "count" nearest ones, or the "count" nearest ones within "radius"
+  struct NearbyStops {
+    GeoIndex::Query query;
+
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
   };
 
+  struct NearbyCompanies {
+    GeoIndex::Query query;
+
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
+  };
+
+  // Hits and misses of the response cache of the catalog since it was loaded
+  struct CacheStats {
+    void Process(const TransportCatalog& db, Json::Writer& out) const;
+  };
 
-  std::variant<Stop, Bus, Route, Map, FindCompanies, RouteToCompany> Read(const Json::Dict& attrs);
+  using Request = std::variant<Stop, Bus, Route, Map, MapTile, FindCompanies, RouteToCompany, NearbyStops, NearbyCompanies,
+                               CacheStats>;
 
-  std::vector<Json::Node> ProcessAll(const TransportCatalog& db, const std::vector<Json::Node>& requests);
+  // Throws std::invalid_argument for a well-formed request with values out of range
+  Request Read(const Json::Dict& attrs);
+
+  // Writes the response object, with the members of the request's Process,
+  // or with "error_message" if the request has values out of range
+  void ProcessOne(const TransportCatalog& db, const Json::Node& request_node, Json::Writer& out);
+
+  // Requests only read the catalog, so they are processed by the threads of the pool.
+  // Returns the serialized responses.
+  std::vector<std::string> ProcessAll(const TransportCatalog& db, const std::vector<Json::Node>& requests,
+                                     ThreadPool& pool);
+
+  // Writes the responses as one JSON array while the requests are still coming.
+  // Requests are answered in batches of a few per thread, and every batch is
+  // printed and flushed as soon as it is ready, so only one batch is in memory.
+  class ResponseStream {
+  public:
+    ResponseStream(const TransportCatalog& db, std::ostream& output, size_t thread_count = 1);
+
+    void Add(Json::Node request);
+
+    // Answers the remaining requests and closes the array
+    void Finish();
+
+  private:
+    static constexpr size_t BATCH_SIZE_PER_THREAD = 4;
+
+    const TransportCatalog& db_;
+    std::ostream& output_;
+    ThreadPool pool_;  // lives as long as the stream, so batches do not start threads
+    std::vector<Json::Node> batch_;
+    bool is_first_ = true;
+
+    void Flush();
+  };
 }
@@ -1,142 +1,261 @@
 #pragma once
 
+#include "contraction_hierarchy.h"
 #include "graph.h"
 #include "graph.pb.h"
+#include "search_space.h"
+#include "utils.h"
 
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <optional>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace Graph {
 
+  enum class RouterStrategy {
+    ALL_PAIRS,  // Floyd-Warshall matrix built once, O(V^2) memory
+    DIJKSTRA,   // no preprocessing, single-pair search on every query
+    CONTRACTION_HIERARCHIES,  // shortcuts added at build time, bidirectional upward search
+  };
+
   template <typename Weight>
   class Router {
   private:
     using Graph = DirectedWeightedGraph<Weight>;
 
   public:
-    Router(const Graph& graph);
+    // thread_count limits the threads used to build the all-pairs matrix
+    Router(const Graph& graph, RouterStrategy strategy = RouterStrategy::ALL_PAIRS, size_t thread_count = 1);
 
-    GraphProto::Router Serialize() const;
-    Router(const GraphProto::Router& router, const Graph& graph);
+    // The all-pairs matrices are too big for the proto and are stored
+    // as raw arrays next to it; a loaded router uses them in place
+    using PrevEdgeId = uint32_t;
+    struct RouteMatrixView {
+      const Weight* weights = nullptr;
+      const PrevEdgeId* prev_edges = nullptr;
+    };
 
-    using RouteId = uint64_t;
+    GraphProto::Router Serialize() const;
+    RouteMatrixView GetRouteMatrix() const;
+    // The matrix must outlive the router
+    Router(const GraphProto::Router& router, const Graph& graph, RouteMatrixView matrix);
 
-    struct RouteInfo {
-      RouteId id;
-      Weight weight;
-      size_t edge_count;
+    // Scratch space of route queries, owned by the caller. The router itself
+    // is only read by BuildRoute, so threads may query it concurrently as long as
+    // each uses its own buffer. The buffer keeps its capacity between queries.
+    struct RouteBuffer {
+      std::vector<EdgeId> edges;
+      SearchSpace<Weight> search_space;
+      typename ContractionHierarchy<Weight>::QueryBuffers hierarchy;
     };
 
-    std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
-    EdgeId GetRouteEdge(RouteId route_id, size_t edge_idx) const;
-    void ReleaseRoute(RouteId route_id);
+    // Fills buffer.edges with the edges of the best route and returns its weight
+    std::optional<Weight> BuildRoute(VertexId from, VertexId to, RouteBuffer& buffer) const;
 
   private:
     const Graph& graph_;
+    RouterStrategy strategy_;
 
-    struct RouteInternalData {
-      Weight weight;
-      std::optional<EdgeId> prev_edge;
-    };
-    using RoutesInternalData = std::vector<std::vector<std::optional<RouteInternalData>>>;
+    // All-pairs data is kept as two row-major V x V matrices: the row of a source
+    // holds the weights of the best routes from it and the last edges of those routes.
+    // Missing routes have infinite weight, missing last edges are NO_EDGE.
+    static constexpr PrevEdgeId NO_EDGE = std::numeric_limits<PrevEdgeId>::max();
+    static constexpr Weight NO_ROUTE = std::numeric_limits<Weight>::infinity();
 
-    using ExpandedRoute = std::vector<EdgeId>;
-    mutable RouteId next_route_id_ = 0;
-    mutable std::unordered_map<RouteId, ExpandedRoute> expanded_routes_cache_;
+    struct RoutesInternalData {
+      size_t vertex_count = 0;
+      // Filled when the matrices are built, left empty when they are loaded
+      std::vector<Weight> weights;
+      std::vector<PrevEdgeId> prev_edges;
+      // What queries read: either the vectors above or loaded arrays
+      RouteMatrixView view;
+
+      size_t Index(VertexId from, VertexId to) const {
+        return from * vertex_count + to;
+      }
+    };
 
     void InitializeRoutesInternalData(const Graph& graph) {
       const size_t vertex_count = graph.GetVertexCount();
+      auto& data = routes_internal_data_;
+      data.vertex_count = vertex_count;
+      data.weights.assign(vertex_count * vertex_count, NO_ROUTE);
+      data.prev_edges.assign(vertex_count * vertex_count, NO_EDGE);
       for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
-        routes_internal_data_[vertex][vertex] = RouteInternalData{ 0, std::nullopt };
+        data.weights[data.Index(vertex, vertex)] = 0;
         for (const EdgeId edge_id : graph.GetIncidentEdges(vertex)) {
           const auto& edge = graph.GetEdge(edge_id);
           assert(edge.weight >= 0);
-          auto& route_internal_data = routes_internal_data_[vertex][edge.to];
-          if (!route_internal_data || route_internal_data->weight > edge.weight) {
-            route_internal_data = RouteInternalData{ edge.weight, edge_id };
+          const size_t idx = data.Index(vertex, edge.to);
+          if (data.weights[idx] > edge.weight) {
+            data.weights[idx] = edge.weight;
+            data.prev_edges[idx] = static_cast<PrevEdgeId>(edge_id);
           }
         }
       }
     }
 
-    void RelaxRoute(VertexId vertex_from, VertexId vertex_to,
-      const RouteInternalData& route_from, const RouteInternalData& route_to) {
-      auto& route_relaxing = routes_internal_data_[vertex_from][vertex_to];
-      const Weight candidate_weight = route_from.weight + route_to.weight;
-      if (!route_relaxing || candidate_weight < route_relaxing->weight) {
-        route_relaxing = {
-            candidate_weight,
-            route_to.prev_edge
-                ? route_to.prev_edge
-                : route_from.prev_edge
-        };
+    // Floyd-Warshall is run over square tiles of the matrix. For every diagonal
+    // tile the tile itself is relaxed first, then the tiles of its row and column,
+    // then all the remaining ones; tiles within the last two phases are independent.
+    static constexpr size_t TILE_SIZE = 64;
+
+    void RelaxRoutesInternalDataInTiles(size_t thread_count) {
+      const size_t tile_count = (routes_internal_data_.vertex_count + TILE_SIZE - 1) / TILE_SIZE;
+      // Every diagonal tile has two parallel phases, so the threads are started only once
+      ThreadPool pool(thread_count);
+      for (size_t tile_through = 0; tile_through < tile_count; ++tile_through) {
+        RelaxTileThroughTile(tile_through, tile_through, tile_through);
+        pool.ParallelFor(tile_count, [&](size_t tile) {
+          if (tile != tile_through) {
+            RelaxTileThroughTile(tile_through, tile, tile_through);
+            RelaxTileThroughTile(tile, tile_through, tile_through);
+          }
+        });
+        pool.ParallelFor(tile_count * tile_count, [&](size_t tile_idx) {
+          const size_t tile_from = tile_idx / tile_count;
+          const size_t tile_to = tile_idx % tile_count;
+          if (tile_from != tile_through && tile_to != tile_through) {
+            RelaxTileThroughTile(tile_from, tile_to, tile_through);
+          }
+        });
       }
     }
 
-    void RelaxRoutesInternalDataThroughVertex(size_t vertex_count, VertexId vertex_through) {
-      for (VertexId vertex_from = 0; vertex_from < vertex_count; ++vertex_from) {
-        if (const auto& route_from = routes_internal_data_[vertex_from][vertex_through]) {
-          for (VertexId vertex_to = 0; vertex_to < vertex_count; ++vertex_to) {
-            if (const auto& route_to = routes_internal_data_[vertex_through][vertex_to]) {
-              RelaxRoute(vertex_from, vertex_to, *route_from, *route_to);
-            }
+    // Relaxes routes from the vertices of one tile row to the vertices of one tile column
+    // through the vertices of another tile. A route through vertex k ends with the last edge
+    // of the route from k, which is never missing when its weight wins: a missing route has
+    // infinite weight, and a route through k = to is never shorter than the current one.
+    void RelaxTileThroughTile(size_t tile_from, size_t tile_to, size_t tile_through) {
+      auto& data = routes_internal_data_;
+      const size_t vertex_count = data.vertex_count;
+      const VertexId from_begin = tile_from * TILE_SIZE;
+      const VertexId from_end = std::min(from_begin + TILE_SIZE, vertex_count);
+      const VertexId to_begin = tile_to * TILE_SIZE;
+      const size_t to_size = std::min(to_begin + TILE_SIZE, vertex_count) - to_begin;
+      const VertexId through_begin = tile_through * TILE_SIZE;
+      const VertexId through_end = std::min(through_begin + TILE_SIZE, vertex_count);
+
+      for (VertexId vertex_through = through_begin; vertex_through < through_end; ++vertex_through) {
+        const Weight* through_weights = &data.weights[data.Index(vertex_through, to_begin)];
+        const PrevEdgeId* through_prev_edges = &data.prev_edges[data.Index(vertex_through, to_begin)];
+        for (VertexId vertex_from = from_begin; vertex_from < from_end; ++vertex_from) {
+          const Weight weight_from = data.weights[data.Index(vertex_from, vertex_through)];
+          if (weight_from == NO_ROUTE) {
+            continue;
+          }
+          Weight* weights = &data.weights[data.Index(vertex_from, to_begin)];
+          PrevEdgeId* prev_edges = &data.prev_edges[data.Index(vertex_from, to_begin)];
+          // Branchless select, so that the loop is vectorized
+          for (size_t idx = 0; idx < to_size; ++idx) {
+            const Weight candidate_weight = weight_from + through_weights[idx];
+            const bool is_better = candidate_weight < weights[idx];
+            weights[idx] = is_better ? candidate_weight : weights[idx];
+            prev_edges[idx] = is_better ? through_prev_edges[idx] : prev_edges[idx];
           }
         }
       }
     }
 
     RoutesInternalData routes_internal_data_;
+
+    std::unique_ptr<ContractionHierarchy<Weight>> hierarchy_;
+
+    bool RunDijkstra(VertexId from, VertexId to, SearchSpace<Weight>& search_space) const;
+    void ExpandAllPairsRoute(VertexId from, VertexId to, std::vector<EdgeId>& edges) const;
+    void ExpandDijkstraRoute(VertexId to, const SearchSpace<Weight>& search_space, std::vector<EdgeId>& edges) const;
   };
 
 
   template <typename Weight>
-  Router<Weight>::Router(const Graph& graph)
+  Router<Weight>::Router(const Graph& graph, RouterStrategy strategy, size_t thread_count)
     : graph_(graph),
-    routes_internal_data_(graph.GetVertexCount(), std::vector<std::optional<RouteInternalData>>(graph.GetVertexCount()))
+    strategy_(strategy)
   {
+    if (strategy_ == RouterStrategy::CONTRACTION_HIERARCHIES) {
+      hierarchy_ = std::make_unique<ContractionHierarchy<Weight>>(graph);
+    }
+    if (strategy_ != RouterStrategy::ALL_PAIRS) {
+      return;
+    }
     InitializeRoutesInternalData(graph);
+    RelaxRoutesInternalDataInTiles(thread_count);
+    routes_internal_data_.view = { routes_internal_data_.weights.data(), routes_internal_data_.prev_edges.data() };
+  }
 
-    const size_t vertex_count = graph.GetVertexCount();
-    for (VertexId vertex_through = 0; vertex_through < vertex_count; ++vertex_through) {
-      RelaxRoutesInternalDataThroughVertex(vertex_count, vertex_through);
-    }
+  template <typename Weight>
+  typename Router<Weight>::RouteMatrixView Router<Weight>::GetRouteMatrix() const {
+    return routes_internal_data_.view;
   }
 
   template <typename Weight>
-  std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildRoute(VertexId from, VertexId to) const {
-    const auto& route_internal_data = routes_internal_data_[from][to];
-    if (!route_internal_data) {
-      return std::nullopt;
+  bool Router<Weight>::RunDijkstra(VertexId from, VertexId to, SearchSpace<Weight>& search_space) const {
+    search_space.Reset(graph_.GetVertexCount());
+    search_space.Relax(from, 0, std::nullopt);
+    while (const auto nearest = search_space.PopNearest()) {
+      const auto [weight, vertex] = *nearest;
+      if (vertex == to) {
+        return true;
+      }
+      for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex)) {
+        const auto& edge = graph_.GetEdge(edge_id);
+        assert(edge.weight >= 0);
+        search_space.Relax(edge.to, weight + edge.weight, edge_id);
+      }
     }
-    const Weight weight = route_internal_data->weight;
-    std::vector<EdgeId> edges;
-    for (std::optional<EdgeId> edge_id = route_internal_data->prev_edge;
-      edge_id;
-      edge_id = routes_internal_data_[from][graph_.GetEdge(*edge_id).from]->prev_edge) {
-      edges.push_back(*edge_id);
+    return false;
+  }
+
+  template <typename Weight>
+  void Router<Weight>::ExpandAllPairsRoute(VertexId from, VertexId to, std::vector<EdgeId>& edges) const {
+    const auto& data = routes_internal_data_;
+    const PrevEdgeId* prev_edges = data.view.prev_edges + data.Index(from, 0);
+    for (PrevEdgeId edge_id = prev_edges[to];
+      edge_id != NO_EDGE;
+      edge_id = prev_edges[graph_.GetEdge(edge_id).from]) {
+      edges.push_back(edge_id);
     }
     std::reverse(std::begin(edges), std::end(edges));
-
-    const RouteId route_id = next_route_id_++;
-    const size_t route_edge_count = edges.size();
-    expanded_routes_cache_[route_id] = std::move(edges);
-    return RouteInfo{ route_id, weight, route_edge_count };
   }
 
   template <typename Weight>
-  EdgeId Router<Weight>::GetRouteEdge(RouteId route_id, size_t edge_idx) const {
-    return expanded_routes_cache_.at(route_id)[edge_idx];
+  void Router<Weight>::ExpandDijkstraRoute(VertexId to, const SearchSpace<Weight>& search_space,
+                                           std::vector<EdgeId>& edges) const {
+    for (std::optional<EdgeId> edge_id = search_space.GetPrevEdge(to);
+      edge_id;
+      edge_id = search_space.GetPrevEdge(graph_.GetEdge(*edge_id).from)) {
+      edges.push_back(*edge_id);
+    }
+    std::reverse(std::begin(edges), std::end(edges));
   }
 
   template <typename Weight>
-  void Router<Weight>::ReleaseRoute(RouteId route_id) {
-    expanded_routes_cache_.erase(route_id);
+  std::optional<Weight> Router<Weight>::BuildRoute(VertexId from, VertexId to, RouteBuffer& buffer) const {
+    buffer.edges.clear();
+    if (strategy_ == RouterStrategy::ALL_PAIRS) {
+      const Weight weight = routes_internal_data_.view.weights[routes_internal_data_.Index(from, to)];
+      if (weight == NO_ROUTE) {
+        return std::nullopt;
+      }
+      ExpandAllPairsRoute(from, to, buffer.edges);
+      return weight;
+    }
+    else if (strategy_ == RouterStrategy::DIJKSTRA) {
+      if (!RunDijkstra(from, to, buffer.search_space)) {
+        return std::nullopt;
+      }
+      ExpandDijkstraRoute(to, buffer.search_space, buffer.edges);
+      return buffer.search_space.GetWeight(to);
+    }
+    else {
+      return hierarchy_->FindRoute(from, to, buffer.hierarchy, buffer.edges);
+    }
   }
 
 }
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -42,20 +41,12 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_rubric_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_rubric_2eproto;
 namespace YellowPages {
 class Rubric;
-class RubricDefaultTypeInternal;
+struct RubricDefaultTypeInternal;
 extern RubricDefaultTypeInternal _Rubric_default_instance_;
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
@@ -65,11 +56,12 @@ namespace YellowPages {
 
 // ===================================================================
 
-class Rubric PROTOBUF_FINAL :
+class Rubric final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.Rubric) */ {
  public:
   inline Rubric() : Rubric(nullptr) {}
-  virtual ~Rubric();
+  ~Rubric() override;
+  explicit PROTOBUF_CONSTEXPR Rubric(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Rubric(const Rubric& from);
   Rubric(Rubric&& from) noexcept
@@ -82,8 +74,13 @@ class Rubric PROTOBUF_FINAL :
     return *this;
   }
   inline Rubric& operator=(Rubric&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -94,13 +91,14 @@ class Rubric PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Rubric& default_instance() {
+    return *internal_default_instance();
   }
-  static const Rubric& default_instance();
-
   static inline const Rubric* internal_default_instance() {
     return reinterpret_cast<const Rubric*>(
                &_Rubric_default_instance_);
@@ -113,7 +111,12 @@ class Rubric PROTOBUF_FINAL :
   }
   inline void Swap(Rubric* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -121,56 +124,53 @@ class Rubric PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Rubric* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Rubric* New() const final {
-    return CreateMaybeMessage<Rubric>(nullptr);
-  }
-
-  Rubric* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Rubric* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Rubric>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Rubric& from);
-  void MergeFrom(const Rubric& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Rubric& from) {
+    Rubric::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Rubric* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.Rubric";
   }
   protected:
-  explicit Rubric(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Rubric(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_rubric_2eproto);
-    return ::descriptor_table_rubric_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -207,16 +207,14 @@ class Rubric PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -227,9 +225,12 @@ class Rubric PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keywords_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keywords_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_rubric_2eproto;
 };
 // ===================================================================
@@ -245,53 +246,38 @@ class Rubric PROTOBUF_FINAL :
 
 // string name = 1;
 inline void Rubric::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& Rubric::name() const {
   // @@protoc_insertion_point(field_get:YellowPages.Rubric.name)
   return _internal_name();
 }
-inline void Rubric::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Rubric::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.Rubric.name)
 }
 inline std::string* Rubric::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:YellowPages.Rubric.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& Rubric::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void Rubric::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Rubric::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.Rubric.name)
-}
-inline void Rubric::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.Rubric.name)
-}
-inline void Rubric::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.Rubric.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Rubric::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Rubric::release_name() {
   // @@protoc_insertion_point(field_release:YellowPages.Rubric.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void Rubric::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -299,27 +285,32 @@ inline void Rubric::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.Rubric.name)
 }
 
 // repeated string keywords = 2;
 inline int Rubric::_internal_keywords_size() const {
-  return keywords_.size();
+  return _impl_.keywords_.size();
 }
 inline int Rubric::keywords_size() const {
   return _internal_keywords_size();
 }
 inline void Rubric::clear_keywords() {
-  keywords_.Clear();
+  _impl_.keywords_.Clear();
 }
 inline std::string* Rubric::add_keywords() {
+  std::string* _s = _internal_add_keywords();
   // @@protoc_insertion_point(field_add_mutable:YellowPages.Rubric.keywords)
-  return _internal_add_keywords();
+  return _s;
 }
 inline const std::string& Rubric::_internal_keywords(int index) const {
-  return keywords_.Get(index);
+  return _impl_.keywords_.Get(index);
 }
 inline const std::string& Rubric::keywords(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.Rubric.keywords)
@@ -327,55 +318,55 @@ inline const std::string& Rubric::keywords(int index) const {
 }
 inline std::string* Rubric::mutable_keywords(int index) {
   // @@protoc_insertion_point(field_mutable:YellowPages.Rubric.keywords)
-  return keywords_.Mutable(index);
+  return _impl_.keywords_.Mutable(index);
 }
 inline void Rubric::set_keywords(int index, const std::string& value) {
+  _impl_.keywords_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:YellowPages.Rubric.keywords)
-  keywords_.Mutable(index)->assign(value);
 }
 inline void Rubric::set_keywords(int index, std::string&& value) {
+  _impl_.keywords_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:YellowPages.Rubric.keywords)
-  keywords_.Mutable(index)->assign(std::move(value));
 }
 inline void Rubric::set_keywords(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  keywords_.Mutable(index)->assign(value);
+  _impl_.keywords_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:YellowPages.Rubric.keywords)
 }
 inline void Rubric::set_keywords(int index, const char* value, size_t size) {
-  keywords_.Mutable(index)->assign(
+  _impl_.keywords_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:YellowPages.Rubric.keywords)
 }
 inline std::string* Rubric::_internal_add_keywords() {
-  return keywords_.Add();
+  return _impl_.keywords_.Add();
 }
 inline void Rubric::add_keywords(const std::string& value) {
-  keywords_.Add()->assign(value);
+  _impl_.keywords_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:YellowPages.Rubric.keywords)
 }
 inline void Rubric::add_keywords(std::string&& value) {
-  keywords_.Add(std::move(value));
+  _impl_.keywords_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:YellowPages.Rubric.keywords)
 }
 inline void Rubric::add_keywords(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  keywords_.Add()->assign(value);
+  _impl_.keywords_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:YellowPages.Rubric.keywords)
 }
 inline void Rubric::add_keywords(const char* value, size_t size) {
-  keywords_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.keywords_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:YellowPages.Rubric.keywords)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 Rubric::keywords() const {
   // @@protoc_insertion_point(field_list:YellowPages.Rubric.keywords)
-  return keywords_;
+  return _impl_.keywords_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 Rubric::mutable_keywords() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.Rubric.keywords)
-  return &keywords_;
+  return &_impl_.keywords_;
 }
 
 #ifdef __GNUC__
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "graph.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Graph {
+
+  // Reusable state of a Dijkstra-like search. A vertex's weight and prev_edge
+  // are valid only while its stamp equals the current epoch, so starting
+  // a new search costs O(1) instead of clearing V entries.
+  template <typename Weight>
+  class SearchSpace {
+  public:
+    void Reset(size_t vertex_count);
+
+    bool IsReached(VertexId vertex) const;
+    Weight GetWeight(VertexId vertex) const;
+    std::optional<EdgeId> GetPrevEdge(VertexId vertex) const;
+
+    // Returns false if the vertex is already reached with a weight not greater than given
+    bool Relax(VertexId vertex, Weight weight, std::optional<EdgeId> prev_edge);
+
+    bool HasQueued() const;
+    Weight GetNearestWeight() const;
+    // Pops the nearest queued vertex skipping stale entries
+    std::optional<std::pair<Weight, VertexId>> PopNearest();
+    void ClearQueue();
+
+  private:
+    std::vector<Weight> weights_;
+    std::vector<std::optional<EdgeId>> prev_edges_;
+    std::vector<uint32_t> stamps_;
+    uint32_t epoch_ = 0;
+
+    using QueueItem = std::pair<Weight, VertexId>;
+    std::vector<QueueItem> queue_;
+
+    static bool ByWeightDesc(const QueueItem& lhs, const QueueItem& rhs) {
+      return lhs.first > rhs.first;
+    }
+    void SkipStale();
+  };
+
+
+  template <typename Weight>
+  void SearchSpace<Weight>::Reset(size_t vertex_count) {
+    if (stamps_.size() != vertex_count) {
+      weights_.resize(vertex_count);
+      prev_edges_.resize(vertex_count);
+      stamps_.assign(vertex_count, 0);
+      epoch_ = 0;
+    }
+    if (++epoch_ == 0) {
+      std::fill(std::begin(stamps_), std::end(stamps_), 0);
+      epoch_ = 1;
+    }
+    queue_.clear();
+  }
+
+  template <typename Weight>
+  bool SearchSpace<Weight>::IsReached(VertexId vertex) const {
+    return stamps_[vertex] == epoch_;
+  }
+
+  template <typename Weight>
+  Weight SearchSpace<Weight>::GetWeight(VertexId vertex) const {
+    return weights_[vertex];
+  }
+
+  template <typename Weight>
+  std::optional<EdgeId> SearchSpace<Weight>::GetPrevEdge(VertexId vertex) const {
+    return prev_edges_[vertex];
+  }
+
+  template <typename Weight>
+  bool SearchSpace<Weight>::Relax(VertexId vertex, Weight weight, std::optional<EdgeId> prev_edge) {
+    if (IsReached(vertex) && !(weight < weights_[vertex])) {
+      return false;
+    }
+    stamps_[vertex] = epoch_;
+    weights_[vertex] = weight;
+    prev_edges_[vertex] = prev_edge;
+    queue_.emplace_back(weight, vertex);
+    std::push_heap(std::begin(queue_), std::end(queue_), ByWeightDesc);
+    return true;
+  }
+
+  template <typename Weight>
+  void SearchSpace<Weight>::SkipStale() {
+    while (!queue_.empty() && queue_.front().first > weights_[queue_.front().second]) {
+      std::pop_heap(std::begin(queue_), std::end(queue_), ByWeightDesc);
+      queue_.pop_back();
+    }
+  }
+
+  template <typename Weight>
+  bool SearchSpace<Weight>::HasQueued() const {
+    return !queue_.empty();
+  }
+
+  template <typename Weight>
+  Weight SearchSpace<Weight>::GetNearestWeight() const {
+    return queue_.front().first;
+  }
+
+  template <typename Weight>
+  std::optional<std::pair<Weight, VertexId>> SearchSpace<Weight>::PopNearest() {
+    SkipStale();
+    if (queue_.empty()) {
+      return std::nullopt;
+    }
+    std::pop_heap(std::begin(queue_), std::end(queue_), ByWeightDesc);
+    const QueueItem item = queue_.back();
+    queue_.pop_back();
+    SkipStale();
+    return item;
+  }
+
+  template <typename Weight>
+  void SearchSpace<Weight>::ClearQueue() {
+    queue_.clear();
+  }
+
+}
@@ -13,6 +13,7 @@
 #include "sphere.pb.h"
 #include "url.pb.h"
 #include "working_time.pb.h"
+#include "base_file.h"
 #include "graph.h"
 #include "svg.h"
 #include "painter.h"
@@ -20,6 +21,11 @@
 #include "transport_router.h"
 #include "transport_catalog.h"
 #include "companies_catalog.h"
+#include "geo_index.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/wire_format_lite.h>
 
 using namespace std;
 
@@ -66,44 +72,91 @@ Graph::DirectedWeightedGraph<double>::DirectedWeightedGraph(const GraphProto::Di
 }
 
 
+/* CONTRACTION_HIERARCHY SERIALIZATION */
+
+template<>
+GraphProto::ContractionHierarchy Graph::ContractionHierarchy<double>::Serialize() const {
+  GraphProto::ContractionHierarchy proto;
+  for (const auto rank : ranks_) {
+    proto.add_ranks(rank);
+  }
+  for (const auto& shortcut : shortcuts_) {
+    auto& shortcut_proto = *proto.add_shortcuts();
+    shortcut_proto.set_from(shortcut.from);
+    shortcut_proto.set_to(shortcut.to);
+    shortcut_proto.set_weight(shortcut.weight);
+    shortcut_proto.set_first(shortcut.first);
+    shortcut_proto.set_second(shortcut.second);
+  }
+  return proto;
+}
+
+template<>
+Graph::ContractionHierarchy<double>::ContractionHierarchy(
+  const GraphProto::ContractionHierarchy& proto, const Graph& graph) : graph_(graph) {
+  ranks_.reserve(proto.ranks_size());
+  for (const auto rank : proto.ranks()) {
+    ranks_.push_back(rank);
+  }
+  shortcuts_.reserve(proto.shortcuts_size());
+  for (const auto& shortcut_proto : proto.shortcuts()) {
+    shortcuts_.push_back({
+      shortcut_proto.from(),
+      shortcut_proto.to(),
+      shortcut_proto.weight(),
+      shortcut_proto.first(),
+      shortcut_proto.second(),
+    });
+  }
+  BuildSearchGraph();
+}
+
+
 /* ROUTER SERIALIZATION */
 
+GraphProto::Router::Strategy SerializeStrategy(Graph::RouterStrategy strategy) {
+  switch (strategy) {
+  case Graph::RouterStrategy::DIJKSTRA:
+    return GraphProto::Router::DIJKSTRA;
+  case Graph::RouterStrategy::CONTRACTION_HIERARCHIES:
+    return GraphProto::Router::CONTRACTION_HIERARCHIES;
+  default:
+    return GraphProto::Router::ALL_PAIRS;
+  }
+}
+
+Graph::RouterStrategy DeserializeStrategy(GraphProto::Router::Strategy proto) {
+  switch (proto) {
+  case GraphProto::Router::DIJKSTRA:
+    return Graph::RouterStrategy::DIJKSTRA;
+  case GraphProto::Router::CONTRACTION_HIERARCHIES:
+    return Graph::RouterStrategy::CONTRACTION_HIERARCHIES;
+  default:
+    return Graph::RouterStrategy::ALL_PAIRS;
+  }
+}
+
 template<>
 GraphProto::Router Graph::Router<double>::Serialize() const {
   GraphProto::Router proto;
-  for (const auto& source_data : routes_internal_data_) {
-    auto& source_data_proto = *proto.add_sources_data();
-    for (const auto& route_data : source_data) {
-      auto& route_data_proto = *source_data_proto.add_targets_data();
-      if (route_data) {
-        route_data_proto.set_exists(true);
-        route_data_proto.set_weight(route_data->weight);
-        if (route_data->prev_edge) {
-          route_data_proto.set_has_prev_edge(true);
-          route_data_proto.set_prev_edge(*route_data->prev_edge);
-        }
-      }
-    }
+  proto.set_strategy(SerializeStrategy(strategy_));
+  if (hierarchy_) {
+    (*proto.mutable_hierarchy()) = hierarchy_->Serialize();
   }
+  proto.set_vertex_count(routes_internal_data_.vertex_count);
   return proto;
 }
 
 template<>
-Graph::Router<double>::Router(const GraphProto::Router& proto, const Graph& graph) : graph_(graph) {
-  routes_internal_data_.reserve(proto.sources_data_size());
-  for (const auto& source_data_proto : proto.sources_data()) {
-    auto& source_data = routes_internal_data_.emplace_back();
-    source_data.reserve(source_data_proto.targets_data_size());
-    for (const auto& route_data_proto : source_data_proto.targets_data()) {
-      auto& route_data = source_data.emplace_back();
-      if (route_data_proto.exists()) {
-        route_data = RouteInternalData{ route_data_proto.weight(), std::nullopt };
-        if (route_data_proto.has_prev_edge()) {
-          route_data->prev_edge = route_data_proto.prev_edge();
-        }
-      }
-    }
+Graph::Router<double>::Router(const GraphProto::Router& proto, const Graph& graph, RouteMatrixView matrix)
+  : graph_(graph),
+  strategy_(DeserializeStrategy(proto.strategy()))
+{
+  if (strategy_ == RouterStrategy::CONTRACTION_HIERARCHIES) {
+    hierarchy_ = make_unique<ContractionHierarchy<double>>(proto.hierarchy(), graph);
   }
+  routes_internal_data_.vertex_count = proto.vertex_count();
+  routes_internal_data_.view = matrix;
 }
 
 
@@ -140,6 +193,22 @@ TCProto::TransportRouter TransportRouter::Serialize() const {
       bus_edge_info_proto.set_finish_stop_idx(bus_edge_info.finish_stop_idx);
       bus_edge_info_proto.set_span_count(bus_edge_info.span_count);
     }
+    else if (holds_alternative<BoardEdgeInfo>(edge_info)) {
+      const auto& board_edge_info = get<BoardEdgeInfo>(edge_info);
+      auto& board_edge_info_proto = *edge_info_proto.mutable_board_data();
+      board_edge_info_proto.set_bus_name(board_edge_info.bus_name);
+      board_edge_info_proto.set_stop_idx(board_edge_info.stop_idx);
+      board_edge_info_proto.set_distance(board_edge_info.distance);
+    }
+    else if (holds_alternative<RideEdgeInfo>(edge_info)) {
+      edge_info_proto.mutable_ride_data();
+    }
+    else if (holds_alternative<AlightEdgeInfo>(edge_info)) {
+      const auto& alight_edge_info = get<AlightEdgeInfo>(edge_info);
+      auto& alight_edge_info_proto = *edge_info_proto.mutable_alight_data();
+      alight_edge_info_proto.set_stop_idx(alight_edge_info.stop_idx);
+      alight_edge_info_proto.set_distance(alight_edge_info.distance);
+    }
     else {
       edge_info_proto.mutable_wait_data();
     }
@@ -147,13 +216,24 @@ TCProto::TransportRouter TransportRouter::Serialize() const {
   return proto;
 }
 
-TransportRouter::TransportRouter(const TCProto::TransportRouter& proto) {
+void TransportRouter::SerializeRouteMatrix(BaseFile::Writer& writer) const {
+  const auto matrix = router_->GetRouteMatrix();
+  const size_t cell_count = matrix.weights ? graph_.GetVertexCount() * graph_.GetVertexCount() : 0;
+  writer.AddArraySection(BaseFile::Section::ROUTE_WEIGHTS, matrix.weights, cell_count);
+  writer.AddArraySection(BaseFile::Section::ROUTE_PREV_EDGES, matrix.prev_edges, cell_count);
+}
+
+TransportRouter::TransportRouter(const TCProto::TransportRouter& proto, const BaseFile::Reader& base) {
   routing_settings_.bus_wait_time = proto.routing_settings().bus_wait_time();
   routing_settings_.bus_velocity = proto.routing_settings().bus_velocity();
   routing_settings_.pedestrian_velocity = proto.routing_settings().pedestrian_velocity();
 
   graph_ = Graph::DirectedWeightedGraph<double>(proto.graph());
-  router_ = make_unique<Router>(proto.router(), graph_);
+  const size_t cell_count = static_cast<size_t>(proto.router().vertex_count()) * proto.router().vertex_count();
+  router_ = make_unique<Router>(proto.router(), graph_, Router::RouteMatrixView{
+      base.GetArraySection<double>(BaseFile::Section::ROUTE_WEIGHTS, cell_count),
+      base.GetArraySection<Router::PrevEdgeId>(BaseFile::Section::ROUTE_PREV_EDGES, cell_count),
+    });
 
   for (const auto& stop_vertex_ids_proto : proto.stops_vertex_ids()) {
     stops_vertex_ids_[stop_vertex_ids_proto.name()] = {
@@ -179,6 +259,24 @@ TransportRouter::TransportRouter(const TCProto::TransportRouter& proto) {
           bus_info_proto.span_count()
       };
     }
+    else if (edge_info_proto.has_board_data()) {
+      const auto& board_info_proto = edge_info_proto.board_data();
+      edge_info = BoardEdgeInfo{
+          board_info_proto.bus_name(),
+          board_info_proto.stop_idx(),
+          board_info_proto.distance()
+      };
+    }
+    else if (edge_info_proto.has_ride_data()) {
+      edge_info = RideEdgeInfo{};
+    }
+    else if (edge_info_proto.has_alight_data()) {
+      const auto& alight_info_proto = edge_info_proto.alight_data();
+      edge_info = AlightEdgeInfo{
+          alight_info_proto.stop_idx(),
+          alight_info_proto.distance()
+      };
+    }
     else {
       edge_info = WaitEdgeInfo{};
     }
@@ -384,13 +482,14 @@ std::unordered_map<std::string, Svg::Color> DeserializeBusColors(const TCProto::
   return result;
 }
 
-Paint::Painter::Painter(const TCProto::Painter& proto) 
+Paint::Painter::Painter(const TCProto::Painter& proto, optional<string> base_map_svg)
   : settings_(DeserializeSettings(proto)),
   buses_dict_(make_shared<Descriptions::BusesDict>(DeserializeBusesDict(proto))),
   stops_dict_(make_shared<Descriptions::StopsDict>(DeserializeStopsDict(proto))),
   places_coords_(DeserialzieStopsCoords(proto)),
   bus_colors_(DeserializeBusColors(proto)),
-  base_map_(MakeDocument()) {}
+  tile_index_(BuildTileIndex()),
+  base_map_svg_(CheckBaseMap(base_map_svg ? move(*base_map_svg) : RenderDocument(MakeDocument()))) {}
 
 
 /* COMPANIES_CATALOG SERIALIZATION */
@@ -422,9 +521,52 @@ CompaniesCatalog::CompaniesCatalog(const YellowPages::Database& proto)
 }
 
 
+/* GEO_INDEX SERIALIZATION */
+
+TCProto::GeoIndex GeoIndex::Serialize() const {
+  TCProto::GeoIndex proto;
+  proto.set_min_latitude(min_latitude_);
+  proto.set_min_longitude(min_longitude_);
+  proto.set_cell_latitude(cell_latitude_);
+  proto.set_cell_longitude(cell_longitude_);
+  proto.set_rows(rows_);
+  proto.set_cols(cols_);
+  for (const string& name : names_) {
+    proto.add_names(name);
+  }
+  return proto;
+}
+
+GeoIndex::GeoIndex(const TCProto::GeoIndex& proto, ArraysView arrays)
+  : min_latitude_(proto.min_latitude()),
+  min_longitude_(proto.min_longitude()),
+  cell_latitude_(proto.cell_latitude()),
+  cell_longitude_(proto.cell_longitude()),
+  rows_(proto.rows()),
+  cols_(proto.cols()),
+  names_(proto.names().begin(), proto.names().end()),
+  view_(arrays)
+{
+  if (rows_ == 0 || cols_ == 0) {
+    throw runtime_error("Cannot parse base file geo index");
+  }
+  ComputeMinCellSide();
+}
+
+// An index is stored as the proto and two arrays in sections of its own
+static void SerializeGeoIndex(const GeoIndex& index, BaseFile::Writer& writer,
+  BaseFile::Section index_section, BaseFile::Section cells_section, BaseFile::Section positions_section) {
+  writer.AddSection(index_section, index.Serialize().SerializeAsString());
+  const auto arrays = index.GetArrays();
+  writer.AddArraySection(cells_section, arrays.cell_starts, index.GetCellCount() + 1);
+  writer.AddArraySection(positions_section, arrays.positions, index.GetPlaceCount());
+}
+
+
 /* TRANSPORT_CATALOG SERIALIZATION */
 
 void TransportCatalog::Serialize(ostream& os) const {
+  BaseFile::Writer writer;
   TCProto::TransportCatalog db_proto;
   for (const auto& [name, stop] : stops_) {
     TCProto::StopResponse& stop_proto = *db_proto.add_stops();
@@ -443,33 +585,130 @@ void TransportCatalog::Serialize(ostream& os) const {
     bus_proto.set_geo_route_length(bus.geo_route_length);
   }
 
-  (*db_proto.mutable_router()) = router_->Serialize();
-  (*db_proto.mutable_painter()) = painter_->Serialize();
-  (*db_proto.mutable_companies()) = companies_->Serialize();
+  writer.AddSection(BaseFile::Section::CATALOG, db_proto.SerializeAsString());
+  writer.AddSection(BaseFile::Section::ROUTER, router_->Serialize().SerializeAsString());
+  router_->SerializeRouteMatrix(writer);
+  writer.AddSection(BaseFile::Section::PAINTER, painter_->Serialize().SerializeAsString());
+  writer.AddSection(BaseFile::Section::BASE_MAP, painter_->PaintMap());
+  writer.AddSection(BaseFile::Section::COMPANIES, companies_->Serialize().SerializeAsString());
+  SerializeGeoIndex(stops_geo_index_.Get(), writer, BaseFile::Section::STOPS_GEO_INDEX,
+    BaseFile::Section::STOPS_GEO_CELLS, BaseFile::Section::STOPS_GEO_POSITIONS);
+  SerializeGeoIndex(companies_geo_index_.Get(), writer, BaseFile::Section::COMPANIES_GEO_INDEX,
+    BaseFile::Section::COMPANIES_GEO_CELLS, BaseFile::Section::COMPANIES_GEO_POSITIONS);
+  writer.Write(os);
+}
+
+// Parses the next length-delimited sub-message of the stream
+template <typename Proto>
+Proto ReadNestedMessage(google::protobuf::io::CodedInputStream& input) {
+  Proto proto;
+  uint32_t length;
+  if (!input.ReadVarint32(&length)) {
+    throw runtime_error("Cannot parse base file catalog");
+  }
+  const auto limit = input.PushLimit(length);
+  if (!proto.MergeFromCodedStream(&input) || !input.ConsumedEntireMessage()) {
+    throw runtime_error("Cannot parse base file catalog");
+  }
+  input.PopLimit(limit);
+  return proto;
+}
 
-  db_proto.SerializeToOstream(&os);
+template <typename Proto>
+Proto ParseSection(const BaseFile::Reader& base, BaseFile::Section section) {
+  Proto proto;
+  const string_view data = base.GetSection(section);
+  if (!proto.ParseFromArray(data.data(), data.size())) {
+    throw runtime_error("Cannot parse base file section " + to_string(static_cast<uint32_t>(section)));
+  }
+  return proto;
 }
 
-TransportCatalog::TransportCatalog(istream& is) {
-  TCProto::TransportCatalog proto;
-  proto.ParseFromIstream(&is);
+static unique_ptr<GeoIndex> LoadGeoIndex(const BaseFile::Reader& base,
+  BaseFile::Section index_section, BaseFile::Section cells_section, BaseFile::Section positions_section) {
+  const auto proto = ParseSection<TCProto::GeoIndex>(base, index_section);
+  const size_t cell_count = static_cast<size_t>(proto.rows()) * proto.cols();
+  return make_unique<GeoIndex>(proto, GeoIndex::ArraysView{
+      base.GetArraySection<uint32_t>(cells_section, cell_count + 1),
+      base.GetArraySection<Sphere::Point>(positions_section, proto.names_size()),
+    });
+}
 
-  for (const TCProto::StopResponse& stop_proto : proto.stops()) {
-    Stop& stop = stops_[stop_proto.name()];
-    for (const string& bus_name : stop_proto.bus_names()) {
-      stop.bus_names.insert(bus_name);
+// Stops and buses are parsed right from the mapped file one by one, so the catalog
+// proto is never materialized as a whole. The other components are parsed
+// from their own sections only when a request needs them.
+TransportCatalog::TransportCatalog(const string& base_file_name)
+  : base_(make_unique<BaseFile::Reader>(base_file_name))
+{
+  using google::protobuf::internal::WireFormatLite;
+  const string_view catalog_data = base_->GetSection(BaseFile::Section::CATALOG);
+  google::protobuf::io::ArrayInputStream stream(catalog_data.data(), catalog_data.size());
+  google::protobuf::io::CodedInputStream input(&stream);
+
+  while (const uint32_t tag = input.ReadTag()) {
+    if (WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+      if (!WireFormatLite::SkipField(&input, tag)) {
+        throw runtime_error("Cannot parse base file catalog");
+      }
+      continue;
+    }
+    switch (WireFormatLite::GetTagFieldNumber(tag)) {
+    case TCProto::TransportCatalog::kStopsFieldNumber: {
+      const auto stop_proto = ReadNestedMessage<TCProto::StopResponse>(input);
+      Stop& stop = stops_[stop_proto.name()];
+      for (const string& bus_name : stop_proto.bus_names()) {
+        stop.bus_names.insert(bus_name);
+      }
+      break;
+    }
+    case TCProto::TransportCatalog::kBusesFieldNumber: {
+      const auto bus_proto = ReadNestedMessage<TCProto::BusResponse>(input);
+      Bus& bus = buses_[bus_proto.name()];
+      bus.stop_count = bus_proto.stop_count();
+      bus.unique_stop_count = bus_proto.unique_stop_count();
+      bus.road_route_length = bus_proto.road_route_length();
+      bus.geo_route_length = bus_proto.geo_route_length();
+      break;
+    }
+    default:
+      if (!WireFormatLite::SkipField(&input, tag)) {
+        throw runtime_error("Cannot parse base file catalog");
+      }
     }
   }
-
-  for (const TCProto::BusResponse& bus_proto : proto.buses()) {
-    Bus& bus = buses_[bus_proto.name()];
-    bus.stop_count = bus_proto.stop_count();
-    bus.unique_stop_count = bus_proto.unique_stop_count();
-    bus.road_route_length = bus_proto.road_route_length();
-    bus.geo_route_length = bus_proto.geo_route_length();
+  if (!input.ConsumedEntireMessage()) {
+    throw runtime_error("Cannot parse base file catalog");
   }
 
-  router_ = make_unique<TransportRouter>(proto.router());
-  painter_ = make_unique<Paint::Painter>(proto.painter());
-  companies_ = make_unique<CompaniesCatalog>(proto.companies());
-}
\ No newline at end of file
+  const BaseFile::Reader& base = *base_;
+  router_.SetFactory([&base] {
+    return make_unique<TransportRouter>(ParseSection<TCProto::TransportRouter>(base, BaseFile::Section::ROUTER), base);
+  });
+  painter_.SetFactory([&base] {
+    optional<string> base_map_svg;
+    if (base.HasSection(BaseFile::Section::BASE_MAP)) {
+      base_map_svg = string(base.GetSection(BaseFile::Section::BASE_MAP));
+    }
+    return make_unique<Paint::Painter>(ParseSection<TCProto::Painter>(base, BaseFile::Section::PAINTER), move(base_map_svg));
+  });
+  companies_.SetFactory([&base] {
+    return make_unique<CompaniesCatalog>(ParseSection<YellowPages::Database>(base, BaseFile::Section::COMPANIES));
+  });
+  // Bases written before the geo indexes were added lack their sections;
+  // for them the indexes are built from the painter's stops and the companies
+  stops_geo_index_.SetFactory([&base] {
+    if (!base.HasSection(BaseFile::Section::STOPS_GEO_INDEX)) {
+      const auto stops_dict = DeserializeStopsDict(ParseSection<TCProto::Painter>(base, BaseFile::Section::PAINTER));
+      return make_unique<GeoIndex>(CollectStopPlaces(stops_dict));
+    }
+    return LoadGeoIndex(base, BaseFile::Section::STOPS_GEO_INDEX,
+      BaseFile::Section::STOPS_GEO_CELLS, BaseFile::Section::STOPS_GEO_POSITIONS);
+  });
+  companies_geo_index_.SetFactory([this, &base] {
+    if (!base.HasSection(BaseFile::Section::COMPANIES_GEO_INDEX)) {
+      return make_unique<GeoIndex>(CollectCompanyPlaces(companies_->GetCompanies()));
+    }
+    return LoadGeoIndex(base, BaseFile::Section::COMPANIES_GEO_INDEX,
+      BaseFile::Section::COMPANIES_GEO_CELLS, BaseFile::Section::COMPANIES_GEO_POSITIONS);
+  });
+}
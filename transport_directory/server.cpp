@@ -0,0 +1,376 @@
+#include "server.h"
+#include "json.h"
+#include "json_writer.h"
+#include "requests.h"
+
+#include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#ifndef _WIN32
+#include <csignal>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace Server {
+
+  namespace {
+    // Responses may come out of order, so an error carries the id of its request when it is known
+    string MakeErrorResponse(optional<int> request_id, string_view message) {
+      string response;
+      Json::Writer out(response);
+      out.BeginObject();
+      if (request_id) {
+        out.Key("request_id").Value(*request_id);
+      }
+      out.Key("error_message").Value(message).EndObject();
+      return response;
+    }
+
+    optional<int> FindRequestId(const Json::Node& request) {
+      const auto* attrs = get_if<Json::Dict>(&request.GetBase());
+      if (!attrs) {
+        return nullopt;
+      }
+      const auto it = attrs->find("id");
+      if (it == attrs->end() || !holds_alternative<int>(it->second.GetBase())) {
+        return nullopt;
+      }
+      return it->second.AsInt();
+    }
+
+    // Errors of the input and of the base are told as they are. Those of the
+    // standard library, such as a missing key or a value of a wrong type, would
+    // only tell the client names like "unordered_map::at".
+    string_view DescribeError(const exception& error) {
+      return dynamic_cast<const runtime_error*>(&error) ? error.what() : "Invalid request";
+    }
+
+    bool IsReload(const Json::Node& request) {
+      const auto* attrs = get_if<Json::Dict>(&request.GetBase());
+      if (!attrs) {
+        return false;
+      }
+      const auto it = attrs->find("type");
+      return it != attrs->end() && holds_alternative<string>(it->second.GetBase()) && it->second.AsString() == "Reload";
+    }
+
+    void Reload(CatalogHolder& catalog, const Json::Dict& request, Json::Writer& out) {
+      const int request_id = request.at("id").AsInt();
+      if (const auto it = request.find("file"); it != request.end()) {
+        catalog.Reload(it->second.AsString());
+      } else {
+        catalog.Reload();
+      }
+      out.BeginObject()
+        .Key("request_id").Value(request_id)
+        .Key("reloaded").Value(true)
+        .EndObject();
+    }
+
+    string HandleRequest(CatalogHolder& catalog, const Json::Node& request) {
+      string response;
+      try {
+        Json::Writer out(response);
+        if (IsReload(request)) {
+          Reload(catalog, request.AsMap(), out);
+        } else {
+          // The snapshot keeps the catalog alive even if a reload happens meanwhile
+          const auto db = catalog.Get();
+          Requests::ProcessOne(*db, request, out);
+        }
+      } catch (const exception& error) {
+        response = MakeErrorResponse(FindRequestId(request), DescribeError(error));
+      }
+      return response;
+    }
+  }
+
+  string HandleLine(CatalogHolder& catalog, string_view line) {
+    try {
+      return HandleRequest(catalog, Json::Load(line).GetRoot());
+    } catch (const exception& error) {
+      return MakeErrorResponse(nullopt, DescribeError(error));
+    }
+  }
+
+  namespace {
+    bool IsBlank(string_view line) {
+      return line.find_first_not_of(" \t\r") == string_view::npos;
+    }
+  }
+
+  // A reload runs in a thread of its own while the next lines are answered
+  // with the old catalog, so its response may come after theirs. The holder
+  // runs reloads one at a time.
+  void ServePipe(CatalogHolder& catalog, istream& input, ostream& output) {
+    mutex output_mutex;
+    auto print = [&output, &output_mutex](const string& response) {
+      lock_guard lock(output_mutex);
+      output << response << endl;
+    };
+
+    vector<thread> reload_threads;
+    string line;
+    while (getline(input, line)) {
+      if (IsBlank(line)) {
+        continue;
+      }
+      optional<Json::Document> request;
+      try {
+        request.emplace(Json::Load(line));
+      } catch (const exception& error) {
+        print(MakeErrorResponse(nullopt, DescribeError(error)));
+        continue;
+      }
+      if (!IsReload(request->GetRoot())) {
+        print(HandleRequest(catalog, request->GetRoot()));
+        continue;
+      }
+      reload_threads.emplace_back([&catalog, &print, request = move(*request)] {
+        print(HandleRequest(catalog, request.GetRoot()));
+      });
+    }
+    for (thread& reload_thread : reload_threads) {
+      reload_thread.join();
+    }
+  }
+
+#ifdef _WIN32
+  void ServeUnixSocket(CatalogHolder&, const string&, size_t) {
+    throw runtime_error("Unix socket server is not supported on this platform");
+  }
+#else
+  namespace {
+
+    // A client that sends this much without a newline is disconnected,
+    // so a line never makes the server buffer without limit
+    constexpr size_t MAX_LINE_SIZE = 1 << 20;
+
+    // Lines read from a connection wait here for a worker. A connection is
+    // taken by one worker at a time, so its responses keep the order of its
+    // requests, and it holds no worker while it has nothing to answer.
+    struct Connection {
+      explicit Connection(int fd) : fd(fd) {}
+      ~Connection() {
+        close(fd);
+      }
+
+      const int fd;
+      string partial_line;  // read by the polling thread only
+
+      mutex lines_mutex;
+      deque<string> lines;
+      bool is_line_too_long = false;
+      bool is_scheduled = false;
+      bool is_broken = false;
+    };
+
+    // Connections with lines to answer and no worker yet
+    class ConnectionQueue {
+    public:
+      void Push(shared_ptr<Connection> connection) {
+        {
+          lock_guard lock(mutex_);
+          connections_.push(move(connection));
+        }
+        ready_.notify_one();
+      }
+
+      shared_ptr<Connection> Pop() {
+        unique_lock lock(mutex_);
+        ready_.wait(lock, [this] { return !connections_.empty(); });
+        auto connection = move(connections_.front());
+        connections_.pop();
+        return connection;
+      }
+
+    private:
+      mutex mutex_;
+      condition_variable ready_;
+      queue<shared_ptr<Connection>> connections_;
+    };
+
+    bool WriteAll(int fd, string_view data) {
+      while (!data.empty()) {
+        const ssize_t written = write(fd, data.data(), data.size());
+        if (written <= 0) {
+          return false;
+        }
+        data.remove_prefix(written);
+      }
+      return true;
+    }
+
+    bool AnswerLine(CatalogHolder& catalog, int fd, string_view line) {
+      return IsBlank(line) || WriteAll(fd, HandleLine(catalog, line) + '\n');
+    }
+
+    void AddLines(ConnectionQueue& ready, const shared_ptr<Connection>& connection,
+                  vector<string> lines, bool is_line_too_long) {
+      {
+        lock_guard lock(connection->lines_mutex);
+        if (connection->is_broken) {
+          return;
+        }
+        move(lines.begin(), lines.end(), back_inserter(connection->lines));
+        connection->is_line_too_long = is_line_too_long;
+        if (connection->is_scheduled || (connection->lines.empty() && !is_line_too_long)) {
+          return;
+        }
+        connection->is_scheduled = true;
+      }
+      ready.Push(connection);
+    }
+
+    // Answers the queued lines until there are none left
+    void ServeConnection(CatalogHolder& catalog, Connection& connection) {
+      while (true) {
+        string line;
+        bool is_line_too_long = false;
+        {
+          lock_guard lock(connection.lines_mutex);
+          if (connection.lines.empty()) {
+            connection.is_scheduled = false;
+            if (!connection.is_line_too_long) {
+              return;
+            }
+            connection.is_broken = is_line_too_long = true;
+          } else {
+            line = move(connection.lines.front());
+            connection.lines.pop_front();
+          }
+        }
+        if (is_line_too_long) {
+          WriteAll(connection.fd, MakeErrorResponse(nullopt, "Request line is too long") + '\n');
+          shutdown(connection.fd, SHUT_RDWR);
+          return;
+        }
+        if (!AnswerLine(catalog, connection.fd, line)) {
+          lock_guard lock(connection.lines_mutex);
+          connection.is_broken = true;
+          connection.is_scheduled = false;
+          connection.lines.clear();
+          shutdown(connection.fd, SHUT_RDWR);
+          return;
+        }
+      }
+    }
+
+    // Reads what has arrived and queues the complete lines. Returns false
+    // when the connection is done: closed, failed or sending too long a line.
+    bool ReadLines(ConnectionQueue& ready, const shared_ptr<Connection>& connection) {
+      char buffer[1 << 16];
+      const ssize_t size = read(connection->fd, buffer, sizeof(buffer));
+      string& pending = connection->partial_line;
+      if (size <= 0) {
+        if (size < 0 && errno == EINTR) {
+          return true;
+        }
+        // The last line may lack the newline
+        AddLines(ready, connection, { move(pending) }, false);
+        return false;
+      }
+
+      pending.append(buffer, size);
+      vector<string> lines;
+      size_t line_begin = 0;
+      for (size_t line_end; (line_end = pending.find('\n', line_begin)) != string::npos; line_begin = line_end + 1) {
+        lines.push_back(pending.substr(line_begin, line_end - line_begin));
+      }
+      pending.erase(0, line_begin);
+      const bool is_line_too_long = pending.size() > MAX_LINE_SIZE;
+      AddLines(ready, connection, move(lines), is_line_too_long);
+      return !is_line_too_long;
+    }
+
+    // Waits for new connections and for requests on all the open ones
+    void PollConnections(int listen_fd, ConnectionQueue& ready) {
+      vector<shared_ptr<Connection>> connections;
+      vector<pollfd> fds;
+      while (true) {
+        fds.assign(1, pollfd{ listen_fd, POLLIN, 0 });
+        for (const auto& connection : connections) {
+          fds.push_back(pollfd{ connection->fd, POLLIN, 0 });
+        }
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          return;
+        }
+
+        // A dropped connection is closed when its worker lets it go too
+        size_t kept_count = 0;
+        for (size_t idx = 0; idx < connections.size(); ++idx) {
+          if (fds[idx + 1].revents == 0 || ReadLines(ready, connections[idx])) {
+            connections[kept_count++] = move(connections[idx]);
+          }
+        }
+        connections.resize(kept_count);
+
+        if (fds[0].revents & POLLIN) {
+          const int fd = accept(listen_fd, nullptr, nullptr);
+          if (fd >= 0) {
+            connections.push_back(make_shared<Connection>(fd));
+          } else if (errno != EINTR && errno != ECONNABORTED) {
+            return;
+          }
+        }
+      }
+    }
+
+  }
+
+  void ServeUnixSocket(CatalogHolder& catalog, const string& socket_path, size_t thread_count) {
+    sockaddr_un address = {};
+    address.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+      throw runtime_error("Socket path is too long: " + socket_path);
+    }
+    socket_path.copy(address.sun_path, socket_path.size());
+
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+      throw runtime_error("Cannot create socket");
+    }
+    unlink(socket_path.c_str());
+    if (bind(listen_fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0
+        || listen(listen_fd, SOMAXCONN) < 0) {
+      close(listen_fd);
+      throw runtime_error("Cannot listen on " + socket_path);
+    }
+    // A client that disconnects early must not kill the server
+    signal(SIGPIPE, SIG_IGN);
+
+    // The workers never finish, as the server lives until the process ends
+    static ConnectionQueue ready;
+    for (size_t i = 0; i < thread_count; ++i) {
+      thread([&catalog] {
+        while (true) {
+          ServeConnection(catalog, *ready.Pop());
+        }
+      }).detach();
+    }
+
+    PollConnections(listen_fd, ready);
+    close(listen_fd);
+    throw runtime_error("Cannot accept connections on " + socket_path);
+  }
+#endif
+
+}
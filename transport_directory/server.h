@@ -0,0 +1,27 @@
+#pragma once
+
+#include "catalog_holder.h"
+
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// Resident mode: the catalog is loaded once and then answers stat requests as
+// newline-delimited JSON, one response line per request line. Requests that
+// fail are answered with {"error_message": ...} instead of stopping the server.
+// {"type": "Reload", "id": N, "file": "..."} swaps in a new base without
+// stopping; without "file" the current base file is read again.
+namespace Server {
+
+  // Returns the response line for one request line, without the newline
+  std::string HandleLine(CatalogHolder& catalog, std::string_view line);
+
+  // Answers the lines of input until it ends
+  void ServePipe(CatalogHolder& catalog, std::istream& input, std::ostream& output);
+
+  // Listens on a Unix domain socket. The calling thread reads all connections
+  // and thread_count workers answer the lines read, so an idle client holds
+  // no worker. A line over 1 MiB closes its connection. Never returns normally.
+  void ServeUnixSocket(CatalogHolder& catalog, const std::string& socket_path, size_t thread_count);
+
+}
@@ -24,15 +24,14 @@ namespace Sphere {
     return lhs.longitude < rhs.longitude;
   }
 
-  const double EARTH_RADIUS = 6'371'000;
-
   double Distance(Point lhs, Point rhs) {
     lhs = Point::FromDegrees(lhs.latitude, lhs.longitude);
     rhs = Point::FromDegrees(rhs.latitude, rhs.longitude);
-    return acos(
+    // Rounding may take the cosine of equal points a bit over 1
+    return acos(min(1.0,
       sin(lhs.latitude) * sin(rhs.latitude)
       + cos(lhs.latitude) * cos(rhs.latitude) * cos(abs(lhs.longitude - rhs.longitude))
-    ) * EARTH_RADIUS;
+    )) * EARTH_RADIUS;
   }
 
 
@@ -5,6 +5,8 @@
 #include <algorithm>
 
 namespace Sphere {
+  const double EARTH_RADIUS = 6'371'000;
+
   double ConvertDegreesToRadians(double degrees);
 
   struct Point {
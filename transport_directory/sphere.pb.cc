@@ -14,65 +14,69 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-namespace SphereProto {
-class CoordsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Coords> _instance;
-} _Coords_default_instance_;
-}  // namespace SphereProto
-static void InitDefaultsscc_info_Coords_sphere_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::SphereProto::_Coords_default_instance_;
-    new (ptr) ::SphereProto::Coords();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Coords_sphere_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Coords_sphere_2eproto}, {}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_sphere_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_sphere_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_sphere_2eproto = nullptr;
+namespace SphereProto {
+PROTOBUF_CONSTEXPR Coords::Coords(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.lat_)*/0
+  , /*decltype(_impl_.lon_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CoordsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CoordsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CoordsDefaultTypeInternal() {}
+  union {
+    Coords _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CoordsDefaultTypeInternal _Coords_default_instance_;
+}  // namespace SphereProto
+static ::_pb::Metadata file_level_metadata_sphere_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_sphere_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_sphere_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_sphere_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_sphere_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::SphereProto::Coords, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::SphereProto::Coords, lat_),
-  PROTOBUF_FIELD_OFFSET(::SphereProto::Coords, lon_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::SphereProto::Coords, _impl_.lat_),
+  PROTOBUF_FIELD_OFFSET(::SphereProto::Coords, _impl_.lon_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::SphereProto::Coords)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::SphereProto::Coords)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::SphereProto::_Coords_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::SphereProto::_Coords_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_sphere_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\014sphere.proto\022\013SphereProto\"\"\n\006Coords\022\013\n"
   "\003lat\030\001 \001(\001\022\013\n\003lon\030\002 \001(\001b\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_sphere_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_sphere_2eproto_sccs[1] = {
-  &scc_info_Coords_sphere_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_sphere_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sphere_2eproto = {
-  false, false, descriptor_table_protodef_sphere_2eproto, "sphere.proto", 71,
-  &descriptor_table_sphere_2eproto_once, descriptor_table_sphere_2eproto_sccs, descriptor_table_sphere_2eproto_deps, 1, 0,
-  schemas, file_default_instances, TableStruct_sphere_2eproto::offsets,
-  file_level_metadata_sphere_2eproto, 1, file_level_enum_descriptors_sphere_2eproto, file_level_service_descriptors_sphere_2eproto,
+static ::_pbi::once_flag descriptor_table_sphere_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_sphere_2eproto = {
+    false, false, 71, descriptor_table_protodef_sphere_2eproto,
+    "sphere.proto",
+    &descriptor_table_sphere_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_sphere_2eproto::offsets,
+    file_level_metadata_sphere_2eproto, file_level_enum_descriptors_sphere_2eproto,
+    file_level_service_descriptors_sphere_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_sphere_2eproto_getter() {
+  return &descriptor_table_sphere_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_sphere_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_sphere_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_sphere_2eproto(&descriptor_table_sphere_2eproto);
 namespace SphereProto {
 
 // ===================================================================
@@ -81,128 +85,140 @@ class Coords::_Internal {
  public:
 };
 
-Coords::Coords(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Coords::Coords(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:SphereProto.Coords)
 }
 Coords::Coords(const Coords& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Coords* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lat_){}
+    , decltype(_impl_.lon_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&lat_, &from.lat_,
-    static_cast<size_t>(reinterpret_cast<char*>(&lon_) -
-    reinterpret_cast<char*>(&lat_)) + sizeof(lon_));
+  ::memcpy(&_impl_.lat_, &from._impl_.lat_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lon_) -
+    reinterpret_cast<char*>(&_impl_.lat_)) + sizeof(_impl_.lon_));
   // @@protoc_insertion_point(copy_constructor:SphereProto.Coords)
 }
 
-void Coords::SharedCtor() {
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&lat_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&lon_) -
-      reinterpret_cast<char*>(&lat_)) + sizeof(lon_));
+inline void Coords::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lat_){0}
+    , decltype(_impl_.lon_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Coords::~Coords() {
   // @@protoc_insertion_point(destructor:SphereProto.Coords)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Coords::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void Coords::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void Coords::ArenaDtor(void* object) {
-  Coords* _this = reinterpret_cast< Coords* >(object);
-  (void)_this;
-}
-void Coords::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Coords::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Coords& Coords::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Coords_sphere_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Coords::Clear() {
 // @@protoc_insertion_point(message_clear_start:SphereProto.Coords)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&lat_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&lon_) -
-      reinterpret_cast<char*>(&lat_)) + sizeof(lon_));
+  ::memset(&_impl_.lat_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lon_) -
+      reinterpret_cast<char*>(&_impl_.lat_)) + sizeof(_impl_.lon_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Coords::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Coords::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // double lat = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double lon = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
-          lon_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.lon_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Coords::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Coords::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:SphereProto.Coords)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // double lat = 1;
-  if (!(this->lat() <= 0 && this->lat() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lat = this->_internal_lat();
+  uint64_t raw_lat;
+  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
+  if (raw_lat != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(1, this->_internal_lat(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_lat(), target);
   }
 
   // double lon = 2;
-  if (!(this->lon() <= 0 && this->lon() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lon = this->_internal_lon();
+  uint64_t raw_lon;
+  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
+  if (raw_lon != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_lon(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_lon(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:SphereProto.Coords)
@@ -213,64 +229,61 @@ size_t Coords::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:SphereProto.Coords)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // double lat = 1;
-  if (!(this->lat() <= 0 && this->lat() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lat = this->_internal_lat();
+  uint64_t raw_lat;
+  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
+  if (raw_lat != 0) {
     total_size += 1 + 8;
   }
 
   // double lon = 2;
-  if (!(this->lon() <= 0 && this->lon() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lon = this->_internal_lon();
+  uint64_t raw_lon;
+  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
+  if (raw_lon != 0) {
     total_size += 1 + 8;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Coords::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:SphereProto.Coords)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Coords* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Coords>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:SphereProto.Coords)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:SphereProto.Coords)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Coords::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Coords::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Coords::GetClassData() const { return &_class_data_; }
 
-void Coords::MergeFrom(const Coords& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:SphereProto.Coords)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Coords::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Coords*>(&to_msg);
+  auto& from = static_cast<const Coords&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:SphereProto.Coords)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.lat() <= 0 && from.lat() >= 0)) {
-    _internal_set_lat(from._internal_lat());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lat = from._internal_lat();
+  uint64_t raw_lat;
+  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
+  if (raw_lat != 0) {
+    _this->_internal_set_lat(from._internal_lat());
   }
-  if (!(from.lon() <= 0 && from.lon() >= 0)) {
-    _internal_set_lon(from._internal_lon());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lon = from._internal_lon();
+  uint64_t raw_lon;
+  memcpy(&raw_lon, &tmp_lon, sizeof(tmp_lon));
+  if (raw_lon != 0) {
+    _this->_internal_set_lon(from._internal_lon());
   }
-}
-
-void Coords::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:SphereProto.Coords)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Coords::CopyFrom(const Coords& from) {
@@ -286,24 +299,26 @@ bool Coords::IsInitialized() const {
 
 void Coords::InternalSwap(Coords* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Coords, lon_)
-      + sizeof(Coords::lon_)
-      - PROTOBUF_FIELD_OFFSET(Coords, lat_)>(
-          reinterpret_cast<char*>(&lat_),
-          reinterpret_cast<char*>(&other->lat_));
+      PROTOBUF_FIELD_OFFSET(Coords, _impl_.lon_)
+      + sizeof(Coords::_impl_.lon_)
+      - PROTOBUF_FIELD_OFFSET(Coords, _impl_.lat_)>(
+          reinterpret_cast<char*>(&_impl_.lat_),
+          reinterpret_cast<char*>(&other->_impl_.lat_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Coords::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sphere_2eproto_getter, &descriptor_table_sphere_2eproto_once,
+      file_level_metadata_sphere_2eproto[0]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace SphereProto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::SphereProto::Coords* Arena::CreateMaybeMessage< ::SphereProto::Coords >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::SphereProto::Coords*
+Arena::CreateMaybeMessage< ::SphereProto::Coords >(Arena* arena) {
   return Arena::CreateMessageInternal< ::SphereProto::Coords >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
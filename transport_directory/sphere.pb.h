@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -42,20 +41,12 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_sphere_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[1]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sphere_2eproto;
 namespace SphereProto {
 class Coords;
-class CoordsDefaultTypeInternal;
+struct CoordsDefaultTypeInternal;
 extern CoordsDefaultTypeInternal _Coords_default_instance_;
 }  // namespace SphereProto
 PROTOBUF_NAMESPACE_OPEN
@@ -65,11 +56,12 @@ namespace SphereProto {
 
 // ===================================================================
 
-class Coords PROTOBUF_FINAL :
+class Coords final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SphereProto.Coords) */ {
  public:
   inline Coords() : Coords(nullptr) {}
-  virtual ~Coords();
+  ~Coords() override;
+  explicit PROTOBUF_CONSTEXPR Coords(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Coords(const Coords& from);
   Coords(Coords&& from) noexcept
@@ -82,8 +74,13 @@ class Coords PROTOBUF_FINAL :
     return *this;
   }
   inline Coords& operator=(Coords&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -94,13 +91,14 @@ class Coords PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Coords& default_instance() {
+    return *internal_default_instance();
   }
-  static const Coords& default_instance();
-
   static inline const Coords* internal_default_instance() {
     return reinterpret_cast<const Coords*>(
                &_Coords_default_instance_);
@@ -113,7 +111,12 @@ class Coords PROTOBUF_FINAL :
   }
   inline void Swap(Coords* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -121,56 +124,53 @@ class Coords PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Coords* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Coords* New() const final {
-    return CreateMaybeMessage<Coords>(nullptr);
-  }
-
-  Coords* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Coords* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Coords>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Coords& from);
-  void MergeFrom(const Coords& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Coords& from) {
+    Coords::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Coords* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "SphereProto.Coords";
   }
   protected:
-  explicit Coords(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Coords(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_sphere_2eproto);
-    return ::descriptor_table_sphere_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -205,9 +205,12 @@ class Coords PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double lat_;
-  double lon_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    double lat_;
+    double lon_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_sphere_2eproto;
 };
 // ===================================================================
@@ -223,10 +226,10 @@ class Coords PROTOBUF_FINAL :
 
 // double lat = 1;
 inline void Coords::clear_lat() {
-  lat_ = 0;
+  _impl_.lat_ = 0;
 }
 inline double Coords::_internal_lat() const {
-  return lat_;
+  return _impl_.lat_;
 }
 inline double Coords::lat() const {
   // @@protoc_insertion_point(field_get:SphereProto.Coords.lat)
@@ -234,7 +237,7 @@ inline double Coords::lat() const {
 }
 inline void Coords::_internal_set_lat(double value) {
   
-  lat_ = value;
+  _impl_.lat_ = value;
 }
 inline void Coords::set_lat(double value) {
   _internal_set_lat(value);
@@ -243,10 +246,10 @@ inline void Coords::set_lat(double value) {
 
 // double lon = 2;
 inline void Coords::clear_lon() {
-  lon_ = 0;
+  _impl_.lon_ = 0;
 }
 inline double Coords::_internal_lon() const {
-  return lon_;
+  return _impl_.lon_;
 }
 inline double Coords::lon() const {
   // @@protoc_insertion_point(field_get:SphereProto.Coords.lon)
@@ -254,7 +257,7 @@ inline double Coords::lon() const {
 }
 inline void Coords::_internal_set_lon(double value) {
   
-  lon_ = value;
+  _impl_.lon_ = value;
 }
 inline void Coords::set_lon(double value) {
   _internal_set_lon(value);
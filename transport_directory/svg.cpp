@@ -1,30 +1,53 @@
 #include "svg.h"
+#include <charconv>
 #include <iterator>
 
 namespace Svg {
 
-	void RenderColor(std::ostream& out, std::monostate) {
-		out << "none";
+	void RenderNumber(std::string& out, double value, int precision) {
+		char buffer[32];
+		const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, precision);
+		out.append(buffer, result.ptr);
 	}
 
-	void RenderColor(std::ostream& out, const std::string& value) {
-		out << value;
+	static void RenderInt(std::string& out, int value) {
+		char buffer[16];
+		const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+		out.append(buffer, result.ptr);
 	}
 
-	void RenderColor(std::ostream& out, Rgb rgb) {
-		out << "rgb(" << static_cast<int>(rgb.red)
-			<< "," << static_cast<int>(rgb.green)
-			<< "," << static_cast<int>(rgb.blue) << ")";
+	void RenderColor(std::string& out, std::monostate, int) {
+		out += "none";
 	}
 
-	void RenderColor(std::ostream& out, Rgba rgba) {
-		out << "rgba(" << static_cast<int>(rgba.color.red)
-			<< "," << static_cast<int>(rgba.color.green)
-			<< "," << static_cast<int>(rgba.color.blue) << "," << rgba.alpha << ")";
+	void RenderColor(std::string& out, const std::string& value, int) {
+		out += value;
 	}
 
-	void RenderColor(std::ostream& out, const Color& color) {
-		visit([&out](const auto& value) { RenderColor(out, value); },
+	void RenderColor(std::string& out, Rgb rgb, int) {
+		out += "rgb(";
+		RenderInt(out, rgb.red);
+		out += ',';
+		RenderInt(out, rgb.green);
+		out += ',';
+		RenderInt(out, rgb.blue);
+		out += ')';
+	}
+
+	void RenderColor(std::string& out, Rgba rgba, int precision) {
+		out += "rgba(";
+		RenderInt(out, rgba.color.red);
+		out += ',';
+		RenderInt(out, rgba.color.green);
+		out += ',';
+		RenderInt(out, rgba.color.blue);
+		out += ',';
+		RenderNumber(out, rgba.alpha, precision);
+		out += ')';
+	}
+
+	void RenderColor(std::string& out, const Color& color, int precision) {
+		visit([&out, precision](const auto& value) { RenderColor(out, value, precision); },
 			color);
 	}
 
@@ -37,38 +60,11 @@ namespace Svg {
 		return *this;
 	}
 
-	void Circle::Render(std::ostream& out) const {
-		out << "<circle ";
-		out << "cx=\"" << center_.x << "\" ";
-		out << "cy=\"" << center_.y << "\" ";
-		out << "r=\"" << radius_ << "\" ";
-		PathProps::RenderAttrs(out);
-		out << "/>";
-	}
-
 	Polyline& Polyline::AddPoint(Point point) {
 		points_.push_back(point);
 		return *this;
 	}
 
-	void Polyline::Render(std::ostream& out) const {
-		out << "<polyline ";
-		out << "points=\"";
-		bool first = true;
-		for (const Point point : points_) {
-			if (first) {
-				first = false;
-			}
-			else {
-				out << " ";
-			}
-			out << point.x << "," << point.y;
-		}
-		out << "\" ";
-		PathProps::RenderAttrs(out);
-		out << "/>";
-	}
-
 	Rectangle& Rectangle::SetCorner(Point point) {
 		lu_corner = point;
 		return *this;
@@ -84,15 +80,6 @@ namespace Svg {
 		return *this;
 	}
 
-	void Rectangle::Render(std::ostream& out) const {
-		out << "<rect ";
-		out << "x=\"" << lu_corner.x << "\" ";
-		out << "y=\"" << lu_corner.y << "\" ";
-		out << "width=\"" << w << "\" " << "height=\"" << h << "\" ";
-		PathProps::RenderAttrs(out);
-		out << "/>";
-	}
-
 	Text& Text::SetPoint(Point point) {
 		point_ = point;
 		return *this;
@@ -123,47 +110,133 @@ namespace Svg {
 		return *this;
 	}
 
-	void Text::Render(std::ostream& out) const {
-		out << "<text ";
-		out << "x=\"" << point_.x << "\" ";
-		out << "y=\"" << point_.y << "\" ";
-		out << "dx=\"" << offset_.x << "\" ";
-		out << "dy=\"" << offset_.y << "\" ";
-		out << "font-size=\"" << font_size_ << "\" ";
-		if (font_family_) {
-			out << "font-family=\"" << *font_family_ << "\" ";
-		}
-		if (font_weight_) {
-			out << "font-weight=\"" << *font_weight_ << "\" ";
+	Document::StyleId Document::InternStyle(const std::string& attrs) {
+		const auto [it, inserted] = style_ids_.emplace(attrs, static_cast<StyleId>(styles_.size()));
+		if (inserted) {
+			styles_.push_back(attrs);
 		}
-		PathProps::RenderAttrs(out);
-		out << ">";
-		out << data_;
-		out << "</text>";
+		return it->second;
+	}
+
+	void Document::Add(Circle circle) {
+		std::string attrs;
+		circle.RenderAttrs(attrs, precision_);
+		items_.push_back(CircleItem{ circle.center_, circle.radius_, InternStyle(attrs) });
 	}
 
-	Document::Document(const Document& other) {
-		objects_.reserve(other.objects_.size());
-		for (const auto& object : other.objects_) {
-			objects_.push_back(object->Copy());
+	void Document::Add(Polyline polyline) {
+		std::string attrs;
+		polyline.RenderAttrs(attrs, precision_);
+		items_.push_back(PolylineItem{ std::move(polyline.points_), InternStyle(attrs) });
+	}
+
+	void Document::Add(Rectangle rectangle) {
+		std::string attrs;
+		rectangle.RenderAttrs(attrs, precision_);
+		items_.push_back(RectangleItem{ rectangle.lu_corner, rectangle.w, rectangle.h, InternStyle(attrs) });
+	}
+
+	// Font settings are a part of the style of a text
+	void Document::Add(Text text) {
+		std::string attrs = "font-size=\"";
+		RenderInt(attrs, text.font_size_);
+		attrs += "\" ";
+		if (text.font_family_) {
+			attrs += "font-family=\"" + *text.font_family_ + "\" ";
+		}
+		if (text.font_weight_) {
+			attrs += "font-weight=\"" + *text.font_weight_ + "\" ";
 		}
+		text.RenderAttrs(attrs, precision_);
+		items_.push_back(TextItem{ text.point_, text.offset_, std::move(text.data_), InternStyle(attrs) });
 	}
 
-	Document& Document::operator=(const Document& other) {
-		if (this != &other) {
-			Document other_copy(other);
-			std::swap(*this, other_copy);
+	void Document::SetViewBox(Point corner, double width, double height) {
+		view_box_ = RectangleItem{ corner, width, height, 0 };
+	}
+
+	void Document::RenderNumberAttr(std::string& out, std::string_view name, double value) const {
+		out.append(name);
+		out += "=\"";
+		RenderNumber(out, value, precision_);
+		out += "\" ";
+	}
+
+	void Document::RenderItem(std::string& out, const CircleItem& item) const {
+		out += "<circle ";
+		RenderNumberAttr(out, "cx", item.center.x);
+		RenderNumberAttr(out, "cy", item.center.y);
+		RenderNumberAttr(out, "r", item.radius);
+		out += styles_[item.style];
+		out += "/>";
+	}
+
+	void Document::RenderItem(std::string& out, const PolylineItem& item) const {
+		out += "<polyline ";
+		out += "points=\"";
+		bool first = true;
+		for (const Point point : item.points) {
+			if (first) {
+				first = false;
+			}
+			else {
+				out += ' ';
+			}
+			RenderNumber(out, point.x, precision_);
+			out += ',';
+			RenderNumber(out, point.y, precision_);
 		}
-		return *this;
+		out += "\" ";
+		out += styles_[item.style];
+		out += "/>";
+	}
+
+	void Document::RenderItem(std::string& out, const RectangleItem& item) const {
+		out += "<rect ";
+		RenderNumberAttr(out, "x", item.corner.x);
+		RenderNumberAttr(out, "y", item.corner.y);
+		RenderNumberAttr(out, "width", item.width);
+		RenderNumberAttr(out, "height", item.height);
+		out += styles_[item.style];
+		out += "/>";
+	}
+
+	void Document::RenderItem(std::string& out, const TextItem& item) const {
+		out += "<text ";
+		RenderNumberAttr(out, "x", item.point.x);
+		RenderNumberAttr(out, "y", item.point.y);
+		RenderNumberAttr(out, "dx", item.offset.x);
+		RenderNumberAttr(out, "dy", item.offset.y);
+		out += styles_[item.style];
+		out += ">";
+		out += item.data;
+		out += "</text>";
+	}
+
+	void Document::Render(std::string& out) const {
+		out += "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>";
+		out += "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\"";
+		if (view_box_) {
+			out += " viewBox=\"";
+			RenderNumber(out, view_box_->corner.x, precision_);
+			out += ' ';
+			RenderNumber(out, view_box_->corner.y, precision_);
+			out += ' ';
+			RenderNumber(out, view_box_->width, precision_);
+			out += ' ';
+			RenderNumber(out, view_box_->height, precision_);
+			out += '"';
+		}
+		out += '>';
+		RenderObjects(out);
+		out += FOOTER;
 	}
 
-	void Document::Render(std::ostream& out) const {
-		out << "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>";
-		out << "<svg xmlns=\"http://www.w3.org/2000/svg\" version=\"1.1\">";
-		for (const auto& object_ptr : objects_) {
-			object_ptr->Render(out);
+	// Dispatch over the variant is a jump by the item index, not a virtual call
+	void Document::RenderObjects(std::string& out) const {
+		for (const Item& item : items_) {
+			std::visit([this, &out](const auto& object) { RenderItem(out, object); }, item);
 		}
-		out << "</svg>";
 	}
 
-}
\ No newline at end of file
+}
@@ -1,11 +1,12 @@
 #pragma once
-#include <iostream>
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
-#include <memory>
 
 namespace Svg {
 
@@ -28,33 +29,24 @@ namespace Svg {
 	using Color = std::variant<std::monostate, std::string, Rgb, Rgba>;
 	const Color NoneColor{};
 
-	void RenderColor(std::ostream& out, std::monostate);
+	// Numbers are formatted by std::to_chars into the output string, like %g
+	// with precision significant digits. 6 is what std::ostream prints by default.
+	constexpr int DEFAULT_PRECISION = 6;
 
-	void RenderColor(std::ostream& out, const std::string& value);
+	void RenderNumber(std::string& out, double value, int precision = DEFAULT_PRECISION);
 
-	void RenderColor(std::ostream& out, Rgb rgb);
+	// precision is used for the alpha of Rgba; the other colors take it so Color is visited alike
+	void RenderColor(std::string& out, std::monostate, int precision = DEFAULT_PRECISION);
 
-	void RenderColor(std::ostream& out, Rgba rgba);
+	void RenderColor(std::string& out, const std::string& value, int precision = DEFAULT_PRECISION);
 
-	void RenderColor(std::ostream& out, const Color& color);
+	void RenderColor(std::string& out, Rgb rgb, int precision = DEFAULT_PRECISION);
 
+	void RenderColor(std::string& out, Rgba rgba, int precision = DEFAULT_PRECISION);
 
+	void RenderColor(std::string& out, const Color& color, int precision = DEFAULT_PRECISION);
 
-	class Object {
-	public:
-		virtual void Render(std::ostream& out) const = 0;
-		virtual std::unique_ptr<Object> Copy() const = 0;
-		virtual ~Object() = default;
-	};
 
-	template <typename Owner>
-	class CopyableObject : public Object {
-	public:
-		std::unique_ptr<Object> Copy() const override {
-			return std::make_unique<Owner>(static_cast<const Owner&>(*this));
-		}
-		virtual ~CopyableObject() = default;
-	};
 
 	template <typename Owner>
 	class PathProps {
@@ -79,19 +71,21 @@ namespace Svg {
 			stroke_line_join_ = value;
 			return AsOwner();
 		}
-		void RenderAttrs(std::ostream& out) const {
-			out << "fill=\"";
-			RenderColor(out, fill_color_);
-			out << "\" ";
-			out << "stroke=\"";
-			RenderColor(out, stroke_color_);
-			out << "\" ";
-			out << "stroke-width=\"" << stroke_width_ << "\" ";
+		void RenderAttrs(std::string& out, int precision = DEFAULT_PRECISION) const {
+			out += "fill=\"";
+			RenderColor(out, fill_color_, precision);
+			out += "\" ";
+			out += "stroke=\"";
+			RenderColor(out, stroke_color_, precision);
+			out += "\" ";
+			out += "stroke-width=\"";
+			RenderNumber(out, stroke_width_, precision);
+			out += "\" ";
 			if (stroke_line_cap_) {
-				out << "stroke-linecap=\"" << *stroke_line_cap_ << "\" ";
+				out += "stroke-linecap=\"" + *stroke_line_cap_ + "\" ";
 			}
 			if (stroke_line_join_) {
-				out << "stroke-linejoin=\"" << *stroke_line_join_ << "\" ";
+				out += "stroke-linejoin=\"" + *stroke_line_join_ + "\" ";
 			}
 		}
 
@@ -107,39 +101,46 @@ namespace Svg {
 		}
 	};
 
-	class Circle : public CopyableObject<Circle>, public PathProps<Circle> {
+	// The objects below are builders: they collect the attributes of an
+	// element and are added to a Document, which stores them in its own form
+
+	class Circle : public PathProps<Circle> {
 	public:
 		Circle& SetCenter(Point point);
 		Circle& SetRadius(double radius);
-		void Render(std::ostream& out) const override;
 
 	private:
+		friend class Document;
+
 		Point center_;
 		double radius_ = 1;
 	};
 
-	class Polyline : public CopyableObject<Polyline>, public PathProps<Polyline> {
+	class Polyline : public PathProps<Polyline> {
 	public:
 		Polyline& AddPoint(Point point);
-		void Render(std::ostream& out) const override;
 
 	private:
+		friend class Document;
+
 		std::vector<Point> points_;
 	};
 
-	class Rectangle : public CopyableObject<Rectangle>, public PathProps<Rectangle> {
+	class Rectangle : public PathProps<Rectangle> {
 	public:
 		Rectangle& SetCorner(Point point);
 		Rectangle& SetWidth(double size);
 		Rectangle& SetHeight(double size);
-		void Render(std::ostream& out) const override;
+
 	private:
+		friend class Document;
+
 		Point lu_corner;
 		double w = 0;
 		double h = 0;
 	};
 
-	class Text : public CopyableObject<Text>, public PathProps<Text> {
+	class Text : public PathProps<Text> {
 	public:
 		Text& SetPoint(Point point);
 		Text& SetOffset(Point point);
@@ -147,9 +148,10 @@ namespace Svg {
 		Text& SetFontFamily(const std::string& value);
 		Text& SetFontWeight(const std::string& value);
 		Text& SetData(const std::string& data);
-		void Render(std::ostream& out) const override;
 
 	private:
+		friend class Document;
+
 		Point point_;
 		Point offset_;
 		uint32_t font_size_ = 1;
@@ -158,23 +160,73 @@ namespace Svg {
 		std::string data_;
 	};
 
-	class Document : public CopyableObject<Document> {
+	// Objects are stored by value in one array. Their presentation attributes,
+	// which are mostly the same for thousands of objects, are interned: every
+	// distinct set of them is rendered to text once and objects refer to it by id.
+	class Document {
 	public:
-		Document() = default;
-		Document(const Document& other);
-		Document& operator=(const Document& other);
+		// precision is the count of significant digits of every number
+		explicit Document(int precision = DEFAULT_PRECISION) : precision_(precision) {}
 
-		Document(Document&&) = default;
-		Document& operator=(Document&&) = default;
+		void Add(Circle circle);
+		void Add(Polyline polyline);
+		void Add(Rectangle rectangle);
+		void Add(Text text);
 
-		template <typename ObjectType>
-		void Add(ObjectType object) {
-			objects_.push_back(std::make_unique<ObjectType>(std::move(object)));
-		}
+		// Only this area of the picture is shown, scaled to the viewport
+		void SetViewBox(Point corner, double width, double height);
+
+		// The output is appended to out
+		void Render(std::string& out) const;
+
+		// Renders just the objects, to be put before the footer of another rendered document
+		void RenderObjects(std::string& out) const;
 
-		void Render(std::ostream& out) const override;
+		static constexpr std::string_view FOOTER = "</svg>";
 
 	private:
-		std::vector<std::unique_ptr<Object>> objects_;
+		using StyleId = uint32_t;
+
+		struct CircleItem {
+			Point center;
+			double radius;
+			StyleId style;
+		};
+
+		struct PolylineItem {
+			std::vector<Point> points;
+			StyleId style;
+		};
+
+		struct RectangleItem {
+			Point corner;
+			double width;
+			double height;
+			StyleId style;
+		};
+
+		struct TextItem {
+			Point point;
+			Point offset;
+			std::string data;
+			StyleId style;
+		};
+
+		using Item = std::variant<CircleItem, PolylineItem, RectangleItem, TextItem>;
+
+		int precision_;
+		std::optional<RectangleItem> view_box_;
+		std::vector<Item> items_;
+		std::vector<std::string> styles_;
+		std::unordered_map<std::string, StyleId> style_ids_;
+
+		StyleId InternStyle(const std::string& attrs);
+
+		void RenderNumberAttr(std::string& out, std::string_view name, double value) const;
+
+		void RenderItem(std::string& out, const CircleItem& item) const;
+		void RenderItem(std::string& out, const PolylineItem& item) const;
+		void RenderItem(std::string& out, const RectangleItem& item) const;
+		void RenderItem(std::string& out, const TextItem& item) const;
 	};
 }
\ No newline at end of file
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -42,26 +41,18 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_svg_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_svg_2eproto;
 namespace SvgProto {
 class Color;
-class ColorDefaultTypeInternal;
+struct ColorDefaultTypeInternal;
 extern ColorDefaultTypeInternal _Color_default_instance_;
 class Point;
-class PointDefaultTypeInternal;
+struct PointDefaultTypeInternal;
 extern PointDefaultTypeInternal _Point_default_instance_;
 class Rgba;
-class RgbaDefaultTypeInternal;
+struct RgbaDefaultTypeInternal;
 extern RgbaDefaultTypeInternal _Rgba_default_instance_;
 }  // namespace SvgProto
 PROTOBUF_NAMESPACE_OPEN
@@ -73,11 +64,12 @@ namespace SvgProto {
 
 // ===================================================================
 
-class Rgba PROTOBUF_FINAL :
+class Rgba final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SvgProto.Rgba) */ {
  public:
   inline Rgba() : Rgba(nullptr) {}
-  virtual ~Rgba();
+  ~Rgba() override;
+  explicit PROTOBUF_CONSTEXPR Rgba(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Rgba(const Rgba& from);
   Rgba(Rgba&& from) noexcept
@@ -90,8 +82,13 @@ class Rgba PROTOBUF_FINAL :
     return *this;
   }
   inline Rgba& operator=(Rgba&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -102,13 +99,14 @@ class Rgba PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Rgba& default_instance() {
+    return *internal_default_instance();
   }
-  static const Rgba& default_instance();
-
   static inline const Rgba* internal_default_instance() {
     return reinterpret_cast<const Rgba*>(
                &_Rgba_default_instance_);
@@ -121,7 +119,12 @@ class Rgba PROTOBUF_FINAL :
   }
   inline void Swap(Rgba* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -129,56 +132,53 @@ class Rgba PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Rgba* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Rgba* New() const final {
-    return CreateMaybeMessage<Rgba>(nullptr);
-  }
-
-  Rgba* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Rgba* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Rgba>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Rgba& from);
-  void MergeFrom(const Rgba& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Rgba& from) {
+    Rgba::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Rgba* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "SvgProto.Rgba";
   }
   protected:
-  explicit Rgba(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Rgba(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_svg_2eproto);
-    return ::descriptor_table_svg_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -193,29 +193,29 @@ class Rgba PROTOBUF_FINAL :
   };
   // uint32 red = 1;
   void clear_red();
-  ::PROTOBUF_NAMESPACE_ID::uint32 red() const;
-  void set_red(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t red() const;
+  void set_red(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_red() const;
-  void _internal_set_red(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_red() const;
+  void _internal_set_red(uint32_t value);
   public:
 
   // uint32 green = 2;
   void clear_green();
-  ::PROTOBUF_NAMESPACE_ID::uint32 green() const;
-  void set_green(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t green() const;
+  void set_green(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_green() const;
-  void _internal_set_green(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_green() const;
+  void _internal_set_green(uint32_t value);
   public:
 
   // uint32 blue = 3;
   void clear_blue();
-  ::PROTOBUF_NAMESPACE_ID::uint32 blue() const;
-  void set_blue(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t blue() const;
+  void set_blue(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_blue() const;
-  void _internal_set_blue(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_blue() const;
+  void _internal_set_blue(uint32_t value);
   public:
 
   // bool has_opacity = 4;
@@ -243,21 +243,25 @@ class Rgba PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 red_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 green_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 blue_;
-  bool has_opacity_;
-  double opacity_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t red_;
+    uint32_t green_;
+    uint32_t blue_;
+    bool has_opacity_;
+    double opacity_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_svg_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Color PROTOBUF_FINAL :
+class Color final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SvgProto.Color) */ {
  public:
   inline Color() : Color(nullptr) {}
-  virtual ~Color();
+  ~Color() override;
+  explicit PROTOBUF_CONSTEXPR Color(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Color(const Color& from);
   Color(Color&& from) noexcept
@@ -270,8 +274,13 @@ class Color PROTOBUF_FINAL :
     return *this;
   }
   inline Color& operator=(Color&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -282,13 +291,14 @@ class Color PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Color& default_instance() {
+    return *internal_default_instance();
   }
-  static const Color& default_instance();
-
   enum DataCase {
     kIsNone = 1,
     kName = 2,
@@ -308,7 +318,12 @@ class Color PROTOBUF_FINAL :
   }
   inline void Swap(Color* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -316,56 +331,53 @@ class Color PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Color* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Color* New() const final {
-    return CreateMaybeMessage<Color>(nullptr);
-  }
-
-  Color* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Color* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Color>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Color& from);
-  void MergeFrom(const Color& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Color& from) {
+    Color::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Color* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "SvgProto.Color";
   }
   protected:
-  explicit Color(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Color(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_svg_2eproto);
-    return ::descriptor_table_svg_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -377,6 +389,7 @@ class Color PROTOBUF_FINAL :
     kRgbaFieldNumber = 3,
   };
   // bool is_none = 1;
+  bool has_is_none() const;
   private:
   bool _internal_has_is_none() const;
   public:
@@ -389,21 +402,20 @@ class Color PROTOBUF_FINAL :
   public:
 
   // string name = 2;
+  bool has_name() const;
   private:
   bool _internal_has_name() const;
   public:
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -414,7 +426,7 @@ class Color PROTOBUF_FINAL :
   public:
   void clear_rgba();
   const ::SvgProto::Rgba& rgba() const;
-  ::SvgProto::Rgba* release_rgba();
+  PROTOBUF_NODISCARD ::SvgProto::Rgba* release_rgba();
   ::SvgProto::Rgba* mutable_rgba();
   void set_allocated_rgba(::SvgProto::Rgba* rgba);
   private:
@@ -440,24 +452,29 @@ class Color PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  union DataUnion {
-    DataUnion() {}
-    bool is_none_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-    ::SvgProto::Rgba* rgba_;
-  } data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    union DataUnion {
+      constexpr DataUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      bool is_none_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+      ::SvgProto::Rgba* rgba_;
+    } data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_svg_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Point PROTOBUF_FINAL :
+class Point final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:SvgProto.Point) */ {
  public:
   inline Point() : Point(nullptr) {}
-  virtual ~Point();
+  ~Point() override;
+  explicit PROTOBUF_CONSTEXPR Point(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Point(const Point& from);
   Point(Point&& from) noexcept
@@ -470,8 +487,13 @@ class Point PROTOBUF_FINAL :
     return *this;
   }
   inline Point& operator=(Point&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -482,13 +504,14 @@ class Point PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Point& default_instance() {
+    return *internal_default_instance();
   }
-  static const Point& default_instance();
-
   static inline const Point* internal_default_instance() {
     return reinterpret_cast<const Point*>(
                &_Point_default_instance_);
@@ -501,7 +524,12 @@ class Point PROTOBUF_FINAL :
   }
   inline void Swap(Point* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -509,56 +537,53 @@ class Point PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Point* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Point* New() const final {
-    return CreateMaybeMessage<Point>(nullptr);
-  }
-
-  Point* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Point* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Point>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Point& from);
-  void MergeFrom(const Point& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Point& from) {
+    Point::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Point* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "SvgProto.Point";
   }
   protected:
-  explicit Point(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Point(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_svg_2eproto);
-    return ::descriptor_table_svg_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -593,9 +618,12 @@ class Point PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double x_;
-  double y_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    double x_;
+    double y_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_svg_2eproto;
 };
 // ===================================================================
@@ -611,70 +639,70 @@ class Point PROTOBUF_FINAL :
 
 // uint32 red = 1;
 inline void Rgba::clear_red() {
-  red_ = 0u;
+  _impl_.red_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Rgba::_internal_red() const {
-  return red_;
+inline uint32_t Rgba::_internal_red() const {
+  return _impl_.red_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Rgba::red() const {
+inline uint32_t Rgba::red() const {
   // @@protoc_insertion_point(field_get:SvgProto.Rgba.red)
   return _internal_red();
 }
-inline void Rgba::_internal_set_red(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Rgba::_internal_set_red(uint32_t value) {
   
-  red_ = value;
+  _impl_.red_ = value;
 }
-inline void Rgba::set_red(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Rgba::set_red(uint32_t value) {
   _internal_set_red(value);
   // @@protoc_insertion_point(field_set:SvgProto.Rgba.red)
 }
 
 // uint32 green = 2;
 inline void Rgba::clear_green() {
-  green_ = 0u;
+  _impl_.green_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Rgba::_internal_green() const {
-  return green_;
+inline uint32_t Rgba::_internal_green() const {
+  return _impl_.green_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Rgba::green() const {
+inline uint32_t Rgba::green() const {
   // @@protoc_insertion_point(field_get:SvgProto.Rgba.green)
   return _internal_green();
 }
-inline void Rgba::_internal_set_green(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Rgba::_internal_set_green(uint32_t value) {
   
-  green_ = value;
+  _impl_.green_ = value;
 }
-inline void Rgba::set_green(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Rgba::set_green(uint32_t value) {
   _internal_set_green(value);
   // @@protoc_insertion_point(field_set:SvgProto.Rgba.green)
 }
 
 // uint32 blue = 3;
 inline void Rgba::clear_blue() {
-  blue_ = 0u;
+  _impl_.blue_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Rgba::_internal_blue() const {
-  return blue_;
+inline uint32_t Rgba::_internal_blue() const {
+  return _impl_.blue_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 Rgba::blue() const {
+inline uint32_t Rgba::blue() const {
   // @@protoc_insertion_point(field_get:SvgProto.Rgba.blue)
   return _internal_blue();
 }
-inline void Rgba::_internal_set_blue(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Rgba::_internal_set_blue(uint32_t value) {
   
-  blue_ = value;
+  _impl_.blue_ = value;
 }
-inline void Rgba::set_blue(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void Rgba::set_blue(uint32_t value) {
   _internal_set_blue(value);
   // @@protoc_insertion_point(field_set:SvgProto.Rgba.blue)
 }
 
 // bool has_opacity = 4;
 inline void Rgba::clear_has_opacity() {
-  has_opacity_ = false;
+  _impl_.has_opacity_ = false;
 }
 inline bool Rgba::_internal_has_opacity() const {
-  return has_opacity_;
+  return _impl_.has_opacity_;
 }
 inline bool Rgba::has_opacity() const {
   // @@protoc_insertion_point(field_get:SvgProto.Rgba.has_opacity)
@@ -682,7 +710,7 @@ inline bool Rgba::has_opacity() const {
 }
 inline void Rgba::_internal_set_has_opacity(bool value) {
   
-  has_opacity_ = value;
+  _impl_.has_opacity_ = value;
 }
 inline void Rgba::set_has_opacity(bool value) {
   _internal_set_has_opacity(value);
@@ -691,10 +719,10 @@ inline void Rgba::set_has_opacity(bool value) {
 
 // double opacity = 5;
 inline void Rgba::clear_opacity() {
-  opacity_ = 0;
+  _impl_.opacity_ = 0;
 }
 inline double Rgba::_internal_opacity() const {
-  return opacity_;
+  return _impl_.opacity_;
 }
 inline double Rgba::opacity() const {
   // @@protoc_insertion_point(field_get:SvgProto.Rgba.opacity)
@@ -702,7 +730,7 @@ inline double Rgba::opacity() const {
 }
 inline void Rgba::_internal_set_opacity(double value) {
   
-  opacity_ = value;
+  _impl_.opacity_ = value;
 }
 inline void Rgba::set_opacity(double value) {
   _internal_set_opacity(value);
@@ -717,18 +745,21 @@ inline void Rgba::set_opacity(double value) {
 inline bool Color::_internal_has_is_none() const {
   return data_case() == kIsNone;
 }
+inline bool Color::has_is_none() const {
+  return _internal_has_is_none();
+}
 inline void Color::set_has_is_none() {
-  _oneof_case_[0] = kIsNone;
+  _impl_._oneof_case_[0] = kIsNone;
 }
 inline void Color::clear_is_none() {
   if (_internal_has_is_none()) {
-    data_.is_none_ = false;
+    _impl_.data_.is_none_ = false;
     clear_has_data();
   }
 }
 inline bool Color::_internal_is_none() const {
   if (_internal_has_is_none()) {
-    return data_.is_none_;
+    return _impl_.data_.is_none_;
   }
   return false;
 }
@@ -737,7 +768,7 @@ inline void Color::_internal_set_is_none(bool value) {
     clear_data();
     set_has_is_none();
   }
-  data_.is_none_ = value;
+  _impl_.data_.is_none_ = value;
 }
 inline bool Color::is_none() const {
   // @@protoc_insertion_point(field_get:SvgProto.Color.is_none)
@@ -752,12 +783,15 @@ inline void Color::set_is_none(bool value) {
 inline bool Color::_internal_has_name() const {
   return data_case() == kName;
 }
+inline bool Color::has_name() const {
+  return _internal_has_name();
+}
 inline void Color::set_has_name() {
-  _oneof_case_[0] = kName;
+  _impl_._oneof_case_[0] = kName;
 }
 inline void Color::clear_name() {
   if (_internal_has_name()) {
-    data_.name_.Destroy(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+    _impl_.data_.name_.Destroy();
     clear_has_data();
   }
 }
@@ -765,17 +799,24 @@ inline const std::string& Color::name() const {
   // @@protoc_insertion_point(field_get:SvgProto.Color.name)
   return _internal_name();
 }
-inline void Color::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline void Color::set_name(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_name()) {
+    clear_data();
+    set_has_name();
+    _impl_.data_.name_.InitDefault();
+  }
+  _impl_.data_.name_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:SvgProto.Color.name)
 }
 inline std::string* Color::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:SvgProto.Color.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& Color::_internal_name() const {
   if (_internal_has_name()) {
-    return data_.name_.Get();
+    return _impl_.data_.name_.Get();
   }
   return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
@@ -783,59 +824,23 @@ inline void Color::_internal_set_name(const std::string& value) {
   if (!_internal_has_name()) {
     clear_data();
     set_has_name();
-    data_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.data_.name_.InitDefault();
   }
-  data_.name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Color::set_name(std::string&& value) {
-  // @@protoc_insertion_point(field_set:SvgProto.Color.name)
-  if (!_internal_has_name()) {
-    clear_data();
-    set_has_name();
-    data_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  data_.name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:SvgProto.Color.name)
-}
-inline void Color::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  if (!_internal_has_name()) {
-    clear_data();
-    set_has_name();
-    data_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  data_.name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{},
-      ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:SvgProto.Color.name)
-}
-inline void Color::set_name(const char* value,
-                             size_t size) {
-  if (!_internal_has_name()) {
-    clear_data();
-    set_has_name();
-    data_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  data_.name_.Set(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size),
-      GetArena());
-  // @@protoc_insertion_point(field_set_pointer:SvgProto.Color.name)
+  _impl_.data_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Color::_internal_mutable_name() {
   if (!_internal_has_name()) {
     clear_data();
     set_has_name();
-    data_.name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.data_.name_.InitDefault();
   }
-  return data_.name_.Mutable(
-      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.data_.name_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* Color::release_name() {
   // @@protoc_insertion_point(field_release:SvgProto.Color.name)
   if (_internal_has_name()) {
     clear_has_data();
-    return data_.name_.ReleaseNonDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+    return _impl_.data_.name_.Release();
   } else {
     return nullptr;
   }
@@ -846,11 +851,7 @@ inline void Color::set_allocated_name(std::string* name) {
   }
   if (name != nullptr) {
     set_has_name();
-    data_.name_.UnsafeSetDefault(name);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena();
-    if (arena != nullptr) {
-      arena->Own(name);
-    }
+    _impl_.data_.name_.InitAllocated(name, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:SvgProto.Color.name)
 }
@@ -863,12 +864,12 @@ inline bool Color::has_rgba() const {
   return _internal_has_rgba();
 }
 inline void Color::set_has_rgba() {
-  _oneof_case_[0] = kRgba;
+  _impl_._oneof_case_[0] = kRgba;
 }
 inline void Color::clear_rgba() {
   if (_internal_has_rgba()) {
-    if (GetArena() == nullptr) {
-      delete data_.rgba_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.rgba_;
     }
     clear_has_data();
   }
@@ -877,11 +878,11 @@ inline ::SvgProto::Rgba* Color::release_rgba() {
   // @@protoc_insertion_point(field_release:SvgProto.Color.rgba)
   if (_internal_has_rgba()) {
     clear_has_data();
-      ::SvgProto::Rgba* temp = data_.rgba_;
-    if (GetArena() != nullptr) {
+    ::SvgProto::Rgba* temp = _impl_.data_.rgba_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    data_.rgba_ = nullptr;
+    _impl_.data_.rgba_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -889,7 +890,7 @@ inline ::SvgProto::Rgba* Color::release_rgba() {
 }
 inline const ::SvgProto::Rgba& Color::_internal_rgba() const {
   return _internal_has_rgba()
-      ? *data_.rgba_
+      ? *_impl_.data_.rgba_
       : reinterpret_cast< ::SvgProto::Rgba&>(::SvgProto::_Rgba_default_instance_);
 }
 inline const ::SvgProto::Rgba& Color::rgba() const {
@@ -900,8 +901,8 @@ inline ::SvgProto::Rgba* Color::unsafe_arena_release_rgba() {
   // @@protoc_insertion_point(field_unsafe_arena_release:SvgProto.Color.rgba)
   if (_internal_has_rgba()) {
     clear_has_data();
-    ::SvgProto::Rgba* temp = data_.rgba_;
-    data_.rgba_ = nullptr;
+    ::SvgProto::Rgba* temp = _impl_.data_.rgba_;
+    _impl_.data_.rgba_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -911,7 +912,7 @@ inline void Color::unsafe_arena_set_allocated_rgba(::SvgProto::Rgba* rgba) {
   clear_data();
   if (rgba) {
     set_has_rgba();
-    data_.rgba_ = rgba;
+    _impl_.data_.rgba_ = rgba;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:SvgProto.Color.rgba)
 }
@@ -919,23 +920,24 @@ inline ::SvgProto::Rgba* Color::_internal_mutable_rgba() {
   if (!_internal_has_rgba()) {
     clear_data();
     set_has_rgba();
-    data_.rgba_ = CreateMaybeMessage< ::SvgProto::Rgba >(GetArena());
+    _impl_.data_.rgba_ = CreateMaybeMessage< ::SvgProto::Rgba >(GetArenaForAllocation());
   }
-  return data_.rgba_;
+  return _impl_.data_.rgba_;
 }
 inline ::SvgProto::Rgba* Color::mutable_rgba() {
+  ::SvgProto::Rgba* _msg = _internal_mutable_rgba();
   // @@protoc_insertion_point(field_mutable:SvgProto.Color.rgba)
-  return _internal_mutable_rgba();
+  return _msg;
 }
 
 inline bool Color::has_data() const {
   return data_case() != DATA_NOT_SET;
 }
 inline void Color::clear_has_data() {
-  _oneof_case_[0] = DATA_NOT_SET;
+  _impl_._oneof_case_[0] = DATA_NOT_SET;
 }
 inline Color::DataCase Color::data_case() const {
-  return Color::DataCase(_oneof_case_[0]);
+  return Color::DataCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -943,10 +945,10 @@ inline Color::DataCase Color::data_case() const {
 
 // double x = 1;
 inline void Point::clear_x() {
-  x_ = 0;
+  _impl_.x_ = 0;
 }
 inline double Point::_internal_x() const {
-  return x_;
+  return _impl_.x_;
 }
 inline double Point::x() const {
   // @@protoc_insertion_point(field_get:SvgProto.Point.x)
@@ -954,7 +956,7 @@ inline double Point::x() const {
 }
 inline void Point::_internal_set_x(double value) {
   
-  x_ = value;
+  _impl_.x_ = value;
 }
 inline void Point::set_x(double value) {
   _internal_set_x(value);
@@ -963,10 +965,10 @@ inline void Point::set_x(double value) {
 
 // double y = 2;
 inline void Point::clear_y() {
-  y_ = 0;
+  _impl_.y_ = 0;
 }
 inline double Point::_internal_y() const {
-  return y_;
+  return _impl_.y_;
 }
 inline double Point::y() const {
   // @@protoc_insertion_point(field_get:SvgProto.Point.y)
@@ -974,7 +976,7 @@ inline double Point::y() const {
 }
 inline void Point::_internal_set_y(double value) {
   
-  y_ = value;
+  _impl_.y_ = value;
 }
 inline void Point::set_y(double value) {
   _internal_set_y(value);
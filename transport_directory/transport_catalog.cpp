@@ -6,10 +6,30 @@
 
 using namespace std;
 
+vector<GeoIndex::Place> TransportCatalog::CollectStopPlaces(const Descriptions::StopsDict& stops_dict) {
+  vector<GeoIndex::Place> places;
+  places.reserve(stops_dict.size());
+  for (const auto& [name, stop] : stops_dict) {
+    places.push_back({ name, stop->position });
+  }
+  return places;
+}
+
+vector<GeoIndex::Place> TransportCatalog::CollectCompanyPlaces(const vector<YellowPages::Company>& companies) {
+  vector<GeoIndex::Place> places;
+  for (const auto& company : companies) {
+    if (company.has_address() && company.address().has_coords()) {
+      const auto& coords = company.address().coords();
+      places.push_back({ CompanyMainName(company), { coords.lat(), coords.lon() } });
+    }
+  }
+  return places;
+}
+
 TransportCatalog::TransportCatalog(vector<Descriptions::InputQuery> data,
   const Json::Dict& routing_settings_json,
   const Json::Dict& render_settings_json,
-  const Json::Dict& yellow_pages_json) {
+  unique_ptr<CompaniesCatalog> companies) {
 
   auto stops_end = partition(begin(data), end(data), [](const auto& item) {
     return holds_alternative<Descriptions::Stop>(item);
@@ -39,14 +59,22 @@ TransportCatalog::TransportCatalog(vector<Descriptions::InputQuery> data,
     }
   }
 
-  companies_ = make_unique<CompaniesCatalog>(
-    yellow_pages_json.at("rubrics").AsMap(), yellow_pages_json.at("companies").AsArray()
-    );
-  router_ = make_unique<TransportRouter>(*stops_dict, *buses_dict, routing_settings_json);
-  painter_ = make_unique<Paint::Painter>(render_settings_json, buses_dict, stops_dict, companies_->GetCompanies());
+  companies_.Set(move(companies));
+  router_.Set(make_unique<TransportRouter>(*stops_dict, *buses_dict, routing_settings_json));
+  painter_.Set(make_unique<Paint::Painter>(render_settings_json, buses_dict, stops_dict, companies_->GetCompanies()));
+  stops_geo_index_.Set(make_unique<GeoIndex>(CollectStopPlaces(*stops_dict)));
+  companies_geo_index_.Set(make_unique<GeoIndex>(CollectCompanyPlaces(companies_->GetCompanies())));
 }
 
 
+void TransportCatalog::LoadAll() const {
+  router_.Get();
+  painter_.Get();
+  companies_.Get();
+  stops_geo_index_.Get();
+  companies_geo_index_.Get();
+}
+
 const TransportCatalog::Stop* TransportCatalog::GetStop(const string& name) const {
   return GetValuePointer(stops_, name);
 }
@@ -132,10 +160,30 @@ double TransportCatalog::ComputeGeoRouteDistance(
   return result;
 }
 
-std::string TransportCatalog::RenderMap() const {
-  return painter_->Paint();
+TransportCatalog::ResponseCache& TransportCatalog::GetResponseCache() const {
+  return response_cache_;
+}
+
+const std::string& TransportCatalog::RenderMap() const {
+  return painter_->PaintMap();
 }
 
 std::string TransportCatalog::RenderRoute(const Paint::Route& items) const {
-  return painter_->Paint(items);
+  return painter_->PaintRoute(items);
+}
+
+std::string TransportCatalog::RenderTile(const Paint::Viewport& viewport) const {
+  return painter_->PaintTile(viewport);
+}
+
+Paint::Viewport TransportCatalog::GetTileViewport(int zoom, int x, int y) const {
+  return painter_->GetTileViewport(zoom, x, y);
+}
+
+vector<GeoIndex::Neighbour> TransportCatalog::FindNearbyStops(const GeoIndex::Query& query) const {
+  return stops_geo_index_->Find(query);
+}
+
+vector<GeoIndex::Neighbour> TransportCatalog::FindNearbyCompanies(const GeoIndex::Query& query) const {
+  return companies_geo_index_->Find(query);
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "base_file.h"
 #include "descriptions.h"
 #include "json.h"
 #include "transport_router.h"
@@ -7,7 +8,10 @@
 #include "utils.h"
 #include "sphere.h"
 #include "companies_catalog.h"
+#include "geo_index.h"
+#include "lru_cache.h"
 
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -38,9 +42,12 @@ public:
 	TransportCatalog(std::vector<Descriptions::InputQuery> data,
 		const Json::Dict& routing_settings_json,
 		const Json::Dict& render_settings_json,
-		const Json::Dict& yellow_pages_json);
+		std::unique_ptr<CompaniesCatalog> companies);
 
-	TransportCatalog(std::istream& is);
+	explicit TransportCatalog(const std::string& base_file_name);
+	// Builds now the parts a loaded catalog builds on first use, so that
+	// the first requests after loading do not wait for them
+	void LoadAll() const;
 	void Serialize(std::ostream& os) const;
 
 	const Stop* GetStop(const std::string& name) const;
@@ -53,10 +60,28 @@ public:
 	std::optional<TransportRouter::RouteInfo> RouteToCompany(
 		const std::string& stop_from, const double datetime, const CompanyQuery::Company& model) const;
 
-	std::string RenderMap() const;
+	const std::string& RenderMap() const;
 	std::string RenderRoute(const Paint::Route& items) const;
+	std::string RenderTile(const Paint::Viewport& viewport) const;
+	Paint::Viewport GetTileViewport(int zoom, int x, int y) const;
+
+	// Stops and companies around a point; companies without coordinates are never found
+	std::vector<GeoIndex::Neighbour> FindNearbyStops(const GeoIndex::Query& query) const;
+	std::vector<GeoIndex::Neighbour> FindNearbyCompanies(const GeoIndex::Query& query) const;
+
+	// Serialized responses of repeated heavy requests by their normalized content.
+	// Responses hold route maps and may be big, so the cache is bounded in bytes.
+	struct ResponseSize {
+		size_t operator()(const std::string& key, const std::shared_ptr<const std::string>& response) const {
+			return key.size() + response->size();
+		}
+	};
+	using ResponseCache = ShardedLruCache<std::string, std::shared_ptr<const std::string>, ResponseSize>;
+	ResponseCache& GetResponseCache() const;
 
 private:
+	static constexpr size_t RESPONSE_CACHE_CAPACITY = 32 << 20;  // bytes
+
 	static int ComputeRoadRouteLength(
 		const std::vector<std::string>& stops,
 		const Descriptions::StopsDict& stops_dict
@@ -67,10 +92,22 @@ private:
 		const Descriptions::StopsDict& stops_dict
 	);
 
+	// Places for the geo indexes, also for bases written without them
+	static std::vector<GeoIndex::Place> CollectStopPlaces(const Descriptions::StopsDict& stops_dict);
+	static std::vector<GeoIndex::Place> CollectCompanyPlaces(const std::vector<YellowPages::Company>& companies);
+
+	// Loaded parts of the catalog may point into the mapped base file
+	std::unique_ptr<BaseFile::Reader> base_;
+
 	std::unordered_map<std::string, Stop> stops_;
 	std::unordered_map<std::string, Bus> buses_;
 
-	std::unique_ptr<TransportRouter> router_;
-	std::unique_ptr<Paint::Painter> painter_;
-	std::unique_ptr<CompaniesCatalog> companies_;
+	// A loaded catalog builds these on first use from their own base file sections
+	Lazy<TransportRouter> router_;
+	Lazy<Paint::Painter> painter_;
+	Lazy<CompaniesCatalog> companies_;
+	Lazy<GeoIndex> stops_geo_index_;
+	Lazy<GeoIndex> companies_geo_index_;
+
+	mutable ResponseCache response_cache_{ RESPONSE_CACHE_CAPACITY };
 };
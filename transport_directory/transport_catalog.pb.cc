@@ -14,149 +14,168 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_transport_5fcatalog_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BusResponse_transport_5fcatalog_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_painter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_Painter_painter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5fcatalog_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StopResponse_transport_5fcatalog_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5frouter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TransportRouter_transport_5frouter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_database_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Database_database_2eproto;
-namespace TCProto {
-class StopResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StopResponse> _instance;
-} _StopResponse_default_instance_;
-class BusResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BusResponse> _instance;
-} _BusResponse_default_instance_;
-class TransportCatalogDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TransportCatalog> _instance;
-} _TransportCatalog_default_instance_;
-}  // namespace TCProto
-static void InitDefaultsscc_info_BusResponse_transport_5fcatalog_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_BusResponse_default_instance_;
-    new (ptr) ::TCProto::BusResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BusResponse_transport_5fcatalog_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_BusResponse_transport_5fcatalog_2eproto}, {}};
 
-static void InitDefaultsscc_info_StopResponse_transport_5fcatalog_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_StopResponse_default_instance_;
-    new (ptr) ::TCProto::StopResponse();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StopResponse_transport_5fcatalog_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_StopResponse_transport_5fcatalog_2eproto}, {}};
-
-static void InitDefaultsscc_info_TransportCatalog_transport_5fcatalog_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_TransportCatalog_default_instance_;
-    new (ptr) ::TCProto::TransportCatalog();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<5> scc_info_TransportCatalog_transport_5fcatalog_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 5, 0, InitDefaultsscc_info_TransportCatalog_transport_5fcatalog_2eproto}, {
-      &scc_info_StopResponse_transport_5fcatalog_2eproto.base,
-      &scc_info_BusResponse_transport_5fcatalog_2eproto.base,
-      &scc_info_TransportRouter_transport_5frouter_2eproto.base,
-      &scc_info_Painter_painter_2eproto.base,
-      &scc_info_Database_database_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_transport_5fcatalog_2eproto[3];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_transport_5fcatalog_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_transport_5fcatalog_2eproto = nullptr;
+namespace TCProto {
+PROTOBUF_CONSTEXPR StopResponse::StopResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bus_names_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StopResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StopResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StopResponseDefaultTypeInternal() {}
+  union {
+    StopResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopResponseDefaultTypeInternal _StopResponse_default_instance_;
+PROTOBUF_CONSTEXPR BusResponse::BusResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stop_count_)*/0u
+  , /*decltype(_impl_.unique_stop_count_)*/0u
+  , /*decltype(_impl_.geo_route_length_)*/0
+  , /*decltype(_impl_.road_route_length_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BusResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BusResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BusResponseDefaultTypeInternal() {}
+  union {
+    BusResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BusResponseDefaultTypeInternal _BusResponse_default_instance_;
+PROTOBUF_CONSTEXPR TransportCatalog::TransportCatalog(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stops_)*/{}
+  , /*decltype(_impl_.buses_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransportCatalogDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransportCatalogDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransportCatalogDefaultTypeInternal() {}
+  union {
+    TransportCatalog _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransportCatalogDefaultTypeInternal _TransportCatalog_default_instance_;
+PROTOBUF_CONSTEXPR GeoIndex::GeoIndex(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.names_)*/{}
+  , /*decltype(_impl_.min_latitude_)*/0
+  , /*decltype(_impl_.min_longitude_)*/0
+  , /*decltype(_impl_.cell_latitude_)*/0
+  , /*decltype(_impl_.cell_longitude_)*/0
+  , /*decltype(_impl_.rows_)*/0u
+  , /*decltype(_impl_.cols_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GeoIndexDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GeoIndexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GeoIndexDefaultTypeInternal() {}
+  union {
+    GeoIndex _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GeoIndexDefaultTypeInternal _GeoIndex_default_instance_;
+}  // namespace TCProto
+static ::_pb::Metadata file_level_metadata_transport_5fcatalog_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_transport_5fcatalog_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transport_5fcatalog_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_transport_5fcatalog_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_transport_5fcatalog_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::StopResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopResponse, name_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopResponse, bus_names_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopResponse, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopResponse, _impl_.bus_names_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, name_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, stop_count_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, unique_stop_count_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, road_route_length_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, geo_route_length_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, _impl_.stop_count_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, _impl_.unique_stop_count_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, _impl_.road_route_length_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusResponse, _impl_.geo_route_length_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::TransportCatalog, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportCatalog, stops_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportCatalog, buses_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportCatalog, router_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportCatalog, painter_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportCatalog, companies_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::TransportCatalog, _impl_.stops_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::TransportCatalog, _impl_.buses_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TCProto::GeoIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::GeoIndex, _impl_.min_latitude_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::GeoIndex, _impl_.min_longitude_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::GeoIndex, _impl_.cell_latitude_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::GeoIndex, _impl_.cell_longitude_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::GeoIndex, _impl_.rows_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::GeoIndex, _impl_.cols_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::GeoIndex, _impl_.names_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::TCProto::StopResponse)},
-  { 7, -1, sizeof(::TCProto::BusResponse)},
-  { 17, -1, sizeof(::TCProto::TransportCatalog)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::TCProto::StopResponse)},
+  { 8, -1, -1, sizeof(::TCProto::BusResponse)},
+  { 19, -1, -1, sizeof(::TCProto::TransportCatalog)},
+  { 27, -1, -1, sizeof(::TCProto::GeoIndex)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_StopResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_BusResponse_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_TransportCatalog_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TCProto::_StopResponse_default_instance_._instance,
+  &::TCProto::_BusResponse_default_instance_._instance,
+  &::TCProto::_TransportCatalog_default_instance_._instance,
+  &::TCProto::_GeoIndex_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_transport_5fcatalog_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\027transport_catalog.proto\022\007TCProto\032\rpain"
-  "ter.proto\032\026transport_router.proto\032\016datab"
-  "ase.proto\"/\n\014StopResponse\022\014\n\004name\030\001 \001(\t\022"
-  "\021\n\tbus_names\030\002 \003(\t\"\177\n\013BusResponse\022\014\n\004nam"
-  "e\030\001 \001(\t\022\022\n\nstop_count\030\002 \001(\r\022\031\n\021unique_st"
-  "op_count\030\003 \001(\r\022\031\n\021road_route_length\030\004 \001("
-  "\r\022\030\n\020geo_route_length\030\005 \001(\001\"\324\001\n\020Transpor"
-  "tCatalog\022$\n\005stops\030\001 \003(\0132\025.TCProto.StopRe"
-  "sponse\022#\n\005buses\030\002 \003(\0132\024.TCProto.BusRespo"
-  "nse\022(\n\006router\030\003 \001(\0132\030.TCProto.TransportR"
-  "outer\022!\n\007painter\030\004 \001(\0132\020.TCProto.Painter"
-  "\022(\n\tcompanies\030\005 \001(\0132\025.YellowPages.Databa"
-  "seb\006proto3"
+  "\n\027transport_catalog.proto\022\007TCProto\"/\n\014St"
+  "opResponse\022\014\n\004name\030\001 \001(\t\022\021\n\tbus_names\030\002 "
+  "\003(\t\"\177\n\013BusResponse\022\014\n\004name\030\001 \001(\t\022\022\n\nstop"
+  "_count\030\002 \001(\r\022\031\n\021unique_stop_count\030\003 \001(\r\022"
+  "\031\n\021road_route_length\030\004 \001(\r\022\030\n\020geo_route_"
+  "length\030\005 \001(\001\"o\n\020TransportCatalog\022$\n\005stop"
+  "s\030\001 \003(\0132\025.TCProto.StopResponse\022#\n\005buses\030"
+  "\002 \003(\0132\024.TCProto.BusResponseJ\004\010\003\020\004J\004\010\004\020\005J"
+  "\004\010\005\020\006\"\221\001\n\010GeoIndex\022\024\n\014min_latitude\030\001 \001(\001"
+  "\022\025\n\rmin_longitude\030\002 \001(\001\022\025\n\rcell_latitude"
+  "\030\003 \001(\001\022\026\n\016cell_longitude\030\004 \001(\001\022\014\n\004rows\030\005"
+  " \001(\r\022\014\n\004cols\030\006 \001(\r\022\r\n\005names\030\007 \003(\tb\006proto"
+  "3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_transport_5fcatalog_2eproto_deps[3] = {
-  &::descriptor_table_database_2eproto,
-  &::descriptor_table_painter_2eproto,
-  &::descriptor_table_transport_5frouter_2eproto,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_transport_5fcatalog_2eproto_sccs[3] = {
-  &scc_info_BusResponse_transport_5fcatalog_2eproto.base,
-  &scc_info_StopResponse_transport_5fcatalog_2eproto.base,
-  &scc_info_TransportCatalog_transport_5fcatalog_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_transport_5fcatalog_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5fcatalog_2eproto = {
-  false, false, descriptor_table_protodef_transport_5fcatalog_2eproto, "transport_catalog.proto", 490,
-  &descriptor_table_transport_5fcatalog_2eproto_once, descriptor_table_transport_5fcatalog_2eproto_sccs, descriptor_table_transport_5fcatalog_2eproto_deps, 3, 3,
-  schemas, file_default_instances, TableStruct_transport_5fcatalog_2eproto::offsets,
-  file_level_metadata_transport_5fcatalog_2eproto, 3, file_level_enum_descriptors_transport_5fcatalog_2eproto, file_level_service_descriptors_transport_5fcatalog_2eproto,
+static ::_pbi::once_flag descriptor_table_transport_5fcatalog_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transport_5fcatalog_2eproto = {
+    false, false, 481, descriptor_table_protodef_transport_5fcatalog_2eproto,
+    "transport_catalog.proto",
+    &descriptor_table_transport_5fcatalog_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_transport_5fcatalog_2eproto::offsets,
+    file_level_metadata_transport_5fcatalog_2eproto, file_level_enum_descriptors_transport_5fcatalog_2eproto,
+    file_level_service_descriptors_transport_5fcatalog_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transport_5fcatalog_2eproto_getter() {
+  return &descriptor_table_transport_5fcatalog_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_transport_5fcatalog_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_transport_5fcatalog_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transport_5fcatalog_2eproto(&descriptor_table_transport_5fcatalog_2eproto);
 namespace TCProto {
 
 // ===================================================================
@@ -165,127 +184,139 @@ class StopResponse::_Internal {
  public:
 };
 
-StopResponse::StopResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  bus_names_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+StopResponse::StopResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.StopResponse)
 }
 StopResponse::StopResponse(const StopResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      bus_names_(from.bus_names_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_names_){from._impl_.bus_names_}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:TCProto.StopResponse)
 }
 
-void StopResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StopResponse_transport_5fcatalog_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void StopResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_names_){arena}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 StopResponse::~StopResponse() {
   // @@protoc_insertion_point(destructor:TCProto.StopResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void StopResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void StopResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bus_names_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
 }
 
-void StopResponse::ArenaDtor(void* object) {
-  StopResponse* _this = reinterpret_cast< StopResponse* >(object);
-  (void)_this;
-}
-void StopResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void StopResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const StopResponse& StopResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StopResponse_transport_5fcatalog_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void StopResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.StopResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  bus_names_.Clear();
-  name_.ClearToEmpty();
+  _impl_.bus_names_.Clear();
+  _impl_.name_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StopResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StopResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.StopResponse.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.StopResponse.name"));
+        } else
+          goto handle_unusual;
         continue;
       // repeated string bus_names = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
             auto str = _internal_add_bus_names();
-            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.StopResponse.bus_names"));
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "TCProto.StopResponse.bus_names"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* StopResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* StopResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.StopResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -305,7 +336,7 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.StopResponse)
@@ -316,67 +347,48 @@ size_t StopResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.StopResponse)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated string bus_names = 2;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(bus_names_.size());
-  for (int i = 0, n = bus_names_.size(); i < n; i++) {
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.bus_names_.size());
+  for (int i = 0, n = _impl_.bus_names_.size(); i < n; i++) {
     total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      bus_names_.Get(i));
+      _impl_.bus_names_.Get(i));
   }
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void StopResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.StopResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const StopResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StopResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.StopResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.StopResponse)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void StopResponse::MergeFrom(const StopResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.StopResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StopResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopResponse::GetClassData() const { return &_class_data_; }
+
+
+void StopResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopResponse*>(&to_msg);
+  auto& from = static_cast<const StopResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.StopResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  bus_names_.MergeFrom(from.bus_names_);
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  _this->_impl_.bus_names_.MergeFrom(from._impl_.bus_names_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-}
-
-void StopResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.StopResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StopResponse::CopyFrom(const StopResponse& from) {
@@ -392,164 +404,188 @@ bool StopResponse::IsInitialized() const {
 
 void StopResponse::InternalSwap(StopResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  bus_names_.InternalSwap(&other->bus_names_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bus_names_.InternalSwap(&other->_impl_.bus_names_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StopResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalog_2eproto_getter, &descriptor_table_transport_5fcatalog_2eproto_once,
+      file_level_metadata_transport_5fcatalog_2eproto[0]);
 }
 
-
 // ===================================================================
 
 class BusResponse::_Internal {
  public:
 };
 
-BusResponse::BusResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+BusResponse::BusResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.BusResponse)
 }
 BusResponse::BusResponse(const BusResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BusResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.stop_count_){}
+    , decltype(_impl_.unique_stop_count_){}
+    , decltype(_impl_.geo_route_length_){}
+    , decltype(_impl_.road_route_length_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&stop_count_, &from.stop_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&road_route_length_) -
-    reinterpret_cast<char*>(&stop_count_)) + sizeof(road_route_length_));
+  ::memcpy(&_impl_.stop_count_, &from._impl_.stop_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.road_route_length_) -
+    reinterpret_cast<char*>(&_impl_.stop_count_)) + sizeof(_impl_.road_route_length_));
   // @@protoc_insertion_point(copy_constructor:TCProto.BusResponse)
 }
 
-void BusResponse::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BusResponse_transport_5fcatalog_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&stop_count_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&road_route_length_) -
-      reinterpret_cast<char*>(&stop_count_)) + sizeof(road_route_length_));
+inline void BusResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.stop_count_){0u}
+    , decltype(_impl_.unique_stop_count_){0u}
+    , decltype(_impl_.geo_route_length_){0}
+    , decltype(_impl_.road_route_length_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BusResponse::~BusResponse() {
   // @@protoc_insertion_point(destructor:TCProto.BusResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void BusResponse::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void BusResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void BusResponse::ArenaDtor(void* object) {
-  BusResponse* _this = reinterpret_cast< BusResponse* >(object);
-  (void)_this;
-}
-void BusResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void BusResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const BusResponse& BusResponse::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BusResponse_transport_5fcatalog_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void BusResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.BusResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmpty();
-  ::memset(&stop_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&road_route_length_) -
-      reinterpret_cast<char*>(&stop_count_)) + sizeof(road_route_length_));
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.stop_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.road_route_length_) -
+      reinterpret_cast<char*>(&_impl_.stop_count_)) + sizeof(_impl_.road_route_length_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BusResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BusResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.BusResponse.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.BusResponse.name"));
+        } else
+          goto handle_unusual;
         continue;
       // uint32 stop_count = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          stop_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.stop_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 unique_stop_count = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          unique_stop_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.unique_stop_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 road_route_length = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          road_route_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.road_route_length_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double geo_route_length = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 41)) {
-          geo_route_length_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.geo_route_length_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* BusResponse::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* BusResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.BusResponse)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -559,31 +595,35 @@ failure:
   }
 
   // uint32 stop_count = 2;
-  if (this->stop_count() != 0) {
+  if (this->_internal_stop_count() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_stop_count(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_stop_count(), target);
   }
 
   // uint32 unique_stop_count = 3;
-  if (this->unique_stop_count() != 0) {
+  if (this->_internal_unique_stop_count() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_unique_stop_count(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_unique_stop_count(), target);
   }
 
   // uint32 road_route_length = 4;
-  if (this->road_route_length() != 0) {
+  if (this->_internal_road_route_length() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_road_route_length(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_road_route_length(), target);
   }
 
   // double geo_route_length = 5;
-  if (!(this->geo_route_length() <= 0 && this->geo_route_length() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_geo_route_length = this->_internal_geo_route_length();
+  uint64_t raw_geo_route_length;
+  memcpy(&raw_geo_route_length, &tmp_geo_route_length, sizeof(tmp_geo_route_length));
+  if (raw_geo_route_length != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(5, this->_internal_geo_route_length(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_geo_route_length(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.BusResponse)
@@ -594,96 +634,79 @@ size_t BusResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.BusResponse)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
   // uint32 stop_count = 2;
-  if (this->stop_count() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_stop_count());
+  if (this->_internal_stop_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_count());
   }
 
   // uint32 unique_stop_count = 3;
-  if (this->unique_stop_count() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_unique_stop_count());
+  if (this->_internal_unique_stop_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unique_stop_count());
   }
 
   // double geo_route_length = 5;
-  if (!(this->geo_route_length() <= 0 && this->geo_route_length() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_geo_route_length = this->_internal_geo_route_length();
+  uint64_t raw_geo_route_length;
+  memcpy(&raw_geo_route_length, &tmp_geo_route_length, sizeof(tmp_geo_route_length));
+  if (raw_geo_route_length != 0) {
     total_size += 1 + 8;
   }
 
   // uint32 road_route_length = 4;
-  if (this->road_route_length() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_road_route_length());
+  if (this->_internal_road_route_length() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_road_route_length());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void BusResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.BusResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BusResponse* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BusResponse>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.BusResponse)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.BusResponse)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BusResponse::MergeFrom(const BusResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BusResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BusResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BusResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BusResponse::GetClassData() const { return &_class_data_; }
+
+
+void BusResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BusResponse*>(&to_msg);
+  auto& from = static_cast<const BusResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BusResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.stop_count() != 0) {
-    _internal_set_stop_count(from._internal_stop_count());
+  if (from._internal_stop_count() != 0) {
+    _this->_internal_set_stop_count(from._internal_stop_count());
   }
-  if (from.unique_stop_count() != 0) {
-    _internal_set_unique_stop_count(from._internal_unique_stop_count());
+  if (from._internal_unique_stop_count() != 0) {
+    _this->_internal_set_unique_stop_count(from._internal_unique_stop_count());
   }
-  if (!(from.geo_route_length() <= 0 && from.geo_route_length() >= 0)) {
-    _internal_set_geo_route_length(from._internal_geo_route_length());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_geo_route_length = from._internal_geo_route_length();
+  uint64_t raw_geo_route_length;
+  memcpy(&raw_geo_route_length, &tmp_geo_route_length, sizeof(tmp_geo_route_length));
+  if (raw_geo_route_length != 0) {
+    _this->_internal_set_geo_route_length(from._internal_geo_route_length());
   }
-  if (from.road_route_length() != 0) {
-    _internal_set_road_route_length(from._internal_road_route_length());
+  if (from._internal_road_route_length() != 0) {
+    _this->_internal_set_road_route_length(from._internal_road_route_length());
   }
-}
-
-void BusResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.BusResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BusResponse::CopyFrom(const BusResponse& from) {
@@ -699,160 +722,101 @@ bool BusResponse::IsInitialized() const {
 
 void BusResponse::InternalSwap(BusResponse* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(BusResponse, road_route_length_)
-      + sizeof(BusResponse::road_route_length_)
-      - PROTOBUF_FIELD_OFFSET(BusResponse, stop_count_)>(
-          reinterpret_cast<char*>(&stop_count_),
-          reinterpret_cast<char*>(&other->stop_count_));
+      PROTOBUF_FIELD_OFFSET(BusResponse, _impl_.road_route_length_)
+      + sizeof(BusResponse::_impl_.road_route_length_)
+      - PROTOBUF_FIELD_OFFSET(BusResponse, _impl_.stop_count_)>(
+          reinterpret_cast<char*>(&_impl_.stop_count_),
+          reinterpret_cast<char*>(&other->_impl_.stop_count_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata BusResponse::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalog_2eproto_getter, &descriptor_table_transport_5fcatalog_2eproto_once,
+      file_level_metadata_transport_5fcatalog_2eproto[1]);
 }
 
-
 // ===================================================================
 
 class TransportCatalog::_Internal {
  public:
-  static const ::TCProto::TransportRouter& router(const TransportCatalog* msg);
-  static const ::TCProto::Painter& painter(const TransportCatalog* msg);
-  static const ::YellowPages::Database& companies(const TransportCatalog* msg);
 };
 
-const ::TCProto::TransportRouter&
-TransportCatalog::_Internal::router(const TransportCatalog* msg) {
-  return *msg->router_;
-}
-const ::TCProto::Painter&
-TransportCatalog::_Internal::painter(const TransportCatalog* msg) {
-  return *msg->painter_;
-}
-const ::YellowPages::Database&
-TransportCatalog::_Internal::companies(const TransportCatalog* msg) {
-  return *msg->companies_;
-}
-void TransportCatalog::clear_router() {
-  if (GetArena() == nullptr && router_ != nullptr) {
-    delete router_;
-  }
-  router_ = nullptr;
-}
-void TransportCatalog::clear_painter() {
-  if (GetArena() == nullptr && painter_ != nullptr) {
-    delete painter_;
-  }
-  painter_ = nullptr;
-}
-void TransportCatalog::clear_companies() {
-  if (GetArena() == nullptr && companies_ != nullptr) {
-    delete companies_;
-  }
-  companies_ = nullptr;
-}
-TransportCatalog::TransportCatalog(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  stops_(arena),
-  buses_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+TransportCatalog::TransportCatalog(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.TransportCatalog)
 }
 TransportCatalog::TransportCatalog(const TransportCatalog& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      stops_(from.stops_),
-      buses_(from.buses_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransportCatalog* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){from._impl_.stops_}
+    , decltype(_impl_.buses_){from._impl_.buses_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_router()) {
-    router_ = new ::TCProto::TransportRouter(*from.router_);
-  } else {
-    router_ = nullptr;
-  }
-  if (from._internal_has_painter()) {
-    painter_ = new ::TCProto::Painter(*from.painter_);
-  } else {
-    painter_ = nullptr;
-  }
-  if (from._internal_has_companies()) {
-    companies_ = new ::YellowPages::Database(*from.companies_);
-  } else {
-    companies_ = nullptr;
-  }
   // @@protoc_insertion_point(copy_constructor:TCProto.TransportCatalog)
 }
 
-void TransportCatalog::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TransportCatalog_transport_5fcatalog_2eproto.base);
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&router_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&companies_) -
-      reinterpret_cast<char*>(&router_)) + sizeof(companies_));
+inline void TransportCatalog::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){arena}
+    , decltype(_impl_.buses_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 TransportCatalog::~TransportCatalog() {
   // @@protoc_insertion_point(destructor:TCProto.TransportCatalog)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TransportCatalog::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete router_;
-  if (this != internal_default_instance()) delete painter_;
-  if (this != internal_default_instance()) delete companies_;
+inline void TransportCatalog::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stops_.~RepeatedPtrField();
+  _impl_.buses_.~RepeatedPtrField();
 }
 
-void TransportCatalog::ArenaDtor(void* object) {
-  TransportCatalog* _this = reinterpret_cast< TransportCatalog* >(object);
-  (void)_this;
-}
-void TransportCatalog::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void TransportCatalog::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const TransportCatalog& TransportCatalog::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TransportCatalog_transport_5fcatalog_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void TransportCatalog::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.TransportCatalog)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stops_.Clear();
-  buses_.Clear();
-  if (GetArena() == nullptr && router_ != nullptr) {
-    delete router_;
-  }
-  router_ = nullptr;
-  if (GetArena() == nullptr && painter_ != nullptr) {
-    delete painter_;
-  }
-  painter_ = nullptr;
-  if (GetArena() == nullptr && companies_ != nullptr) {
-    delete companies_;
-  }
-  companies_ = nullptr;
+  _impl_.stops_.Clear();
+  _impl_.buses_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TransportCatalog::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TransportCatalog::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .TCProto.StopResponse stops = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -860,11 +824,12 @@ const char* TransportCatalog::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .TCProto.BusResponse buses = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -872,240 +837,544 @@ const char* TransportCatalog::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransportCatalog::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TCProto.TransportCatalog)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .TCProto.StopResponse stops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .TCProto.BusResponse buses = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buses(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TCProto.TransportCatalog)
+  return target;
+}
+
+size_t TransportCatalog::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TCProto.TransportCatalog)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .TCProto.StopResponse stops = 1;
+  total_size += 1UL * this->_internal_stops_size();
+  for (const auto& msg : this->_impl_.stops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .TCProto.BusResponse buses = 2;
+  total_size += 1UL * this->_internal_buses_size();
+  for (const auto& msg : this->_impl_.buses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransportCatalog::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransportCatalog::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransportCatalog::GetClassData() const { return &_class_data_; }
+
+
+void TransportCatalog::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransportCatalog*>(&to_msg);
+  auto& from = static_cast<const TransportCatalog&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.TransportCatalog)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
+  _this->_impl_.buses_.MergeFrom(from._impl_.buses_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransportCatalog::CopyFrom(const TransportCatalog& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TCProto.TransportCatalog)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransportCatalog::IsInitialized() const {
+  return true;
+}
+
+void TransportCatalog::InternalSwap(TransportCatalog* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stops_.InternalSwap(&other->_impl_.stops_);
+  _impl_.buses_.InternalSwap(&other->_impl_.buses_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransportCatalog::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalog_2eproto_getter, &descriptor_table_transport_5fcatalog_2eproto_once,
+      file_level_metadata_transport_5fcatalog_2eproto[2]);
+}
+
+// ===================================================================
+
+class GeoIndex::_Internal {
+ public:
+};
+
+GeoIndex::GeoIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TCProto.GeoIndex)
+}
+GeoIndex::GeoIndex(const GeoIndex& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GeoIndex* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.names_){from._impl_.names_}
+    , decltype(_impl_.min_latitude_){}
+    , decltype(_impl_.min_longitude_){}
+    , decltype(_impl_.cell_latitude_){}
+    , decltype(_impl_.cell_longitude_){}
+    , decltype(_impl_.rows_){}
+    , decltype(_impl_.cols_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_latitude_, &from._impl_.min_latitude_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cols_) -
+    reinterpret_cast<char*>(&_impl_.min_latitude_)) + sizeof(_impl_.cols_));
+  // @@protoc_insertion_point(copy_constructor:TCProto.GeoIndex)
+}
+
+inline void GeoIndex::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.names_){arena}
+    , decltype(_impl_.min_latitude_){0}
+    , decltype(_impl_.min_longitude_){0}
+    , decltype(_impl_.cell_latitude_){0}
+    , decltype(_impl_.cell_longitude_){0}
+    , decltype(_impl_.rows_){0u}
+    , decltype(_impl_.cols_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GeoIndex::~GeoIndex() {
+  // @@protoc_insertion_point(destructor:TCProto.GeoIndex)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GeoIndex::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.names_.~RepeatedPtrField();
+}
+
+void GeoIndex::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GeoIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:TCProto.GeoIndex)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.names_.Clear();
+  ::memset(&_impl_.min_latitude_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.cols_) -
+      reinterpret_cast<char*>(&_impl_.min_latitude_)) + sizeof(_impl_.cols_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GeoIndex::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double min_latitude = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.min_latitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double min_longitude = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.min_longitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
         continue;
-      // .TCProto.TransportRouter router = 3;
+      // double cell_latitude = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_router(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.cell_latitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
         continue;
-      // .TCProto.Painter painter = 4;
+      // double cell_longitude = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_painter(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.cell_longitude_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
         continue;
-      // .YellowPages.Database companies = 5;
+      // uint32 rows = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_companies(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.rows_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 cols = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.cols_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string names = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_names();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "TCProto.GeoIndex.names"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TransportCatalog::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:TCProto.TransportCatalog)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* GeoIndex::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TCProto.GeoIndex)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .TCProto.StopResponse stops = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_stops_size()); i < n; i++) {
+  // double min_latitude = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_latitude = this->_internal_min_latitude();
+  uint64_t raw_min_latitude;
+  memcpy(&raw_min_latitude, &tmp_min_latitude, sizeof(tmp_min_latitude));
+  if (raw_min_latitude != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_stops(i), target, stream);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_min_latitude(), target);
   }
 
-  // repeated .TCProto.BusResponse buses = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_buses_size()); i < n; i++) {
+  // double min_longitude = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_longitude = this->_internal_min_longitude();
+  uint64_t raw_min_longitude;
+  memcpy(&raw_min_longitude, &tmp_min_longitude, sizeof(tmp_min_longitude));
+  if (raw_min_longitude != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_buses(i), target, stream);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_min_longitude(), target);
   }
 
-  // .TCProto.TransportRouter router = 3;
-  if (this->has_router()) {
+  // double cell_latitude = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_cell_latitude = this->_internal_cell_latitude();
+  uint64_t raw_cell_latitude;
+  memcpy(&raw_cell_latitude, &tmp_cell_latitude, sizeof(tmp_cell_latitude));
+  if (raw_cell_latitude != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::router(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_cell_latitude(), target);
   }
 
-  // .TCProto.Painter painter = 4;
-  if (this->has_painter()) {
+  // double cell_longitude = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_cell_longitude = this->_internal_cell_longitude();
+  uint64_t raw_cell_longitude;
+  memcpy(&raw_cell_longitude, &tmp_cell_longitude, sizeof(tmp_cell_longitude));
+  if (raw_cell_longitude != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::painter(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_cell_longitude(), target);
   }
 
-  // .YellowPages.Database companies = 5;
-  if (this->has_companies()) {
+  // uint32 rows = 5;
+  if (this->_internal_rows() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::companies(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_rows(), target);
+  }
+
+  // uint32 cols = 6;
+  if (this->_internal_cols() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_cols(), target);
+  }
+
+  // repeated string names = 7;
+  for (int i = 0, n = this->_internal_names_size(); i < n; i++) {
+    const auto& s = this->_internal_names(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TCProto.GeoIndex.names");
+    target = stream->WriteString(7, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:TCProto.TransportCatalog)
+  // @@protoc_insertion_point(serialize_to_array_end:TCProto.GeoIndex)
   return target;
 }
 
-size_t TransportCatalog::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:TCProto.TransportCatalog)
+size_t GeoIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TCProto.GeoIndex)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .TCProto.StopResponse stops = 1;
-  total_size += 1UL * this->_internal_stops_size();
-  for (const auto& msg : this->stops_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // repeated string names = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.names_.size());
+  for (int i = 0, n = _impl_.names_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.names_.Get(i));
   }
 
-  // repeated .TCProto.BusResponse buses = 2;
-  total_size += 1UL * this->_internal_buses_size();
-  for (const auto& msg : this->buses_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // double min_latitude = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_latitude = this->_internal_min_latitude();
+  uint64_t raw_min_latitude;
+  memcpy(&raw_min_latitude, &tmp_min_latitude, sizeof(tmp_min_latitude));
+  if (raw_min_latitude != 0) {
+    total_size += 1 + 8;
   }
 
-  // .TCProto.TransportRouter router = 3;
-  if (this->has_router()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *router_);
+  // double min_longitude = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_longitude = this->_internal_min_longitude();
+  uint64_t raw_min_longitude;
+  memcpy(&raw_min_longitude, &tmp_min_longitude, sizeof(tmp_min_longitude));
+  if (raw_min_longitude != 0) {
+    total_size += 1 + 8;
   }
 
-  // .TCProto.Painter painter = 4;
-  if (this->has_painter()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *painter_);
+  // double cell_latitude = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_cell_latitude = this->_internal_cell_latitude();
+  uint64_t raw_cell_latitude;
+  memcpy(&raw_cell_latitude, &tmp_cell_latitude, sizeof(tmp_cell_latitude));
+  if (raw_cell_latitude != 0) {
+    total_size += 1 + 8;
   }
 
-  // .YellowPages.Database companies = 5;
-  if (this->has_companies()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *companies_);
+  // double cell_longitude = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_cell_longitude = this->_internal_cell_longitude();
+  uint64_t raw_cell_longitude;
+  memcpy(&raw_cell_longitude, &tmp_cell_longitude, sizeof(tmp_cell_longitude));
+  if (raw_cell_longitude != 0) {
+    total_size += 1 + 8;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 rows = 5;
+  if (this->_internal_rows() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_rows());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void TransportCatalog::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.TransportCatalog)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TransportCatalog* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TransportCatalog>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.TransportCatalog)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.TransportCatalog)
-    MergeFrom(*source);
+
+  // uint32 cols = 6;
+  if (this->_internal_cols() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cols());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TransportCatalog::MergeFrom(const TransportCatalog& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.TransportCatalog)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GeoIndex::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GeoIndex::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GeoIndex::GetClassData() const { return &_class_data_; }
+
+
+void GeoIndex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GeoIndex*>(&to_msg);
+  auto& from = static_cast<const GeoIndex&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.GeoIndex)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  stops_.MergeFrom(from.stops_);
-  buses_.MergeFrom(from.buses_);
-  if (from.has_router()) {
-    _internal_mutable_router()->::TCProto::TransportRouter::MergeFrom(from._internal_router());
+  _this->_impl_.names_.MergeFrom(from._impl_.names_);
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_latitude = from._internal_min_latitude();
+  uint64_t raw_min_latitude;
+  memcpy(&raw_min_latitude, &tmp_min_latitude, sizeof(tmp_min_latitude));
+  if (raw_min_latitude != 0) {
+    _this->_internal_set_min_latitude(from._internal_min_latitude());
   }
-  if (from.has_painter()) {
-    _internal_mutable_painter()->::TCProto::Painter::MergeFrom(from._internal_painter());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_min_longitude = from._internal_min_longitude();
+  uint64_t raw_min_longitude;
+  memcpy(&raw_min_longitude, &tmp_min_longitude, sizeof(tmp_min_longitude));
+  if (raw_min_longitude != 0) {
+    _this->_internal_set_min_longitude(from._internal_min_longitude());
   }
-  if (from.has_companies()) {
-    _internal_mutable_companies()->::YellowPages::Database::MergeFrom(from._internal_companies());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_cell_latitude = from._internal_cell_latitude();
+  uint64_t raw_cell_latitude;
+  memcpy(&raw_cell_latitude, &tmp_cell_latitude, sizeof(tmp_cell_latitude));
+  if (raw_cell_latitude != 0) {
+    _this->_internal_set_cell_latitude(from._internal_cell_latitude());
   }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_cell_longitude = from._internal_cell_longitude();
+  uint64_t raw_cell_longitude;
+  memcpy(&raw_cell_longitude, &tmp_cell_longitude, sizeof(tmp_cell_longitude));
+  if (raw_cell_longitude != 0) {
+    _this->_internal_set_cell_longitude(from._internal_cell_longitude());
+  }
+  if (from._internal_rows() != 0) {
+    _this->_internal_set_rows(from._internal_rows());
+  }
+  if (from._internal_cols() != 0) {
+    _this->_internal_set_cols(from._internal_cols());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void TransportCatalog::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.TransportCatalog)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void TransportCatalog::CopyFrom(const TransportCatalog& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:TCProto.TransportCatalog)
+void GeoIndex::CopyFrom(const GeoIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TCProto.GeoIndex)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool TransportCatalog::IsInitialized() const {
+bool GeoIndex::IsInitialized() const {
   return true;
 }
 
-void TransportCatalog::InternalSwap(TransportCatalog* other) {
+void GeoIndex::InternalSwap(GeoIndex* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  stops_.InternalSwap(&other->stops_);
-  buses_.InternalSwap(&other->buses_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.names_.InternalSwap(&other->_impl_.names_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TransportCatalog, companies_)
-      + sizeof(TransportCatalog::companies_)
-      - PROTOBUF_FIELD_OFFSET(TransportCatalog, router_)>(
-          reinterpret_cast<char*>(&router_),
-          reinterpret_cast<char*>(&other->router_));
+      PROTOBUF_FIELD_OFFSET(GeoIndex, _impl_.cols_)
+      + sizeof(GeoIndex::_impl_.cols_)
+      - PROTOBUF_FIELD_OFFSET(GeoIndex, _impl_.min_latitude_)>(
+          reinterpret_cast<char*>(&_impl_.min_latitude_),
+          reinterpret_cast<char*>(&other->_impl_.min_latitude_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata TransportCatalog::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata GeoIndex::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalog_2eproto_getter, &descriptor_table_transport_5fcatalog_2eproto_once,
+      file_level_metadata_transport_5fcatalog_2eproto[3]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace TCProto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::TCProto::StopResponse* Arena::CreateMaybeMessage< ::TCProto::StopResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::StopResponse*
+Arena::CreateMaybeMessage< ::TCProto::StopResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::StopResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::BusResponse* Arena::CreateMaybeMessage< ::TCProto::BusResponse >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::BusResponse*
+Arena::CreateMaybeMessage< ::TCProto::BusResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::BusResponse >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::TransportCatalog* Arena::CreateMaybeMessage< ::TCProto::TransportCatalog >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::TransportCatalog*
+Arena::CreateMaybeMessage< ::TCProto::TransportCatalog >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::TransportCatalog >(arena);
 }
+template<> PROTOBUF_NOINLINE ::TCProto::GeoIndex*
+Arena::CreateMaybeMessage< ::TCProto::GeoIndex >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TCProto::GeoIndex >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -31,9 +30,6 @@
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
-#include "painter.pb.h"
-#include "transport_router.pb.h"
-#include "database.pb.h"
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_transport_5fcatalog_2eproto
@@ -45,30 +41,26 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_transport_5fcatalog_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5fcatalog_2eproto;
 namespace TCProto {
 class BusResponse;
-class BusResponseDefaultTypeInternal;
+struct BusResponseDefaultTypeInternal;
 extern BusResponseDefaultTypeInternal _BusResponse_default_instance_;
+class GeoIndex;
+struct GeoIndexDefaultTypeInternal;
+extern GeoIndexDefaultTypeInternal _GeoIndex_default_instance_;
 class StopResponse;
-class StopResponseDefaultTypeInternal;
+struct StopResponseDefaultTypeInternal;
 extern StopResponseDefaultTypeInternal _StopResponse_default_instance_;
 class TransportCatalog;
-class TransportCatalogDefaultTypeInternal;
+struct TransportCatalogDefaultTypeInternal;
 extern TransportCatalogDefaultTypeInternal _TransportCatalog_default_instance_;
 }  // namespace TCProto
 PROTOBUF_NAMESPACE_OPEN
 template<> ::TCProto::BusResponse* Arena::CreateMaybeMessage<::TCProto::BusResponse>(Arena*);
+template<> ::TCProto::GeoIndex* Arena::CreateMaybeMessage<::TCProto::GeoIndex>(Arena*);
 template<> ::TCProto::StopResponse* Arena::CreateMaybeMessage<::TCProto::StopResponse>(Arena*);
 template<> ::TCProto::TransportCatalog* Arena::CreateMaybeMessage<::TCProto::TransportCatalog>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -76,11 +68,12 @@ namespace TCProto {
 
 // ===================================================================
 
-class StopResponse PROTOBUF_FINAL :
+class StopResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.StopResponse) */ {
  public:
   inline StopResponse() : StopResponse(nullptr) {}
-  virtual ~StopResponse();
+  ~StopResponse() override;
+  explicit PROTOBUF_CONSTEXPR StopResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StopResponse(const StopResponse& from);
   StopResponse(StopResponse&& from) noexcept
@@ -93,8 +86,13 @@ class StopResponse PROTOBUF_FINAL :
     return *this;
   }
   inline StopResponse& operator=(StopResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -105,13 +103,14 @@ class StopResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StopResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const StopResponse& default_instance();
-
   static inline const StopResponse* internal_default_instance() {
     return reinterpret_cast<const StopResponse*>(
                &_StopResponse_default_instance_);
@@ -124,7 +123,12 @@ class StopResponse PROTOBUF_FINAL :
   }
   inline void Swap(StopResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -132,56 +136,53 @@ class StopResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(StopResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline StopResponse* New() const final {
-    return CreateMaybeMessage<StopResponse>(nullptr);
-  }
-
-  StopResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  StopResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<StopResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StopResponse& from);
-  void MergeFrom(const StopResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StopResponse& from) {
+    StopResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StopResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.StopResponse";
   }
   protected:
-  explicit StopResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit StopResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5fcatalog_2eproto);
-    return ::descriptor_table_transport_5fcatalog_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -218,16 +219,14 @@ class StopResponse PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -238,18 +237,22 @@ class StopResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bus_names_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> bus_names_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalog_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BusResponse PROTOBUF_FINAL :
+class BusResponse final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.BusResponse) */ {
  public:
   inline BusResponse() : BusResponse(nullptr) {}
-  virtual ~BusResponse();
+  ~BusResponse() override;
+  explicit PROTOBUF_CONSTEXPR BusResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BusResponse(const BusResponse& from);
   BusResponse(BusResponse&& from) noexcept
@@ -262,8 +265,13 @@ class BusResponse PROTOBUF_FINAL :
     return *this;
   }
   inline BusResponse& operator=(BusResponse&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -274,13 +282,14 @@ class BusResponse PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BusResponse& default_instance() {
+    return *internal_default_instance();
   }
-  static const BusResponse& default_instance();
-
   static inline const BusResponse* internal_default_instance() {
     return reinterpret_cast<const BusResponse*>(
                &_BusResponse_default_instance_);
@@ -293,7 +302,12 @@ class BusResponse PROTOBUF_FINAL :
   }
   inline void Swap(BusResponse* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -301,56 +315,53 @@ class BusResponse PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(BusResponse* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BusResponse* New() const final {
-    return CreateMaybeMessage<BusResponse>(nullptr);
-  }
-
-  BusResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BusResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BusResponse>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BusResponse& from);
-  void MergeFrom(const BusResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BusResponse& from) {
+    BusResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BusResponse* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.BusResponse";
   }
   protected:
-  explicit BusResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BusResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5fcatalog_2eproto);
-    return ::descriptor_table_transport_5fcatalog_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -366,35 +377,33 @@ class BusResponse PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
   // uint32 stop_count = 2;
   void clear_stop_count();
-  ::PROTOBUF_NAMESPACE_ID::uint32 stop_count() const;
-  void set_stop_count(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t stop_count() const;
+  void set_stop_count(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_stop_count() const;
-  void _internal_set_stop_count(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_stop_count() const;
+  void _internal_set_stop_count(uint32_t value);
   public:
 
   // uint32 unique_stop_count = 3;
   void clear_unique_stop_count();
-  ::PROTOBUF_NAMESPACE_ID::uint32 unique_stop_count() const;
-  void set_unique_stop_count(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t unique_stop_count() const;
+  void set_unique_stop_count(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_unique_stop_count() const;
-  void _internal_set_unique_stop_count(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_unique_stop_count() const;
+  void _internal_set_unique_stop_count(uint32_t value);
   public:
 
   // double geo_route_length = 5;
@@ -408,11 +417,11 @@ class BusResponse PROTOBUF_FINAL :
 
   // uint32 road_route_length = 4;
   void clear_road_route_length();
-  ::PROTOBUF_NAMESPACE_ID::uint32 road_route_length() const;
-  void set_road_route_length(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t road_route_length() const;
+  void set_road_route_length(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_road_route_length() const;
-  void _internal_set_road_route_length(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_road_route_length() const;
+  void _internal_set_road_route_length(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:TCProto.BusResponse)
@@ -422,21 +431,25 @@ class BusResponse PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 stop_count_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 unique_stop_count_;
-  double geo_route_length_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 road_route_length_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t stop_count_;
+    uint32_t unique_stop_count_;
+    double geo_route_length_;
+    uint32_t road_route_length_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalog_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransportCatalog PROTOBUF_FINAL :
+class TransportCatalog final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.TransportCatalog) */ {
  public:
   inline TransportCatalog() : TransportCatalog(nullptr) {}
-  virtual ~TransportCatalog();
+  ~TransportCatalog() override;
+  explicit PROTOBUF_CONSTEXPR TransportCatalog(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransportCatalog(const TransportCatalog& from);
   TransportCatalog(TransportCatalog&& from) noexcept
@@ -449,8 +462,13 @@ class TransportCatalog PROTOBUF_FINAL :
     return *this;
   }
   inline TransportCatalog& operator=(TransportCatalog&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -461,13 +479,14 @@ class TransportCatalog PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransportCatalog& default_instance() {
+    return *internal_default_instance();
   }
-  static const TransportCatalog& default_instance();
-
   static inline const TransportCatalog* internal_default_instance() {
     return reinterpret_cast<const TransportCatalog*>(
                &_TransportCatalog_default_instance_);
@@ -480,7 +499,12 @@ class TransportCatalog PROTOBUF_FINAL :
   }
   inline void Swap(TransportCatalog* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -488,56 +512,53 @@ class TransportCatalog PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(TransportCatalog* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TransportCatalog* New() const final {
-    return CreateMaybeMessage<TransportCatalog>(nullptr);
-  }
-
-  TransportCatalog* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TransportCatalog* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransportCatalog>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransportCatalog& from);
-  void MergeFrom(const TransportCatalog& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransportCatalog& from) {
+    TransportCatalog::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransportCatalog* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.TransportCatalog";
   }
   protected:
-  explicit TransportCatalog(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit TransportCatalog(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5fcatalog_2eproto);
-    return ::descriptor_table_transport_5fcatalog_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -546,9 +567,6 @@ class TransportCatalog PROTOBUF_FINAL :
   enum : int {
     kStopsFieldNumber = 1,
     kBusesFieldNumber = 2,
-    kRouterFieldNumber = 3,
-    kPainterFieldNumber = 4,
-    kCompaniesFieldNumber = 5,
   };
   // repeated .TCProto.StopResponse stops = 1;
   int stops_size() const;
@@ -586,73 +604,248 @@ class TransportCatalog PROTOBUF_FINAL :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusResponse >&
       buses() const;
 
-  // .TCProto.TransportRouter router = 3;
-  bool has_router() const;
+  // @@protoc_insertion_point(class_scope:TCProto.TransportCatalog)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopResponse > stops_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusResponse > buses_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalog_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GeoIndex final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.GeoIndex) */ {
+ public:
+  inline GeoIndex() : GeoIndex(nullptr) {}
+  ~GeoIndex() override;
+  explicit PROTOBUF_CONSTEXPR GeoIndex(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GeoIndex(const GeoIndex& from);
+  GeoIndex(GeoIndex&& from) noexcept
+    : GeoIndex() {
+    *this = ::std::move(from);
+  }
+
+  inline GeoIndex& operator=(const GeoIndex& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GeoIndex& operator=(GeoIndex&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GeoIndex& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GeoIndex* internal_default_instance() {
+    return reinterpret_cast<const GeoIndex*>(
+               &_GeoIndex_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(GeoIndex& a, GeoIndex& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GeoIndex* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GeoIndex* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GeoIndex* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GeoIndex>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GeoIndex& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GeoIndex& from) {
+    GeoIndex::MergeImpl(*this, from);
+  }
   private:
-  bool _internal_has_router() const;
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  void clear_router();
-  const ::TCProto::TransportRouter& router() const;
-  ::TCProto::TransportRouter* release_router();
-  ::TCProto::TransportRouter* mutable_router();
-  void set_allocated_router(::TCProto::TransportRouter* router);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  const ::TCProto::TransportRouter& _internal_router() const;
-  ::TCProto::TransportRouter* _internal_mutable_router();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GeoIndex* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TCProto.GeoIndex";
+  }
+  protected:
+  explicit GeoIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  void unsafe_arena_set_allocated_router(
-      ::TCProto::TransportRouter* router);
-  ::TCProto::TransportRouter* unsafe_arena_release_router();
 
-  // .TCProto.Painter painter = 4;
-  bool has_painter() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNamesFieldNumber = 7,
+    kMinLatitudeFieldNumber = 1,
+    kMinLongitudeFieldNumber = 2,
+    kCellLatitudeFieldNumber = 3,
+    kCellLongitudeFieldNumber = 4,
+    kRowsFieldNumber = 5,
+    kColsFieldNumber = 6,
+  };
+  // repeated string names = 7;
+  int names_size() const;
   private:
-  bool _internal_has_painter() const;
+  int _internal_names_size() const;
   public:
-  void clear_painter();
-  const ::TCProto::Painter& painter() const;
-  ::TCProto::Painter* release_painter();
-  ::TCProto::Painter* mutable_painter();
-  void set_allocated_painter(::TCProto::Painter* painter);
+  void clear_names();
+  const std::string& names(int index) const;
+  std::string* mutable_names(int index);
+  void set_names(int index, const std::string& value);
+  void set_names(int index, std::string&& value);
+  void set_names(int index, const char* value);
+  void set_names(int index, const char* value, size_t size);
+  std::string* add_names();
+  void add_names(const std::string& value);
+  void add_names(std::string&& value);
+  void add_names(const char* value);
+  void add_names(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& names() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_names();
   private:
-  const ::TCProto::Painter& _internal_painter() const;
-  ::TCProto::Painter* _internal_mutable_painter();
+  const std::string& _internal_names(int index) const;
+  std::string* _internal_add_names();
   public:
-  void unsafe_arena_set_allocated_painter(
-      ::TCProto::Painter* painter);
-  ::TCProto::Painter* unsafe_arena_release_painter();
 
-  // .YellowPages.Database companies = 5;
-  bool has_companies() const;
+  // double min_latitude = 1;
+  void clear_min_latitude();
+  double min_latitude() const;
+  void set_min_latitude(double value);
   private:
-  bool _internal_has_companies() const;
+  double _internal_min_latitude() const;
+  void _internal_set_min_latitude(double value);
   public:
-  void clear_companies();
-  const ::YellowPages::Database& companies() const;
-  ::YellowPages::Database* release_companies();
-  ::YellowPages::Database* mutable_companies();
-  void set_allocated_companies(::YellowPages::Database* companies);
+
+  // double min_longitude = 2;
+  void clear_min_longitude();
+  double min_longitude() const;
+  void set_min_longitude(double value);
   private:
-  const ::YellowPages::Database& _internal_companies() const;
-  ::YellowPages::Database* _internal_mutable_companies();
+  double _internal_min_longitude() const;
+  void _internal_set_min_longitude(double value);
   public:
-  void unsafe_arena_set_allocated_companies(
-      ::YellowPages::Database* companies);
-  ::YellowPages::Database* unsafe_arena_release_companies();
 
-  // @@protoc_insertion_point(class_scope:TCProto.TransportCatalog)
+  // double cell_latitude = 3;
+  void clear_cell_latitude();
+  double cell_latitude() const;
+  void set_cell_latitude(double value);
+  private:
+  double _internal_cell_latitude() const;
+  void _internal_set_cell_latitude(double value);
+  public:
+
+  // double cell_longitude = 4;
+  void clear_cell_longitude();
+  double cell_longitude() const;
+  void set_cell_longitude(double value);
+  private:
+  double _internal_cell_longitude() const;
+  void _internal_set_cell_longitude(double value);
+  public:
+
+  // uint32 rows = 5;
+  void clear_rows();
+  uint32_t rows() const;
+  void set_rows(uint32_t value);
+  private:
+  uint32_t _internal_rows() const;
+  void _internal_set_rows(uint32_t value);
+  public:
+
+  // uint32 cols = 6;
+  void clear_cols();
+  uint32_t cols() const;
+  void set_cols(uint32_t value);
+  private:
+  uint32_t _internal_cols() const;
+  void _internal_set_cols(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TCProto.GeoIndex)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopResponse > stops_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusResponse > buses_;
-  ::TCProto::TransportRouter* router_;
-  ::TCProto::Painter* painter_;
-  ::YellowPages::Database* companies_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> names_;
+    double min_latitude_;
+    double min_longitude_;
+    double cell_latitude_;
+    double cell_longitude_;
+    uint32_t rows_;
+    uint32_t cols_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5fcatalog_2eproto;
 };
 // ===================================================================
@@ -668,53 +861,38 @@ class TransportCatalog PROTOBUF_FINAL :
 
 // string name = 1;
 inline void StopResponse::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& StopResponse::name() const {
   // @@protoc_insertion_point(field_get:TCProto.StopResponse.name)
   return _internal_name();
 }
-inline void StopResponse::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StopResponse::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.StopResponse.name)
 }
 inline std::string* StopResponse::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:TCProto.StopResponse.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& StopResponse::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void StopResponse::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void StopResponse::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.StopResponse.name)
-}
-inline void StopResponse::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.StopResponse.name)
-}
-inline void StopResponse::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.StopResponse.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* StopResponse::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* StopResponse::release_name() {
   // @@protoc_insertion_point(field_release:TCProto.StopResponse.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void StopResponse::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -722,27 +900,32 @@ inline void StopResponse::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.StopResponse.name)
 }
 
 // repeated string bus_names = 2;
 inline int StopResponse::_internal_bus_names_size() const {
-  return bus_names_.size();
+  return _impl_.bus_names_.size();
 }
 inline int StopResponse::bus_names_size() const {
   return _internal_bus_names_size();
 }
 inline void StopResponse::clear_bus_names() {
-  bus_names_.Clear();
+  _impl_.bus_names_.Clear();
 }
 inline std::string* StopResponse::add_bus_names() {
+  std::string* _s = _internal_add_bus_names();
   // @@protoc_insertion_point(field_add_mutable:TCProto.StopResponse.bus_names)
-  return _internal_add_bus_names();
+  return _s;
 }
 inline const std::string& StopResponse::_internal_bus_names(int index) const {
-  return bus_names_.Get(index);
+  return _impl_.bus_names_.Get(index);
 }
 inline const std::string& StopResponse::bus_names(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.StopResponse.bus_names)
@@ -750,55 +933,55 @@ inline const std::string& StopResponse::bus_names(int index) const {
 }
 inline std::string* StopResponse::mutable_bus_names(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.StopResponse.bus_names)
-  return bus_names_.Mutable(index);
+  return _impl_.bus_names_.Mutable(index);
 }
 inline void StopResponse::set_bus_names(int index, const std::string& value) {
+  _impl_.bus_names_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set:TCProto.StopResponse.bus_names)
-  bus_names_.Mutable(index)->assign(value);
 }
 inline void StopResponse::set_bus_names(int index, std::string&& value) {
+  _impl_.bus_names_.Mutable(index)->assign(std::move(value));
   // @@protoc_insertion_point(field_set:TCProto.StopResponse.bus_names)
-  bus_names_.Mutable(index)->assign(std::move(value));
 }
 inline void StopResponse::set_bus_names(int index, const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  bus_names_.Mutable(index)->assign(value);
+  _impl_.bus_names_.Mutable(index)->assign(value);
   // @@protoc_insertion_point(field_set_char:TCProto.StopResponse.bus_names)
 }
 inline void StopResponse::set_bus_names(int index, const char* value, size_t size) {
-  bus_names_.Mutable(index)->assign(
+  _impl_.bus_names_.Mutable(index)->assign(
     reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_set_pointer:TCProto.StopResponse.bus_names)
 }
 inline std::string* StopResponse::_internal_add_bus_names() {
-  return bus_names_.Add();
+  return _impl_.bus_names_.Add();
 }
 inline void StopResponse::add_bus_names(const std::string& value) {
-  bus_names_.Add()->assign(value);
+  _impl_.bus_names_.Add()->assign(value);
   // @@protoc_insertion_point(field_add:TCProto.StopResponse.bus_names)
 }
 inline void StopResponse::add_bus_names(std::string&& value) {
-  bus_names_.Add(std::move(value));
+  _impl_.bus_names_.Add(std::move(value));
   // @@protoc_insertion_point(field_add:TCProto.StopResponse.bus_names)
 }
 inline void StopResponse::add_bus_names(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
-  bus_names_.Add()->assign(value);
+  _impl_.bus_names_.Add()->assign(value);
   // @@protoc_insertion_point(field_add_char:TCProto.StopResponse.bus_names)
 }
 inline void StopResponse::add_bus_names(const char* value, size_t size) {
-  bus_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  _impl_.bus_names_.Add()->assign(reinterpret_cast<const char*>(value), size);
   // @@protoc_insertion_point(field_add_pointer:TCProto.StopResponse.bus_names)
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
 StopResponse::bus_names() const {
   // @@protoc_insertion_point(field_list:TCProto.StopResponse.bus_names)
-  return bus_names_;
+  return _impl_.bus_names_;
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
 StopResponse::mutable_bus_names() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.StopResponse.bus_names)
-  return &bus_names_;
+  return &_impl_.bus_names_;
 }
 
 // -------------------------------------------------------------------
@@ -807,53 +990,38 @@ StopResponse::mutable_bus_names() {
 
 // string name = 1;
 inline void BusResponse::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& BusResponse::name() const {
   // @@protoc_insertion_point(field_get:TCProto.BusResponse.name)
   return _internal_name();
 }
-inline void BusResponse::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BusResponse::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.BusResponse.name)
 }
 inline std::string* BusResponse::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:TCProto.BusResponse.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& BusResponse::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void BusResponse::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void BusResponse::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.BusResponse.name)
-}
-inline void BusResponse::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.BusResponse.name)
-}
-inline void BusResponse::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.BusResponse.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BusResponse::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BusResponse::release_name() {
   // @@protoc_insertion_point(field_release:TCProto.BusResponse.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void BusResponse::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -861,77 +1029,81 @@ inline void BusResponse::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.BusResponse.name)
 }
 
 // uint32 stop_count = 2;
 inline void BusResponse::clear_stop_count() {
-  stop_count_ = 0u;
+  _impl_.stop_count_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusResponse::_internal_stop_count() const {
-  return stop_count_;
+inline uint32_t BusResponse::_internal_stop_count() const {
+  return _impl_.stop_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusResponse::stop_count() const {
+inline uint32_t BusResponse::stop_count() const {
   // @@protoc_insertion_point(field_get:TCProto.BusResponse.stop_count)
   return _internal_stop_count();
 }
-inline void BusResponse::_internal_set_stop_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusResponse::_internal_set_stop_count(uint32_t value) {
   
-  stop_count_ = value;
+  _impl_.stop_count_ = value;
 }
-inline void BusResponse::set_stop_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusResponse::set_stop_count(uint32_t value) {
   _internal_set_stop_count(value);
   // @@protoc_insertion_point(field_set:TCProto.BusResponse.stop_count)
 }
 
 // uint32 unique_stop_count = 3;
 inline void BusResponse::clear_unique_stop_count() {
-  unique_stop_count_ = 0u;
+  _impl_.unique_stop_count_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusResponse::_internal_unique_stop_count() const {
-  return unique_stop_count_;
+inline uint32_t BusResponse::_internal_unique_stop_count() const {
+  return _impl_.unique_stop_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusResponse::unique_stop_count() const {
+inline uint32_t BusResponse::unique_stop_count() const {
   // @@protoc_insertion_point(field_get:TCProto.BusResponse.unique_stop_count)
   return _internal_unique_stop_count();
 }
-inline void BusResponse::_internal_set_unique_stop_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusResponse::_internal_set_unique_stop_count(uint32_t value) {
   
-  unique_stop_count_ = value;
+  _impl_.unique_stop_count_ = value;
 }
-inline void BusResponse::set_unique_stop_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusResponse::set_unique_stop_count(uint32_t value) {
   _internal_set_unique_stop_count(value);
   // @@protoc_insertion_point(field_set:TCProto.BusResponse.unique_stop_count)
 }
 
 // uint32 road_route_length = 4;
 inline void BusResponse::clear_road_route_length() {
-  road_route_length_ = 0u;
+  _impl_.road_route_length_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusResponse::_internal_road_route_length() const {
-  return road_route_length_;
+inline uint32_t BusResponse::_internal_road_route_length() const {
+  return _impl_.road_route_length_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusResponse::road_route_length() const {
+inline uint32_t BusResponse::road_route_length() const {
   // @@protoc_insertion_point(field_get:TCProto.BusResponse.road_route_length)
   return _internal_road_route_length();
 }
-inline void BusResponse::_internal_set_road_route_length(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusResponse::_internal_set_road_route_length(uint32_t value) {
   
-  road_route_length_ = value;
+  _impl_.road_route_length_ = value;
 }
-inline void BusResponse::set_road_route_length(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusResponse::set_road_route_length(uint32_t value) {
   _internal_set_road_route_length(value);
   // @@protoc_insertion_point(field_set:TCProto.BusResponse.road_route_length)
 }
 
 // double geo_route_length = 5;
 inline void BusResponse::clear_geo_route_length() {
-  geo_route_length_ = 0;
+  _impl_.geo_route_length_ = 0;
 }
 inline double BusResponse::_internal_geo_route_length() const {
-  return geo_route_length_;
+  return _impl_.geo_route_length_;
 }
 inline double BusResponse::geo_route_length() const {
   // @@protoc_insertion_point(field_get:TCProto.BusResponse.geo_route_length)
@@ -939,7 +1111,7 @@ inline double BusResponse::geo_route_length() const {
 }
 inline void BusResponse::_internal_set_geo_route_length(double value) {
   
-  geo_route_length_ = value;
+  _impl_.geo_route_length_ = value;
 }
 inline void BusResponse::set_geo_route_length(double value) {
   _internal_set_geo_route_length(value);
@@ -952,311 +1124,281 @@ inline void BusResponse::set_geo_route_length(double value) {
 
 // repeated .TCProto.StopResponse stops = 1;
 inline int TransportCatalog::_internal_stops_size() const {
-  return stops_.size();
+  return _impl_.stops_.size();
 }
 inline int TransportCatalog::stops_size() const {
   return _internal_stops_size();
 }
 inline void TransportCatalog::clear_stops() {
-  stops_.Clear();
+  _impl_.stops_.Clear();
 }
 inline ::TCProto::StopResponse* TransportCatalog::mutable_stops(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.TransportCatalog.stops)
-  return stops_.Mutable(index);
+  return _impl_.stops_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopResponse >*
 TransportCatalog::mutable_stops() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.TransportCatalog.stops)
-  return &stops_;
+  return &_impl_.stops_;
 }
 inline const ::TCProto::StopResponse& TransportCatalog::_internal_stops(int index) const {
-  return stops_.Get(index);
+  return _impl_.stops_.Get(index);
 }
 inline const ::TCProto::StopResponse& TransportCatalog::stops(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.TransportCatalog.stops)
   return _internal_stops(index);
 }
 inline ::TCProto::StopResponse* TransportCatalog::_internal_add_stops() {
-  return stops_.Add();
+  return _impl_.stops_.Add();
 }
 inline ::TCProto::StopResponse* TransportCatalog::add_stops() {
+  ::TCProto::StopResponse* _add = _internal_add_stops();
   // @@protoc_insertion_point(field_add:TCProto.TransportCatalog.stops)
-  return _internal_add_stops();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopResponse >&
 TransportCatalog::stops() const {
   // @@protoc_insertion_point(field_list:TCProto.TransportCatalog.stops)
-  return stops_;
+  return _impl_.stops_;
 }
 
 // repeated .TCProto.BusResponse buses = 2;
 inline int TransportCatalog::_internal_buses_size() const {
-  return buses_.size();
+  return _impl_.buses_.size();
 }
 inline int TransportCatalog::buses_size() const {
   return _internal_buses_size();
 }
 inline void TransportCatalog::clear_buses() {
-  buses_.Clear();
+  _impl_.buses_.Clear();
 }
 inline ::TCProto::BusResponse* TransportCatalog::mutable_buses(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.TransportCatalog.buses)
-  return buses_.Mutable(index);
+  return _impl_.buses_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusResponse >*
 TransportCatalog::mutable_buses() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.TransportCatalog.buses)
-  return &buses_;
+  return &_impl_.buses_;
 }
 inline const ::TCProto::BusResponse& TransportCatalog::_internal_buses(int index) const {
-  return buses_.Get(index);
+  return _impl_.buses_.Get(index);
 }
 inline const ::TCProto::BusResponse& TransportCatalog::buses(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.TransportCatalog.buses)
   return _internal_buses(index);
 }
 inline ::TCProto::BusResponse* TransportCatalog::_internal_add_buses() {
-  return buses_.Add();
+  return _impl_.buses_.Add();
 }
 inline ::TCProto::BusResponse* TransportCatalog::add_buses() {
+  ::TCProto::BusResponse* _add = _internal_add_buses();
   // @@protoc_insertion_point(field_add:TCProto.TransportCatalog.buses)
-  return _internal_add_buses();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::BusResponse >&
 TransportCatalog::buses() const {
   // @@protoc_insertion_point(field_list:TCProto.TransportCatalog.buses)
-  return buses_;
+  return _impl_.buses_;
 }
 
-// .TCProto.TransportRouter router = 3;
-inline bool TransportCatalog::_internal_has_router() const {
-  return this != internal_default_instance() && router_ != nullptr;
+// -------------------------------------------------------------------
+
+// GeoIndex
+
+// double min_latitude = 1;
+inline void GeoIndex::clear_min_latitude() {
+  _impl_.min_latitude_ = 0;
 }
-inline bool TransportCatalog::has_router() const {
-  return _internal_has_router();
+inline double GeoIndex::_internal_min_latitude() const {
+  return _impl_.min_latitude_;
 }
-inline const ::TCProto::TransportRouter& TransportCatalog::_internal_router() const {
-  const ::TCProto::TransportRouter* p = router_;
-  return p != nullptr ? *p : reinterpret_cast<const ::TCProto::TransportRouter&>(
-      ::TCProto::_TransportRouter_default_instance_);
+inline double GeoIndex::min_latitude() const {
+  // @@protoc_insertion_point(field_get:TCProto.GeoIndex.min_latitude)
+  return _internal_min_latitude();
 }
-inline const ::TCProto::TransportRouter& TransportCatalog::router() const {
-  // @@protoc_insertion_point(field_get:TCProto.TransportCatalog.router)
-  return _internal_router();
+inline void GeoIndex::_internal_set_min_latitude(double value) {
+  
+  _impl_.min_latitude_ = value;
 }
-inline void TransportCatalog::unsafe_arena_set_allocated_router(
-    ::TCProto::TransportRouter* router) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router_);
-  }
-  router_ = router;
-  if (router) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TCProto.TransportCatalog.router)
+inline void GeoIndex::set_min_latitude(double value) {
+  _internal_set_min_latitude(value);
+  // @@protoc_insertion_point(field_set:TCProto.GeoIndex.min_latitude)
 }
-inline ::TCProto::TransportRouter* TransportCatalog::release_router() {
-  
-  ::TCProto::TransportRouter* temp = router_;
-  router_ = nullptr;
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+
+// double min_longitude = 2;
+inline void GeoIndex::clear_min_longitude() {
+  _impl_.min_longitude_ = 0;
 }
-inline ::TCProto::TransportRouter* TransportCatalog::unsafe_arena_release_router() {
-  // @@protoc_insertion_point(field_release:TCProto.TransportCatalog.router)
-  
-  ::TCProto::TransportRouter* temp = router_;
-  router_ = nullptr;
-  return temp;
+inline double GeoIndex::_internal_min_longitude() const {
+  return _impl_.min_longitude_;
 }
-inline ::TCProto::TransportRouter* TransportCatalog::_internal_mutable_router() {
-  
-  if (router_ == nullptr) {
-    auto* p = CreateMaybeMessage<::TCProto::TransportRouter>(GetArena());
-    router_ = p;
-  }
-  return router_;
+inline double GeoIndex::min_longitude() const {
+  // @@protoc_insertion_point(field_get:TCProto.GeoIndex.min_longitude)
+  return _internal_min_longitude();
 }
-inline ::TCProto::TransportRouter* TransportCatalog::mutable_router() {
-  // @@protoc_insertion_point(field_mutable:TCProto.TransportCatalog.router)
-  return _internal_mutable_router();
+inline void GeoIndex::_internal_set_min_longitude(double value) {
+  
+  _impl_.min_longitude_ = value;
 }
-inline void TransportCatalog::set_allocated_router(::TCProto::TransportRouter* router) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(router_);
-  }
-  if (router) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router)->GetArena();
-    if (message_arena != submessage_arena) {
-      router = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, router, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  router_ = router;
-  // @@protoc_insertion_point(field_set_allocated:TCProto.TransportCatalog.router)
+inline void GeoIndex::set_min_longitude(double value) {
+  _internal_set_min_longitude(value);
+  // @@protoc_insertion_point(field_set:TCProto.GeoIndex.min_longitude)
 }
 
-// .TCProto.Painter painter = 4;
-inline bool TransportCatalog::_internal_has_painter() const {
-  return this != internal_default_instance() && painter_ != nullptr;
+// double cell_latitude = 3;
+inline void GeoIndex::clear_cell_latitude() {
+  _impl_.cell_latitude_ = 0;
 }
-inline bool TransportCatalog::has_painter() const {
-  return _internal_has_painter();
+inline double GeoIndex::_internal_cell_latitude() const {
+  return _impl_.cell_latitude_;
 }
-inline const ::TCProto::Painter& TransportCatalog::_internal_painter() const {
-  const ::TCProto::Painter* p = painter_;
-  return p != nullptr ? *p : reinterpret_cast<const ::TCProto::Painter&>(
-      ::TCProto::_Painter_default_instance_);
+inline double GeoIndex::cell_latitude() const {
+  // @@protoc_insertion_point(field_get:TCProto.GeoIndex.cell_latitude)
+  return _internal_cell_latitude();
 }
-inline const ::TCProto::Painter& TransportCatalog::painter() const {
-  // @@protoc_insertion_point(field_get:TCProto.TransportCatalog.painter)
-  return _internal_painter();
+inline void GeoIndex::_internal_set_cell_latitude(double value) {
+  
+  _impl_.cell_latitude_ = value;
 }
-inline void TransportCatalog::unsafe_arena_set_allocated_painter(
-    ::TCProto::Painter* painter) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(painter_);
-  }
-  painter_ = painter;
-  if (painter) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TCProto.TransportCatalog.painter)
+inline void GeoIndex::set_cell_latitude(double value) {
+  _internal_set_cell_latitude(value);
+  // @@protoc_insertion_point(field_set:TCProto.GeoIndex.cell_latitude)
 }
-inline ::TCProto::Painter* TransportCatalog::release_painter() {
-  
-  ::TCProto::Painter* temp = painter_;
-  painter_ = nullptr;
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+
+// double cell_longitude = 4;
+inline void GeoIndex::clear_cell_longitude() {
+  _impl_.cell_longitude_ = 0;
+}
+inline double GeoIndex::_internal_cell_longitude() const {
+  return _impl_.cell_longitude_;
 }
-inline ::TCProto::Painter* TransportCatalog::unsafe_arena_release_painter() {
-  // @@protoc_insertion_point(field_release:TCProto.TransportCatalog.painter)
+inline double GeoIndex::cell_longitude() const {
+  // @@protoc_insertion_point(field_get:TCProto.GeoIndex.cell_longitude)
+  return _internal_cell_longitude();
+}
+inline void GeoIndex::_internal_set_cell_longitude(double value) {
   
-  ::TCProto::Painter* temp = painter_;
-  painter_ = nullptr;
-  return temp;
+  _impl_.cell_longitude_ = value;
+}
+inline void GeoIndex::set_cell_longitude(double value) {
+  _internal_set_cell_longitude(value);
+  // @@protoc_insertion_point(field_set:TCProto.GeoIndex.cell_longitude)
+}
+
+// uint32 rows = 5;
+inline void GeoIndex::clear_rows() {
+  _impl_.rows_ = 0u;
 }
-inline ::TCProto::Painter* TransportCatalog::_internal_mutable_painter() {
+inline uint32_t GeoIndex::_internal_rows() const {
+  return _impl_.rows_;
+}
+inline uint32_t GeoIndex::rows() const {
+  // @@protoc_insertion_point(field_get:TCProto.GeoIndex.rows)
+  return _internal_rows();
+}
+inline void GeoIndex::_internal_set_rows(uint32_t value) {
   
-  if (painter_ == nullptr) {
-    auto* p = CreateMaybeMessage<::TCProto::Painter>(GetArena());
-    painter_ = p;
-  }
-  return painter_;
+  _impl_.rows_ = value;
 }
-inline ::TCProto::Painter* TransportCatalog::mutable_painter() {
-  // @@protoc_insertion_point(field_mutable:TCProto.TransportCatalog.painter)
-  return _internal_mutable_painter();
+inline void GeoIndex::set_rows(uint32_t value) {
+  _internal_set_rows(value);
+  // @@protoc_insertion_point(field_set:TCProto.GeoIndex.rows)
 }
-inline void TransportCatalog::set_allocated_painter(::TCProto::Painter* painter) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(painter_);
-  }
-  if (painter) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(painter)->GetArena();
-    if (message_arena != submessage_arena) {
-      painter = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, painter, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  painter_ = painter;
-  // @@protoc_insertion_point(field_set_allocated:TCProto.TransportCatalog.painter)
+
+// uint32 cols = 6;
+inline void GeoIndex::clear_cols() {
+  _impl_.cols_ = 0u;
+}
+inline uint32_t GeoIndex::_internal_cols() const {
+  return _impl_.cols_;
+}
+inline uint32_t GeoIndex::cols() const {
+  // @@protoc_insertion_point(field_get:TCProto.GeoIndex.cols)
+  return _internal_cols();
+}
+inline void GeoIndex::_internal_set_cols(uint32_t value) {
+  
+  _impl_.cols_ = value;
+}
+inline void GeoIndex::set_cols(uint32_t value) {
+  _internal_set_cols(value);
+  // @@protoc_insertion_point(field_set:TCProto.GeoIndex.cols)
 }
 
-// .YellowPages.Database companies = 5;
-inline bool TransportCatalog::_internal_has_companies() const {
-  return this != internal_default_instance() && companies_ != nullptr;
+// repeated string names = 7;
+inline int GeoIndex::_internal_names_size() const {
+  return _impl_.names_.size();
 }
-inline bool TransportCatalog::has_companies() const {
-  return _internal_has_companies();
+inline int GeoIndex::names_size() const {
+  return _internal_names_size();
 }
-inline const ::YellowPages::Database& TransportCatalog::_internal_companies() const {
-  const ::YellowPages::Database* p = companies_;
-  return p != nullptr ? *p : reinterpret_cast<const ::YellowPages::Database&>(
-      ::YellowPages::_Database_default_instance_);
+inline void GeoIndex::clear_names() {
+  _impl_.names_.Clear();
 }
-inline const ::YellowPages::Database& TransportCatalog::companies() const {
-  // @@protoc_insertion_point(field_get:TCProto.TransportCatalog.companies)
-  return _internal_companies();
+inline std::string* GeoIndex::add_names() {
+  std::string* _s = _internal_add_names();
+  // @@protoc_insertion_point(field_add_mutable:TCProto.GeoIndex.names)
+  return _s;
 }
-inline void TransportCatalog::unsafe_arena_set_allocated_companies(
-    ::YellowPages::Database* companies) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(companies_);
-  }
-  companies_ = companies;
-  if (companies) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TCProto.TransportCatalog.companies)
+inline const std::string& GeoIndex::_internal_names(int index) const {
+  return _impl_.names_.Get(index);
 }
-inline ::YellowPages::Database* TransportCatalog::release_companies() {
-  
-  ::YellowPages::Database* temp = companies_;
-  companies_ = nullptr;
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+inline const std::string& GeoIndex::names(int index) const {
+  // @@protoc_insertion_point(field_get:TCProto.GeoIndex.names)
+  return _internal_names(index);
 }
-inline ::YellowPages::Database* TransportCatalog::unsafe_arena_release_companies() {
-  // @@protoc_insertion_point(field_release:TCProto.TransportCatalog.companies)
-  
-  ::YellowPages::Database* temp = companies_;
-  companies_ = nullptr;
-  return temp;
+inline std::string* GeoIndex::mutable_names(int index) {
+  // @@protoc_insertion_point(field_mutable:TCProto.GeoIndex.names)
+  return _impl_.names_.Mutable(index);
 }
-inline ::YellowPages::Database* TransportCatalog::_internal_mutable_companies() {
-  
-  if (companies_ == nullptr) {
-    auto* p = CreateMaybeMessage<::YellowPages::Database>(GetArena());
-    companies_ = p;
-  }
-  return companies_;
+inline void GeoIndex::set_names(int index, const std::string& value) {
+  _impl_.names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:TCProto.GeoIndex.names)
 }
-inline ::YellowPages::Database* TransportCatalog::mutable_companies() {
-  // @@protoc_insertion_point(field_mutable:TCProto.TransportCatalog.companies)
-  return _internal_mutable_companies();
+inline void GeoIndex::set_names(int index, std::string&& value) {
+  _impl_.names_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:TCProto.GeoIndex.names)
 }
-inline void TransportCatalog::set_allocated_companies(::YellowPages::Database* companies) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(companies_);
-  }
-  if (companies) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(companies)->GetArena();
-    if (message_arena != submessage_arena) {
-      companies = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, companies, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  companies_ = companies;
-  // @@protoc_insertion_point(field_set_allocated:TCProto.TransportCatalog.companies)
+inline void GeoIndex::set_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:TCProto.GeoIndex.names)
+}
+inline void GeoIndex::set_names(int index, const char* value, size_t size) {
+  _impl_.names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:TCProto.GeoIndex.names)
+}
+inline std::string* GeoIndex::_internal_add_names() {
+  return _impl_.names_.Add();
+}
+inline void GeoIndex::add_names(const std::string& value) {
+  _impl_.names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:TCProto.GeoIndex.names)
+}
+inline void GeoIndex::add_names(std::string&& value) {
+  _impl_.names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:TCProto.GeoIndex.names)
+}
+inline void GeoIndex::add_names(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:TCProto.GeoIndex.names)
+}
+inline void GeoIndex::add_names(const char* value, size_t size) {
+  _impl_.names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:TCProto.GeoIndex.names)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+GeoIndex::names() const {
+  // @@protoc_insertion_point(field_list:TCProto.GeoIndex.names)
+  return _impl_.names_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+GeoIndex::mutable_names() {
+  // @@protoc_insertion_point(field_mutable_list:TCProto.GeoIndex.names)
+  return &_impl_.names_;
 }
 
 #ifdef __GNUC__
@@ -1266,6 +1408,8 @@ inline void TransportCatalog::set_allocated_companies(::YellowPages::Database* c
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
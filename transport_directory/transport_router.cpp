@@ -1,5 +1,8 @@
 #include "transport_router.h"
 
+#include <thread>
+#include <utility>
+
 using namespace std;
 
 
@@ -8,14 +11,27 @@ TransportRouter::TransportRouter(const Descriptions::StopsDict& stops_dict,
                                  const Json::Dict& routing_settings_json)
     : routing_settings_(MakeRoutingSettings(routing_settings_json))
 {
-  const size_t vertex_count = stops_dict.size() * 2;
+  const BusGraphModel bus_graph_model = ReadBusGraphModel(routing_settings_json);
+  size_t vertex_count = stops_dict.size() * 2;
+  if (bus_graph_model == BusGraphModel::ON_BOARD) {
+    for (const auto& [_, bus] : buses_dict) {
+      vertex_count += bus->stops.size() > 1 ? bus->stops.size() - 1 : 0;
+    }
+  }
   vertices_info_.resize(vertex_count);
   graph_ = BusGraph(vertex_count);
 
   FillGraphWithStops(stops_dict);
-  FillGraphWithBuses(stops_dict, buses_dict);
+  if (bus_graph_model == BusGraphModel::ON_BOARD) {
+    FillGraphWithBusChains(stops_dict, buses_dict);
+  }
+  else {
+    FillGraphWithBuses(stops_dict, buses_dict);
+  }
 
-  router_ = std::make_unique<Router>(graph_);
+  router_ = std::make_unique<Router>(graph_,
+                                     ReadRouterStrategy(routing_settings_json),
+                                     ReadRouterThreadCount(routing_settings_json));
 }
 
 TransportRouter::RoutingSettings TransportRouter::MakeRoutingSettings(const Json::Dict& json) {
@@ -26,6 +42,42 @@ TransportRouter::RoutingSettings TransportRouter::MakeRoutingSettings(const Json
   };
 }
 
+Graph::RouterStrategy TransportRouter::ReadRouterStrategy(const Json::Dict& json) {
+  if (!json.count("routing_strategy")) {
+    return Graph::RouterStrategy::ALL_PAIRS;
+  }
+  const string& strategy = json.at("routing_strategy").AsString();
+  if (strategy == "all_pairs") return Graph::RouterStrategy::ALL_PAIRS;
+  else if (strategy == "dijkstra") return Graph::RouterStrategy::DIJKSTRA;
+  else if (strategy == "contraction_hierarchies") return Graph::RouterStrategy::CONTRACTION_HIERARCHIES;
+  else throw runtime_error("Unknown routing strategy");
+}
+
+size_t TransportRouter::ReadRouterThreadCount(const Json::Dict& json) {
+  if (!json.count("router_threads")) {
+    return max(thread::hardware_concurrency(), 1u);
+  }
+  const int thread_count = json.at("router_threads").AsInt();
+  if (thread_count < 1) {
+    throw runtime_error("Invalid router thread count");
+  }
+  return thread_count;
+}
+
+TransportRouter::BusGraphModel TransportRouter::ReadBusGraphModel(const Json::Dict& json) {
+  if (!json.count("bus_graph")) {
+    return BusGraphModel::STOP_PAIRS;
+  }
+  const string& model = json.at("bus_graph").AsString();
+  if (model == "stop_pairs") return BusGraphModel::STOP_PAIRS;
+  else if (model == "on_board") return BusGraphModel::ON_BOARD;
+  else throw runtime_error("Unknown bus graph model");
+}
+
+double TransportRouter::ComputeRideTime(int distance) const {
+  return distance * 1.0 / (routing_settings_.bus_velocity * 1000.0 / 60);  // m / (km/h * 1000 / 60) = min
+}
+
 void TransportRouter::FillGraphWithStops(const Descriptions::StopsDict& stops_dict) {
   Graph::VertexId vertex_id = 0;
 
@@ -36,7 +88,7 @@ void TransportRouter::FillGraphWithStops(const Descriptions::StopsDict& stops_di
     vertices_info_[vertex_ids.in] = {stop_name};
     vertices_info_[vertex_ids.out] = {stop_name};
 
-    edges_info_.push_back(WaitEdgeInfo{});
+    edges_info_.emplace_back(in_place_type<WaitEdgeInfo>);
     const Graph::EdgeId edge_id = graph_.AddEdge({
         vertex_ids.out,
         vertex_ids.in,
@@ -45,7 +97,7 @@ void TransportRouter::FillGraphWithStops(const Descriptions::StopsDict& stops_di
     assert(edge_id == edges_info_.size() - 1);
   }
 
-  assert(vertex_id == graph_.GetVertexCount());
+  assert(vertex_id == stops_dict.size() * 2);
 }
 
 void TransportRouter::FillGraphWithBuses(const Descriptions::StopsDict& stops_dict,
@@ -64,7 +116,7 @@ void TransportRouter::FillGraphWithBuses(const Descriptions::StopsDict& stops_di
       int total_distance = 0;
       for (size_t finish_stop_idx = start_stop_idx + 1; finish_stop_idx < stop_count; ++finish_stop_idx) {
         total_distance += compute_distance_from(finish_stop_idx - 1);
-        edges_info_.push_back(BusEdgeInfo{
+        edges_info_.emplace_back(in_place_type<BusEdgeInfo>, BusEdgeInfo{
             .bus_name = bus.name,
             .start_stop_idx = start_stop_idx,
             .finish_stop_idx = finish_stop_idx,
@@ -73,7 +125,7 @@ void TransportRouter::FillGraphWithBuses(const Descriptions::StopsDict& stops_di
         const Graph::EdgeId edge_id = graph_.AddEdge({
             start_vertex,
             stops_vertex_ids_[bus.stops[finish_stop_idx]].out,
-            total_distance * 1.0 / (routing_settings_.bus_velocity * 1000.0 / 60)  // m / (km/h * 1000 / 60) = min
+            ComputeRideTime(total_distance)
           });
         assert(edge_id == edges_info_.size() - 1);
       }
@@ -81,18 +133,72 @@ void TransportRouter::FillGraphWithBuses(const Descriptions::StopsDict& stops_di
   }
 }
 
+// The on-board vertex of stop_idx means "in the bus arriving at stops[stop_idx]".
+// Boarding at a stop leads straight to the on-board vertex of the next one,
+// so every ride spans at least one stop, as in the stop pairs model.
+void TransportRouter::FillGraphWithBusChains(const Descriptions::StopsDict& stops_dict,
+                                             const Descriptions::BusesDict& buses_dict) {
+  Graph::VertexId vertex_id = stops_dict.size() * 2;
+
+  for (const auto& [_, bus_item] : buses_dict) {
+    const auto& bus = *bus_item;
+    const size_t stop_count = bus.stops.size();
+    if (stop_count <= 1) {
+      continue;
+    }
+    int total_distance = 0;
+    for (size_t stop_idx = 1; stop_idx < stop_count; ++stop_idx) {
+      const int distance = Descriptions::ComputeStopsDistance(
+        *stops_dict.at(bus.stops[stop_idx - 1]), *stops_dict.at(bus.stops[stop_idx]));
+      const double ride_time = ComputeRideTime(distance);
+      const Graph::VertexId on_board_vertex = vertex_id++;
+      vertices_info_[on_board_vertex] = {bus.stops[stop_idx]};
+
+      edges_info_.emplace_back(in_place_type<BoardEdgeInfo>, BoardEdgeInfo{
+          .bus_name = bus.name,
+          .stop_idx = stop_idx - 1,
+          .distance = total_distance,
+      });
+      Graph::EdgeId edge_id = graph_.AddEdge({
+          stops_vertex_ids_[bus.stops[stop_idx - 1]].in,
+          on_board_vertex,
+          ride_time
+        });
+      assert(edge_id == edges_info_.size() - 1);
+
+      if (stop_idx > 1) {
+        edges_info_.emplace_back(in_place_type<RideEdgeInfo>);
+        edge_id = graph_.AddEdge({on_board_vertex - 1, on_board_vertex, ride_time});
+        assert(edge_id == edges_info_.size() - 1);
+      }
+
+      total_distance += distance;
+      edges_info_.emplace_back(in_place_type<AlightEdgeInfo>, AlightEdgeInfo{
+          .stop_idx = stop_idx,
+          .distance = total_distance,
+      });
+      edge_id = graph_.AddEdge({on_board_vertex, stops_vertex_ids_[bus.stops[stop_idx]].out, 0});
+      assert(edge_id == edges_info_.size() - 1);
+    }
+  }
+
+  assert(vertex_id == graph_.GetVertexCount());
+}
+
 optional<TransportRouter::RouteInfo> TransportRouter::FindRoute(const string& stop_from, const string& stop_to) const {
   const Graph::VertexId vertex_from = stops_vertex_ids_.at(stop_from).out;
   const Graph::VertexId vertex_to = stops_vertex_ids_.at(stop_to).out;
-  const auto route = router_->BuildRoute(vertex_from, vertex_to);
-  if (!route) {
+  // Every thread reuses its own buffer, so queries neither race nor allocate inside the router
+  thread_local Router::RouteBuffer route_buffer;
+  const auto total_time = router_->BuildRoute(vertex_from, vertex_to, route_buffer);
+  if (!total_time) {
     return nullopt;
   }
 
-  RouteInfo route_info = {.total_time = route->weight};
-  route_info.items.reserve(route->edge_count);
-  for (size_t edge_idx = 0; edge_idx < route->edge_count; ++edge_idx) {
-    const Graph::EdgeId edge_id = router_->GetRouteEdge(route->id, edge_idx);
+  RouteInfo route_info = {.total_time = *total_time, .items = {}};
+  route_info.items.reserve(route_buffer.edges.size());
+  const BoardEdgeInfo* boarding = nullptr;
+  for (const Graph::EdgeId edge_id : route_buffer.edges) {
     const auto& edge = graph_.GetEdge(edge_id);
     const auto& edge_info = edges_info_[edge_id];
     if (holds_alternative<BusEdgeInfo>(edge_info)) {
@@ -104,18 +210,26 @@ optional<TransportRouter::RouteInfo> TransportRouter::FindRoute(const string& st
           .time = edge.weight,
           .span_count = bus_edge_info.span_count,
       });
-    } else {
+    } else if (holds_alternative<WaitEdgeInfo>(edge_info)) {
       const Graph::VertexId vertex_id = edge.from;
       route_info.items.push_back(RouteInfo::WaitItem{
           .stop_name = vertices_info_[vertex_id].stop_name,
           .time = edge.weight,
       });
+    } else if (holds_alternative<BoardEdgeInfo>(edge_info)) {
+      boarding = &get<BoardEdgeInfo>(edge_info);
+    } else if (holds_alternative<AlightEdgeInfo>(edge_info)) {
+      const AlightEdgeInfo& alight_edge_info = get<AlightEdgeInfo>(edge_info);
+      route_info.items.push_back(RouteInfo::BusItem{
+          .bus_name = boarding->bus_name,
+          .start_stop_idx = boarding->stop_idx,
+          .finish_stop_idx = alight_edge_info.stop_idx,
+          .time = ComputeRideTime(alight_edge_info.distance - boarding->distance),
+          .span_count = alight_edge_info.stop_idx - boarding->stop_idx,
+      });
     }
   }
 
-  // Releasing in destructor of some proxy object would be better,
-  // but we do not expect exceptions in normal workflow
-  router_->ReleaseRoute(route->id);
   return route_info;
 }
 
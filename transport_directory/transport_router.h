@@ -1,5 +1,6 @@
 #pragma once
 
+#include "base_file.h"
 #include "descriptions.h"
 #include "graph.h"
 #include "json.h"
@@ -22,7 +23,9 @@ public:
                   const Json::Dict& routing_settings_json);
 
   TCProto::TransportRouter Serialize() const;
-  TransportRouter(const TCProto::TransportRouter& router);
+  void SerializeRouteMatrix(BaseFile::Writer& writer) const;
+  // The route matrix is used right from the base, so it must outlive the router
+  TransportRouter(const TCProto::TransportRouter& router, const BaseFile::Reader& base);
 
   struct RouteInfo {
     double total_time;
@@ -66,12 +69,23 @@ private:
     double pedestrian_velocity; //km/h
   };
 
+  // How riding a bus is represented in the graph
+  enum class BusGraphModel {
+    STOP_PAIRS,  // an edge for every ordered pair of stops of a bus, O(k^2) per bus
+    ON_BOARD,    // a chain of on-board vertices per bus with board/ride/alight edges, O(k) per bus
+  };
+
   static RoutingSettings MakeRoutingSettings(const Json::Dict& json);
+  static Graph::RouterStrategy ReadRouterStrategy(const Json::Dict& json);
+  static size_t ReadRouterThreadCount(const Json::Dict& json);
+  static BusGraphModel ReadBusGraphModel(const Json::Dict& json);
 
   void FillGraphWithStops(const Descriptions::StopsDict& stops_dict);
 
   void FillGraphWithBuses(const Descriptions::StopsDict& stops_dict,
                           const Descriptions::BusesDict& buses_dict);
+  void FillGraphWithBusChains(const Descriptions::StopsDict& stops_dict,
+                              const Descriptions::BusesDict& buses_dict);
 
   struct StopVertexIds {
     Graph::VertexId in;
@@ -88,7 +102,21 @@ private:
     size_t span_count;
   };
   struct WaitEdgeInfo {};
-  using EdgeInfo = std::variant<BusEdgeInfo, WaitEdgeInfo>;
+
+  // Distances are counted from the first stop of the bus, in meters
+  struct BoardEdgeInfo {
+    std::string bus_name;
+    size_t stop_idx;
+    int distance;
+  };
+  struct RideEdgeInfo {};
+  struct AlightEdgeInfo {
+    size_t stop_idx;
+    int distance;
+  };
+  using EdgeInfo = std::variant<BusEdgeInfo, WaitEdgeInfo, BoardEdgeInfo, RideEdgeInfo, AlightEdgeInfo>;
+
+  double ComputeRideTime(int distance) const;
 
   RoutingSettings routing_settings_;
   BusGraph graph_;
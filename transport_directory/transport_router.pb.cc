@@ -14,222 +14,274 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_DirectedWeightedGraph_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_graph_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Router_graph_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5frouter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BusEdgeInfo_transport_5frouter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5frouter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_EdgeInfo_transport_5frouter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5frouter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RoutingSettings_transport_5frouter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5frouter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StopVertexIds_transport_5frouter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5frouter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VertexInfo_transport_5frouter_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_transport_5frouter_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_WaitEdgeInfo_transport_5frouter_2eproto;
-namespace TCProto {
-class RoutingSettingsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RoutingSettings> _instance;
-} _RoutingSettings_default_instance_;
-class StopVertexIdsDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<StopVertexIds> _instance;
-} _StopVertexIds_default_instance_;
-class VertexInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<VertexInfo> _instance;
-} _VertexInfo_default_instance_;
-class BusEdgeInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BusEdgeInfo> _instance;
-} _BusEdgeInfo_default_instance_;
-class WaitEdgeInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<WaitEdgeInfo> _instance;
-} _WaitEdgeInfo_default_instance_;
-class EdgeInfoDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<EdgeInfo> _instance;
-} _EdgeInfo_default_instance_;
-class TransportRouterDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TransportRouter> _instance;
-} _TransportRouter_default_instance_;
-}  // namespace TCProto
-static void InitDefaultsscc_info_BusEdgeInfo_transport_5frouter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_BusEdgeInfo_default_instance_;
-    new (ptr) ::TCProto::BusEdgeInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BusEdgeInfo_transport_5frouter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_BusEdgeInfo_transport_5frouter_2eproto}, {}};
-
-static void InitDefaultsscc_info_EdgeInfo_transport_5frouter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_EdgeInfo_default_instance_;
-    new (ptr) ::TCProto::EdgeInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_EdgeInfo_transport_5frouter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_EdgeInfo_transport_5frouter_2eproto}, {
-      &scc_info_BusEdgeInfo_transport_5frouter_2eproto.base,
-      &scc_info_WaitEdgeInfo_transport_5frouter_2eproto.base,}};
-
-static void InitDefaultsscc_info_RoutingSettings_transport_5frouter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_RoutingSettings_default_instance_;
-    new (ptr) ::TCProto::RoutingSettings();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RoutingSettings_transport_5frouter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RoutingSettings_transport_5frouter_2eproto}, {}};
-
-static void InitDefaultsscc_info_StopVertexIds_transport_5frouter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_StopVertexIds_default_instance_;
-    new (ptr) ::TCProto::StopVertexIds();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StopVertexIds_transport_5frouter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_StopVertexIds_transport_5frouter_2eproto}, {}};
-
-static void InitDefaultsscc_info_TransportRouter_transport_5frouter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_TransportRouter_default_instance_;
-    new (ptr) ::TCProto::TransportRouter();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_TransportRouter_transport_5frouter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 6, 0, InitDefaultsscc_info_TransportRouter_transport_5frouter_2eproto}, {
-      &scc_info_RoutingSettings_transport_5frouter_2eproto.base,
-      &scc_info_DirectedWeightedGraph_graph_2eproto.base,
-      &scc_info_Router_graph_2eproto.base,
-      &scc_info_StopVertexIds_transport_5frouter_2eproto.base,
-      &scc_info_VertexInfo_transport_5frouter_2eproto.base,
-      &scc_info_EdgeInfo_transport_5frouter_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static void InitDefaultsscc_info_VertexInfo_transport_5frouter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_VertexInfo_default_instance_;
-    new (ptr) ::TCProto::VertexInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_VertexInfo_transport_5frouter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_VertexInfo_transport_5frouter_2eproto}, {}};
-
-static void InitDefaultsscc_info_WaitEdgeInfo_transport_5frouter_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::TCProto::_WaitEdgeInfo_default_instance_;
-    new (ptr) ::TCProto::WaitEdgeInfo();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_WaitEdgeInfo_transport_5frouter_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_WaitEdgeInfo_transport_5frouter_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_transport_5frouter_2eproto[7];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_transport_5frouter_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_transport_5frouter_2eproto = nullptr;
+namespace TCProto {
+PROTOBUF_CONSTEXPR RoutingSettings::RoutingSettings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bus_velocity_)*/0
+  , /*decltype(_impl_.pedestrian_velocity_)*/0
+  , /*decltype(_impl_.bus_wait_time_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoutingSettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoutingSettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoutingSettingsDefaultTypeInternal() {}
+  union {
+    RoutingSettings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutingSettingsDefaultTypeInternal _RoutingSettings_default_instance_;
+PROTOBUF_CONSTEXPR StopVertexIds::StopVertexIds(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.in_)*/0u
+  , /*decltype(_impl_.out_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StopVertexIdsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StopVertexIdsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StopVertexIdsDefaultTypeInternal() {}
+  union {
+    StopVertexIds _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopVertexIdsDefaultTypeInternal _StopVertexIds_default_instance_;
+PROTOBUF_CONSTEXPR VertexInfo::VertexInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stop_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct VertexInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR VertexInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~VertexInfoDefaultTypeInternal() {}
+  union {
+    VertexInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 VertexInfoDefaultTypeInternal _VertexInfo_default_instance_;
+PROTOBUF_CONSTEXPR BusEdgeInfo::BusEdgeInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bus_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.start_stop_idx_)*/0u
+  , /*decltype(_impl_.finish_stop_idx_)*/0u
+  , /*decltype(_impl_.span_count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BusEdgeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BusEdgeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BusEdgeInfoDefaultTypeInternal() {}
+  union {
+    BusEdgeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BusEdgeInfoDefaultTypeInternal _BusEdgeInfo_default_instance_;
+PROTOBUF_CONSTEXPR WaitEdgeInfo::WaitEdgeInfo(
+    ::_pbi::ConstantInitialized) {}
+struct WaitEdgeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WaitEdgeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WaitEdgeInfoDefaultTypeInternal() {}
+  union {
+    WaitEdgeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WaitEdgeInfoDefaultTypeInternal _WaitEdgeInfo_default_instance_;
+PROTOBUF_CONSTEXPR BoardEdgeInfo::BoardEdgeInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bus_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stop_idx_)*/0u
+  , /*decltype(_impl_.distance_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BoardEdgeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BoardEdgeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BoardEdgeInfoDefaultTypeInternal() {}
+  union {
+    BoardEdgeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BoardEdgeInfoDefaultTypeInternal _BoardEdgeInfo_default_instance_;
+PROTOBUF_CONSTEXPR RideEdgeInfo::RideEdgeInfo(
+    ::_pbi::ConstantInitialized) {}
+struct RideEdgeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RideEdgeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RideEdgeInfoDefaultTypeInternal() {}
+  union {
+    RideEdgeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RideEdgeInfoDefaultTypeInternal _RideEdgeInfo_default_instance_;
+PROTOBUF_CONSTEXPR AlightEdgeInfo::AlightEdgeInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stop_idx_)*/0u
+  , /*decltype(_impl_.distance_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AlightEdgeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AlightEdgeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AlightEdgeInfoDefaultTypeInternal() {}
+  union {
+    AlightEdgeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AlightEdgeInfoDefaultTypeInternal _AlightEdgeInfo_default_instance_;
+PROTOBUF_CONSTEXPR EdgeInfo::EdgeInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct EdgeInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EdgeInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EdgeInfoDefaultTypeInternal() {}
+  union {
+    EdgeInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeInfoDefaultTypeInternal _EdgeInfo_default_instance_;
+PROTOBUF_CONSTEXPR TransportRouter::TransportRouter(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stops_vertex_ids_)*/{}
+  , /*decltype(_impl_.vertices_info_)*/{}
+  , /*decltype(_impl_.edges_info_)*/{}
+  , /*decltype(_impl_.routing_settings_)*/nullptr
+  , /*decltype(_impl_.graph_)*/nullptr
+  , /*decltype(_impl_.router_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransportRouterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransportRouterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransportRouterDefaultTypeInternal() {}
+  union {
+    TransportRouter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransportRouterDefaultTypeInternal _TransportRouter_default_instance_;
+}  // namespace TCProto
+static ::_pb::Metadata file_level_metadata_transport_5frouter_2eproto[10];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_transport_5frouter_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transport_5frouter_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_transport_5frouter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_transport_5frouter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::RoutingSettings, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::RoutingSettings, bus_wait_time_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RoutingSettings, bus_velocity_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::RoutingSettings, pedestrian_velocity_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::RoutingSettings, _impl_.bus_wait_time_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RoutingSettings, _impl_.bus_velocity_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::RoutingSettings, _impl_.pedestrian_velocity_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::StopVertexIds, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopVertexIds, name_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopVertexIds, in_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::StopVertexIds, out_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopVertexIds, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopVertexIds, _impl_.in_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::StopVertexIds, _impl_.out_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::VertexInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::VertexInfo, stop_name_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::VertexInfo, _impl_.stop_name_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, bus_name_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, start_stop_idx_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, finish_stop_idx_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, span_count_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, _impl_.bus_name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, _impl_.start_stop_idx_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, _impl_.finish_stop_idx_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BusEdgeInfo, _impl_.span_count_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::WaitEdgeInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TCProto::BoardEdgeInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::BoardEdgeInfo, _impl_.bus_name_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BoardEdgeInfo, _impl_.stop_idx_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::BoardEdgeInfo, _impl_.distance_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TCProto::RideEdgeInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::TCProto::AlightEdgeInfo, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::AlightEdgeInfo, _impl_.stop_idx_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::AlightEdgeInfo, _impl_.distance_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::EdgeInfo, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::TCProto::EdgeInfo, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::TCProto::EdgeInfo, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  ::PROTOBUF_NAMESPACE_ID::internal::kInvalidFieldOffsetTag,
-  ::PROTOBUF_NAMESPACE_ID::internal::kInvalidFieldOffsetTag,
-  PROTOBUF_FIELD_OFFSET(::TCProto::EdgeInfo, data_),
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::TCProto::EdgeInfo, _impl_.data_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, routing_settings_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, graph_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, router_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, stops_vertex_ids_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, vertices_info_),
-  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, edges_info_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, _impl_.routing_settings_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, _impl_.graph_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, _impl_.router_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, _impl_.stops_vertex_ids_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, _impl_.vertices_info_),
+  PROTOBUF_FIELD_OFFSET(::TCProto::TransportRouter, _impl_.edges_info_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::TCProto::RoutingSettings)},
-  { 8, -1, sizeof(::TCProto::StopVertexIds)},
-  { 16, -1, sizeof(::TCProto::VertexInfo)},
-  { 22, -1, sizeof(::TCProto::BusEdgeInfo)},
-  { 31, -1, sizeof(::TCProto::WaitEdgeInfo)},
-  { 36, -1, sizeof(::TCProto::EdgeInfo)},
-  { 44, -1, sizeof(::TCProto::TransportRouter)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::TCProto::RoutingSettings)},
+  { 9, -1, -1, sizeof(::TCProto::StopVertexIds)},
+  { 18, -1, -1, sizeof(::TCProto::VertexInfo)},
+  { 25, -1, -1, sizeof(::TCProto::BusEdgeInfo)},
+  { 35, -1, -1, sizeof(::TCProto::WaitEdgeInfo)},
+  { 41, -1, -1, sizeof(::TCProto::BoardEdgeInfo)},
+  { 50, -1, -1, sizeof(::TCProto::RideEdgeInfo)},
+  { 56, -1, -1, sizeof(::TCProto::AlightEdgeInfo)},
+  { 64, -1, -1, sizeof(::TCProto::EdgeInfo)},
+  { 76, -1, -1, sizeof(::TCProto::TransportRouter)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_RoutingSettings_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_StopVertexIds_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_VertexInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_BusEdgeInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_WaitEdgeInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_EdgeInfo_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::TCProto::_TransportRouter_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::TCProto::_RoutingSettings_default_instance_._instance,
+  &::TCProto::_StopVertexIds_default_instance_._instance,
+  &::TCProto::_VertexInfo_default_instance_._instance,
+  &::TCProto::_BusEdgeInfo_default_instance_._instance,
+  &::TCProto::_WaitEdgeInfo_default_instance_._instance,
+  &::TCProto::_BoardEdgeInfo_default_instance_._instance,
+  &::TCProto::_RideEdgeInfo_default_instance_._instance,
+  &::TCProto::_AlightEdgeInfo_default_instance_._instance,
+  &::TCProto::_EdgeInfo_default_instance_._instance,
+  &::TCProto::_TransportRouter_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_transport_5frouter_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -241,9 +293,16 @@ const char descriptor_table_protodef_transport_5frouter_2eproto[] PROTOBUF_SECTI
   "ertexInfo\022\021\n\tstop_name\030\001 \001(\t\"d\n\013BusEdgeI"
   "nfo\022\020\n\010bus_name\030\001 \001(\t\022\026\n\016start_stop_idx\030"
   "\002 \001(\r\022\027\n\017finish_stop_idx\030\003 \001(\r\022\022\n\nspan_c"
-  "ount\030\004 \001(\r\"\016\n\014WaitEdgeInfo\"h\n\010EdgeInfo\022("
-  "\n\010bus_data\030\001 \001(\0132\024.TCProto.BusEdgeInfoH\000"
-  "\022*\n\twait_data\030\002 \001(\0132\025.TCProto.WaitEdgeIn"
+  "ount\030\004 \001(\r\"\016\n\014WaitEdgeInfo\"E\n\rBoardEdgeI"
+  "nfo\022\020\n\010bus_name\030\001 \001(\t\022\020\n\010stop_idx\030\002 \001(\r\022"
+  "\020\n\010distance\030\003 \001(\005\"\016\n\014RideEdgeInfo\"4\n\016Ali"
+  "ghtEdgeInfo\022\020\n\010stop_idx\030\001 \001(\r\022\020\n\010distanc"
+  "e\030\002 \001(\005\"\362\001\n\010EdgeInfo\022(\n\010bus_data\030\001 \001(\0132\024"
+  ".TCProto.BusEdgeInfoH\000\022*\n\twait_data\030\002 \001("
+  "\0132\025.TCProto.WaitEdgeInfoH\000\022,\n\nboard_data"
+  "\030\003 \001(\0132\026.TCProto.BoardEdgeInfoH\000\022*\n\tride"
+  "_data\030\004 \001(\0132\025.TCProto.RideEdgeInfoH\000\022.\n\013"
+  "alight_data\030\005 \001(\0132\027.TCProto.AlightEdgeIn"
   "foH\000B\006\n\004data\"\240\002\n\017TransportRouter\0222\n\020rout"
   "ing_settings\030\001 \001(\0132\030.TCProto.RoutingSett"
   "ings\0220\n\005graph\030\002 \001(\0132!.GraphProto.Directe"
@@ -253,28 +312,24 @@ const char descriptor_table_protodef_transport_5frouter_2eproto[] PROTOBUF_SECTI
   "\003(\0132\023.TCProto.VertexInfo\022%\n\nedges_info\030\006"
   " \003(\0132\021.TCProto.EdgeInfob\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_transport_5frouter_2eproto_deps[1] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_transport_5frouter_2eproto_deps[1] = {
   &::descriptor_table_graph_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_transport_5frouter_2eproto_sccs[7] = {
-  &scc_info_BusEdgeInfo_transport_5frouter_2eproto.base,
-  &scc_info_EdgeInfo_transport_5frouter_2eproto.base,
-  &scc_info_RoutingSettings_transport_5frouter_2eproto.base,
-  &scc_info_StopVertexIds_transport_5frouter_2eproto.base,
-  &scc_info_TransportRouter_transport_5frouter_2eproto.base,
-  &scc_info_VertexInfo_transport_5frouter_2eproto.base,
-  &scc_info_WaitEdgeInfo_transport_5frouter_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_transport_5frouter_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5frouter_2eproto = {
-  false, false, descriptor_table_protodef_transport_5frouter_2eproto, "transport_router.proto", 751,
-  &descriptor_table_transport_5frouter_2eproto_once, descriptor_table_transport_5frouter_2eproto_sccs, descriptor_table_transport_5frouter_2eproto_deps, 7, 1,
-  schemas, file_default_instances, TableStruct_transport_5frouter_2eproto::offsets,
-  file_level_metadata_transport_5frouter_2eproto, 7, file_level_enum_descriptors_transport_5frouter_2eproto, file_level_service_descriptors_transport_5frouter_2eproto,
+static ::_pbi::once_flag descriptor_table_transport_5frouter_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transport_5frouter_2eproto = {
+    false, false, 1031, descriptor_table_protodef_transport_5frouter_2eproto,
+    "transport_router.proto",
+    &descriptor_table_transport_5frouter_2eproto_once, descriptor_table_transport_5frouter_2eproto_deps, 1, 10,
+    schemas, file_default_instances, TableStruct_transport_5frouter_2eproto::offsets,
+    file_level_metadata_transport_5frouter_2eproto, file_level_enum_descriptors_transport_5frouter_2eproto,
+    file_level_service_descriptors_transport_5frouter_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transport_5frouter_2eproto_getter() {
+  return &descriptor_table_transport_5frouter_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_transport_5frouter_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_transport_5frouter_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transport_5frouter_2eproto(&descriptor_table_transport_5frouter_2eproto);
 namespace TCProto {
 
 // ===================================================================
@@ -283,141 +338,156 @@ class RoutingSettings::_Internal {
  public:
 };
 
-RoutingSettings::RoutingSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+RoutingSettings::RoutingSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.RoutingSettings)
 }
 RoutingSettings::RoutingSettings(const RoutingSettings& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoutingSettings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_velocity_){}
+    , decltype(_impl_.pedestrian_velocity_){}
+    , decltype(_impl_.bus_wait_time_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&bus_velocity_, &from.bus_velocity_,
-    static_cast<size_t>(reinterpret_cast<char*>(&bus_wait_time_) -
-    reinterpret_cast<char*>(&bus_velocity_)) + sizeof(bus_wait_time_));
+  ::memcpy(&_impl_.bus_velocity_, &from._impl_.bus_velocity_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bus_wait_time_) -
+    reinterpret_cast<char*>(&_impl_.bus_velocity_)) + sizeof(_impl_.bus_wait_time_));
   // @@protoc_insertion_point(copy_constructor:TCProto.RoutingSettings)
 }
 
-void RoutingSettings::SharedCtor() {
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&bus_velocity_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&bus_wait_time_) -
-      reinterpret_cast<char*>(&bus_velocity_)) + sizeof(bus_wait_time_));
+inline void RoutingSettings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_velocity_){0}
+    , decltype(_impl_.pedestrian_velocity_){0}
+    , decltype(_impl_.bus_wait_time_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RoutingSettings::~RoutingSettings() {
   // @@protoc_insertion_point(destructor:TCProto.RoutingSettings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RoutingSettings::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void RoutingSettings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void RoutingSettings::ArenaDtor(void* object) {
-  RoutingSettings* _this = reinterpret_cast< RoutingSettings* >(object);
-  (void)_this;
-}
-void RoutingSettings::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void RoutingSettings::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const RoutingSettings& RoutingSettings::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RoutingSettings_transport_5frouter_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void RoutingSettings::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.RoutingSettings)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&bus_velocity_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&bus_wait_time_) -
-      reinterpret_cast<char*>(&bus_velocity_)) + sizeof(bus_wait_time_));
+  ::memset(&_impl_.bus_velocity_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.bus_wait_time_) -
+      reinterpret_cast<char*>(&_impl_.bus_velocity_)) + sizeof(_impl_.bus_wait_time_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RoutingSettings::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* RoutingSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // int32 bus_wait_time = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          bus_wait_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.bus_wait_time_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double bus_velocity = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
-          bus_velocity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.bus_velocity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double pedestrian_velocity = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25)) {
-          pedestrian_velocity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.pedestrian_velocity_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RoutingSettings::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* RoutingSettings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.RoutingSettings)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // int32 bus_wait_time = 1;
-  if (this->bus_wait_time() != 0) {
+  if (this->_internal_bus_wait_time() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_bus_wait_time(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_bus_wait_time(), target);
   }
 
   // double bus_velocity = 2;
-  if (!(this->bus_velocity() <= 0 && this->bus_velocity() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bus_velocity = this->_internal_bus_velocity();
+  uint64_t raw_bus_velocity;
+  memcpy(&raw_bus_velocity, &tmp_bus_velocity, sizeof(tmp_bus_velocity));
+  if (raw_bus_velocity != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_bus_velocity(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_bus_velocity(), target);
   }
 
   // double pedestrian_velocity = 3;
-  if (!(this->pedestrian_velocity() <= 0 && this->pedestrian_velocity() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pedestrian_velocity = this->_internal_pedestrian_velocity();
+  uint64_t raw_pedestrian_velocity;
+  memcpy(&raw_pedestrian_velocity, &tmp_pedestrian_velocity, sizeof(tmp_pedestrian_velocity));
+  if (raw_pedestrian_velocity != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_pedestrian_velocity(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_pedestrian_velocity(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.RoutingSettings)
@@ -428,74 +498,69 @@ size_t RoutingSettings::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.RoutingSettings)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // double bus_velocity = 2;
-  if (!(this->bus_velocity() <= 0 && this->bus_velocity() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bus_velocity = this->_internal_bus_velocity();
+  uint64_t raw_bus_velocity;
+  memcpy(&raw_bus_velocity, &tmp_bus_velocity, sizeof(tmp_bus_velocity));
+  if (raw_bus_velocity != 0) {
     total_size += 1 + 8;
   }
 
   // double pedestrian_velocity = 3;
-  if (!(this->pedestrian_velocity() <= 0 && this->pedestrian_velocity() >= 0)) {
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pedestrian_velocity = this->_internal_pedestrian_velocity();
+  uint64_t raw_pedestrian_velocity;
+  memcpy(&raw_pedestrian_velocity, &tmp_pedestrian_velocity, sizeof(tmp_pedestrian_velocity));
+  if (raw_pedestrian_velocity != 0) {
     total_size += 1 + 8;
   }
 
   // int32 bus_wait_time = 1;
-  if (this->bus_wait_time() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_bus_wait_time());
+  if (this->_internal_bus_wait_time() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_bus_wait_time());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RoutingSettings::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.RoutingSettings)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RoutingSettings* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RoutingSettings>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.RoutingSettings)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.RoutingSettings)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoutingSettings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoutingSettings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoutingSettings::GetClassData() const { return &_class_data_; }
 
-void RoutingSettings::MergeFrom(const RoutingSettings& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.RoutingSettings)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void RoutingSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoutingSettings*>(&to_msg);
+  auto& from = static_cast<const RoutingSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.RoutingSettings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!(from.bus_velocity() <= 0 && from.bus_velocity() >= 0)) {
-    _internal_set_bus_velocity(from._internal_bus_velocity());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bus_velocity = from._internal_bus_velocity();
+  uint64_t raw_bus_velocity;
+  memcpy(&raw_bus_velocity, &tmp_bus_velocity, sizeof(tmp_bus_velocity));
+  if (raw_bus_velocity != 0) {
+    _this->_internal_set_bus_velocity(from._internal_bus_velocity());
   }
-  if (!(from.pedestrian_velocity() <= 0 && from.pedestrian_velocity() >= 0)) {
-    _internal_set_pedestrian_velocity(from._internal_pedestrian_velocity());
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_pedestrian_velocity = from._internal_pedestrian_velocity();
+  uint64_t raw_pedestrian_velocity;
+  memcpy(&raw_pedestrian_velocity, &tmp_pedestrian_velocity, sizeof(tmp_pedestrian_velocity));
+  if (raw_pedestrian_velocity != 0) {
+    _this->_internal_set_pedestrian_velocity(from._internal_pedestrian_velocity());
   }
-  if (from.bus_wait_time() != 0) {
-    _internal_set_bus_wait_time(from._internal_bus_wait_time());
+  if (from._internal_bus_wait_time() != 0) {
+    _this->_internal_set_bus_wait_time(from._internal_bus_wait_time());
   }
-}
-
-void RoutingSettings::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.RoutingSettings)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RoutingSettings::CopyFrom(const RoutingSettings& from) {
@@ -511,154 +576,167 @@ bool RoutingSettings::IsInitialized() const {
 
 void RoutingSettings::InternalSwap(RoutingSettings* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RoutingSettings, bus_wait_time_)
-      + sizeof(RoutingSettings::bus_wait_time_)
-      - PROTOBUF_FIELD_OFFSET(RoutingSettings, bus_velocity_)>(
-          reinterpret_cast<char*>(&bus_velocity_),
-          reinterpret_cast<char*>(&other->bus_velocity_));
+      PROTOBUF_FIELD_OFFSET(RoutingSettings, _impl_.bus_wait_time_)
+      + sizeof(RoutingSettings::_impl_.bus_wait_time_)
+      - PROTOBUF_FIELD_OFFSET(RoutingSettings, _impl_.bus_velocity_)>(
+          reinterpret_cast<char*>(&_impl_.bus_velocity_),
+          reinterpret_cast<char*>(&other->_impl_.bus_velocity_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata RoutingSettings::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[0]);
 }
 
-
 // ===================================================================
 
 class StopVertexIds::_Internal {
  public:
 };
 
-StopVertexIds::StopVertexIds(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+StopVertexIds::StopVertexIds(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.StopVertexIds)
 }
 StopVertexIds::StopVertexIds(const StopVertexIds& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopVertexIds* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.in_){}
+    , decltype(_impl_.out_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_name(), 
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&in_, &from.in_,
-    static_cast<size_t>(reinterpret_cast<char*>(&out_) -
-    reinterpret_cast<char*>(&in_)) + sizeof(out_));
+  ::memcpy(&_impl_.in_, &from._impl_.in_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.out_) -
+    reinterpret_cast<char*>(&_impl_.in_)) + sizeof(_impl_.out_));
   // @@protoc_insertion_point(copy_constructor:TCProto.StopVertexIds)
 }
 
-void StopVertexIds::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_StopVertexIds_transport_5frouter_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&in_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&out_) -
-      reinterpret_cast<char*>(&in_)) + sizeof(out_));
+inline void StopVertexIds::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.in_){0u}
+    , decltype(_impl_.out_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 StopVertexIds::~StopVertexIds() {
   // @@protoc_insertion_point(destructor:TCProto.StopVertexIds)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void StopVertexIds::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void StopVertexIds::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void StopVertexIds::ArenaDtor(void* object) {
-  StopVertexIds* _this = reinterpret_cast< StopVertexIds* >(object);
-  (void)_this;
-}
-void StopVertexIds::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void StopVertexIds::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const StopVertexIds& StopVertexIds::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_StopVertexIds_transport_5frouter_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void StopVertexIds::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.StopVertexIds)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmpty();
-  ::memset(&in_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&out_) -
-      reinterpret_cast<char*>(&in_)) + sizeof(out_));
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.in_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.out_) -
+      reinterpret_cast<char*>(&_impl_.in_)) + sizeof(_impl_.out_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StopVertexIds::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* StopVertexIds::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.StopVertexIds.name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.StopVertexIds.name"));
+        } else
+          goto handle_unusual;
         continue;
       // uint32 in = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          in_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.in_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 out = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          out_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.out_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* StopVertexIds::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* StopVertexIds::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.StopVertexIds)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -668,19 +746,19 @@ failure:
   }
 
   // uint32 in = 2;
-  if (this->in() != 0) {
+  if (this->_internal_in() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_in(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_in(), target);
   }
 
   // uint32 out = 3;
-  if (this->out() != 0) {
+  if (this->_internal_out() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_out(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_out(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.StopVertexIds)
@@ -691,78 +769,55 @@ size_t StopVertexIds::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.StopVertexIds)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
   // uint32 in = 2;
-  if (this->in() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_in());
+  if (this->_internal_in() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_in());
   }
 
   // uint32 out = 3;
-  if (this->out() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_out());
+  if (this->_internal_out() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_out());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void StopVertexIds::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.StopVertexIds)
-  GOOGLE_DCHECK_NE(&from, this);
-  const StopVertexIds* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<StopVertexIds>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.StopVertexIds)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.StopVertexIds)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopVertexIds::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StopVertexIds::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopVertexIds::GetClassData() const { return &_class_data_; }
 
-void StopVertexIds::MergeFrom(const StopVertexIds& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.StopVertexIds)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void StopVertexIds::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopVertexIds*>(&to_msg);
+  auto& from = static_cast<const StopVertexIds&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.StopVertexIds)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (from.in() != 0) {
-    _internal_set_in(from._internal_in());
+  if (from._internal_in() != 0) {
+    _this->_internal_set_in(from._internal_in());
   }
-  if (from.out() != 0) {
-    _internal_set_out(from._internal_out());
+  if (from._internal_out() != 0) {
+    _this->_internal_set_out(from._internal_out());
   }
-}
-
-void StopVertexIds::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.StopVertexIds)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StopVertexIds::CopyFrom(const StopVertexIds& from) {
@@ -778,131 +833,147 @@ bool StopVertexIds::IsInitialized() const {
 
 void StopVertexIds::InternalSwap(StopVertexIds* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(StopVertexIds, out_)
-      + sizeof(StopVertexIds::out_)
-      - PROTOBUF_FIELD_OFFSET(StopVertexIds, in_)>(
-          reinterpret_cast<char*>(&in_),
-          reinterpret_cast<char*>(&other->in_));
+      PROTOBUF_FIELD_OFFSET(StopVertexIds, _impl_.out_)
+      + sizeof(StopVertexIds::_impl_.out_)
+      - PROTOBUF_FIELD_OFFSET(StopVertexIds, _impl_.in_)>(
+          reinterpret_cast<char*>(&_impl_.in_),
+          reinterpret_cast<char*>(&other->_impl_.in_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StopVertexIds::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[1]);
 }
 
-
 // ===================================================================
 
 class VertexInfo::_Internal {
  public:
 };
 
-VertexInfo::VertexInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+VertexInfo::VertexInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.VertexInfo)
 }
 VertexInfo::VertexInfo(const VertexInfo& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  VertexInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stop_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  stop_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.stop_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stop_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_stop_name().empty()) {
-    stop_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_stop_name(), 
-      GetArena());
+    _this->_impl_.stop_name_.Set(from._internal_stop_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:TCProto.VertexInfo)
 }
 
-void VertexInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_VertexInfo_transport_5frouter_2eproto.base);
-  stop_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void VertexInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stop_name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.stop_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stop_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 VertexInfo::~VertexInfo() {
   // @@protoc_insertion_point(destructor:TCProto.VertexInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void VertexInfo::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  stop_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void VertexInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stop_name_.Destroy();
 }
 
-void VertexInfo::ArenaDtor(void* object) {
-  VertexInfo* _this = reinterpret_cast< VertexInfo* >(object);
-  (void)_this;
-}
-void VertexInfo::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void VertexInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const VertexInfo& VertexInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_VertexInfo_transport_5frouter_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void VertexInfo::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.VertexInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stop_name_.ClearToEmpty();
+  _impl_.stop_name_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* VertexInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* VertexInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string stop_name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_stop_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.VertexInfo.stop_name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.VertexInfo.stop_name"));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* VertexInfo::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* VertexInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.VertexInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string stop_name = 1;
-  if (this->stop_name().size() > 0) {
+  if (!this->_internal_stop_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_stop_name().data(), static_cast<int>(this->_internal_stop_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -912,7 +983,7 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.VertexInfo)
@@ -923,58 +994,39 @@ size_t VertexInfo::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.VertexInfo)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string stop_name = 1;
-  if (this->stop_name().size() > 0) {
+  if (!this->_internal_stop_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_stop_name());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void VertexInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.VertexInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const VertexInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<VertexInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.VertexInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.VertexInfo)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData VertexInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    VertexInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*VertexInfo::GetClassData() const { return &_class_data_; }
 
-void VertexInfo::MergeFrom(const VertexInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.VertexInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void VertexInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<VertexInfo*>(&to_msg);
+  auto& from = static_cast<const VertexInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.VertexInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.stop_name().size() > 0) {
-    _internal_set_stop_name(from._internal_stop_name());
+  if (!from._internal_stop_name().empty()) {
+    _this->_internal_set_stop_name(from._internal_stop_name());
   }
-}
-
-void VertexInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.VertexInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void VertexInfo::CopyFrom(const VertexInfo& from) {
@@ -990,156 +1042,177 @@ bool VertexInfo::IsInitialized() const {
 
 void VertexInfo::InternalSwap(VertexInfo* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  stop_name_.Swap(&other->stop_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.stop_name_, lhs_arena,
+      &other->_impl_.stop_name_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata VertexInfo::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[2]);
 }
 
-
 // ===================================================================
 
 class BusEdgeInfo::_Internal {
  public:
 };
 
-BusEdgeInfo::BusEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+BusEdgeInfo::BusEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.BusEdgeInfo)
 }
 BusEdgeInfo::BusEdgeInfo(const BusEdgeInfo& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BusEdgeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_name_){}
+    , decltype(_impl_.start_stop_idx_){}
+    , decltype(_impl_.finish_stop_idx_){}
+    , decltype(_impl_.span_count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  bus_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.bus_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_bus_name().empty()) {
-    bus_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_bus_name(), 
-      GetArena());
+    _this->_impl_.bus_name_.Set(from._internal_bus_name(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&start_stop_idx_, &from.start_stop_idx_,
-    static_cast<size_t>(reinterpret_cast<char*>(&span_count_) -
-    reinterpret_cast<char*>(&start_stop_idx_)) + sizeof(span_count_));
+  ::memcpy(&_impl_.start_stop_idx_, &from._impl_.start_stop_idx_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.span_count_) -
+    reinterpret_cast<char*>(&_impl_.start_stop_idx_)) + sizeof(_impl_.span_count_));
   // @@protoc_insertion_point(copy_constructor:TCProto.BusEdgeInfo)
 }
 
-void BusEdgeInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BusEdgeInfo_transport_5frouter_2eproto.base);
-  bus_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&start_stop_idx_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&span_count_) -
-      reinterpret_cast<char*>(&start_stop_idx_)) + sizeof(span_count_));
+inline void BusEdgeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_name_){}
+    , decltype(_impl_.start_stop_idx_){0u}
+    , decltype(_impl_.finish_stop_idx_){0u}
+    , decltype(_impl_.span_count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.bus_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 BusEdgeInfo::~BusEdgeInfo() {
   // @@protoc_insertion_point(destructor:TCProto.BusEdgeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void BusEdgeInfo::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  bus_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void BusEdgeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bus_name_.Destroy();
 }
 
-void BusEdgeInfo::ArenaDtor(void* object) {
-  BusEdgeInfo* _this = reinterpret_cast< BusEdgeInfo* >(object);
-  (void)_this;
-}
-void BusEdgeInfo::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void BusEdgeInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const BusEdgeInfo& BusEdgeInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BusEdgeInfo_transport_5frouter_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void BusEdgeInfo::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.BusEdgeInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  bus_name_.ClearToEmpty();
-  ::memset(&start_stop_idx_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&span_count_) -
-      reinterpret_cast<char*>(&start_stop_idx_)) + sizeof(span_count_));
+  _impl_.bus_name_.ClearToEmpty();
+  ::memset(&_impl_.start_stop_idx_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.span_count_) -
+      reinterpret_cast<char*>(&_impl_.start_stop_idx_)) + sizeof(_impl_.span_count_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BusEdgeInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BusEdgeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string bus_name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_bus_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "TCProto.BusEdgeInfo.bus_name"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.BusEdgeInfo.bus_name"));
+        } else
+          goto handle_unusual;
         continue;
       // uint32 start_stop_idx = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          start_stop_idx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.start_stop_idx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 finish_stop_idx = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          finish_stop_idx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.finish_stop_idx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 span_count = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          span_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.span_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* BusEdgeInfo::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* BusEdgeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.BusEdgeInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string bus_name = 1;
-  if (this->bus_name().size() > 0) {
+  if (!this->_internal_bus_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_bus_name().data(), static_cast<int>(this->_internal_bus_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1149,25 +1222,25 @@ failure:
   }
 
   // uint32 start_stop_idx = 2;
-  if (this->start_stop_idx() != 0) {
+  if (this->_internal_start_stop_idx() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_start_stop_idx(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_start_stop_idx(), target);
   }
 
   // uint32 finish_stop_idx = 3;
-  if (this->finish_stop_idx() != 0) {
+  if (this->_internal_finish_stop_idx() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_finish_stop_idx(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_finish_stop_idx(), target);
   }
 
   // uint32 span_count = 4;
-  if (this->span_count() != 0) {
+  if (this->_internal_span_count() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_span_count(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_span_count(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.BusEdgeInfo)
@@ -1178,88 +1251,63 @@ size_t BusEdgeInfo::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.BusEdgeInfo)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string bus_name = 1;
-  if (this->bus_name().size() > 0) {
+  if (!this->_internal_bus_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_bus_name());
   }
 
   // uint32 start_stop_idx = 2;
-  if (this->start_stop_idx() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_start_stop_idx());
+  if (this->_internal_start_stop_idx() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_start_stop_idx());
   }
 
   // uint32 finish_stop_idx = 3;
-  if (this->finish_stop_idx() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_finish_stop_idx());
+  if (this->_internal_finish_stop_idx() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_finish_stop_idx());
   }
 
   // uint32 span_count = 4;
-  if (this->span_count() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_span_count());
+  if (this->_internal_span_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_span_count());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void BusEdgeInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.BusEdgeInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const BusEdgeInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BusEdgeInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.BusEdgeInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.BusEdgeInfo)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BusEdgeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BusEdgeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BusEdgeInfo::GetClassData() const { return &_class_data_; }
 
-void BusEdgeInfo::MergeFrom(const BusEdgeInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BusEdgeInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void BusEdgeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BusEdgeInfo*>(&to_msg);
+  auto& from = static_cast<const BusEdgeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BusEdgeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.bus_name().size() > 0) {
-    _internal_set_bus_name(from._internal_bus_name());
+  if (!from._internal_bus_name().empty()) {
+    _this->_internal_set_bus_name(from._internal_bus_name());
   }
-  if (from.start_stop_idx() != 0) {
-    _internal_set_start_stop_idx(from._internal_start_stop_idx());
+  if (from._internal_start_stop_idx() != 0) {
+    _this->_internal_set_start_stop_idx(from._internal_start_stop_idx());
   }
-  if (from.finish_stop_idx() != 0) {
-    _internal_set_finish_stop_idx(from._internal_finish_stop_idx());
+  if (from._internal_finish_stop_idx() != 0) {
+    _this->_internal_set_finish_stop_idx(from._internal_finish_stop_idx());
   }
-  if (from.span_count() != 0) {
-    _internal_set_span_count(from._internal_span_count());
+  if (from._internal_span_count() != 0) {
+    _this->_internal_set_span_count(from._internal_span_count());
   }
-}
-
-void BusEdgeInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.BusEdgeInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void BusEdgeInfo::CopyFrom(const BusEdgeInfo& from) {
@@ -1275,246 +1323,727 @@ bool BusEdgeInfo::IsInitialized() const {
 
 void BusEdgeInfo::InternalSwap(BusEdgeInfo* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  bus_name_.Swap(&other->bus_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bus_name_, lhs_arena,
+      &other->_impl_.bus_name_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(BusEdgeInfo, span_count_)
-      + sizeof(BusEdgeInfo::span_count_)
-      - PROTOBUF_FIELD_OFFSET(BusEdgeInfo, start_stop_idx_)>(
-          reinterpret_cast<char*>(&start_stop_idx_),
-          reinterpret_cast<char*>(&other->start_stop_idx_));
+      PROTOBUF_FIELD_OFFSET(BusEdgeInfo, _impl_.span_count_)
+      + sizeof(BusEdgeInfo::_impl_.span_count_)
+      - PROTOBUF_FIELD_OFFSET(BusEdgeInfo, _impl_.start_stop_idx_)>(
+          reinterpret_cast<char*>(&_impl_.start_stop_idx_),
+          reinterpret_cast<char*>(&other->_impl_.start_stop_idx_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata BusEdgeInfo::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[3]);
 }
 
-
 // ===================================================================
 
 class WaitEdgeInfo::_Internal {
  public:
 };
 
-WaitEdgeInfo::WaitEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+WaitEdgeInfo::WaitEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
   // @@protoc_insertion_point(arena_constructor:TCProto.WaitEdgeInfo)
 }
 WaitEdgeInfo::WaitEdgeInfo(const WaitEdgeInfo& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  WaitEdgeInfo* const _this = this; (void)_this;
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:TCProto.WaitEdgeInfo)
 }
 
-void WaitEdgeInfo::SharedCtor() {
-}
 
-WaitEdgeInfo::~WaitEdgeInfo() {
-  // @@protoc_insertion_point(destructor:TCProto.WaitEdgeInfo)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
 
-void WaitEdgeInfo::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
 
-void WaitEdgeInfo::ArenaDtor(void* object) {
-  WaitEdgeInfo* _this = reinterpret_cast< WaitEdgeInfo* >(object);
-  (void)_this;
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WaitEdgeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WaitEdgeInfo::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata WaitEdgeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[4]);
 }
-void WaitEdgeInfo::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+
+// ===================================================================
+
+class BoardEdgeInfo::_Internal {
+ public:
+};
+
+BoardEdgeInfo::BoardEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TCProto.BoardEdgeInfo)
 }
-void WaitEdgeInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+BoardEdgeInfo::BoardEdgeInfo(const BoardEdgeInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BoardEdgeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_name_){}
+    , decltype(_impl_.stop_idx_){}
+    , decltype(_impl_.distance_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.bus_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_bus_name().empty()) {
+    _this->_impl_.bus_name_.Set(from._internal_bus_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.stop_idx_, &from._impl_.stop_idx_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.distance_) -
+    reinterpret_cast<char*>(&_impl_.stop_idx_)) + sizeof(_impl_.distance_));
+  // @@protoc_insertion_point(copy_constructor:TCProto.BoardEdgeInfo)
+}
+
+inline void BoardEdgeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_name_){}
+    , decltype(_impl_.stop_idx_){0u}
+    , decltype(_impl_.distance_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.bus_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BoardEdgeInfo::~BoardEdgeInfo() {
+  // @@protoc_insertion_point(destructor:TCProto.BoardEdgeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-const WaitEdgeInfo& WaitEdgeInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_WaitEdgeInfo_transport_5frouter_2eproto.base);
-  return *internal_default_instance();
+
+inline void BoardEdgeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bus_name_.Destroy();
 }
 
+void BoardEdgeInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-void WaitEdgeInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:TCProto.WaitEdgeInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void BoardEdgeInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:TCProto.BoardEdgeInfo)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.bus_name_.ClearToEmpty();
+  ::memset(&_impl_.stop_idx_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.distance_) -
+      reinterpret_cast<char*>(&_impl_.stop_idx_)) + sizeof(_impl_.distance_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* WaitEdgeInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* BoardEdgeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string bus_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_bus_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "TCProto.BoardEdgeInfo.bus_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 stop_idx = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.stop_idx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 distance = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.distance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* WaitEdgeInfo::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:TCProto.WaitEdgeInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* BoardEdgeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TCProto.BoardEdgeInfo)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  // string bus_name = 1;
+  if (!this->_internal_bus_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_bus_name().data(), static_cast<int>(this->_internal_bus_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "TCProto.BoardEdgeInfo.bus_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_bus_name(), target);
+  }
+
+  // uint32 stop_idx = 2;
+  if (this->_internal_stop_idx() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_stop_idx(), target);
+  }
+
+  // int32 distance = 3;
+  if (this->_internal_distance() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_distance(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:TCProto.WaitEdgeInfo)
+  // @@protoc_insertion_point(serialize_to_array_end:TCProto.BoardEdgeInfo)
   return target;
 }
 
-size_t WaitEdgeInfo::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:TCProto.WaitEdgeInfo)
+size_t BoardEdgeInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TCProto.BoardEdgeInfo)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // string bus_name = 1;
+  if (!this->_internal_bus_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_bus_name());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void WaitEdgeInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.WaitEdgeInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const WaitEdgeInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<WaitEdgeInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.WaitEdgeInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.WaitEdgeInfo)
-    MergeFrom(*source);
+  // uint32 stop_idx = 2;
+  if (this->_internal_stop_idx() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_idx());
   }
+
+  // int32 distance = 3;
+  if (this->_internal_distance() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_distance());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void WaitEdgeInfo::MergeFrom(const WaitEdgeInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.WaitEdgeInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BoardEdgeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BoardEdgeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BoardEdgeInfo::GetClassData() const { return &_class_data_; }
+
+
+void BoardEdgeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BoardEdgeInfo*>(&to_msg);
+  auto& from = static_cast<const BoardEdgeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.BoardEdgeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  if (!from._internal_bus_name().empty()) {
+    _this->_internal_set_bus_name(from._internal_bus_name());
+  }
+  if (from._internal_stop_idx() != 0) {
+    _this->_internal_set_stop_idx(from._internal_stop_idx());
+  }
+  if (from._internal_distance() != 0) {
+    _this->_internal_set_distance(from._internal_distance());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void WaitEdgeInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.WaitEdgeInfo)
+void BoardEdgeInfo::CopyFrom(const BoardEdgeInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TCProto.BoardEdgeInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void WaitEdgeInfo::CopyFrom(const WaitEdgeInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:TCProto.WaitEdgeInfo)
+bool BoardEdgeInfo::IsInitialized() const {
+  return true;
+}
+
+void BoardEdgeInfo::InternalSwap(BoardEdgeInfo* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bus_name_, lhs_arena,
+      &other->_impl_.bus_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BoardEdgeInfo, _impl_.distance_)
+      + sizeof(BoardEdgeInfo::_impl_.distance_)
+      - PROTOBUF_FIELD_OFFSET(BoardEdgeInfo, _impl_.stop_idx_)>(
+          reinterpret_cast<char*>(&_impl_.stop_idx_),
+          reinterpret_cast<char*>(&other->_impl_.stop_idx_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BoardEdgeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[5]);
+}
+
+// ===================================================================
+
+class RideEdgeInfo::_Internal {
+ public:
+};
+
+RideEdgeInfo::RideEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:TCProto.RideEdgeInfo)
+}
+RideEdgeInfo::RideEdgeInfo(const RideEdgeInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  RideEdgeInfo* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:TCProto.RideEdgeInfo)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RideEdgeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RideEdgeInfo::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata RideEdgeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[6]);
+}
+
+// ===================================================================
+
+class AlightEdgeInfo::_Internal {
+ public:
+};
+
+AlightEdgeInfo::AlightEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:TCProto.AlightEdgeInfo)
+}
+AlightEdgeInfo::AlightEdgeInfo(const AlightEdgeInfo& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AlightEdgeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stop_idx_){}
+    , decltype(_impl_.distance_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.stop_idx_, &from._impl_.stop_idx_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.distance_) -
+    reinterpret_cast<char*>(&_impl_.stop_idx_)) + sizeof(_impl_.distance_));
+  // @@protoc_insertion_point(copy_constructor:TCProto.AlightEdgeInfo)
+}
+
+inline void AlightEdgeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stop_idx_){0u}
+    , decltype(_impl_.distance_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+AlightEdgeInfo::~AlightEdgeInfo() {
+  // @@protoc_insertion_point(destructor:TCProto.AlightEdgeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AlightEdgeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void AlightEdgeInfo::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AlightEdgeInfo::Clear() {
+// @@protoc_insertion_point(message_clear_start:TCProto.AlightEdgeInfo)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.stop_idx_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.distance_) -
+      reinterpret_cast<char*>(&_impl_.stop_idx_)) + sizeof(_impl_.distance_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AlightEdgeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 stop_idx = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.stop_idx_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 distance = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.distance_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AlightEdgeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:TCProto.AlightEdgeInfo)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 stop_idx = 1;
+  if (this->_internal_stop_idx() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_stop_idx(), target);
+  }
+
+  // int32 distance = 2;
+  if (this->_internal_distance() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_distance(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:TCProto.AlightEdgeInfo)
+  return target;
+}
+
+size_t AlightEdgeInfo::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:TCProto.AlightEdgeInfo)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 stop_idx = 1;
+  if (this->_internal_stop_idx() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_stop_idx());
+  }
+
+  // int32 distance = 2;
+  if (this->_internal_distance() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_distance());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AlightEdgeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AlightEdgeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AlightEdgeInfo::GetClassData() const { return &_class_data_; }
+
+
+void AlightEdgeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AlightEdgeInfo*>(&to_msg);
+  auto& from = static_cast<const AlightEdgeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.AlightEdgeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_stop_idx() != 0) {
+    _this->_internal_set_stop_idx(from._internal_stop_idx());
+  }
+  if (from._internal_distance() != 0) {
+    _this->_internal_set_distance(from._internal_distance());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AlightEdgeInfo::CopyFrom(const AlightEdgeInfo& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:TCProto.AlightEdgeInfo)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool WaitEdgeInfo::IsInitialized() const {
+bool AlightEdgeInfo::IsInitialized() const {
   return true;
 }
 
-void WaitEdgeInfo::InternalSwap(WaitEdgeInfo* other) {
+void AlightEdgeInfo::InternalSwap(AlightEdgeInfo* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AlightEdgeInfo, _impl_.distance_)
+      + sizeof(AlightEdgeInfo::_impl_.distance_)
+      - PROTOBUF_FIELD_OFFSET(AlightEdgeInfo, _impl_.stop_idx_)>(
+          reinterpret_cast<char*>(&_impl_.stop_idx_),
+          reinterpret_cast<char*>(&other->_impl_.stop_idx_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata WaitEdgeInfo::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata AlightEdgeInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[7]);
 }
 
-
 // ===================================================================
 
 class EdgeInfo::_Internal {
  public:
   static const ::TCProto::BusEdgeInfo& bus_data(const EdgeInfo* msg);
   static const ::TCProto::WaitEdgeInfo& wait_data(const EdgeInfo* msg);
+  static const ::TCProto::BoardEdgeInfo& board_data(const EdgeInfo* msg);
+  static const ::TCProto::RideEdgeInfo& ride_data(const EdgeInfo* msg);
+  static const ::TCProto::AlightEdgeInfo& alight_data(const EdgeInfo* msg);
 };
 
 const ::TCProto::BusEdgeInfo&
 EdgeInfo::_Internal::bus_data(const EdgeInfo* msg) {
-  return *msg->data_.bus_data_;
+  return *msg->_impl_.data_.bus_data_;
 }
 const ::TCProto::WaitEdgeInfo&
 EdgeInfo::_Internal::wait_data(const EdgeInfo* msg) {
-  return *msg->data_.wait_data_;
+  return *msg->_impl_.data_.wait_data_;
+}
+const ::TCProto::BoardEdgeInfo&
+EdgeInfo::_Internal::board_data(const EdgeInfo* msg) {
+  return *msg->_impl_.data_.board_data_;
+}
+const ::TCProto::RideEdgeInfo&
+EdgeInfo::_Internal::ride_data(const EdgeInfo* msg) {
+  return *msg->_impl_.data_.ride_data_;
+}
+const ::TCProto::AlightEdgeInfo&
+EdgeInfo::_Internal::alight_data(const EdgeInfo* msg) {
+  return *msg->_impl_.data_.alight_data_;
 }
 void EdgeInfo::set_allocated_bus_data(::TCProto::BusEdgeInfo* bus_data) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_data();
   if (bus_data) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(bus_data);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bus_data);
     if (message_arena != submessage_arena) {
       bus_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, bus_data, submessage_arena);
     }
     set_has_bus_data();
-    data_.bus_data_ = bus_data;
+    _impl_.data_.bus_data_ = bus_data;
   }
   // @@protoc_insertion_point(field_set_allocated:TCProto.EdgeInfo.bus_data)
 }
 void EdgeInfo::set_allocated_wait_data(::TCProto::WaitEdgeInfo* wait_data) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_data();
   if (wait_data) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(wait_data);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(wait_data);
     if (message_arena != submessage_arena) {
       wait_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, wait_data, submessage_arena);
     }
     set_has_wait_data();
-    data_.wait_data_ = wait_data;
+    _impl_.data_.wait_data_ = wait_data;
   }
   // @@protoc_insertion_point(field_set_allocated:TCProto.EdgeInfo.wait_data)
 }
-EdgeInfo::EdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+void EdgeInfo::set_allocated_board_data(::TCProto::BoardEdgeInfo* board_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (board_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(board_data);
+    if (message_arena != submessage_arena) {
+      board_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, board_data, submessage_arena);
+    }
+    set_has_board_data();
+    _impl_.data_.board_data_ = board_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:TCProto.EdgeInfo.board_data)
+}
+void EdgeInfo::set_allocated_ride_data(::TCProto::RideEdgeInfo* ride_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (ride_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(ride_data);
+    if (message_arena != submessage_arena) {
+      ride_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ride_data, submessage_arena);
+    }
+    set_has_ride_data();
+    _impl_.data_.ride_data_ = ride_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:TCProto.EdgeInfo.ride_data)
+}
+void EdgeInfo::set_allocated_alight_data(::TCProto::AlightEdgeInfo* alight_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_data();
+  if (alight_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(alight_data);
+    if (message_arena != submessage_arena) {
+      alight_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, alight_data, submessage_arena);
+    }
+    set_has_alight_data();
+    _impl_.data_.alight_data_ = alight_data;
+  }
+  // @@protoc_insertion_point(field_set_allocated:TCProto.EdgeInfo.alight_data)
+}
+EdgeInfo::EdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.EdgeInfo)
 }
 EdgeInfo::EdgeInfo(const EdgeInfo& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EdgeInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_data();
   switch (from.data_case()) {
     case kBusData: {
-      _internal_mutable_bus_data()->::TCProto::BusEdgeInfo::MergeFrom(from._internal_bus_data());
+      _this->_internal_mutable_bus_data()->::TCProto::BusEdgeInfo::MergeFrom(
+          from._internal_bus_data());
       break;
     }
     case kWaitData: {
-      _internal_mutable_wait_data()->::TCProto::WaitEdgeInfo::MergeFrom(from._internal_wait_data());
+      _this->_internal_mutable_wait_data()->::TCProto::WaitEdgeInfo::MergeFrom(
+          from._internal_wait_data());
+      break;
+    }
+    case kBoardData: {
+      _this->_internal_mutable_board_data()->::TCProto::BoardEdgeInfo::MergeFrom(
+          from._internal_board_data());
+      break;
+    }
+    case kRideData: {
+      _this->_internal_mutable_ride_data()->::TCProto::RideEdgeInfo::MergeFrom(
+          from._internal_ride_data());
+      break;
+    }
+    case kAlightData: {
+      _this->_internal_mutable_alight_data()->::TCProto::AlightEdgeInfo::MergeFrom(
+          from._internal_alight_data());
       break;
     }
     case DATA_NOT_SET: {
@@ -1524,51 +2053,68 @@ EdgeInfo::EdgeInfo(const EdgeInfo& from)
   // @@protoc_insertion_point(copy_constructor:TCProto.EdgeInfo)
 }
 
-void EdgeInfo::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_EdgeInfo_transport_5frouter_2eproto.base);
+inline void EdgeInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_data();
 }
 
 EdgeInfo::~EdgeInfo() {
   // @@protoc_insertion_point(destructor:TCProto.EdgeInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void EdgeInfo::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void EdgeInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_data()) {
     clear_data();
   }
 }
 
-void EdgeInfo::ArenaDtor(void* object) {
-  EdgeInfo* _this = reinterpret_cast< EdgeInfo* >(object);
-  (void)_this;
-}
-void EdgeInfo::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void EdgeInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const EdgeInfo& EdgeInfo::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_EdgeInfo_transport_5frouter_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void EdgeInfo::clear_data() {
 // @@protoc_insertion_point(one_of_clear_start:TCProto.EdgeInfo)
   switch (data_case()) {
     case kBusData: {
-      if (GetArena() == nullptr) {
-        delete data_.bus_data_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.bus_data_;
       }
       break;
     }
     case kWaitData: {
-      if (GetArena() == nullptr) {
-        delete data_.wait_data_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.wait_data_;
+      }
+      break;
+    }
+    case kBoardData: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.board_data_;
+      }
+      break;
+    }
+    case kRideData: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.ride_data_;
+      }
+      break;
+    }
+    case kAlightData: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.data_.alight_data_;
       }
       break;
     }
@@ -1576,13 +2122,13 @@ void EdgeInfo::clear_data() {
       break;
     }
   }
-  _oneof_case_[0] = DATA_NOT_SET;
+  _impl_._oneof_case_[0] = DATA_NOT_SET;
 }
 
 
 void EdgeInfo::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.EdgeInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -1590,73 +2136,118 @@ void EdgeInfo::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EdgeInfo::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EdgeInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .TCProto.BusEdgeInfo bus_data = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_bus_data(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .TCProto.WaitEdgeInfo wait_data = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_wait_data(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .TCProto.BoardEdgeInfo board_data = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_board_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // .TCProto.RideEdgeInfo ride_data = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ride_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .TCProto.AlightEdgeInfo alight_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_alight_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* EdgeInfo::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* EdgeInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.EdgeInfo)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .TCProto.BusEdgeInfo bus_data = 1;
   if (_internal_has_bus_data()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::bus_data(this), target, stream);
+      InternalWriteMessage(1, _Internal::bus_data(this),
+        _Internal::bus_data(this).GetCachedSize(), target, stream);
   }
 
   // .TCProto.WaitEdgeInfo wait_data = 2;
   if (_internal_has_wait_data()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::wait_data(this), target, stream);
+      InternalWriteMessage(2, _Internal::wait_data(this),
+        _Internal::wait_data(this).GetCachedSize(), target, stream);
+  }
+
+  // .TCProto.BoardEdgeInfo board_data = 3;
+  if (_internal_has_board_data()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::board_data(this),
+        _Internal::board_data(this).GetCachedSize(), target, stream);
+  }
+
+  // .TCProto.RideEdgeInfo ride_data = 4;
+  if (_internal_has_ride_data()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::ride_data(this),
+        _Internal::ride_data(this).GetCachedSize(), target, stream);
+  }
+
+  // .TCProto.AlightEdgeInfo alight_data = 5;
+  if (_internal_has_alight_data()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::alight_data(this),
+        _Internal::alight_data(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.EdgeInfo)
@@ -1667,7 +2258,7 @@ size_t EdgeInfo::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.EdgeInfo)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -1676,71 +2267,90 @@ size_t EdgeInfo::ByteSizeLong() const {
     case kBusData: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *data_.bus_data_);
+          *_impl_.data_.bus_data_);
       break;
     }
     // .TCProto.WaitEdgeInfo wait_data = 2;
     case kWaitData: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *data_.wait_data_);
+          *_impl_.data_.wait_data_);
+      break;
+    }
+    // .TCProto.BoardEdgeInfo board_data = 3;
+    case kBoardData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.board_data_);
+      break;
+    }
+    // .TCProto.RideEdgeInfo ride_data = 4;
+    case kRideData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.ride_data_);
+      break;
+    }
+    // .TCProto.AlightEdgeInfo alight_data = 5;
+    case kAlightData: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.data_.alight_data_);
       break;
     }
     case DATA_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void EdgeInfo::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.EdgeInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const EdgeInfo* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<EdgeInfo>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.EdgeInfo)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.EdgeInfo)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EdgeInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EdgeInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EdgeInfo::GetClassData() const { return &_class_data_; }
 
-void EdgeInfo::MergeFrom(const EdgeInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.EdgeInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void EdgeInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EdgeInfo*>(&to_msg);
+  auto& from = static_cast<const EdgeInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.EdgeInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.data_case()) {
     case kBusData: {
-      _internal_mutable_bus_data()->::TCProto::BusEdgeInfo::MergeFrom(from._internal_bus_data());
+      _this->_internal_mutable_bus_data()->::TCProto::BusEdgeInfo::MergeFrom(
+          from._internal_bus_data());
       break;
     }
     case kWaitData: {
-      _internal_mutable_wait_data()->::TCProto::WaitEdgeInfo::MergeFrom(from._internal_wait_data());
+      _this->_internal_mutable_wait_data()->::TCProto::WaitEdgeInfo::MergeFrom(
+          from._internal_wait_data());
+      break;
+    }
+    case kBoardData: {
+      _this->_internal_mutable_board_data()->::TCProto::BoardEdgeInfo::MergeFrom(
+          from._internal_board_data());
+      break;
+    }
+    case kRideData: {
+      _this->_internal_mutable_ride_data()->::TCProto::RideEdgeInfo::MergeFrom(
+          from._internal_ride_data());
+      break;
+    }
+    case kAlightData: {
+      _this->_internal_mutable_alight_data()->::TCProto::AlightEdgeInfo::MergeFrom(
+          from._internal_alight_data());
       break;
     }
     case DATA_NOT_SET: {
       break;
     }
   }
-}
-
-void EdgeInfo::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.EdgeInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void EdgeInfo::CopyFrom(const EdgeInfo& from) {
@@ -1756,16 +2366,17 @@ bool EdgeInfo::IsInitialized() const {
 
 void EdgeInfo::InternalSwap(EdgeInfo* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(data_, other->data_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.data_, other->_impl_.data_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EdgeInfo::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[8]);
 }
 
-
 // ===================================================================
 
 class TransportRouter::_Internal {
@@ -1777,152 +2388,154 @@ class TransportRouter::_Internal {
 
 const ::TCProto::RoutingSettings&
 TransportRouter::_Internal::routing_settings(const TransportRouter* msg) {
-  return *msg->routing_settings_;
+  return *msg->_impl_.routing_settings_;
 }
 const ::GraphProto::DirectedWeightedGraph&
 TransportRouter::_Internal::graph(const TransportRouter* msg) {
-  return *msg->graph_;
+  return *msg->_impl_.graph_;
 }
 const ::GraphProto::Router&
 TransportRouter::_Internal::router(const TransportRouter* msg) {
-  return *msg->router_;
+  return *msg->_impl_.router_;
 }
 void TransportRouter::clear_graph() {
-  if (GetArena() == nullptr && graph_ != nullptr) {
-    delete graph_;
+  if (GetArenaForAllocation() == nullptr && _impl_.graph_ != nullptr) {
+    delete _impl_.graph_;
   }
-  graph_ = nullptr;
+  _impl_.graph_ = nullptr;
 }
 void TransportRouter::clear_router() {
-  if (GetArena() == nullptr && router_ != nullptr) {
-    delete router_;
-  }
-  router_ = nullptr;
-}
-TransportRouter::TransportRouter(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  stops_vertex_ids_(arena),
-  vertices_info_(arena),
-  edges_info_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+  if (GetArenaForAllocation() == nullptr && _impl_.router_ != nullptr) {
+    delete _impl_.router_;
+  }
+  _impl_.router_ = nullptr;
+}
+TransportRouter::TransportRouter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:TCProto.TransportRouter)
 }
 TransportRouter::TransportRouter(const TransportRouter& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      stops_vertex_ids_(from.stops_vertex_ids_),
-      vertices_info_(from.vertices_info_),
-      edges_info_(from.edges_info_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransportRouter* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_vertex_ids_){from._impl_.stops_vertex_ids_}
+    , decltype(_impl_.vertices_info_){from._impl_.vertices_info_}
+    , decltype(_impl_.edges_info_){from._impl_.edges_info_}
+    , decltype(_impl_.routing_settings_){nullptr}
+    , decltype(_impl_.graph_){nullptr}
+    , decltype(_impl_.router_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   if (from._internal_has_routing_settings()) {
-    routing_settings_ = new ::TCProto::RoutingSettings(*from.routing_settings_);
-  } else {
-    routing_settings_ = nullptr;
+    _this->_impl_.routing_settings_ = new ::TCProto::RoutingSettings(*from._impl_.routing_settings_);
   }
   if (from._internal_has_graph()) {
-    graph_ = new ::GraphProto::DirectedWeightedGraph(*from.graph_);
-  } else {
-    graph_ = nullptr;
+    _this->_impl_.graph_ = new ::GraphProto::DirectedWeightedGraph(*from._impl_.graph_);
   }
   if (from._internal_has_router()) {
-    router_ = new ::GraphProto::Router(*from.router_);
-  } else {
-    router_ = nullptr;
+    _this->_impl_.router_ = new ::GraphProto::Router(*from._impl_.router_);
   }
   // @@protoc_insertion_point(copy_constructor:TCProto.TransportRouter)
 }
 
-void TransportRouter::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TransportRouter_transport_5frouter_2eproto.base);
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&routing_settings_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&router_) -
-      reinterpret_cast<char*>(&routing_settings_)) + sizeof(router_));
+inline void TransportRouter::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_vertex_ids_){arena}
+    , decltype(_impl_.vertices_info_){arena}
+    , decltype(_impl_.edges_info_){arena}
+    , decltype(_impl_.routing_settings_){nullptr}
+    , decltype(_impl_.graph_){nullptr}
+    , decltype(_impl_.router_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 TransportRouter::~TransportRouter() {
   // @@protoc_insertion_point(destructor:TCProto.TransportRouter)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void TransportRouter::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete routing_settings_;
-  if (this != internal_default_instance()) delete graph_;
-  if (this != internal_default_instance()) delete router_;
+inline void TransportRouter::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stops_vertex_ids_.~RepeatedPtrField();
+  _impl_.vertices_info_.~RepeatedPtrField();
+  _impl_.edges_info_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.routing_settings_;
+  if (this != internal_default_instance()) delete _impl_.graph_;
+  if (this != internal_default_instance()) delete _impl_.router_;
 }
 
-void TransportRouter::ArenaDtor(void* object) {
-  TransportRouter* _this = reinterpret_cast< TransportRouter* >(object);
-  (void)_this;
-}
-void TransportRouter::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void TransportRouter::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const TransportRouter& TransportRouter::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TransportRouter_transport_5frouter_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void TransportRouter::Clear() {
 // @@protoc_insertion_point(message_clear_start:TCProto.TransportRouter)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  stops_vertex_ids_.Clear();
-  vertices_info_.Clear();
-  edges_info_.Clear();
-  if (GetArena() == nullptr && routing_settings_ != nullptr) {
-    delete routing_settings_;
+  _impl_.stops_vertex_ids_.Clear();
+  _impl_.vertices_info_.Clear();
+  _impl_.edges_info_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.routing_settings_ != nullptr) {
+    delete _impl_.routing_settings_;
   }
-  routing_settings_ = nullptr;
-  if (GetArena() == nullptr && graph_ != nullptr) {
-    delete graph_;
+  _impl_.routing_settings_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.graph_ != nullptr) {
+    delete _impl_.graph_;
   }
-  graph_ = nullptr;
-  if (GetArena() == nullptr && router_ != nullptr) {
-    delete router_;
+  _impl_.graph_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.router_ != nullptr) {
+    delete _impl_.router_;
   }
-  router_ = nullptr;
+  _impl_.router_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* TransportRouter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* TransportRouter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .TCProto.RoutingSettings routing_settings = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_routing_settings(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .GraphProto.DirectedWeightedGraph graph = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_graph(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .GraphProto.Router router = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_router(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .TCProto.StopVertexIds stops_vertex_ids = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1930,11 +2543,12 @@ const char* TransportRouter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .TCProto.VertexInfo vertices_info = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1942,11 +2556,12 @@ const char* TransportRouter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .TCProto.EdgeInfo edges_info = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1954,86 +2569,85 @@ const char* TransportRouter::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* TransportRouter::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* TransportRouter::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:TCProto.TransportRouter)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .TCProto.RoutingSettings routing_settings = 1;
-  if (this->has_routing_settings()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_routing_settings()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::routing_settings(this), target, stream);
+      InternalWriteMessage(1, _Internal::routing_settings(this),
+        _Internal::routing_settings(this).GetCachedSize(), target, stream);
   }
 
   // .GraphProto.DirectedWeightedGraph graph = 2;
-  if (this->has_graph()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_graph()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::graph(this), target, stream);
+      InternalWriteMessage(2, _Internal::graph(this),
+        _Internal::graph(this).GetCachedSize(), target, stream);
   }
 
   // .GraphProto.Router router = 3;
-  if (this->has_router()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_router()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::router(this), target, stream);
+      InternalWriteMessage(3, _Internal::router(this),
+        _Internal::router(this).GetCachedSize(), target, stream);
   }
 
   // repeated .TCProto.StopVertexIds stops_vertex_ids = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_stops_vertex_ids_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stops_vertex_ids_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stops_vertex_ids(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, this->_internal_stops_vertex_ids(i), target, stream);
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .TCProto.VertexInfo vertices_info = 5;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_vertices_info_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_vertices_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_vertices_info(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, this->_internal_vertices_info(i), target, stream);
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .TCProto.EdgeInfo edges_info = 6;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_edges_info_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_edges_info_size()); i < n; i++) {
+    const auto& repfield = this->_internal_edges_info(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(6, this->_internal_edges_info(i), target, stream);
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:TCProto.TransportRouter)
@@ -2044,102 +2658,86 @@ size_t TransportRouter::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:TCProto.TransportRouter)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .TCProto.StopVertexIds stops_vertex_ids = 4;
   total_size += 1UL * this->_internal_stops_vertex_ids_size();
-  for (const auto& msg : this->stops_vertex_ids_) {
+  for (const auto& msg : this->_impl_.stops_vertex_ids_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .TCProto.VertexInfo vertices_info = 5;
   total_size += 1UL * this->_internal_vertices_info_size();
-  for (const auto& msg : this->vertices_info_) {
+  for (const auto& msg : this->_impl_.vertices_info_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .TCProto.EdgeInfo edges_info = 6;
   total_size += 1UL * this->_internal_edges_info_size();
-  for (const auto& msg : this->edges_info_) {
+  for (const auto& msg : this->_impl_.edges_info_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // .TCProto.RoutingSettings routing_settings = 1;
-  if (this->has_routing_settings()) {
+  if (this->_internal_has_routing_settings()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *routing_settings_);
+        *_impl_.routing_settings_);
   }
 
   // .GraphProto.DirectedWeightedGraph graph = 2;
-  if (this->has_graph()) {
+  if (this->_internal_has_graph()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *graph_);
+        *_impl_.graph_);
   }
 
   // .GraphProto.Router router = 3;
-  if (this->has_router()) {
+  if (this->_internal_has_router()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *router_);
+        *_impl_.router_);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TransportRouter::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:TCProto.TransportRouter)
-  GOOGLE_DCHECK_NE(&from, this);
-  const TransportRouter* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TransportRouter>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:TCProto.TransportRouter)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:TCProto.TransportRouter)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransportRouter::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransportRouter::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransportRouter::GetClassData() const { return &_class_data_; }
 
-void TransportRouter::MergeFrom(const TransportRouter& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:TCProto.TransportRouter)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void TransportRouter::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransportRouter*>(&to_msg);
+  auto& from = static_cast<const TransportRouter&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:TCProto.TransportRouter)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  stops_vertex_ids_.MergeFrom(from.stops_vertex_ids_);
-  vertices_info_.MergeFrom(from.vertices_info_);
-  edges_info_.MergeFrom(from.edges_info_);
-  if (from.has_routing_settings()) {
-    _internal_mutable_routing_settings()->::TCProto::RoutingSettings::MergeFrom(from._internal_routing_settings());
+  _this->_impl_.stops_vertex_ids_.MergeFrom(from._impl_.stops_vertex_ids_);
+  _this->_impl_.vertices_info_.MergeFrom(from._impl_.vertices_info_);
+  _this->_impl_.edges_info_.MergeFrom(from._impl_.edges_info_);
+  if (from._internal_has_routing_settings()) {
+    _this->_internal_mutable_routing_settings()->::TCProto::RoutingSettings::MergeFrom(
+        from._internal_routing_settings());
   }
-  if (from.has_graph()) {
-    _internal_mutable_graph()->::GraphProto::DirectedWeightedGraph::MergeFrom(from._internal_graph());
+  if (from._internal_has_graph()) {
+    _this->_internal_mutable_graph()->::GraphProto::DirectedWeightedGraph::MergeFrom(
+        from._internal_graph());
   }
-  if (from.has_router()) {
-    _internal_mutable_router()->::GraphProto::Router::MergeFrom(from._internal_router());
+  if (from._internal_has_router()) {
+    _this->_internal_mutable_router()->::GraphProto::Router::MergeFrom(
+        from._internal_router());
   }
-}
-
-void TransportRouter::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:TCProto.TransportRouter)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TransportRouter::CopyFrom(const TransportRouter& from) {
@@ -2155,45 +2753,65 @@ bool TransportRouter::IsInitialized() const {
 
 void TransportRouter::InternalSwap(TransportRouter* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  stops_vertex_ids_.InternalSwap(&other->stops_vertex_ids_);
-  vertices_info_.InternalSwap(&other->vertices_info_);
-  edges_info_.InternalSwap(&other->edges_info_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stops_vertex_ids_.InternalSwap(&other->_impl_.stops_vertex_ids_);
+  _impl_.vertices_info_.InternalSwap(&other->_impl_.vertices_info_);
+  _impl_.edges_info_.InternalSwap(&other->_impl_.edges_info_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(TransportRouter, router_)
-      + sizeof(TransportRouter::router_)
-      - PROTOBUF_FIELD_OFFSET(TransportRouter, routing_settings_)>(
-          reinterpret_cast<char*>(&routing_settings_),
-          reinterpret_cast<char*>(&other->routing_settings_));
+      PROTOBUF_FIELD_OFFSET(TransportRouter, _impl_.router_)
+      + sizeof(TransportRouter::_impl_.router_)
+      - PROTOBUF_FIELD_OFFSET(TransportRouter, _impl_.routing_settings_)>(
+          reinterpret_cast<char*>(&_impl_.routing_settings_),
+          reinterpret_cast<char*>(&other->_impl_.routing_settings_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata TransportRouter::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[9]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace TCProto
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::TCProto::RoutingSettings* Arena::CreateMaybeMessage< ::TCProto::RoutingSettings >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::RoutingSettings*
+Arena::CreateMaybeMessage< ::TCProto::RoutingSettings >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::RoutingSettings >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::StopVertexIds* Arena::CreateMaybeMessage< ::TCProto::StopVertexIds >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::StopVertexIds*
+Arena::CreateMaybeMessage< ::TCProto::StopVertexIds >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::StopVertexIds >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::VertexInfo* Arena::CreateMaybeMessage< ::TCProto::VertexInfo >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::VertexInfo*
+Arena::CreateMaybeMessage< ::TCProto::VertexInfo >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::VertexInfo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::BusEdgeInfo* Arena::CreateMaybeMessage< ::TCProto::BusEdgeInfo >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::BusEdgeInfo*
+Arena::CreateMaybeMessage< ::TCProto::BusEdgeInfo >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::BusEdgeInfo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::WaitEdgeInfo* Arena::CreateMaybeMessage< ::TCProto::WaitEdgeInfo >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::WaitEdgeInfo*
+Arena::CreateMaybeMessage< ::TCProto::WaitEdgeInfo >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::WaitEdgeInfo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::EdgeInfo* Arena::CreateMaybeMessage< ::TCProto::EdgeInfo >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::BoardEdgeInfo*
+Arena::CreateMaybeMessage< ::TCProto::BoardEdgeInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TCProto::BoardEdgeInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TCProto::RideEdgeInfo*
+Arena::CreateMaybeMessage< ::TCProto::RideEdgeInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TCProto::RideEdgeInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TCProto::AlightEdgeInfo*
+Arena::CreateMaybeMessage< ::TCProto::AlightEdgeInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::TCProto::AlightEdgeInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::TCProto::EdgeInfo*
+Arena::CreateMaybeMessage< ::TCProto::EdgeInfo >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::EdgeInfo >(arena);
 }
-template<> PROTOBUF_NOINLINE ::TCProto::TransportRouter* Arena::CreateMaybeMessage< ::TCProto::TransportRouter >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::TCProto::TransportRouter*
+Arena::CreateMaybeMessage< ::TCProto::TransportRouter >(Arena* arena) {
   return Arena::CreateMessageInternal< ::TCProto::TransportRouter >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_bases.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,43 +43,47 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_transport_5frouter_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[7]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5frouter_2eproto;
 namespace TCProto {
+class AlightEdgeInfo;
+struct AlightEdgeInfoDefaultTypeInternal;
+extern AlightEdgeInfoDefaultTypeInternal _AlightEdgeInfo_default_instance_;
+class BoardEdgeInfo;
+struct BoardEdgeInfoDefaultTypeInternal;
+extern BoardEdgeInfoDefaultTypeInternal _BoardEdgeInfo_default_instance_;
 class BusEdgeInfo;
-class BusEdgeInfoDefaultTypeInternal;
+struct BusEdgeInfoDefaultTypeInternal;
 extern BusEdgeInfoDefaultTypeInternal _BusEdgeInfo_default_instance_;
 class EdgeInfo;
-class EdgeInfoDefaultTypeInternal;
+struct EdgeInfoDefaultTypeInternal;
 extern EdgeInfoDefaultTypeInternal _EdgeInfo_default_instance_;
+class RideEdgeInfo;
+struct RideEdgeInfoDefaultTypeInternal;
+extern RideEdgeInfoDefaultTypeInternal _RideEdgeInfo_default_instance_;
 class RoutingSettings;
-class RoutingSettingsDefaultTypeInternal;
+struct RoutingSettingsDefaultTypeInternal;
 extern RoutingSettingsDefaultTypeInternal _RoutingSettings_default_instance_;
 class StopVertexIds;
-class StopVertexIdsDefaultTypeInternal;
+struct StopVertexIdsDefaultTypeInternal;
 extern StopVertexIdsDefaultTypeInternal _StopVertexIds_default_instance_;
 class TransportRouter;
-class TransportRouterDefaultTypeInternal;
+struct TransportRouterDefaultTypeInternal;
 extern TransportRouterDefaultTypeInternal _TransportRouter_default_instance_;
 class VertexInfo;
-class VertexInfoDefaultTypeInternal;
+struct VertexInfoDefaultTypeInternal;
 extern VertexInfoDefaultTypeInternal _VertexInfo_default_instance_;
 class WaitEdgeInfo;
-class WaitEdgeInfoDefaultTypeInternal;
+struct WaitEdgeInfoDefaultTypeInternal;
 extern WaitEdgeInfoDefaultTypeInternal _WaitEdgeInfo_default_instance_;
 }  // namespace TCProto
 PROTOBUF_NAMESPACE_OPEN
+template<> ::TCProto::AlightEdgeInfo* Arena::CreateMaybeMessage<::TCProto::AlightEdgeInfo>(Arena*);
+template<> ::TCProto::BoardEdgeInfo* Arena::CreateMaybeMessage<::TCProto::BoardEdgeInfo>(Arena*);
 template<> ::TCProto::BusEdgeInfo* Arena::CreateMaybeMessage<::TCProto::BusEdgeInfo>(Arena*);
 template<> ::TCProto::EdgeInfo* Arena::CreateMaybeMessage<::TCProto::EdgeInfo>(Arena*);
+template<> ::TCProto::RideEdgeInfo* Arena::CreateMaybeMessage<::TCProto::RideEdgeInfo>(Arena*);
 template<> ::TCProto::RoutingSettings* Arena::CreateMaybeMessage<::TCProto::RoutingSettings>(Arena*);
 template<> ::TCProto::StopVertexIds* Arena::CreateMaybeMessage<::TCProto::StopVertexIds>(Arena*);
 template<> ::TCProto::TransportRouter* Arena::CreateMaybeMessage<::TCProto::TransportRouter>(Arena*);
@@ -90,11 +94,12 @@ namespace TCProto {
 
 // ===================================================================
 
-class RoutingSettings PROTOBUF_FINAL :
+class RoutingSettings final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.RoutingSettings) */ {
  public:
   inline RoutingSettings() : RoutingSettings(nullptr) {}
-  virtual ~RoutingSettings();
+  ~RoutingSettings() override;
+  explicit PROTOBUF_CONSTEXPR RoutingSettings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoutingSettings(const RoutingSettings& from);
   RoutingSettings(RoutingSettings&& from) noexcept
@@ -107,8 +112,13 @@ class RoutingSettings PROTOBUF_FINAL :
     return *this;
   }
   inline RoutingSettings& operator=(RoutingSettings&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -119,13 +129,14 @@ class RoutingSettings PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoutingSettings& default_instance() {
+    return *internal_default_instance();
   }
-  static const RoutingSettings& default_instance();
-
   static inline const RoutingSettings* internal_default_instance() {
     return reinterpret_cast<const RoutingSettings*>(
                &_RoutingSettings_default_instance_);
@@ -138,7 +149,12 @@ class RoutingSettings PROTOBUF_FINAL :
   }
   inline void Swap(RoutingSettings* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -146,56 +162,53 @@ class RoutingSettings PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(RoutingSettings* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RoutingSettings* New() const final {
-    return CreateMaybeMessage<RoutingSettings>(nullptr);
-  }
-
-  RoutingSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  RoutingSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoutingSettings>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoutingSettings& from);
-  void MergeFrom(const RoutingSettings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoutingSettings& from) {
+    RoutingSettings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoutingSettings* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.RoutingSettings";
   }
   protected:
-  explicit RoutingSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RoutingSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5frouter_2eproto);
-    return ::descriptor_table_transport_5frouter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -226,11 +239,11 @@ class RoutingSettings PROTOBUF_FINAL :
 
   // int32 bus_wait_time = 1;
   void clear_bus_wait_time();
-  ::PROTOBUF_NAMESPACE_ID::int32 bus_wait_time() const;
-  void set_bus_wait_time(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t bus_wait_time() const;
+  void set_bus_wait_time(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_bus_wait_time() const;
-  void _internal_set_bus_wait_time(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_bus_wait_time() const;
+  void _internal_set_bus_wait_time(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:TCProto.RoutingSettings)
@@ -240,19 +253,23 @@ class RoutingSettings PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  double bus_velocity_;
-  double pedestrian_velocity_;
-  ::PROTOBUF_NAMESPACE_ID::int32 bus_wait_time_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    double bus_velocity_;
+    double pedestrian_velocity_;
+    int32_t bus_wait_time_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5frouter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class StopVertexIds PROTOBUF_FINAL :
+class StopVertexIds final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.StopVertexIds) */ {
  public:
   inline StopVertexIds() : StopVertexIds(nullptr) {}
-  virtual ~StopVertexIds();
+  ~StopVertexIds() override;
+  explicit PROTOBUF_CONSTEXPR StopVertexIds(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   StopVertexIds(const StopVertexIds& from);
   StopVertexIds(StopVertexIds&& from) noexcept
@@ -265,8 +282,13 @@ class StopVertexIds PROTOBUF_FINAL :
     return *this;
   }
   inline StopVertexIds& operator=(StopVertexIds&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -277,13 +299,14 @@ class StopVertexIds PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StopVertexIds& default_instance() {
+    return *internal_default_instance();
   }
-  static const StopVertexIds& default_instance();
-
   static inline const StopVertexIds* internal_default_instance() {
     return reinterpret_cast<const StopVertexIds*>(
                &_StopVertexIds_default_instance_);
@@ -296,7 +319,12 @@ class StopVertexIds PROTOBUF_FINAL :
   }
   inline void Swap(StopVertexIds* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -304,56 +332,53 @@ class StopVertexIds PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(StopVertexIds* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline StopVertexIds* New() const final {
-    return CreateMaybeMessage<StopVertexIds>(nullptr);
-  }
-
-  StopVertexIds* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  StopVertexIds* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<StopVertexIds>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StopVertexIds& from);
-  void MergeFrom(const StopVertexIds& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StopVertexIds& from) {
+    StopVertexIds::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(StopVertexIds* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.StopVertexIds";
   }
   protected:
-  explicit StopVertexIds(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit StopVertexIds(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5frouter_2eproto);
-    return ::descriptor_table_transport_5frouter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -367,35 +392,33 @@ class StopVertexIds PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
   // uint32 in = 2;
   void clear_in();
-  ::PROTOBUF_NAMESPACE_ID::uint32 in() const;
-  void set_in(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t in() const;
+  void set_in(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_in() const;
-  void _internal_set_in(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_in() const;
+  void _internal_set_in(uint32_t value);
   public:
 
   // uint32 out = 3;
   void clear_out();
-  ::PROTOBUF_NAMESPACE_ID::uint32 out() const;
-  void set_out(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t out() const;
+  void set_out(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_out() const;
-  void _internal_set_out(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_out() const;
+  void _internal_set_out(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:TCProto.StopVertexIds)
@@ -405,19 +428,23 @@ class StopVertexIds PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 in_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 out_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t in_;
+    uint32_t out_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5frouter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class VertexInfo PROTOBUF_FINAL :
+class VertexInfo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.VertexInfo) */ {
  public:
   inline VertexInfo() : VertexInfo(nullptr) {}
-  virtual ~VertexInfo();
+  ~VertexInfo() override;
+  explicit PROTOBUF_CONSTEXPR VertexInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   VertexInfo(const VertexInfo& from);
   VertexInfo(VertexInfo&& from) noexcept
@@ -430,8 +457,13 @@ class VertexInfo PROTOBUF_FINAL :
     return *this;
   }
   inline VertexInfo& operator=(VertexInfo&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -442,13 +474,14 @@ class VertexInfo PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const VertexInfo& default_instance() {
+    return *internal_default_instance();
   }
-  static const VertexInfo& default_instance();
-
   static inline const VertexInfo* internal_default_instance() {
     return reinterpret_cast<const VertexInfo*>(
                &_VertexInfo_default_instance_);
@@ -461,7 +494,12 @@ class VertexInfo PROTOBUF_FINAL :
   }
   inline void Swap(VertexInfo* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -469,56 +507,53 @@ class VertexInfo PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(VertexInfo* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline VertexInfo* New() const final {
-    return CreateMaybeMessage<VertexInfo>(nullptr);
-  }
-
-  VertexInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  VertexInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<VertexInfo>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const VertexInfo& from);
-  void MergeFrom(const VertexInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const VertexInfo& from) {
+    VertexInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(VertexInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.VertexInfo";
   }
   protected:
-  explicit VertexInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit VertexInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5frouter_2eproto);
-    return ::descriptor_table_transport_5frouter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -530,16 +565,14 @@ class VertexInfo PROTOBUF_FINAL :
   // string stop_name = 1;
   void clear_stop_name();
   const std::string& stop_name() const;
-  void set_stop_name(const std::string& value);
-  void set_stop_name(std::string&& value);
-  void set_stop_name(const char* value);
-  void set_stop_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stop_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_stop_name();
-  std::string* release_stop_name();
+  PROTOBUF_NODISCARD std::string* release_stop_name();
   void set_allocated_stop_name(std::string* stop_name);
   private:
   const std::string& _internal_stop_name() const;
-  void _internal_set_stop_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stop_name(const std::string& value);
   std::string* _internal_mutable_stop_name();
   public:
 
@@ -550,17 +583,21 @@ class VertexInfo PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stop_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stop_name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5frouter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BusEdgeInfo PROTOBUF_FINAL :
+class BusEdgeInfo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.BusEdgeInfo) */ {
  public:
   inline BusEdgeInfo() : BusEdgeInfo(nullptr) {}
-  virtual ~BusEdgeInfo();
+  ~BusEdgeInfo() override;
+  explicit PROTOBUF_CONSTEXPR BusEdgeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BusEdgeInfo(const BusEdgeInfo& from);
   BusEdgeInfo(BusEdgeInfo&& from) noexcept
@@ -573,8 +610,13 @@ class BusEdgeInfo PROTOBUF_FINAL :
     return *this;
   }
   inline BusEdgeInfo& operator=(BusEdgeInfo&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -585,13 +627,14 @@ class BusEdgeInfo PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BusEdgeInfo& default_instance() {
+    return *internal_default_instance();
   }
-  static const BusEdgeInfo& default_instance();
-
   static inline const BusEdgeInfo* internal_default_instance() {
     return reinterpret_cast<const BusEdgeInfo*>(
                &_BusEdgeInfo_default_instance_);
@@ -604,7 +647,12 @@ class BusEdgeInfo PROTOBUF_FINAL :
   }
   inline void Swap(BusEdgeInfo* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -612,56 +660,53 @@ class BusEdgeInfo PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(BusEdgeInfo* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline BusEdgeInfo* New() const final {
-    return CreateMaybeMessage<BusEdgeInfo>(nullptr);
-  }
-
-  BusEdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  BusEdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<BusEdgeInfo>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BusEdgeInfo& from);
-  void MergeFrom(const BusEdgeInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BusEdgeInfo& from) {
+    BusEdgeInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BusEdgeInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.BusEdgeInfo";
   }
   protected:
-  explicit BusEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit BusEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5frouter_2eproto);
-    return ::descriptor_table_transport_5frouter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -676,44 +721,42 @@ class BusEdgeInfo PROTOBUF_FINAL :
   // string bus_name = 1;
   void clear_bus_name();
   const std::string& bus_name() const;
-  void set_bus_name(const std::string& value);
-  void set_bus_name(std::string&& value);
-  void set_bus_name(const char* value);
-  void set_bus_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bus_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_bus_name();
-  std::string* release_bus_name();
+  PROTOBUF_NODISCARD std::string* release_bus_name();
   void set_allocated_bus_name(std::string* bus_name);
   private:
   const std::string& _internal_bus_name() const;
-  void _internal_set_bus_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bus_name(const std::string& value);
   std::string* _internal_mutable_bus_name();
   public:
 
   // uint32 start_stop_idx = 2;
   void clear_start_stop_idx();
-  ::PROTOBUF_NAMESPACE_ID::uint32 start_stop_idx() const;
-  void set_start_stop_idx(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t start_stop_idx() const;
+  void set_start_stop_idx(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_start_stop_idx() const;
-  void _internal_set_start_stop_idx(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_start_stop_idx() const;
+  void _internal_set_start_stop_idx(uint32_t value);
   public:
 
   // uint32 finish_stop_idx = 3;
   void clear_finish_stop_idx();
-  ::PROTOBUF_NAMESPACE_ID::uint32 finish_stop_idx() const;
-  void set_finish_stop_idx(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t finish_stop_idx() const;
+  void set_finish_stop_idx(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_finish_stop_idx() const;
-  void _internal_set_finish_stop_idx(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_finish_stop_idx() const;
+  void _internal_set_finish_stop_idx(uint32_t value);
   public:
 
   // uint32 span_count = 4;
   void clear_span_count();
-  ::PROTOBUF_NAMESPACE_ID::uint32 span_count() const;
-  void set_span_count(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t span_count() const;
+  void set_span_count(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_span_count() const;
-  void _internal_set_span_count(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_span_count() const;
+  void _internal_set_span_count(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:TCProto.BusEdgeInfo)
@@ -723,20 +766,23 @@ class BusEdgeInfo PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bus_name_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 start_stop_idx_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 finish_stop_idx_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 span_count_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bus_name_;
+    uint32_t start_stop_idx_;
+    uint32_t finish_stop_idx_;
+    uint32_t span_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5frouter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WaitEdgeInfo PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.WaitEdgeInfo) */ {
+class WaitEdgeInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:TCProto.WaitEdgeInfo) */ {
  public:
   inline WaitEdgeInfo() : WaitEdgeInfo(nullptr) {}
-  virtual ~WaitEdgeInfo();
+  explicit PROTOBUF_CONSTEXPR WaitEdgeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WaitEdgeInfo(const WaitEdgeInfo& from);
   WaitEdgeInfo(WaitEdgeInfo&& from) noexcept
@@ -749,8 +795,13 @@ class WaitEdgeInfo PROTOBUF_FINAL :
     return *this;
   }
   inline WaitEdgeInfo& operator=(WaitEdgeInfo&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -761,105 +812,548 @@ class WaitEdgeInfo PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WaitEdgeInfo& default_instance() {
+    return *internal_default_instance();
   }
-  static const WaitEdgeInfo& default_instance();
-
   static inline const WaitEdgeInfo* internal_default_instance() {
     return reinterpret_cast<const WaitEdgeInfo*>(
                &_WaitEdgeInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    4;
+
+  friend void swap(WaitEdgeInfo& a, WaitEdgeInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WaitEdgeInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WaitEdgeInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WaitEdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WaitEdgeInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const WaitEdgeInfo& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const WaitEdgeInfo& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TCProto.WaitEdgeInfo";
+  }
+  protected:
+  explicit WaitEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:TCProto.WaitEdgeInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BoardEdgeInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.BoardEdgeInfo) */ {
+ public:
+  inline BoardEdgeInfo() : BoardEdgeInfo(nullptr) {}
+  ~BoardEdgeInfo() override;
+  explicit PROTOBUF_CONSTEXPR BoardEdgeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BoardEdgeInfo(const BoardEdgeInfo& from);
+  BoardEdgeInfo(BoardEdgeInfo&& from) noexcept
+    : BoardEdgeInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline BoardEdgeInfo& operator=(const BoardEdgeInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BoardEdgeInfo& operator=(BoardEdgeInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BoardEdgeInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BoardEdgeInfo* internal_default_instance() {
+    return reinterpret_cast<const BoardEdgeInfo*>(
+               &_BoardEdgeInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(BoardEdgeInfo& a, BoardEdgeInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BoardEdgeInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BoardEdgeInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BoardEdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BoardEdgeInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BoardEdgeInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BoardEdgeInfo& from) {
+    BoardEdgeInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BoardEdgeInfo* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TCProto.BoardEdgeInfo";
+  }
+  protected:
+  explicit BoardEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBusNameFieldNumber = 1,
+    kStopIdxFieldNumber = 2,
+    kDistanceFieldNumber = 3,
+  };
+  // string bus_name = 1;
+  void clear_bus_name();
+  const std::string& bus_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bus_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bus_name();
+  PROTOBUF_NODISCARD std::string* release_bus_name();
+  void set_allocated_bus_name(std::string* bus_name);
+  private:
+  const std::string& _internal_bus_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bus_name(const std::string& value);
+  std::string* _internal_mutable_bus_name();
+  public:
+
+  // uint32 stop_idx = 2;
+  void clear_stop_idx();
+  uint32_t stop_idx() const;
+  void set_stop_idx(uint32_t value);
+  private:
+  uint32_t _internal_stop_idx() const;
+  void _internal_set_stop_idx(uint32_t value);
+  public:
+
+  // int32 distance = 3;
+  void clear_distance();
+  int32_t distance() const;
+  void set_distance(int32_t value);
+  private:
+  int32_t _internal_distance() const;
+  void _internal_set_distance(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TCProto.BoardEdgeInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bus_name_;
+    uint32_t stop_idx_;
+    int32_t distance_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RideEdgeInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:TCProto.RideEdgeInfo) */ {
+ public:
+  inline RideEdgeInfo() : RideEdgeInfo(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR RideEdgeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RideEdgeInfo(const RideEdgeInfo& from);
+  RideEdgeInfo(RideEdgeInfo&& from) noexcept
+    : RideEdgeInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline RideEdgeInfo& operator=(const RideEdgeInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RideEdgeInfo& operator=(RideEdgeInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RideEdgeInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RideEdgeInfo* internal_default_instance() {
+    return reinterpret_cast<const RideEdgeInfo*>(
+               &_RideEdgeInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(RideEdgeInfo& a, RideEdgeInfo& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RideEdgeInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RideEdgeInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RideEdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RideEdgeInfo>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const RideEdgeInfo& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const RideEdgeInfo& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "TCProto.RideEdgeInfo";
+  }
+  protected:
+  explicit RideEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:TCProto.RideEdgeInfo)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AlightEdgeInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.AlightEdgeInfo) */ {
+ public:
+  inline AlightEdgeInfo() : AlightEdgeInfo(nullptr) {}
+  ~AlightEdgeInfo() override;
+  explicit PROTOBUF_CONSTEXPR AlightEdgeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AlightEdgeInfo(const AlightEdgeInfo& from);
+  AlightEdgeInfo(AlightEdgeInfo&& from) noexcept
+    : AlightEdgeInfo() {
+    *this = ::std::move(from);
+  }
+
+  inline AlightEdgeInfo& operator=(const AlightEdgeInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AlightEdgeInfo& operator=(AlightEdgeInfo&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AlightEdgeInfo& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AlightEdgeInfo* internal_default_instance() {
+    return reinterpret_cast<const AlightEdgeInfo*>(
+               &_AlightEdgeInfo_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  friend void swap(WaitEdgeInfo& a, WaitEdgeInfo& b) {
+  friend void swap(AlightEdgeInfo& a, AlightEdgeInfo& b) {
     a.Swap(&b);
   }
-  inline void Swap(WaitEdgeInfo* other) {
+  inline void Swap(AlightEdgeInfo* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(WaitEdgeInfo* other) {
+  void UnsafeArenaSwap(AlightEdgeInfo* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline WaitEdgeInfo* New() const final {
-    return CreateMaybeMessage<WaitEdgeInfo>(nullptr);
+  AlightEdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AlightEdgeInfo>(arena);
   }
-
-  WaitEdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<WaitEdgeInfo>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AlightEdgeInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AlightEdgeInfo& from) {
+    AlightEdgeInfo::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const WaitEdgeInfo& from);
-  void MergeFrom(const WaitEdgeInfo& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(WaitEdgeInfo* other);
+  void InternalSwap(AlightEdgeInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "TCProto.WaitEdgeInfo";
+    return "TCProto.AlightEdgeInfo";
   }
   protected:
-  explicit WaitEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AlightEdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5frouter_2eproto);
-    return ::descriptor_table_transport_5frouter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:TCProto.WaitEdgeInfo)
+  enum : int {
+    kStopIdxFieldNumber = 1,
+    kDistanceFieldNumber = 2,
+  };
+  // uint32 stop_idx = 1;
+  void clear_stop_idx();
+  uint32_t stop_idx() const;
+  void set_stop_idx(uint32_t value);
+  private:
+  uint32_t _internal_stop_idx() const;
+  void _internal_set_stop_idx(uint32_t value);
+  public:
+
+  // int32 distance = 2;
+  void clear_distance();
+  int32_t distance() const;
+  void set_distance(int32_t value);
+  private:
+  int32_t _internal_distance() const;
+  void _internal_set_distance(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:TCProto.AlightEdgeInfo)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t stop_idx_;
+    int32_t distance_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5frouter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EdgeInfo PROTOBUF_FINAL :
+class EdgeInfo final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.EdgeInfo) */ {
  public:
   inline EdgeInfo() : EdgeInfo(nullptr) {}
-  virtual ~EdgeInfo();
+  ~EdgeInfo() override;
+  explicit PROTOBUF_CONSTEXPR EdgeInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EdgeInfo(const EdgeInfo& from);
   EdgeInfo(EdgeInfo&& from) noexcept
@@ -872,8 +1366,13 @@ class EdgeInfo PROTOBUF_FINAL :
     return *this;
   }
   inline EdgeInfo& operator=(EdgeInfo&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -884,16 +1383,20 @@ class EdgeInfo PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EdgeInfo& default_instance() {
+    return *internal_default_instance();
   }
-  static const EdgeInfo& default_instance();
-
   enum DataCase {
     kBusData = 1,
     kWaitData = 2,
+    kBoardData = 3,
+    kRideData = 4,
+    kAlightData = 5,
     DATA_NOT_SET = 0,
   };
 
@@ -902,14 +1405,19 @@ class EdgeInfo PROTOBUF_FINAL :
                &_EdgeInfo_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    8;
 
   friend void swap(EdgeInfo& a, EdgeInfo& b) {
     a.Swap(&b);
   }
   inline void Swap(EdgeInfo* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -917,56 +1425,53 @@ class EdgeInfo PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(EdgeInfo* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline EdgeInfo* New() const final {
-    return CreateMaybeMessage<EdgeInfo>(nullptr);
-  }
-
-  EdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  EdgeInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<EdgeInfo>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const EdgeInfo& from);
-  void MergeFrom(const EdgeInfo& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EdgeInfo& from) {
+    EdgeInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(EdgeInfo* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.EdgeInfo";
   }
   protected:
-  explicit EdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit EdgeInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5frouter_2eproto);
-    return ::descriptor_table_transport_5frouter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -975,6 +1480,9 @@ class EdgeInfo PROTOBUF_FINAL :
   enum : int {
     kBusDataFieldNumber = 1,
     kWaitDataFieldNumber = 2,
+    kBoardDataFieldNumber = 3,
+    kRideDataFieldNumber = 4,
+    kAlightDataFieldNumber = 5,
   };
   // .TCProto.BusEdgeInfo bus_data = 1;
   bool has_bus_data() const;
@@ -983,7 +1491,7 @@ class EdgeInfo PROTOBUF_FINAL :
   public:
   void clear_bus_data();
   const ::TCProto::BusEdgeInfo& bus_data() const;
-  ::TCProto::BusEdgeInfo* release_bus_data();
+  PROTOBUF_NODISCARD ::TCProto::BusEdgeInfo* release_bus_data();
   ::TCProto::BusEdgeInfo* mutable_bus_data();
   void set_allocated_bus_data(::TCProto::BusEdgeInfo* bus_data);
   private:
@@ -1001,7 +1509,7 @@ class EdgeInfo PROTOBUF_FINAL :
   public:
   void clear_wait_data();
   const ::TCProto::WaitEdgeInfo& wait_data() const;
-  ::TCProto::WaitEdgeInfo* release_wait_data();
+  PROTOBUF_NODISCARD ::TCProto::WaitEdgeInfo* release_wait_data();
   ::TCProto::WaitEdgeInfo* mutable_wait_data();
   void set_allocated_wait_data(::TCProto::WaitEdgeInfo* wait_data);
   private:
@@ -1012,6 +1520,60 @@ class EdgeInfo PROTOBUF_FINAL :
       ::TCProto::WaitEdgeInfo* wait_data);
   ::TCProto::WaitEdgeInfo* unsafe_arena_release_wait_data();
 
+  // .TCProto.BoardEdgeInfo board_data = 3;
+  bool has_board_data() const;
+  private:
+  bool _internal_has_board_data() const;
+  public:
+  void clear_board_data();
+  const ::TCProto::BoardEdgeInfo& board_data() const;
+  PROTOBUF_NODISCARD ::TCProto::BoardEdgeInfo* release_board_data();
+  ::TCProto::BoardEdgeInfo* mutable_board_data();
+  void set_allocated_board_data(::TCProto::BoardEdgeInfo* board_data);
+  private:
+  const ::TCProto::BoardEdgeInfo& _internal_board_data() const;
+  ::TCProto::BoardEdgeInfo* _internal_mutable_board_data();
+  public:
+  void unsafe_arena_set_allocated_board_data(
+      ::TCProto::BoardEdgeInfo* board_data);
+  ::TCProto::BoardEdgeInfo* unsafe_arena_release_board_data();
+
+  // .TCProto.RideEdgeInfo ride_data = 4;
+  bool has_ride_data() const;
+  private:
+  bool _internal_has_ride_data() const;
+  public:
+  void clear_ride_data();
+  const ::TCProto::RideEdgeInfo& ride_data() const;
+  PROTOBUF_NODISCARD ::TCProto::RideEdgeInfo* release_ride_data();
+  ::TCProto::RideEdgeInfo* mutable_ride_data();
+  void set_allocated_ride_data(::TCProto::RideEdgeInfo* ride_data);
+  private:
+  const ::TCProto::RideEdgeInfo& _internal_ride_data() const;
+  ::TCProto::RideEdgeInfo* _internal_mutable_ride_data();
+  public:
+  void unsafe_arena_set_allocated_ride_data(
+      ::TCProto::RideEdgeInfo* ride_data);
+  ::TCProto::RideEdgeInfo* unsafe_arena_release_ride_data();
+
+  // .TCProto.AlightEdgeInfo alight_data = 5;
+  bool has_alight_data() const;
+  private:
+  bool _internal_has_alight_data() const;
+  public:
+  void clear_alight_data();
+  const ::TCProto::AlightEdgeInfo& alight_data() const;
+  PROTOBUF_NODISCARD ::TCProto::AlightEdgeInfo* release_alight_data();
+  ::TCProto::AlightEdgeInfo* mutable_alight_data();
+  void set_allocated_alight_data(::TCProto::AlightEdgeInfo* alight_data);
+  private:
+  const ::TCProto::AlightEdgeInfo& _internal_alight_data() const;
+  ::TCProto::AlightEdgeInfo* _internal_mutable_alight_data();
+  public:
+  void unsafe_arena_set_allocated_alight_data(
+      ::TCProto::AlightEdgeInfo* alight_data);
+  ::TCProto::AlightEdgeInfo* unsafe_arena_release_alight_data();
+
   void clear_data();
   DataCase data_case() const;
   // @@protoc_insertion_point(class_scope:TCProto.EdgeInfo)
@@ -1019,6 +1581,9 @@ class EdgeInfo PROTOBUF_FINAL :
   class _Internal;
   void set_has_bus_data();
   void set_has_wait_data();
+  void set_has_board_data();
+  void set_has_ride_data();
+  void set_has_alight_data();
 
   inline bool has_data() const;
   inline void clear_has_data();
@@ -1026,23 +1591,31 @@ class EdgeInfo PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  union DataUnion {
-    DataUnion() {}
-    ::TCProto::BusEdgeInfo* bus_data_;
-    ::TCProto::WaitEdgeInfo* wait_data_;
-  } data_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    union DataUnion {
+      constexpr DataUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::TCProto::BusEdgeInfo* bus_data_;
+      ::TCProto::WaitEdgeInfo* wait_data_;
+      ::TCProto::BoardEdgeInfo* board_data_;
+      ::TCProto::RideEdgeInfo* ride_data_;
+      ::TCProto::AlightEdgeInfo* alight_data_;
+    } data_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5frouter_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TransportRouter PROTOBUF_FINAL :
+class TransportRouter final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:TCProto.TransportRouter) */ {
  public:
   inline TransportRouter() : TransportRouter(nullptr) {}
-  virtual ~TransportRouter();
+  ~TransportRouter() override;
+  explicit PROTOBUF_CONSTEXPR TransportRouter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   TransportRouter(const TransportRouter& from);
   TransportRouter(TransportRouter&& from) noexcept
@@ -1055,8 +1628,13 @@ class TransportRouter PROTOBUF_FINAL :
     return *this;
   }
   inline TransportRouter& operator=(TransportRouter&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1067,26 +1645,32 @@ class TransportRouter PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransportRouter& default_instance() {
+    return *internal_default_instance();
   }
-  static const TransportRouter& default_instance();
-
   static inline const TransportRouter* internal_default_instance() {
     return reinterpret_cast<const TransportRouter*>(
                &_TransportRouter_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    9;
 
   friend void swap(TransportRouter& a, TransportRouter& b) {
     a.Swap(&b);
   }
   inline void Swap(TransportRouter* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1094,56 +1678,53 @@ class TransportRouter PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(TransportRouter* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline TransportRouter* New() const final {
-    return CreateMaybeMessage<TransportRouter>(nullptr);
-  }
-
-  TransportRouter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  TransportRouter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<TransportRouter>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TransportRouter& from);
-  void MergeFrom(const TransportRouter& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransportRouter& from) {
+    TransportRouter::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(TransportRouter* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "TCProto.TransportRouter";
   }
   protected:
-  explicit TransportRouter(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit TransportRouter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_transport_5frouter_2eproto);
-    return ::descriptor_table_transport_5frouter_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1218,7 +1799,7 @@ class TransportRouter PROTOBUF_FINAL :
   public:
   void clear_routing_settings();
   const ::TCProto::RoutingSettings& routing_settings() const;
-  ::TCProto::RoutingSettings* release_routing_settings();
+  PROTOBUF_NODISCARD ::TCProto::RoutingSettings* release_routing_settings();
   ::TCProto::RoutingSettings* mutable_routing_settings();
   void set_allocated_routing_settings(::TCProto::RoutingSettings* routing_settings);
   private:
@@ -1236,7 +1817,7 @@ class TransportRouter PROTOBUF_FINAL :
   public:
   void clear_graph();
   const ::GraphProto::DirectedWeightedGraph& graph() const;
-  ::GraphProto::DirectedWeightedGraph* release_graph();
+  PROTOBUF_NODISCARD ::GraphProto::DirectedWeightedGraph* release_graph();
   ::GraphProto::DirectedWeightedGraph* mutable_graph();
   void set_allocated_graph(::GraphProto::DirectedWeightedGraph* graph);
   private:
@@ -1254,7 +1835,7 @@ class TransportRouter PROTOBUF_FINAL :
   public:
   void clear_router();
   const ::GraphProto::Router& router() const;
-  ::GraphProto::Router* release_router();
+  PROTOBUF_NODISCARD ::GraphProto::Router* release_router();
   ::GraphProto::Router* mutable_router();
   void set_allocated_router(::GraphProto::Router* router);
   private:
@@ -1272,13 +1853,16 @@ class TransportRouter PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopVertexIds > stops_vertex_ids_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::VertexInfo > vertices_info_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::EdgeInfo > edges_info_;
-  ::TCProto::RoutingSettings* routing_settings_;
-  ::GraphProto::DirectedWeightedGraph* graph_;
-  ::GraphProto::Router* router_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopVertexIds > stops_vertex_ids_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::VertexInfo > vertices_info_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::EdgeInfo > edges_info_;
+    ::TCProto::RoutingSettings* routing_settings_;
+    ::GraphProto::DirectedWeightedGraph* graph_;
+    ::GraphProto::Router* router_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_transport_5frouter_2eproto;
 };
 // ===================================================================
@@ -1294,30 +1878,30 @@ class TransportRouter PROTOBUF_FINAL :
 
 // int32 bus_wait_time = 1;
 inline void RoutingSettings::clear_bus_wait_time() {
-  bus_wait_time_ = 0;
+  _impl_.bus_wait_time_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RoutingSettings::_internal_bus_wait_time() const {
-  return bus_wait_time_;
+inline int32_t RoutingSettings::_internal_bus_wait_time() const {
+  return _impl_.bus_wait_time_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 RoutingSettings::bus_wait_time() const {
+inline int32_t RoutingSettings::bus_wait_time() const {
   // @@protoc_insertion_point(field_get:TCProto.RoutingSettings.bus_wait_time)
   return _internal_bus_wait_time();
 }
-inline void RoutingSettings::_internal_set_bus_wait_time(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RoutingSettings::_internal_set_bus_wait_time(int32_t value) {
   
-  bus_wait_time_ = value;
+  _impl_.bus_wait_time_ = value;
 }
-inline void RoutingSettings::set_bus_wait_time(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void RoutingSettings::set_bus_wait_time(int32_t value) {
   _internal_set_bus_wait_time(value);
   // @@protoc_insertion_point(field_set:TCProto.RoutingSettings.bus_wait_time)
 }
 
 // double bus_velocity = 2;
 inline void RoutingSettings::clear_bus_velocity() {
-  bus_velocity_ = 0;
+  _impl_.bus_velocity_ = 0;
 }
 inline double RoutingSettings::_internal_bus_velocity() const {
-  return bus_velocity_;
+  return _impl_.bus_velocity_;
 }
 inline double RoutingSettings::bus_velocity() const {
   // @@protoc_insertion_point(field_get:TCProto.RoutingSettings.bus_velocity)
@@ -1325,7 +1909,7 @@ inline double RoutingSettings::bus_velocity() const {
 }
 inline void RoutingSettings::_internal_set_bus_velocity(double value) {
   
-  bus_velocity_ = value;
+  _impl_.bus_velocity_ = value;
 }
 inline void RoutingSettings::set_bus_velocity(double value) {
   _internal_set_bus_velocity(value);
@@ -1334,10 +1918,10 @@ inline void RoutingSettings::set_bus_velocity(double value) {
 
 // double pedestrian_velocity = 3;
 inline void RoutingSettings::clear_pedestrian_velocity() {
-  pedestrian_velocity_ = 0;
+  _impl_.pedestrian_velocity_ = 0;
 }
 inline double RoutingSettings::_internal_pedestrian_velocity() const {
-  return pedestrian_velocity_;
+  return _impl_.pedestrian_velocity_;
 }
 inline double RoutingSettings::pedestrian_velocity() const {
   // @@protoc_insertion_point(field_get:TCProto.RoutingSettings.pedestrian_velocity)
@@ -1345,7 +1929,7 @@ inline double RoutingSettings::pedestrian_velocity() const {
 }
 inline void RoutingSettings::_internal_set_pedestrian_velocity(double value) {
   
-  pedestrian_velocity_ = value;
+  _impl_.pedestrian_velocity_ = value;
 }
 inline void RoutingSettings::set_pedestrian_velocity(double value) {
   _internal_set_pedestrian_velocity(value);
@@ -1358,53 +1942,38 @@ inline void RoutingSettings::set_pedestrian_velocity(double value) {
 
 // string name = 1;
 inline void StopVertexIds::clear_name() {
-  name_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
 }
 inline const std::string& StopVertexIds::name() const {
   // @@protoc_insertion_point(field_get:TCProto.StopVertexIds.name)
   return _internal_name();
 }
-inline void StopVertexIds::set_name(const std::string& value) {
-  _internal_set_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StopVertexIds::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.StopVertexIds.name)
 }
 inline std::string* StopVertexIds::mutable_name() {
+  std::string* _s = _internal_mutable_name();
   // @@protoc_insertion_point(field_mutable:TCProto.StopVertexIds.name)
-  return _internal_mutable_name();
+  return _s;
 }
 inline const std::string& StopVertexIds::_internal_name() const {
-  return name_.Get();
+  return _impl_.name_.Get();
 }
 inline void StopVertexIds::_internal_set_name(const std::string& value) {
   
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void StopVertexIds::set_name(std::string&& value) {
-  
-  name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.StopVertexIds.name)
-}
-inline void StopVertexIds::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.StopVertexIds.name)
-}
-inline void StopVertexIds::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.StopVertexIds.name)
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* StopVertexIds::_internal_mutable_name() {
   
-  return name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* StopVertexIds::release_name() {
   // @@protoc_insertion_point(field_release:TCProto.StopVertexIds.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.name_.Release();
 }
 inline void StopVertexIds::set_allocated_name(std::string* name) {
   if (name != nullptr) {
@@ -1412,47 +1981,51 @@ inline void StopVertexIds::set_allocated_name(std::string* name) {
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.StopVertexIds.name)
 }
 
 // uint32 in = 2;
 inline void StopVertexIds::clear_in() {
-  in_ = 0u;
+  _impl_.in_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 StopVertexIds::_internal_in() const {
-  return in_;
+inline uint32_t StopVertexIds::_internal_in() const {
+  return _impl_.in_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 StopVertexIds::in() const {
+inline uint32_t StopVertexIds::in() const {
   // @@protoc_insertion_point(field_get:TCProto.StopVertexIds.in)
   return _internal_in();
 }
-inline void StopVertexIds::_internal_set_in(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void StopVertexIds::_internal_set_in(uint32_t value) {
   
-  in_ = value;
+  _impl_.in_ = value;
 }
-inline void StopVertexIds::set_in(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void StopVertexIds::set_in(uint32_t value) {
   _internal_set_in(value);
   // @@protoc_insertion_point(field_set:TCProto.StopVertexIds.in)
 }
 
 // uint32 out = 3;
 inline void StopVertexIds::clear_out() {
-  out_ = 0u;
+  _impl_.out_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 StopVertexIds::_internal_out() const {
-  return out_;
+inline uint32_t StopVertexIds::_internal_out() const {
+  return _impl_.out_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 StopVertexIds::out() const {
+inline uint32_t StopVertexIds::out() const {
   // @@protoc_insertion_point(field_get:TCProto.StopVertexIds.out)
   return _internal_out();
 }
-inline void StopVertexIds::_internal_set_out(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void StopVertexIds::_internal_set_out(uint32_t value) {
   
-  out_ = value;
+  _impl_.out_ = value;
 }
-inline void StopVertexIds::set_out(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void StopVertexIds::set_out(uint32_t value) {
   _internal_set_out(value);
   // @@protoc_insertion_point(field_set:TCProto.StopVertexIds.out)
 }
@@ -1463,53 +2036,38 @@ inline void StopVertexIds::set_out(::PROTOBUF_NAMESPACE_ID::uint32 value) {
 
 // string stop_name = 1;
 inline void VertexInfo::clear_stop_name() {
-  stop_name_.ClearToEmpty();
+  _impl_.stop_name_.ClearToEmpty();
 }
 inline const std::string& VertexInfo::stop_name() const {
   // @@protoc_insertion_point(field_get:TCProto.VertexInfo.stop_name)
   return _internal_stop_name();
 }
-inline void VertexInfo::set_stop_name(const std::string& value) {
-  _internal_set_stop_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void VertexInfo::set_stop_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.stop_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.VertexInfo.stop_name)
 }
 inline std::string* VertexInfo::mutable_stop_name() {
+  std::string* _s = _internal_mutable_stop_name();
   // @@protoc_insertion_point(field_mutable:TCProto.VertexInfo.stop_name)
-  return _internal_mutable_stop_name();
+  return _s;
 }
 inline const std::string& VertexInfo::_internal_stop_name() const {
-  return stop_name_.Get();
+  return _impl_.stop_name_.Get();
 }
 inline void VertexInfo::_internal_set_stop_name(const std::string& value) {
   
-  stop_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void VertexInfo::set_stop_name(std::string&& value) {
-  
-  stop_name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.VertexInfo.stop_name)
-}
-inline void VertexInfo::set_stop_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  stop_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.VertexInfo.stop_name)
-}
-inline void VertexInfo::set_stop_name(const char* value,
-    size_t size) {
-  
-  stop_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.VertexInfo.stop_name)
+  _impl_.stop_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* VertexInfo::_internal_mutable_stop_name() {
   
-  return stop_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.stop_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* VertexInfo::release_stop_name() {
   // @@protoc_insertion_point(field_release:TCProto.VertexInfo.stop_name)
-  return stop_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.stop_name_.Release();
 }
 inline void VertexInfo::set_allocated_stop_name(std::string* stop_name) {
   if (stop_name != nullptr) {
@@ -1517,8 +2075,12 @@ inline void VertexInfo::set_allocated_stop_name(std::string* stop_name) {
   } else {
     
   }
-  stop_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), stop_name,
-      GetArena());
+  _impl_.stop_name_.SetAllocated(stop_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stop_name_.IsDefault()) {
+    _impl_.stop_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.VertexInfo.stop_name)
 }
 
@@ -1528,53 +2090,38 @@ inline void VertexInfo::set_allocated_stop_name(std::string* stop_name) {
 
 // string bus_name = 1;
 inline void BusEdgeInfo::clear_bus_name() {
-  bus_name_.ClearToEmpty();
+  _impl_.bus_name_.ClearToEmpty();
 }
 inline const std::string& BusEdgeInfo::bus_name() const {
   // @@protoc_insertion_point(field_get:TCProto.BusEdgeInfo.bus_name)
   return _internal_bus_name();
 }
-inline void BusEdgeInfo::set_bus_name(const std::string& value) {
-  _internal_set_bus_name(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BusEdgeInfo::set_bus_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.bus_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:TCProto.BusEdgeInfo.bus_name)
 }
 inline std::string* BusEdgeInfo::mutable_bus_name() {
+  std::string* _s = _internal_mutable_bus_name();
   // @@protoc_insertion_point(field_mutable:TCProto.BusEdgeInfo.bus_name)
-  return _internal_mutable_bus_name();
+  return _s;
 }
 inline const std::string& BusEdgeInfo::_internal_bus_name() const {
-  return bus_name_.Get();
+  return _impl_.bus_name_.Get();
 }
 inline void BusEdgeInfo::_internal_set_bus_name(const std::string& value) {
   
-  bus_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void BusEdgeInfo::set_bus_name(std::string&& value) {
-  
-  bus_name_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:TCProto.BusEdgeInfo.bus_name)
-}
-inline void BusEdgeInfo::set_bus_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  bus_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:TCProto.BusEdgeInfo.bus_name)
-}
-inline void BusEdgeInfo::set_bus_name(const char* value,
-    size_t size) {
-  
-  bus_name_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:TCProto.BusEdgeInfo.bus_name)
+  _impl_.bus_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BusEdgeInfo::_internal_mutable_bus_name() {
   
-  return bus_name_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.bus_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BusEdgeInfo::release_bus_name() {
   // @@protoc_insertion_point(field_release:TCProto.BusEdgeInfo.bus_name)
-  return bus_name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.bus_name_.Release();
 }
 inline void BusEdgeInfo::set_allocated_bus_name(std::string* bus_name) {
   if (bus_name != nullptr) {
@@ -1582,67 +2129,71 @@ inline void BusEdgeInfo::set_allocated_bus_name(std::string* bus_name) {
   } else {
     
   }
-  bus_name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), bus_name,
-      GetArena());
+  _impl_.bus_name_.SetAllocated(bus_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bus_name_.IsDefault()) {
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:TCProto.BusEdgeInfo.bus_name)
 }
 
 // uint32 start_stop_idx = 2;
 inline void BusEdgeInfo::clear_start_stop_idx() {
-  start_stop_idx_ = 0u;
+  _impl_.start_stop_idx_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusEdgeInfo::_internal_start_stop_idx() const {
-  return start_stop_idx_;
+inline uint32_t BusEdgeInfo::_internal_start_stop_idx() const {
+  return _impl_.start_stop_idx_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusEdgeInfo::start_stop_idx() const {
+inline uint32_t BusEdgeInfo::start_stop_idx() const {
   // @@protoc_insertion_point(field_get:TCProto.BusEdgeInfo.start_stop_idx)
   return _internal_start_stop_idx();
 }
-inline void BusEdgeInfo::_internal_set_start_stop_idx(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusEdgeInfo::_internal_set_start_stop_idx(uint32_t value) {
   
-  start_stop_idx_ = value;
+  _impl_.start_stop_idx_ = value;
 }
-inline void BusEdgeInfo::set_start_stop_idx(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusEdgeInfo::set_start_stop_idx(uint32_t value) {
   _internal_set_start_stop_idx(value);
   // @@protoc_insertion_point(field_set:TCProto.BusEdgeInfo.start_stop_idx)
 }
 
 // uint32 finish_stop_idx = 3;
 inline void BusEdgeInfo::clear_finish_stop_idx() {
-  finish_stop_idx_ = 0u;
+  _impl_.finish_stop_idx_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusEdgeInfo::_internal_finish_stop_idx() const {
-  return finish_stop_idx_;
+inline uint32_t BusEdgeInfo::_internal_finish_stop_idx() const {
+  return _impl_.finish_stop_idx_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusEdgeInfo::finish_stop_idx() const {
+inline uint32_t BusEdgeInfo::finish_stop_idx() const {
   // @@protoc_insertion_point(field_get:TCProto.BusEdgeInfo.finish_stop_idx)
   return _internal_finish_stop_idx();
 }
-inline void BusEdgeInfo::_internal_set_finish_stop_idx(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusEdgeInfo::_internal_set_finish_stop_idx(uint32_t value) {
   
-  finish_stop_idx_ = value;
+  _impl_.finish_stop_idx_ = value;
 }
-inline void BusEdgeInfo::set_finish_stop_idx(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusEdgeInfo::set_finish_stop_idx(uint32_t value) {
   _internal_set_finish_stop_idx(value);
   // @@protoc_insertion_point(field_set:TCProto.BusEdgeInfo.finish_stop_idx)
 }
 
 // uint32 span_count = 4;
 inline void BusEdgeInfo::clear_span_count() {
-  span_count_ = 0u;
+  _impl_.span_count_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusEdgeInfo::_internal_span_count() const {
-  return span_count_;
+inline uint32_t BusEdgeInfo::_internal_span_count() const {
+  return _impl_.span_count_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 BusEdgeInfo::span_count() const {
+inline uint32_t BusEdgeInfo::span_count() const {
   // @@protoc_insertion_point(field_get:TCProto.BusEdgeInfo.span_count)
   return _internal_span_count();
 }
-inline void BusEdgeInfo::_internal_set_span_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusEdgeInfo::_internal_set_span_count(uint32_t value) {
   
-  span_count_ = value;
+  _impl_.span_count_ = value;
 }
-inline void BusEdgeInfo::set_span_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void BusEdgeInfo::set_span_count(uint32_t value) {
   _internal_set_span_count(value);
   // @@protoc_insertion_point(field_set:TCProto.BusEdgeInfo.span_count)
 }
@@ -1653,6 +2204,148 @@ inline void BusEdgeInfo::set_span_count(::PROTOBUF_NAMESPACE_ID::uint32 value) {
 
 // -------------------------------------------------------------------
 
+// BoardEdgeInfo
+
+// string bus_name = 1;
+inline void BoardEdgeInfo::clear_bus_name() {
+  _impl_.bus_name_.ClearToEmpty();
+}
+inline const std::string& BoardEdgeInfo::bus_name() const {
+  // @@protoc_insertion_point(field_get:TCProto.BoardEdgeInfo.bus_name)
+  return _internal_bus_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BoardEdgeInfo::set_bus_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.bus_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:TCProto.BoardEdgeInfo.bus_name)
+}
+inline std::string* BoardEdgeInfo::mutable_bus_name() {
+  std::string* _s = _internal_mutable_bus_name();
+  // @@protoc_insertion_point(field_mutable:TCProto.BoardEdgeInfo.bus_name)
+  return _s;
+}
+inline const std::string& BoardEdgeInfo::_internal_bus_name() const {
+  return _impl_.bus_name_.Get();
+}
+inline void BoardEdgeInfo::_internal_set_bus_name(const std::string& value) {
+  
+  _impl_.bus_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BoardEdgeInfo::_internal_mutable_bus_name() {
+  
+  return _impl_.bus_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BoardEdgeInfo::release_bus_name() {
+  // @@protoc_insertion_point(field_release:TCProto.BoardEdgeInfo.bus_name)
+  return _impl_.bus_name_.Release();
+}
+inline void BoardEdgeInfo::set_allocated_bus_name(std::string* bus_name) {
+  if (bus_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.bus_name_.SetAllocated(bus_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bus_name_.IsDefault()) {
+    _impl_.bus_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:TCProto.BoardEdgeInfo.bus_name)
+}
+
+// uint32 stop_idx = 2;
+inline void BoardEdgeInfo::clear_stop_idx() {
+  _impl_.stop_idx_ = 0u;
+}
+inline uint32_t BoardEdgeInfo::_internal_stop_idx() const {
+  return _impl_.stop_idx_;
+}
+inline uint32_t BoardEdgeInfo::stop_idx() const {
+  // @@protoc_insertion_point(field_get:TCProto.BoardEdgeInfo.stop_idx)
+  return _internal_stop_idx();
+}
+inline void BoardEdgeInfo::_internal_set_stop_idx(uint32_t value) {
+  
+  _impl_.stop_idx_ = value;
+}
+inline void BoardEdgeInfo::set_stop_idx(uint32_t value) {
+  _internal_set_stop_idx(value);
+  // @@protoc_insertion_point(field_set:TCProto.BoardEdgeInfo.stop_idx)
+}
+
+// int32 distance = 3;
+inline void BoardEdgeInfo::clear_distance() {
+  _impl_.distance_ = 0;
+}
+inline int32_t BoardEdgeInfo::_internal_distance() const {
+  return _impl_.distance_;
+}
+inline int32_t BoardEdgeInfo::distance() const {
+  // @@protoc_insertion_point(field_get:TCProto.BoardEdgeInfo.distance)
+  return _internal_distance();
+}
+inline void BoardEdgeInfo::_internal_set_distance(int32_t value) {
+  
+  _impl_.distance_ = value;
+}
+inline void BoardEdgeInfo::set_distance(int32_t value) {
+  _internal_set_distance(value);
+  // @@protoc_insertion_point(field_set:TCProto.BoardEdgeInfo.distance)
+}
+
+// -------------------------------------------------------------------
+
+// RideEdgeInfo
+
+// -------------------------------------------------------------------
+
+// AlightEdgeInfo
+
+// uint32 stop_idx = 1;
+inline void AlightEdgeInfo::clear_stop_idx() {
+  _impl_.stop_idx_ = 0u;
+}
+inline uint32_t AlightEdgeInfo::_internal_stop_idx() const {
+  return _impl_.stop_idx_;
+}
+inline uint32_t AlightEdgeInfo::stop_idx() const {
+  // @@protoc_insertion_point(field_get:TCProto.AlightEdgeInfo.stop_idx)
+  return _internal_stop_idx();
+}
+inline void AlightEdgeInfo::_internal_set_stop_idx(uint32_t value) {
+  
+  _impl_.stop_idx_ = value;
+}
+inline void AlightEdgeInfo::set_stop_idx(uint32_t value) {
+  _internal_set_stop_idx(value);
+  // @@protoc_insertion_point(field_set:TCProto.AlightEdgeInfo.stop_idx)
+}
+
+// int32 distance = 2;
+inline void AlightEdgeInfo::clear_distance() {
+  _impl_.distance_ = 0;
+}
+inline int32_t AlightEdgeInfo::_internal_distance() const {
+  return _impl_.distance_;
+}
+inline int32_t AlightEdgeInfo::distance() const {
+  // @@protoc_insertion_point(field_get:TCProto.AlightEdgeInfo.distance)
+  return _internal_distance();
+}
+inline void AlightEdgeInfo::_internal_set_distance(int32_t value) {
+  
+  _impl_.distance_ = value;
+}
+inline void AlightEdgeInfo::set_distance(int32_t value) {
+  _internal_set_distance(value);
+  // @@protoc_insertion_point(field_set:TCProto.AlightEdgeInfo.distance)
+}
+
+// -------------------------------------------------------------------
+
 // EdgeInfo
 
 // .TCProto.BusEdgeInfo bus_data = 1;
@@ -1663,12 +2356,12 @@ inline bool EdgeInfo::has_bus_data() const {
   return _internal_has_bus_data();
 }
 inline void EdgeInfo::set_has_bus_data() {
-  _oneof_case_[0] = kBusData;
+  _impl_._oneof_case_[0] = kBusData;
 }
 inline void EdgeInfo::clear_bus_data() {
   if (_internal_has_bus_data()) {
-    if (GetArena() == nullptr) {
-      delete data_.bus_data_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.bus_data_;
     }
     clear_has_data();
   }
@@ -1677,11 +2370,11 @@ inline ::TCProto::BusEdgeInfo* EdgeInfo::release_bus_data() {
   // @@protoc_insertion_point(field_release:TCProto.EdgeInfo.bus_data)
   if (_internal_has_bus_data()) {
     clear_has_data();
-      ::TCProto::BusEdgeInfo* temp = data_.bus_data_;
-    if (GetArena() != nullptr) {
+    ::TCProto::BusEdgeInfo* temp = _impl_.data_.bus_data_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    data_.bus_data_ = nullptr;
+    _impl_.data_.bus_data_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -1689,7 +2382,7 @@ inline ::TCProto::BusEdgeInfo* EdgeInfo::release_bus_data() {
 }
 inline const ::TCProto::BusEdgeInfo& EdgeInfo::_internal_bus_data() const {
   return _internal_has_bus_data()
-      ? *data_.bus_data_
+      ? *_impl_.data_.bus_data_
       : reinterpret_cast< ::TCProto::BusEdgeInfo&>(::TCProto::_BusEdgeInfo_default_instance_);
 }
 inline const ::TCProto::BusEdgeInfo& EdgeInfo::bus_data() const {
@@ -1700,8 +2393,8 @@ inline ::TCProto::BusEdgeInfo* EdgeInfo::unsafe_arena_release_bus_data() {
   // @@protoc_insertion_point(field_unsafe_arena_release:TCProto.EdgeInfo.bus_data)
   if (_internal_has_bus_data()) {
     clear_has_data();
-    ::TCProto::BusEdgeInfo* temp = data_.bus_data_;
-    data_.bus_data_ = nullptr;
+    ::TCProto::BusEdgeInfo* temp = _impl_.data_.bus_data_;
+    _impl_.data_.bus_data_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -1711,7 +2404,7 @@ inline void EdgeInfo::unsafe_arena_set_allocated_bus_data(::TCProto::BusEdgeInfo
   clear_data();
   if (bus_data) {
     set_has_bus_data();
-    data_.bus_data_ = bus_data;
+    _impl_.data_.bus_data_ = bus_data;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TCProto.EdgeInfo.bus_data)
 }
@@ -1719,13 +2412,14 @@ inline ::TCProto::BusEdgeInfo* EdgeInfo::_internal_mutable_bus_data() {
   if (!_internal_has_bus_data()) {
     clear_data();
     set_has_bus_data();
-    data_.bus_data_ = CreateMaybeMessage< ::TCProto::BusEdgeInfo >(GetArena());
+    _impl_.data_.bus_data_ = CreateMaybeMessage< ::TCProto::BusEdgeInfo >(GetArenaForAllocation());
   }
-  return data_.bus_data_;
+  return _impl_.data_.bus_data_;
 }
 inline ::TCProto::BusEdgeInfo* EdgeInfo::mutable_bus_data() {
+  ::TCProto::BusEdgeInfo* _msg = _internal_mutable_bus_data();
   // @@protoc_insertion_point(field_mutable:TCProto.EdgeInfo.bus_data)
-  return _internal_mutable_bus_data();
+  return _msg;
 }
 
 // .TCProto.WaitEdgeInfo wait_data = 2;
@@ -1736,12 +2430,12 @@ inline bool EdgeInfo::has_wait_data() const {
   return _internal_has_wait_data();
 }
 inline void EdgeInfo::set_has_wait_data() {
-  _oneof_case_[0] = kWaitData;
+  _impl_._oneof_case_[0] = kWaitData;
 }
 inline void EdgeInfo::clear_wait_data() {
   if (_internal_has_wait_data()) {
-    if (GetArena() == nullptr) {
-      delete data_.wait_data_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.wait_data_;
     }
     clear_has_data();
   }
@@ -1750,11 +2444,11 @@ inline ::TCProto::WaitEdgeInfo* EdgeInfo::release_wait_data() {
   // @@protoc_insertion_point(field_release:TCProto.EdgeInfo.wait_data)
   if (_internal_has_wait_data()) {
     clear_has_data();
-      ::TCProto::WaitEdgeInfo* temp = data_.wait_data_;
-    if (GetArena() != nullptr) {
+    ::TCProto::WaitEdgeInfo* temp = _impl_.data_.wait_data_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    data_.wait_data_ = nullptr;
+    _impl_.data_.wait_data_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -1762,7 +2456,7 @@ inline ::TCProto::WaitEdgeInfo* EdgeInfo::release_wait_data() {
 }
 inline const ::TCProto::WaitEdgeInfo& EdgeInfo::_internal_wait_data() const {
   return _internal_has_wait_data()
-      ? *data_.wait_data_
+      ? *_impl_.data_.wait_data_
       : reinterpret_cast< ::TCProto::WaitEdgeInfo&>(::TCProto::_WaitEdgeInfo_default_instance_);
 }
 inline const ::TCProto::WaitEdgeInfo& EdgeInfo::wait_data() const {
@@ -1773,8 +2467,8 @@ inline ::TCProto::WaitEdgeInfo* EdgeInfo::unsafe_arena_release_wait_data() {
   // @@protoc_insertion_point(field_unsafe_arena_release:TCProto.EdgeInfo.wait_data)
   if (_internal_has_wait_data()) {
     clear_has_data();
-    ::TCProto::WaitEdgeInfo* temp = data_.wait_data_;
-    data_.wait_data_ = nullptr;
+    ::TCProto::WaitEdgeInfo* temp = _impl_.data_.wait_data_;
+    _impl_.data_.wait_data_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -1784,7 +2478,7 @@ inline void EdgeInfo::unsafe_arena_set_allocated_wait_data(::TCProto::WaitEdgeIn
   clear_data();
   if (wait_data) {
     set_has_wait_data();
-    data_.wait_data_ = wait_data;
+    _impl_.data_.wait_data_ = wait_data;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TCProto.EdgeInfo.wait_data)
 }
@@ -1792,23 +2486,246 @@ inline ::TCProto::WaitEdgeInfo* EdgeInfo::_internal_mutable_wait_data() {
   if (!_internal_has_wait_data()) {
     clear_data();
     set_has_wait_data();
-    data_.wait_data_ = CreateMaybeMessage< ::TCProto::WaitEdgeInfo >(GetArena());
+    _impl_.data_.wait_data_ = CreateMaybeMessage< ::TCProto::WaitEdgeInfo >(GetArenaForAllocation());
   }
-  return data_.wait_data_;
+  return _impl_.data_.wait_data_;
 }
 inline ::TCProto::WaitEdgeInfo* EdgeInfo::mutable_wait_data() {
+  ::TCProto::WaitEdgeInfo* _msg = _internal_mutable_wait_data();
   // @@protoc_insertion_point(field_mutable:TCProto.EdgeInfo.wait_data)
-  return _internal_mutable_wait_data();
+  return _msg;
+}
+
+// .TCProto.BoardEdgeInfo board_data = 3;
+inline bool EdgeInfo::_internal_has_board_data() const {
+  return data_case() == kBoardData;
+}
+inline bool EdgeInfo::has_board_data() const {
+  return _internal_has_board_data();
+}
+inline void EdgeInfo::set_has_board_data() {
+  _impl_._oneof_case_[0] = kBoardData;
+}
+inline void EdgeInfo::clear_board_data() {
+  if (_internal_has_board_data()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.board_data_;
+    }
+    clear_has_data();
+  }
+}
+inline ::TCProto::BoardEdgeInfo* EdgeInfo::release_board_data() {
+  // @@protoc_insertion_point(field_release:TCProto.EdgeInfo.board_data)
+  if (_internal_has_board_data()) {
+    clear_has_data();
+    ::TCProto::BoardEdgeInfo* temp = _impl_.data_.board_data_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.board_data_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::TCProto::BoardEdgeInfo& EdgeInfo::_internal_board_data() const {
+  return _internal_has_board_data()
+      ? *_impl_.data_.board_data_
+      : reinterpret_cast< ::TCProto::BoardEdgeInfo&>(::TCProto::_BoardEdgeInfo_default_instance_);
+}
+inline const ::TCProto::BoardEdgeInfo& EdgeInfo::board_data() const {
+  // @@protoc_insertion_point(field_get:TCProto.EdgeInfo.board_data)
+  return _internal_board_data();
+}
+inline ::TCProto::BoardEdgeInfo* EdgeInfo::unsafe_arena_release_board_data() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:TCProto.EdgeInfo.board_data)
+  if (_internal_has_board_data()) {
+    clear_has_data();
+    ::TCProto::BoardEdgeInfo* temp = _impl_.data_.board_data_;
+    _impl_.data_.board_data_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void EdgeInfo::unsafe_arena_set_allocated_board_data(::TCProto::BoardEdgeInfo* board_data) {
+  clear_data();
+  if (board_data) {
+    set_has_board_data();
+    _impl_.data_.board_data_ = board_data;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TCProto.EdgeInfo.board_data)
+}
+inline ::TCProto::BoardEdgeInfo* EdgeInfo::_internal_mutable_board_data() {
+  if (!_internal_has_board_data()) {
+    clear_data();
+    set_has_board_data();
+    _impl_.data_.board_data_ = CreateMaybeMessage< ::TCProto::BoardEdgeInfo >(GetArenaForAllocation());
+  }
+  return _impl_.data_.board_data_;
+}
+inline ::TCProto::BoardEdgeInfo* EdgeInfo::mutable_board_data() {
+  ::TCProto::BoardEdgeInfo* _msg = _internal_mutable_board_data();
+  // @@protoc_insertion_point(field_mutable:TCProto.EdgeInfo.board_data)
+  return _msg;
+}
+
+// .TCProto.RideEdgeInfo ride_data = 4;
+inline bool EdgeInfo::_internal_has_ride_data() const {
+  return data_case() == kRideData;
+}
+inline bool EdgeInfo::has_ride_data() const {
+  return _internal_has_ride_data();
+}
+inline void EdgeInfo::set_has_ride_data() {
+  _impl_._oneof_case_[0] = kRideData;
+}
+inline void EdgeInfo::clear_ride_data() {
+  if (_internal_has_ride_data()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.ride_data_;
+    }
+    clear_has_data();
+  }
+}
+inline ::TCProto::RideEdgeInfo* EdgeInfo::release_ride_data() {
+  // @@protoc_insertion_point(field_release:TCProto.EdgeInfo.ride_data)
+  if (_internal_has_ride_data()) {
+    clear_has_data();
+    ::TCProto::RideEdgeInfo* temp = _impl_.data_.ride_data_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.ride_data_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::TCProto::RideEdgeInfo& EdgeInfo::_internal_ride_data() const {
+  return _internal_has_ride_data()
+      ? *_impl_.data_.ride_data_
+      : reinterpret_cast< ::TCProto::RideEdgeInfo&>(::TCProto::_RideEdgeInfo_default_instance_);
+}
+inline const ::TCProto::RideEdgeInfo& EdgeInfo::ride_data() const {
+  // @@protoc_insertion_point(field_get:TCProto.EdgeInfo.ride_data)
+  return _internal_ride_data();
+}
+inline ::TCProto::RideEdgeInfo* EdgeInfo::unsafe_arena_release_ride_data() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:TCProto.EdgeInfo.ride_data)
+  if (_internal_has_ride_data()) {
+    clear_has_data();
+    ::TCProto::RideEdgeInfo* temp = _impl_.data_.ride_data_;
+    _impl_.data_.ride_data_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void EdgeInfo::unsafe_arena_set_allocated_ride_data(::TCProto::RideEdgeInfo* ride_data) {
+  clear_data();
+  if (ride_data) {
+    set_has_ride_data();
+    _impl_.data_.ride_data_ = ride_data;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TCProto.EdgeInfo.ride_data)
+}
+inline ::TCProto::RideEdgeInfo* EdgeInfo::_internal_mutable_ride_data() {
+  if (!_internal_has_ride_data()) {
+    clear_data();
+    set_has_ride_data();
+    _impl_.data_.ride_data_ = CreateMaybeMessage< ::TCProto::RideEdgeInfo >(GetArenaForAllocation());
+  }
+  return _impl_.data_.ride_data_;
+}
+inline ::TCProto::RideEdgeInfo* EdgeInfo::mutable_ride_data() {
+  ::TCProto::RideEdgeInfo* _msg = _internal_mutable_ride_data();
+  // @@protoc_insertion_point(field_mutable:TCProto.EdgeInfo.ride_data)
+  return _msg;
+}
+
+// .TCProto.AlightEdgeInfo alight_data = 5;
+inline bool EdgeInfo::_internal_has_alight_data() const {
+  return data_case() == kAlightData;
+}
+inline bool EdgeInfo::has_alight_data() const {
+  return _internal_has_alight_data();
+}
+inline void EdgeInfo::set_has_alight_data() {
+  _impl_._oneof_case_[0] = kAlightData;
+}
+inline void EdgeInfo::clear_alight_data() {
+  if (_internal_has_alight_data()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.data_.alight_data_;
+    }
+    clear_has_data();
+  }
+}
+inline ::TCProto::AlightEdgeInfo* EdgeInfo::release_alight_data() {
+  // @@protoc_insertion_point(field_release:TCProto.EdgeInfo.alight_data)
+  if (_internal_has_alight_data()) {
+    clear_has_data();
+    ::TCProto::AlightEdgeInfo* temp = _impl_.data_.alight_data_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.data_.alight_data_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::TCProto::AlightEdgeInfo& EdgeInfo::_internal_alight_data() const {
+  return _internal_has_alight_data()
+      ? *_impl_.data_.alight_data_
+      : reinterpret_cast< ::TCProto::AlightEdgeInfo&>(::TCProto::_AlightEdgeInfo_default_instance_);
+}
+inline const ::TCProto::AlightEdgeInfo& EdgeInfo::alight_data() const {
+  // @@protoc_insertion_point(field_get:TCProto.EdgeInfo.alight_data)
+  return _internal_alight_data();
+}
+inline ::TCProto::AlightEdgeInfo* EdgeInfo::unsafe_arena_release_alight_data() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:TCProto.EdgeInfo.alight_data)
+  if (_internal_has_alight_data()) {
+    clear_has_data();
+    ::TCProto::AlightEdgeInfo* temp = _impl_.data_.alight_data_;
+    _impl_.data_.alight_data_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void EdgeInfo::unsafe_arena_set_allocated_alight_data(::TCProto::AlightEdgeInfo* alight_data) {
+  clear_data();
+  if (alight_data) {
+    set_has_alight_data();
+    _impl_.data_.alight_data_ = alight_data;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:TCProto.EdgeInfo.alight_data)
+}
+inline ::TCProto::AlightEdgeInfo* EdgeInfo::_internal_mutable_alight_data() {
+  if (!_internal_has_alight_data()) {
+    clear_data();
+    set_has_alight_data();
+    _impl_.data_.alight_data_ = CreateMaybeMessage< ::TCProto::AlightEdgeInfo >(GetArenaForAllocation());
+  }
+  return _impl_.data_.alight_data_;
+}
+inline ::TCProto::AlightEdgeInfo* EdgeInfo::mutable_alight_data() {
+  ::TCProto::AlightEdgeInfo* _msg = _internal_mutable_alight_data();
+  // @@protoc_insertion_point(field_mutable:TCProto.EdgeInfo.alight_data)
+  return _msg;
 }
 
 inline bool EdgeInfo::has_data() const {
   return data_case() != DATA_NOT_SET;
 }
 inline void EdgeInfo::clear_has_data() {
-  _oneof_case_[0] = DATA_NOT_SET;
+  _impl_._oneof_case_[0] = DATA_NOT_SET;
 }
 inline EdgeInfo::DataCase EdgeInfo::data_case() const {
-  return EdgeInfo::DataCase(_oneof_case_[0]);
+  return EdgeInfo::DataCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -1816,19 +2733,19 @@ inline EdgeInfo::DataCase EdgeInfo::data_case() const {
 
 // .TCProto.RoutingSettings routing_settings = 1;
 inline bool TransportRouter::_internal_has_routing_settings() const {
-  return this != internal_default_instance() && routing_settings_ != nullptr;
+  return this != internal_default_instance() && _impl_.routing_settings_ != nullptr;
 }
 inline bool TransportRouter::has_routing_settings() const {
   return _internal_has_routing_settings();
 }
 inline void TransportRouter::clear_routing_settings() {
-  if (GetArena() == nullptr && routing_settings_ != nullptr) {
-    delete routing_settings_;
+  if (GetArenaForAllocation() == nullptr && _impl_.routing_settings_ != nullptr) {
+    delete _impl_.routing_settings_;
   }
-  routing_settings_ = nullptr;
+  _impl_.routing_settings_ = nullptr;
 }
 inline const ::TCProto::RoutingSettings& TransportRouter::_internal_routing_settings() const {
-  const ::TCProto::RoutingSettings* p = routing_settings_;
+  const ::TCProto::RoutingSettings* p = _impl_.routing_settings_;
   return p != nullptr ? *p : reinterpret_cast<const ::TCProto::RoutingSettings&>(
       ::TCProto::_RoutingSettings_default_instance_);
 }
@@ -1838,10 +2755,10 @@ inline const ::TCProto::RoutingSettings& TransportRouter::routing_settings() con
 }
 inline void TransportRouter::unsafe_arena_set_allocated_routing_settings(
     ::TCProto::RoutingSettings* routing_settings) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(routing_settings_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.routing_settings_);
   }
-  routing_settings_ = routing_settings;
+  _impl_.routing_settings_ = routing_settings;
   if (routing_settings) {
     
   } else {
@@ -1851,40 +2768,47 @@ inline void TransportRouter::unsafe_arena_set_allocated_routing_settings(
 }
 inline ::TCProto::RoutingSettings* TransportRouter::release_routing_settings() {
   
-  ::TCProto::RoutingSettings* temp = routing_settings_;
-  routing_settings_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::TCProto::RoutingSettings* temp = _impl_.routing_settings_;
+  _impl_.routing_settings_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::TCProto::RoutingSettings* TransportRouter::unsafe_arena_release_routing_settings() {
   // @@protoc_insertion_point(field_release:TCProto.TransportRouter.routing_settings)
   
-  ::TCProto::RoutingSettings* temp = routing_settings_;
-  routing_settings_ = nullptr;
+  ::TCProto::RoutingSettings* temp = _impl_.routing_settings_;
+  _impl_.routing_settings_ = nullptr;
   return temp;
 }
 inline ::TCProto::RoutingSettings* TransportRouter::_internal_mutable_routing_settings() {
   
-  if (routing_settings_ == nullptr) {
-    auto* p = CreateMaybeMessage<::TCProto::RoutingSettings>(GetArena());
-    routing_settings_ = p;
+  if (_impl_.routing_settings_ == nullptr) {
+    auto* p = CreateMaybeMessage<::TCProto::RoutingSettings>(GetArenaForAllocation());
+    _impl_.routing_settings_ = p;
   }
-  return routing_settings_;
+  return _impl_.routing_settings_;
 }
 inline ::TCProto::RoutingSettings* TransportRouter::mutable_routing_settings() {
+  ::TCProto::RoutingSettings* _msg = _internal_mutable_routing_settings();
   // @@protoc_insertion_point(field_mutable:TCProto.TransportRouter.routing_settings)
-  return _internal_mutable_routing_settings();
+  return _msg;
 }
 inline void TransportRouter::set_allocated_routing_settings(::TCProto::RoutingSettings* routing_settings) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete routing_settings_;
+    delete _impl_.routing_settings_;
   }
   if (routing_settings) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(routing_settings);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(routing_settings);
     if (message_arena != submessage_arena) {
       routing_settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, routing_settings, submessage_arena);
@@ -1893,19 +2817,19 @@ inline void TransportRouter::set_allocated_routing_settings(::TCProto::RoutingSe
   } else {
     
   }
-  routing_settings_ = routing_settings;
+  _impl_.routing_settings_ = routing_settings;
   // @@protoc_insertion_point(field_set_allocated:TCProto.TransportRouter.routing_settings)
 }
 
 // .GraphProto.DirectedWeightedGraph graph = 2;
 inline bool TransportRouter::_internal_has_graph() const {
-  return this != internal_default_instance() && graph_ != nullptr;
+  return this != internal_default_instance() && _impl_.graph_ != nullptr;
 }
 inline bool TransportRouter::has_graph() const {
   return _internal_has_graph();
 }
 inline const ::GraphProto::DirectedWeightedGraph& TransportRouter::_internal_graph() const {
-  const ::GraphProto::DirectedWeightedGraph* p = graph_;
+  const ::GraphProto::DirectedWeightedGraph* p = _impl_.graph_;
   return p != nullptr ? *p : reinterpret_cast<const ::GraphProto::DirectedWeightedGraph&>(
       ::GraphProto::_DirectedWeightedGraph_default_instance_);
 }
@@ -1915,10 +2839,10 @@ inline const ::GraphProto::DirectedWeightedGraph& TransportRouter::graph() const
 }
 inline void TransportRouter::unsafe_arena_set_allocated_graph(
     ::GraphProto::DirectedWeightedGraph* graph) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(graph_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.graph_);
   }
-  graph_ = graph;
+  _impl_.graph_ = graph;
   if (graph) {
     
   } else {
@@ -1928,40 +2852,48 @@ inline void TransportRouter::unsafe_arena_set_allocated_graph(
 }
 inline ::GraphProto::DirectedWeightedGraph* TransportRouter::release_graph() {
   
-  ::GraphProto::DirectedWeightedGraph* temp = graph_;
-  graph_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::GraphProto::DirectedWeightedGraph* temp = _impl_.graph_;
+  _impl_.graph_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::GraphProto::DirectedWeightedGraph* TransportRouter::unsafe_arena_release_graph() {
   // @@protoc_insertion_point(field_release:TCProto.TransportRouter.graph)
   
-  ::GraphProto::DirectedWeightedGraph* temp = graph_;
-  graph_ = nullptr;
+  ::GraphProto::DirectedWeightedGraph* temp = _impl_.graph_;
+  _impl_.graph_ = nullptr;
   return temp;
 }
 inline ::GraphProto::DirectedWeightedGraph* TransportRouter::_internal_mutable_graph() {
   
-  if (graph_ == nullptr) {
-    auto* p = CreateMaybeMessage<::GraphProto::DirectedWeightedGraph>(GetArena());
-    graph_ = p;
+  if (_impl_.graph_ == nullptr) {
+    auto* p = CreateMaybeMessage<::GraphProto::DirectedWeightedGraph>(GetArenaForAllocation());
+    _impl_.graph_ = p;
   }
-  return graph_;
+  return _impl_.graph_;
 }
 inline ::GraphProto::DirectedWeightedGraph* TransportRouter::mutable_graph() {
+  ::GraphProto::DirectedWeightedGraph* _msg = _internal_mutable_graph();
   // @@protoc_insertion_point(field_mutable:TCProto.TransportRouter.graph)
-  return _internal_mutable_graph();
+  return _msg;
 }
 inline void TransportRouter::set_allocated_graph(::GraphProto::DirectedWeightedGraph* graph) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(graph_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.graph_);
   }
   if (graph) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(graph)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(graph));
     if (message_arena != submessage_arena) {
       graph = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, graph, submessage_arena);
@@ -1970,19 +2902,19 @@ inline void TransportRouter::set_allocated_graph(::GraphProto::DirectedWeightedG
   } else {
     
   }
-  graph_ = graph;
+  _impl_.graph_ = graph;
   // @@protoc_insertion_point(field_set_allocated:TCProto.TransportRouter.graph)
 }
 
 // .GraphProto.Router router = 3;
 inline bool TransportRouter::_internal_has_router() const {
-  return this != internal_default_instance() && router_ != nullptr;
+  return this != internal_default_instance() && _impl_.router_ != nullptr;
 }
 inline bool TransportRouter::has_router() const {
   return _internal_has_router();
 }
 inline const ::GraphProto::Router& TransportRouter::_internal_router() const {
-  const ::GraphProto::Router* p = router_;
+  const ::GraphProto::Router* p = _impl_.router_;
   return p != nullptr ? *p : reinterpret_cast<const ::GraphProto::Router&>(
       ::GraphProto::_Router_default_instance_);
 }
@@ -1992,10 +2924,10 @@ inline const ::GraphProto::Router& TransportRouter::router() const {
 }
 inline void TransportRouter::unsafe_arena_set_allocated_router(
     ::GraphProto::Router* router) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.router_);
   }
-  router_ = router;
+  _impl_.router_ = router;
   if (router) {
     
   } else {
@@ -2005,40 +2937,48 @@ inline void TransportRouter::unsafe_arena_set_allocated_router(
 }
 inline ::GraphProto::Router* TransportRouter::release_router() {
   
-  ::GraphProto::Router* temp = router_;
-  router_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::GraphProto::Router* temp = _impl_.router_;
+  _impl_.router_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::GraphProto::Router* TransportRouter::unsafe_arena_release_router() {
   // @@protoc_insertion_point(field_release:TCProto.TransportRouter.router)
   
-  ::GraphProto::Router* temp = router_;
-  router_ = nullptr;
+  ::GraphProto::Router* temp = _impl_.router_;
+  _impl_.router_ = nullptr;
   return temp;
 }
 inline ::GraphProto::Router* TransportRouter::_internal_mutable_router() {
   
-  if (router_ == nullptr) {
-    auto* p = CreateMaybeMessage<::GraphProto::Router>(GetArena());
-    router_ = p;
+  if (_impl_.router_ == nullptr) {
+    auto* p = CreateMaybeMessage<::GraphProto::Router>(GetArenaForAllocation());
+    _impl_.router_ = p;
   }
-  return router_;
+  return _impl_.router_;
 }
 inline ::GraphProto::Router* TransportRouter::mutable_router() {
+  ::GraphProto::Router* _msg = _internal_mutable_router();
   // @@protoc_insertion_point(field_mutable:TCProto.TransportRouter.router)
-  return _internal_mutable_router();
+  return _msg;
 }
 inline void TransportRouter::set_allocated_router(::GraphProto::Router* router) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(router_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.router_);
   }
   if (router) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router)->GetArena();
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router));
     if (message_arena != submessage_arena) {
       router = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, router, submessage_arena);
@@ -2047,125 +2987,128 @@ inline void TransportRouter::set_allocated_router(::GraphProto::Router* router)
   } else {
     
   }
-  router_ = router;
+  _impl_.router_ = router;
   // @@protoc_insertion_point(field_set_allocated:TCProto.TransportRouter.router)
 }
 
 // repeated .TCProto.StopVertexIds stops_vertex_ids = 4;
 inline int TransportRouter::_internal_stops_vertex_ids_size() const {
-  return stops_vertex_ids_.size();
+  return _impl_.stops_vertex_ids_.size();
 }
 inline int TransportRouter::stops_vertex_ids_size() const {
   return _internal_stops_vertex_ids_size();
 }
 inline void TransportRouter::clear_stops_vertex_ids() {
-  stops_vertex_ids_.Clear();
+  _impl_.stops_vertex_ids_.Clear();
 }
 inline ::TCProto::StopVertexIds* TransportRouter::mutable_stops_vertex_ids(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.TransportRouter.stops_vertex_ids)
-  return stops_vertex_ids_.Mutable(index);
+  return _impl_.stops_vertex_ids_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopVertexIds >*
 TransportRouter::mutable_stops_vertex_ids() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.TransportRouter.stops_vertex_ids)
-  return &stops_vertex_ids_;
+  return &_impl_.stops_vertex_ids_;
 }
 inline const ::TCProto::StopVertexIds& TransportRouter::_internal_stops_vertex_ids(int index) const {
-  return stops_vertex_ids_.Get(index);
+  return _impl_.stops_vertex_ids_.Get(index);
 }
 inline const ::TCProto::StopVertexIds& TransportRouter::stops_vertex_ids(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.TransportRouter.stops_vertex_ids)
   return _internal_stops_vertex_ids(index);
 }
 inline ::TCProto::StopVertexIds* TransportRouter::_internal_add_stops_vertex_ids() {
-  return stops_vertex_ids_.Add();
+  return _impl_.stops_vertex_ids_.Add();
 }
 inline ::TCProto::StopVertexIds* TransportRouter::add_stops_vertex_ids() {
+  ::TCProto::StopVertexIds* _add = _internal_add_stops_vertex_ids();
   // @@protoc_insertion_point(field_add:TCProto.TransportRouter.stops_vertex_ids)
-  return _internal_add_stops_vertex_ids();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::StopVertexIds >&
 TransportRouter::stops_vertex_ids() const {
   // @@protoc_insertion_point(field_list:TCProto.TransportRouter.stops_vertex_ids)
-  return stops_vertex_ids_;
+  return _impl_.stops_vertex_ids_;
 }
 
 // repeated .TCProto.VertexInfo vertices_info = 5;
 inline int TransportRouter::_internal_vertices_info_size() const {
-  return vertices_info_.size();
+  return _impl_.vertices_info_.size();
 }
 inline int TransportRouter::vertices_info_size() const {
   return _internal_vertices_info_size();
 }
 inline void TransportRouter::clear_vertices_info() {
-  vertices_info_.Clear();
+  _impl_.vertices_info_.Clear();
 }
 inline ::TCProto::VertexInfo* TransportRouter::mutable_vertices_info(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.TransportRouter.vertices_info)
-  return vertices_info_.Mutable(index);
+  return _impl_.vertices_info_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::VertexInfo >*
 TransportRouter::mutable_vertices_info() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.TransportRouter.vertices_info)
-  return &vertices_info_;
+  return &_impl_.vertices_info_;
 }
 inline const ::TCProto::VertexInfo& TransportRouter::_internal_vertices_info(int index) const {
-  return vertices_info_.Get(index);
+  return _impl_.vertices_info_.Get(index);
 }
 inline const ::TCProto::VertexInfo& TransportRouter::vertices_info(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.TransportRouter.vertices_info)
   return _internal_vertices_info(index);
 }
 inline ::TCProto::VertexInfo* TransportRouter::_internal_add_vertices_info() {
-  return vertices_info_.Add();
+  return _impl_.vertices_info_.Add();
 }
 inline ::TCProto::VertexInfo* TransportRouter::add_vertices_info() {
+  ::TCProto::VertexInfo* _add = _internal_add_vertices_info();
   // @@protoc_insertion_point(field_add:TCProto.TransportRouter.vertices_info)
-  return _internal_add_vertices_info();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::VertexInfo >&
 TransportRouter::vertices_info() const {
   // @@protoc_insertion_point(field_list:TCProto.TransportRouter.vertices_info)
-  return vertices_info_;
+  return _impl_.vertices_info_;
 }
 
 // repeated .TCProto.EdgeInfo edges_info = 6;
 inline int TransportRouter::_internal_edges_info_size() const {
-  return edges_info_.size();
+  return _impl_.edges_info_.size();
 }
 inline int TransportRouter::edges_info_size() const {
   return _internal_edges_info_size();
 }
 inline void TransportRouter::clear_edges_info() {
-  edges_info_.Clear();
+  _impl_.edges_info_.Clear();
 }
 inline ::TCProto::EdgeInfo* TransportRouter::mutable_edges_info(int index) {
   // @@protoc_insertion_point(field_mutable:TCProto.TransportRouter.edges_info)
-  return edges_info_.Mutable(index);
+  return _impl_.edges_info_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::EdgeInfo >*
 TransportRouter::mutable_edges_info() {
   // @@protoc_insertion_point(field_mutable_list:TCProto.TransportRouter.edges_info)
-  return &edges_info_;
+  return &_impl_.edges_info_;
 }
 inline const ::TCProto::EdgeInfo& TransportRouter::_internal_edges_info(int index) const {
-  return edges_info_.Get(index);
+  return _impl_.edges_info_.Get(index);
 }
 inline const ::TCProto::EdgeInfo& TransportRouter::edges_info(int index) const {
   // @@protoc_insertion_point(field_get:TCProto.TransportRouter.edges_info)
   return _internal_edges_info(index);
 }
 inline ::TCProto::EdgeInfo* TransportRouter::_internal_add_edges_info() {
-  return edges_info_.Add();
+  return _impl_.edges_info_.Add();
 }
 inline ::TCProto::EdgeInfo* TransportRouter::add_edges_info() {
+  ::TCProto::EdgeInfo* _add = _internal_add_edges_info();
   // @@protoc_insertion_point(field_add:TCProto.TransportRouter.edges_info)
-  return _internal_add_edges_info();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::TCProto::EdgeInfo >&
 TransportRouter::edges_info() const {
   // @@protoc_insertion_point(field_list:TCProto.TransportRouter.edges_info)
-  return edges_info_;
+  return _impl_.edges_info_;
 }
 
 #ifdef __GNUC__
@@ -2183,6 +3126,12 @@ TransportRouter::edges_info() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
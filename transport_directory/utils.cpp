@@ -16,4 +16,81 @@ string_view Strip(string_view line) {
 
 int ConvertToMinutes(int day, int hours, int minutes) {
   return day * 24 * 60 + hours * 60 + minutes;
-}
\ No newline at end of file
+}
+
+ThreadPool::ThreadPool(size_t thread_count) {
+  for (size_t i = 1; i < thread_count; ++i) {
+    workers_.emplace_back([this] { RunWorker(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    lock_guard lock(mutex_);
+    is_stopping_ = true;
+  }
+  job_ready_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Run(const function<void()>& job, size_t helper_count) {
+  {
+    lock_guard lock(mutex_);
+    job_ = &job;
+    ++job_generation_;
+    free_slots_ = helper_count;
+    running_helpers_ = helper_count;
+    error_ = nullptr;
+  }
+  job_ready_.notify_all();
+
+  exception_ptr error;
+  try {
+    job();
+  } catch (...) {
+    error = current_exception();
+  }
+
+  // The job lives on the caller's stack, so the helpers must be done with it
+  unique_lock lock(mutex_);
+  job_done_.wait(lock, [this] { return running_helpers_ == 0; });
+  job_ = nullptr;
+  if (!error) {
+    error = error_;
+  }
+  lock.unlock();
+  if (error) {
+    rethrow_exception(error);
+  }
+}
+
+void ThreadPool::RunWorker() {
+  size_t seen_generation = 0;
+  unique_lock lock(mutex_);
+  while (true) {
+    job_ready_.wait(lock, [&] {
+      return is_stopping_ || (job_generation_ != seen_generation && free_slots_ > 0);
+    });
+    if (is_stopping_) {
+      return;
+    }
+    seen_generation = job_generation_;
+    --free_slots_;
+    const function<void()>& job = *job_;
+    lock.unlock();
+    try {
+      job();
+    } catch (...) {
+      lock_guard error_lock(mutex_);
+      if (!error_) {
+        error_ = current_exception();
+      }
+    }
+    lock.lock();
+    if (--running_helpers_ == 0) {
+      job_done_.notify_one();
+    }
+  }
+}
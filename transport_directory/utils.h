@@ -1,9 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 template <typename It>
 class Range {
@@ -59,6 +68,91 @@ std::unordered_set<T> Intersect(const std::unordered_set<T>& set1, const std::un
   return result;
 }
 
+// Threads started once and reused by every ParallelFor call, so that many
+// small calls do not pay for starting and joining threads. The calling thread
+// is one of the thread_count, so a pool of one thread starts none. Calls must
+// come from one thread at a time.
+class ThreadPool {
+public:
+  explicit ThreadPool(size_t thread_count);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  size_t GetThreadCount() const {
+    return workers_.size() + 1;
+  }
+
+  // Calls func(idx) for every idx in [0, count) and returns when all are done.
+  // Indices are handed out one by one, so unevenly heavy items are balanced;
+  // func must be safe to call concurrently for different indices. The first
+  // exception thrown by func is rethrown here.
+  template <typename Func>
+  void ParallelFor(size_t count, Func func) {
+    const size_t helper_count = std::min(workers_.size(), count > 0 ? count - 1 : 0);
+    if (helper_count == 0) {
+      for (size_t idx = 0; idx < count; ++idx) {
+        func(idx);
+      }
+      return;
+    }
+    std::atomic<size_t> next_idx = 0;
+    Run([&] {
+      for (size_t idx = next_idx++; idx < count; idx = next_idx++) {
+        func(idx);
+      }
+    }, helper_count);
+  }
+
+private:
+  std::vector<std::thread> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable job_ready_;
+  std::condition_variable job_done_;
+  const std::function<void()>* job_ = nullptr;
+  size_t job_generation_ = 0;
+  size_t free_slots_ = 0;      // helpers the current job still wants
+  size_t running_helpers_ = 0;
+  std::exception_ptr error_;
+  bool is_stopping_ = false;
+
+  // Runs job in the calling thread and in helper_count workers
+  void Run(const std::function<void()>& job, size_t helper_count);
+  void RunWorker();
+};
+
+// Holds a value that is either set right away or built by the factory on first access.
+// Concurrent first accesses build it only once.
+template <typename T>
+class Lazy {
+public:
+  void Set(std::unique_ptr<T> value) {
+    value_ = std::move(value);
+  }
+  void SetFactory(std::function<std::unique_ptr<T>()> factory) {
+    factory_ = std::move(factory);
+  }
+
+  const T& Get() const {
+    std::call_once(once_, [this] {
+      if (!value_) {
+        value_ = factory_();
+      }
+    });
+    return *value_;
+  }
+  const T* operator->() const {
+    return &Get();
+  }
+
+private:
+  mutable std::once_flag once_;
+  mutable std::unique_ptr<T> value_;
+  std::function<std::unique_ptr<T>()> factory_;
+};
+
 int ConvertToMinutes(int day, int hours, int minutes);
 
 std::string_view Strip(std::string_view line);
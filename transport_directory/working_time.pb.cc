@@ -14,73 +14,74 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_working_5ftime_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_WorkingTimeInterval_working_5ftime_2eproto;
-namespace YellowPages {
-class WorkingTimeIntervalDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<WorkingTimeInterval> _instance;
-} _WorkingTimeInterval_default_instance_;
-class WorkingTimeDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<WorkingTime> _instance;
-} _WorkingTime_default_instance_;
-}  // namespace YellowPages
-static void InitDefaultsscc_info_WorkingTime_working_5ftime_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::YellowPages::_WorkingTime_default_instance_;
-    new (ptr) ::YellowPages::WorkingTime();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_WorkingTime_working_5ftime_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_WorkingTime_working_5ftime_2eproto}, {
-      &scc_info_WorkingTimeInterval_working_5ftime_2eproto.base,}};
 
-static void InitDefaultsscc_info_WorkingTimeInterval_working_5ftime_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::YellowPages::_WorkingTimeInterval_default_instance_;
-    new (ptr) ::YellowPages::WorkingTimeInterval();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_WorkingTimeInterval_working_5ftime_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_WorkingTimeInterval_working_5ftime_2eproto}, {}};
-
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_working_5ftime_2eproto[2];
-static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_working_5ftime_2eproto[1];
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_working_5ftime_2eproto = nullptr;
+namespace YellowPages {
+PROTOBUF_CONSTEXPR WorkingTimeInterval::WorkingTimeInterval(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.day_)*/0
+  , /*decltype(_impl_.minutes_from_)*/0
+  , /*decltype(_impl_.minutes_to_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WorkingTimeIntervalDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorkingTimeIntervalDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorkingTimeIntervalDefaultTypeInternal() {}
+  union {
+    WorkingTimeInterval _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorkingTimeIntervalDefaultTypeInternal _WorkingTimeInterval_default_instance_;
+PROTOBUF_CONSTEXPR WorkingTime::WorkingTime(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.intervals_)*/{}
+  , /*decltype(_impl_.formatted_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WorkingTimeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WorkingTimeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WorkingTimeDefaultTypeInternal() {}
+  union {
+    WorkingTime _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WorkingTimeDefaultTypeInternal _WorkingTime_default_instance_;
+}  // namespace YellowPages
+static ::_pb::Metadata file_level_metadata_working_5ftime_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_working_5ftime_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_working_5ftime_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_working_5ftime_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_working_5ftime_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTimeInterval, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTimeInterval, day_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTimeInterval, minutes_from_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTimeInterval, minutes_to_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTimeInterval, _impl_.day_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTimeInterval, _impl_.minutes_from_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTimeInterval, _impl_.minutes_to_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTime, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTime, formatted_),
-  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTime, intervals_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTime, _impl_.formatted_),
+  PROTOBUF_FIELD_OFFSET(::YellowPages::WorkingTime, _impl_.intervals_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::YellowPages::WorkingTimeInterval)},
-  { 8, -1, sizeof(::YellowPages::WorkingTime)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::YellowPages::WorkingTimeInterval)},
+  { 9, -1, -1, sizeof(::YellowPages::WorkingTime)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::YellowPages::_WorkingTimeInterval_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::YellowPages::_WorkingTime_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::YellowPages::_WorkingTimeInterval_default_instance_._instance,
+  &::YellowPages::_WorkingTime_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_working_5ftime_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -94,22 +95,21 @@ const char descriptor_table_protodef_working_5ftime_2eproto[] PROTOBUF_SECTION_V
   "\n\tformatted\030\001 \001(\t\0223\n\tintervals\030\002 \003(\0132 .Y"
   "ellowPages.WorkingTimeIntervalb\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_working_5ftime_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_working_5ftime_2eproto_sccs[2] = {
-  &scc_info_WorkingTime_working_5ftime_2eproto.base,
-  &scc_info_WorkingTimeInterval_working_5ftime_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_working_5ftime_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_working_5ftime_2eproto = {
-  false, false, descriptor_table_protodef_working_5ftime_2eproto, "working_time.proto", 358,
-  &descriptor_table_working_5ftime_2eproto_once, descriptor_table_working_5ftime_2eproto_sccs, descriptor_table_working_5ftime_2eproto_deps, 2, 0,
-  schemas, file_default_instances, TableStruct_working_5ftime_2eproto::offsets,
-  file_level_metadata_working_5ftime_2eproto, 2, file_level_enum_descriptors_working_5ftime_2eproto, file_level_service_descriptors_working_5ftime_2eproto,
+static ::_pbi::once_flag descriptor_table_working_5ftime_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_working_5ftime_2eproto = {
+    false, false, 358, descriptor_table_protodef_working_5ftime_2eproto,
+    "working_time.proto",
+    &descriptor_table_working_5ftime_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_working_5ftime_2eproto::offsets,
+    file_level_metadata_working_5ftime_2eproto, file_level_enum_descriptors_working_5ftime_2eproto,
+    file_level_service_descriptors_working_5ftime_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_working_5ftime_2eproto_getter() {
+  return &descriptor_table_working_5ftime_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_working_5ftime_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_working_5ftime_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_working_5ftime_2eproto(&descriptor_table_working_5ftime_2eproto);
 namespace YellowPages {
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* WorkingTimeInterval_Day_descriptor() {
   ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_working_5ftime_2eproto);
@@ -131,7 +131,7 @@ bool WorkingTimeInterval_Day_IsValid(int value) {
   }
 }
 
-#if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 constexpr WorkingTimeInterval_Day WorkingTimeInterval::EVERYDAY;
 constexpr WorkingTimeInterval_Day WorkingTimeInterval::MONDAY;
 constexpr WorkingTimeInterval_Day WorkingTimeInterval::TUESDAY;
@@ -143,7 +143,7 @@ constexpr WorkingTimeInterval_Day WorkingTimeInterval::SUNDAY;
 constexpr WorkingTimeInterval_Day WorkingTimeInterval::Day_MIN;
 constexpr WorkingTimeInterval_Day WorkingTimeInterval::Day_MAX;
 constexpr int WorkingTimeInterval::Day_ARRAYSIZE;
-#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
@@ -151,143 +151,150 @@ class WorkingTimeInterval::_Internal {
  public:
 };
 
-WorkingTimeInterval::WorkingTimeInterval(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+WorkingTimeInterval::WorkingTimeInterval(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:YellowPages.WorkingTimeInterval)
 }
 WorkingTimeInterval::WorkingTimeInterval(const WorkingTimeInterval& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WorkingTimeInterval* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.day_){}
+    , decltype(_impl_.minutes_from_){}
+    , decltype(_impl_.minutes_to_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&day_, &from.day_,
-    static_cast<size_t>(reinterpret_cast<char*>(&minutes_to_) -
-    reinterpret_cast<char*>(&day_)) + sizeof(minutes_to_));
+  ::memcpy(&_impl_.day_, &from._impl_.day_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.minutes_to_) -
+    reinterpret_cast<char*>(&_impl_.day_)) + sizeof(_impl_.minutes_to_));
   // @@protoc_insertion_point(copy_constructor:YellowPages.WorkingTimeInterval)
 }
 
-void WorkingTimeInterval::SharedCtor() {
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&day_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&minutes_to_) -
-      reinterpret_cast<char*>(&day_)) + sizeof(minutes_to_));
+inline void WorkingTimeInterval::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.day_){0}
+    , decltype(_impl_.minutes_from_){0}
+    , decltype(_impl_.minutes_to_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 WorkingTimeInterval::~WorkingTimeInterval() {
   // @@protoc_insertion_point(destructor:YellowPages.WorkingTimeInterval)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void WorkingTimeInterval::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void WorkingTimeInterval::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void WorkingTimeInterval::ArenaDtor(void* object) {
-  WorkingTimeInterval* _this = reinterpret_cast< WorkingTimeInterval* >(object);
-  (void)_this;
-}
-void WorkingTimeInterval::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void WorkingTimeInterval::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const WorkingTimeInterval& WorkingTimeInterval::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_WorkingTimeInterval_working_5ftime_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void WorkingTimeInterval::Clear() {
 // @@protoc_insertion_point(message_clear_start:YellowPages.WorkingTimeInterval)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&day_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&minutes_to_) -
-      reinterpret_cast<char*>(&day_)) + sizeof(minutes_to_));
+  ::memset(&_impl_.day_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.minutes_to_) -
+      reinterpret_cast<char*>(&_impl_.day_)) + sizeof(_impl_.minutes_to_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* WorkingTimeInterval::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* WorkingTimeInterval::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .YellowPages.WorkingTimeInterval.Day day = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
           _internal_set_day(static_cast<::YellowPages::WorkingTimeInterval_Day>(val));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 minutes_from = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          minutes_from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.minutes_from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // int32 minutes_to = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          minutes_to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.minutes_to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* WorkingTimeInterval::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* WorkingTimeInterval::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:YellowPages.WorkingTimeInterval)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .YellowPages.WorkingTimeInterval.Day day = 1;
-  if (this->day() != 0) {
+  if (this->_internal_day() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
       1, this->_internal_day(), target);
   }
 
   // int32 minutes_from = 2;
-  if (this->minutes_from() != 0) {
+  if (this->_internal_minutes_from() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_minutes_from(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_minutes_from(), target);
   }
 
   // int32 minutes_to = 3;
-  if (this->minutes_to() != 0) {
+  if (this->_internal_minutes_to() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(3, this->_internal_minutes_to(), target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_minutes_to(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:YellowPages.WorkingTimeInterval)
@@ -298,77 +305,54 @@ size_t WorkingTimeInterval::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:YellowPages.WorkingTimeInterval)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // .YellowPages.WorkingTimeInterval.Day day = 1;
-  if (this->day() != 0) {
+  if (this->_internal_day() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_day());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_day());
   }
 
   // int32 minutes_from = 2;
-  if (this->minutes_from() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_minutes_from());
+  if (this->_internal_minutes_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_minutes_from());
   }
 
   // int32 minutes_to = 3;
-  if (this->minutes_to() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_minutes_to());
+  if (this->_internal_minutes_to() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_minutes_to());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void WorkingTimeInterval::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:YellowPages.WorkingTimeInterval)
-  GOOGLE_DCHECK_NE(&from, this);
-  const WorkingTimeInterval* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<WorkingTimeInterval>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:YellowPages.WorkingTimeInterval)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:YellowPages.WorkingTimeInterval)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void WorkingTimeInterval::MergeFrom(const WorkingTimeInterval& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.WorkingTimeInterval)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorkingTimeInterval::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WorkingTimeInterval::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorkingTimeInterval::GetClassData() const { return &_class_data_; }
+
+
+void WorkingTimeInterval::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WorkingTimeInterval*>(&to_msg);
+  auto& from = static_cast<const WorkingTimeInterval&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.WorkingTimeInterval)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.day() != 0) {
-    _internal_set_day(from._internal_day());
+  if (from._internal_day() != 0) {
+    _this->_internal_set_day(from._internal_day());
   }
-  if (from.minutes_from() != 0) {
-    _internal_set_minutes_from(from._internal_minutes_from());
+  if (from._internal_minutes_from() != 0) {
+    _this->_internal_set_minutes_from(from._internal_minutes_from());
   }
-  if (from.minutes_to() != 0) {
-    _internal_set_minutes_to(from._internal_minutes_to());
+  if (from._internal_minutes_to() != 0) {
+    _this->_internal_set_minutes_to(from._internal_minutes_to());
   }
-}
-
-void WorkingTimeInterval::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:YellowPages.WorkingTimeInterval)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void WorkingTimeInterval::CopyFrom(const WorkingTimeInterval& from) {
@@ -384,106 +368,117 @@ bool WorkingTimeInterval::IsInitialized() const {
 
 void WorkingTimeInterval::InternalSwap(WorkingTimeInterval* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(WorkingTimeInterval, minutes_to_)
-      + sizeof(WorkingTimeInterval::minutes_to_)
-      - PROTOBUF_FIELD_OFFSET(WorkingTimeInterval, day_)>(
-          reinterpret_cast<char*>(&day_),
-          reinterpret_cast<char*>(&other->day_));
+      PROTOBUF_FIELD_OFFSET(WorkingTimeInterval, _impl_.minutes_to_)
+      + sizeof(WorkingTimeInterval::_impl_.minutes_to_)
+      - PROTOBUF_FIELD_OFFSET(WorkingTimeInterval, _impl_.day_)>(
+          reinterpret_cast<char*>(&_impl_.day_),
+          reinterpret_cast<char*>(&other->_impl_.day_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata WorkingTimeInterval::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_working_5ftime_2eproto_getter, &descriptor_table_working_5ftime_2eproto_once,
+      file_level_metadata_working_5ftime_2eproto[0]);
 }
 
-
 // ===================================================================
 
 class WorkingTime::_Internal {
  public:
 };
 
-WorkingTime::WorkingTime(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  intervals_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+WorkingTime::WorkingTime(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:YellowPages.WorkingTime)
 }
 WorkingTime::WorkingTime(const WorkingTime& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      intervals_(from.intervals_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WorkingTime* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.intervals_){from._impl_.intervals_}
+    , decltype(_impl_.formatted_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  formatted_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.formatted_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.formatted_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_formatted().empty()) {
-    formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_formatted(), 
-      GetArena());
+    _this->_impl_.formatted_.Set(from._internal_formatted(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:YellowPages.WorkingTime)
 }
 
-void WorkingTime::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_WorkingTime_working_5ftime_2eproto.base);
-  formatted_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void WorkingTime::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.intervals_){arena}
+    , decltype(_impl_.formatted_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.formatted_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.formatted_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 WorkingTime::~WorkingTime() {
   // @@protoc_insertion_point(destructor:YellowPages.WorkingTime)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void WorkingTime::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  formatted_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void WorkingTime::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.intervals_.~RepeatedPtrField();
+  _impl_.formatted_.Destroy();
 }
 
-void WorkingTime::ArenaDtor(void* object) {
-  WorkingTime* _this = reinterpret_cast< WorkingTime* >(object);
-  (void)_this;
-}
-void WorkingTime::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void WorkingTime::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const WorkingTime& WorkingTime::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_WorkingTime_working_5ftime_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void WorkingTime::Clear() {
 // @@protoc_insertion_point(message_clear_start:YellowPages.WorkingTime)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  intervals_.Clear();
-  formatted_.ClearToEmpty();
+  _impl_.intervals_.Clear();
+  _impl_.formatted_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* WorkingTime::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* WorkingTime::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string formatted = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_formatted();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "YellowPages.WorkingTime.formatted"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "YellowPages.WorkingTime.formatted"));
+        } else
+          goto handle_unusual;
         continue;
       // repeated .YellowPages.WorkingTimeInterval intervals = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -491,38 +486,40 @@ const char* WorkingTime::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* WorkingTime::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* WorkingTime::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:YellowPages.WorkingTime)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string formatted = 1;
-  if (this->formatted().size() > 0) {
+  if (!this->_internal_formatted().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_formatted().data(), static_cast<int>(this->_internal_formatted().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -532,15 +529,15 @@ failure:
   }
 
   // repeated .YellowPages.WorkingTimeInterval intervals = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_intervals_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_intervals_size()); i < n; i++) {
+    const auto& repfield = this->_internal_intervals(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_intervals(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:YellowPages.WorkingTime)
@@ -551,66 +548,47 @@ size_t WorkingTime::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:YellowPages.WorkingTime)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .YellowPages.WorkingTimeInterval intervals = 2;
   total_size += 1UL * this->_internal_intervals_size();
-  for (const auto& msg : this->intervals_) {
+  for (const auto& msg : this->_impl_.intervals_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string formatted = 1;
-  if (this->formatted().size() > 0) {
+  if (!this->_internal_formatted().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_formatted());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void WorkingTime::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:YellowPages.WorkingTime)
-  GOOGLE_DCHECK_NE(&from, this);
-  const WorkingTime* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<WorkingTime>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:YellowPages.WorkingTime)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:YellowPages.WorkingTime)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void WorkingTime::MergeFrom(const WorkingTime& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.WorkingTime)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WorkingTime::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WorkingTime::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WorkingTime::GetClassData() const { return &_class_data_; }
+
+
+void WorkingTime::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WorkingTime*>(&to_msg);
+  auto& from = static_cast<const WorkingTime&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:YellowPages.WorkingTime)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  intervals_.MergeFrom(from.intervals_);
-  if (from.formatted().size() > 0) {
-    _internal_set_formatted(from._internal_formatted());
+  _this->_impl_.intervals_.MergeFrom(from._impl_.intervals_);
+  if (!from._internal_formatted().empty()) {
+    _this->_internal_set_formatted(from._internal_formatted());
   }
-}
-
-void WorkingTime::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:YellowPages.WorkingTime)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void WorkingTime::CopyFrom(const WorkingTime& from) {
@@ -626,23 +604,31 @@ bool WorkingTime::IsInitialized() const {
 
 void WorkingTime::InternalSwap(WorkingTime* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  intervals_.InternalSwap(&other->intervals_);
-  formatted_.Swap(&other->formatted_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.intervals_.InternalSwap(&other->_impl_.intervals_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.formatted_, lhs_arena,
+      &other->_impl_.formatted_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata WorkingTime::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_working_5ftime_2eproto_getter, &descriptor_table_working_5ftime_2eproto_once,
+      file_level_metadata_working_5ftime_2eproto[1]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::YellowPages::WorkingTimeInterval* Arena::CreateMaybeMessage< ::YellowPages::WorkingTimeInterval >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::YellowPages::WorkingTimeInterval*
+Arena::CreateMaybeMessage< ::YellowPages::WorkingTimeInterval >(Arena* arena) {
   return Arena::CreateMessageInternal< ::YellowPages::WorkingTimeInterval >(arena);
 }
-template<> PROTOBUF_NOINLINE ::YellowPages::WorkingTime* Arena::CreateMaybeMessage< ::YellowPages::WorkingTime >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::YellowPages::WorkingTime*
+Arena::CreateMaybeMessage< ::YellowPages::WorkingTime >(Arena* arena) {
   return Arena::CreateMessageInternal< ::YellowPages::WorkingTime >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
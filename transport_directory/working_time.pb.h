@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3014000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3014000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,7 +23,6 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
@@ -43,23 +42,15 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_working_5ftime_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_working_5ftime_2eproto;
 namespace YellowPages {
 class WorkingTime;
-class WorkingTimeDefaultTypeInternal;
+struct WorkingTimeDefaultTypeInternal;
 extern WorkingTimeDefaultTypeInternal _WorkingTime_default_instance_;
 class WorkingTimeInterval;
-class WorkingTimeIntervalDefaultTypeInternal;
+struct WorkingTimeIntervalDefaultTypeInternal;
 extern WorkingTimeIntervalDefaultTypeInternal _WorkingTimeInterval_default_instance_;
 }  // namespace YellowPages
 PROTOBUF_NAMESPACE_OPEN
@@ -77,8 +68,8 @@ enum WorkingTimeInterval_Day : int {
   WorkingTimeInterval_Day_FRIDAY = 5,
   WorkingTimeInterval_Day_SATURDAY = 6,
   WorkingTimeInterval_Day_SUNDAY = 7,
-  WorkingTimeInterval_Day_WorkingTimeInterval_Day_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  WorkingTimeInterval_Day_WorkingTimeInterval_Day_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
+  WorkingTimeInterval_Day_WorkingTimeInterval_Day_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  WorkingTimeInterval_Day_WorkingTimeInterval_Day_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool WorkingTimeInterval_Day_IsValid(int value);
 constexpr WorkingTimeInterval_Day WorkingTimeInterval_Day_Day_MIN = WorkingTimeInterval_Day_EVERYDAY;
@@ -101,11 +92,12 @@ inline bool WorkingTimeInterval_Day_Parse(
 }
 // ===================================================================
 
-class WorkingTimeInterval PROTOBUF_FINAL :
+class WorkingTimeInterval final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.WorkingTimeInterval) */ {
  public:
   inline WorkingTimeInterval() : WorkingTimeInterval(nullptr) {}
-  virtual ~WorkingTimeInterval();
+  ~WorkingTimeInterval() override;
+  explicit PROTOBUF_CONSTEXPR WorkingTimeInterval(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WorkingTimeInterval(const WorkingTimeInterval& from);
   WorkingTimeInterval(WorkingTimeInterval&& from) noexcept
@@ -118,8 +110,13 @@ class WorkingTimeInterval PROTOBUF_FINAL :
     return *this;
   }
   inline WorkingTimeInterval& operator=(WorkingTimeInterval&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -130,13 +127,14 @@ class WorkingTimeInterval PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorkingTimeInterval& default_instance() {
+    return *internal_default_instance();
   }
-  static const WorkingTimeInterval& default_instance();
-
   static inline const WorkingTimeInterval* internal_default_instance() {
     return reinterpret_cast<const WorkingTimeInterval*>(
                &_WorkingTimeInterval_default_instance_);
@@ -149,7 +147,12 @@ class WorkingTimeInterval PROTOBUF_FINAL :
   }
   inline void Swap(WorkingTimeInterval* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -157,56 +160,53 @@ class WorkingTimeInterval PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(WorkingTimeInterval* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline WorkingTimeInterval* New() const final {
-    return CreateMaybeMessage<WorkingTimeInterval>(nullptr);
-  }
-
-  WorkingTimeInterval* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  WorkingTimeInterval* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<WorkingTimeInterval>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const WorkingTimeInterval& from);
-  void MergeFrom(const WorkingTimeInterval& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorkingTimeInterval& from) {
+    WorkingTimeInterval::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(WorkingTimeInterval* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.WorkingTimeInterval";
   }
   protected:
-  explicit WorkingTimeInterval(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit WorkingTimeInterval(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_working_5ftime_2eproto);
-    return ::descriptor_table_working_5ftime_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -270,20 +270,20 @@ class WorkingTimeInterval PROTOBUF_FINAL :
 
   // int32 minutes_from = 2;
   void clear_minutes_from();
-  ::PROTOBUF_NAMESPACE_ID::int32 minutes_from() const;
-  void set_minutes_from(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t minutes_from() const;
+  void set_minutes_from(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_minutes_from() const;
-  void _internal_set_minutes_from(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_minutes_from() const;
+  void _internal_set_minutes_from(int32_t value);
   public:
 
   // int32 minutes_to = 3;
   void clear_minutes_to();
-  ::PROTOBUF_NAMESPACE_ID::int32 minutes_to() const;
-  void set_minutes_to(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t minutes_to() const;
+  void set_minutes_to(int32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_minutes_to() const;
-  void _internal_set_minutes_to(::PROTOBUF_NAMESPACE_ID::int32 value);
+  int32_t _internal_minutes_to() const;
+  void _internal_set_minutes_to(int32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:YellowPages.WorkingTimeInterval)
@@ -293,19 +293,23 @@ class WorkingTimeInterval PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  int day_;
-  ::PROTOBUF_NAMESPACE_ID::int32 minutes_from_;
-  ::PROTOBUF_NAMESPACE_ID::int32 minutes_to_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    int day_;
+    int32_t minutes_from_;
+    int32_t minutes_to_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_working_5ftime_2eproto;
 };
 // -------------------------------------------------------------------
 
-class WorkingTime PROTOBUF_FINAL :
+class WorkingTime final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:YellowPages.WorkingTime) */ {
  public:
   inline WorkingTime() : WorkingTime(nullptr) {}
-  virtual ~WorkingTime();
+  ~WorkingTime() override;
+  explicit PROTOBUF_CONSTEXPR WorkingTime(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   WorkingTime(const WorkingTime& from);
   WorkingTime(WorkingTime&& from) noexcept
@@ -318,8 +322,13 @@ class WorkingTime PROTOBUF_FINAL :
     return *this;
   }
   inline WorkingTime& operator=(WorkingTime&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -330,13 +339,14 @@ class WorkingTime PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WorkingTime& default_instance() {
+    return *internal_default_instance();
   }
-  static const WorkingTime& default_instance();
-
   static inline const WorkingTime* internal_default_instance() {
     return reinterpret_cast<const WorkingTime*>(
                &_WorkingTime_default_instance_);
@@ -349,7 +359,12 @@ class WorkingTime PROTOBUF_FINAL :
   }
   inline void Swap(WorkingTime* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -357,56 +372,53 @@ class WorkingTime PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(WorkingTime* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline WorkingTime* New() const final {
-    return CreateMaybeMessage<WorkingTime>(nullptr);
-  }
-
-  WorkingTime* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  WorkingTime* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<WorkingTime>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const WorkingTime& from);
-  void MergeFrom(const WorkingTime& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WorkingTime& from) {
+    WorkingTime::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(WorkingTime* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "YellowPages.WorkingTime";
   }
   protected:
-  explicit WorkingTime(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit WorkingTime(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_working_5ftime_2eproto);
-    return ::descriptor_table_working_5ftime_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -437,16 +449,14 @@ class WorkingTime PROTOBUF_FINAL :
   // string formatted = 1;
   void clear_formatted();
   const std::string& formatted() const;
-  void set_formatted(const std::string& value);
-  void set_formatted(std::string&& value);
-  void set_formatted(const char* value);
-  void set_formatted(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_formatted(ArgT0&& arg0, ArgT... args);
   std::string* mutable_formatted();
-  std::string* release_formatted();
+  PROTOBUF_NODISCARD std::string* release_formatted();
   void set_allocated_formatted(std::string* formatted);
   private:
   const std::string& _internal_formatted() const;
-  void _internal_set_formatted(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_formatted(const std::string& value);
   std::string* _internal_mutable_formatted();
   public:
 
@@ -457,9 +467,12 @@ class WorkingTime PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::WorkingTimeInterval > intervals_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr formatted_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::WorkingTimeInterval > intervals_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr formatted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_working_5ftime_2eproto;
 };
 // ===================================================================
@@ -475,10 +488,10 @@ class WorkingTime PROTOBUF_FINAL :
 
 // .YellowPages.WorkingTimeInterval.Day day = 1;
 inline void WorkingTimeInterval::clear_day() {
-  day_ = 0;
+  _impl_.day_ = 0;
 }
 inline ::YellowPages::WorkingTimeInterval_Day WorkingTimeInterval::_internal_day() const {
-  return static_cast< ::YellowPages::WorkingTimeInterval_Day >(day_);
+  return static_cast< ::YellowPages::WorkingTimeInterval_Day >(_impl_.day_);
 }
 inline ::YellowPages::WorkingTimeInterval_Day WorkingTimeInterval::day() const {
   // @@protoc_insertion_point(field_get:YellowPages.WorkingTimeInterval.day)
@@ -486,7 +499,7 @@ inline ::YellowPages::WorkingTimeInterval_Day WorkingTimeInterval::day() const {
 }
 inline void WorkingTimeInterval::_internal_set_day(::YellowPages::WorkingTimeInterval_Day value) {
   
-  day_ = value;
+  _impl_.day_ = value;
 }
 inline void WorkingTimeInterval::set_day(::YellowPages::WorkingTimeInterval_Day value) {
   _internal_set_day(value);
@@ -495,40 +508,40 @@ inline void WorkingTimeInterval::set_day(::YellowPages::WorkingTimeInterval_Day
 
 // int32 minutes_from = 2;
 inline void WorkingTimeInterval::clear_minutes_from() {
-  minutes_from_ = 0;
+  _impl_.minutes_from_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 WorkingTimeInterval::_internal_minutes_from() const {
-  return minutes_from_;
+inline int32_t WorkingTimeInterval::_internal_minutes_from() const {
+  return _impl_.minutes_from_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 WorkingTimeInterval::minutes_from() const {
+inline int32_t WorkingTimeInterval::minutes_from() const {
   // @@protoc_insertion_point(field_get:YellowPages.WorkingTimeInterval.minutes_from)
   return _internal_minutes_from();
 }
-inline void WorkingTimeInterval::_internal_set_minutes_from(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void WorkingTimeInterval::_internal_set_minutes_from(int32_t value) {
   
-  minutes_from_ = value;
+  _impl_.minutes_from_ = value;
 }
-inline void WorkingTimeInterval::set_minutes_from(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void WorkingTimeInterval::set_minutes_from(int32_t value) {
   _internal_set_minutes_from(value);
   // @@protoc_insertion_point(field_set:YellowPages.WorkingTimeInterval.minutes_from)
 }
 
 // int32 minutes_to = 3;
 inline void WorkingTimeInterval::clear_minutes_to() {
-  minutes_to_ = 0;
+  _impl_.minutes_to_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 WorkingTimeInterval::_internal_minutes_to() const {
-  return minutes_to_;
+inline int32_t WorkingTimeInterval::_internal_minutes_to() const {
+  return _impl_.minutes_to_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 WorkingTimeInterval::minutes_to() const {
+inline int32_t WorkingTimeInterval::minutes_to() const {
   // @@protoc_insertion_point(field_get:YellowPages.WorkingTimeInterval.minutes_to)
   return _internal_minutes_to();
 }
-inline void WorkingTimeInterval::_internal_set_minutes_to(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void WorkingTimeInterval::_internal_set_minutes_to(int32_t value) {
   
-  minutes_to_ = value;
+  _impl_.minutes_to_ = value;
 }
-inline void WorkingTimeInterval::set_minutes_to(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void WorkingTimeInterval::set_minutes_to(int32_t value) {
   _internal_set_minutes_to(value);
   // @@protoc_insertion_point(field_set:YellowPages.WorkingTimeInterval.minutes_to)
 }
@@ -539,53 +552,38 @@ inline void WorkingTimeInterval::set_minutes_to(::PROTOBUF_NAMESPACE_ID::int32 v
 
 // string formatted = 1;
 inline void WorkingTime::clear_formatted() {
-  formatted_.ClearToEmpty();
+  _impl_.formatted_.ClearToEmpty();
 }
 inline const std::string& WorkingTime::formatted() const {
   // @@protoc_insertion_point(field_get:YellowPages.WorkingTime.formatted)
   return _internal_formatted();
 }
-inline void WorkingTime::set_formatted(const std::string& value) {
-  _internal_set_formatted(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WorkingTime::set_formatted(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.formatted_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:YellowPages.WorkingTime.formatted)
 }
 inline std::string* WorkingTime::mutable_formatted() {
+  std::string* _s = _internal_mutable_formatted();
   // @@protoc_insertion_point(field_mutable:YellowPages.WorkingTime.formatted)
-  return _internal_mutable_formatted();
+  return _s;
 }
 inline const std::string& WorkingTime::_internal_formatted() const {
-  return formatted_.Get();
+  return _impl_.formatted_.Get();
 }
 inline void WorkingTime::_internal_set_formatted(const std::string& value) {
   
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void WorkingTime::set_formatted(std::string&& value) {
-  
-  formatted_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:YellowPages.WorkingTime.formatted)
-}
-inline void WorkingTime::set_formatted(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:YellowPages.WorkingTime.formatted)
-}
-inline void WorkingTime::set_formatted(const char* value,
-    size_t size) {
-  
-  formatted_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:YellowPages.WorkingTime.formatted)
+  _impl_.formatted_.Set(value, GetArenaForAllocation());
 }
 inline std::string* WorkingTime::_internal_mutable_formatted() {
   
-  return formatted_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return _impl_.formatted_.Mutable(GetArenaForAllocation());
 }
 inline std::string* WorkingTime::release_formatted() {
   // @@protoc_insertion_point(field_release:YellowPages.WorkingTime.formatted)
-  return formatted_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.formatted_.Release();
 }
 inline void WorkingTime::set_allocated_formatted(std::string* formatted) {
   if (formatted != nullptr) {
@@ -593,48 +591,53 @@ inline void WorkingTime::set_allocated_formatted(std::string* formatted) {
   } else {
     
   }
-  formatted_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), formatted,
-      GetArena());
+  _impl_.formatted_.SetAllocated(formatted, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.formatted_.IsDefault()) {
+    _impl_.formatted_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:YellowPages.WorkingTime.formatted)
 }
 
 // repeated .YellowPages.WorkingTimeInterval intervals = 2;
 inline int WorkingTime::_internal_intervals_size() const {
-  return intervals_.size();
+  return _impl_.intervals_.size();
 }
 inline int WorkingTime::intervals_size() const {
   return _internal_intervals_size();
 }
 inline void WorkingTime::clear_intervals() {
-  intervals_.Clear();
+  _impl_.intervals_.Clear();
 }
 inline ::YellowPages::WorkingTimeInterval* WorkingTime::mutable_intervals(int index) {
   // @@protoc_insertion_point(field_mutable:YellowPages.WorkingTime.intervals)
-  return intervals_.Mutable(index);
+  return _impl_.intervals_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::WorkingTimeInterval >*
 WorkingTime::mutable_intervals() {
   // @@protoc_insertion_point(field_mutable_list:YellowPages.WorkingTime.intervals)
-  return &intervals_;
+  return &_impl_.intervals_;
 }
 inline const ::YellowPages::WorkingTimeInterval& WorkingTime::_internal_intervals(int index) const {
-  return intervals_.Get(index);
+  return _impl_.intervals_.Get(index);
 }
 inline const ::YellowPages::WorkingTimeInterval& WorkingTime::intervals(int index) const {
   // @@protoc_insertion_point(field_get:YellowPages.WorkingTime.intervals)
   return _internal_intervals(index);
 }
 inline ::YellowPages::WorkingTimeInterval* WorkingTime::_internal_add_intervals() {
-  return intervals_.Add();
+  return _impl_.intervals_.Add();
 }
 inline ::YellowPages::WorkingTimeInterval* WorkingTime::add_intervals() {
+  ::YellowPages::WorkingTimeInterval* _add = _internal_add_intervals();
   // @@protoc_insertion_point(field_add:YellowPages.WorkingTime.intervals)
-  return _internal_add_intervals();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::YellowPages::WorkingTimeInterval >&
 WorkingTime::intervals() const {
   // @@protoc_insertion_point(field_list:YellowPages.WorkingTime.intervals)
-  return intervals_;
+  return _impl_.intervals_;
 }
 
 #ifdef __GNUC__